@@ -0,0 +1,77 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/opennn/ant_colony_optimization.cpp" "opennn/CMakeFiles/opennn.dir/ant_colony_optimization.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/ant_colony_optimization.cpp.o.d"
+  "/root/repo/opennn/association_rules.cpp" "opennn/CMakeFiles/opennn.dir/association_rules.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/association_rules.cpp.o.d"
+  "/root/repo/opennn/bounding_layer.cpp" "opennn/CMakeFiles/opennn.dir/bounding_layer.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/bounding_layer.cpp.o.d"
+  "/root/repo/opennn/conjugate_gradient.cpp" "opennn/CMakeFiles/opennn.dir/conjugate_gradient.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/conjugate_gradient.cpp.o.d"
+  "/root/repo/opennn/correlation_analysis.cpp" "opennn/CMakeFiles/opennn.dir/correlation_analysis.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/correlation_analysis.cpp.o.d"
+  "/root/repo/opennn/cross_entropy_error.cpp" "opennn/CMakeFiles/opennn.dir/cross_entropy_error.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/cross_entropy_error.cpp.o.d"
+  "/root/repo/opennn/data_set.cpp" "opennn/CMakeFiles/opennn.dir/data_set.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/data_set.cpp.o.d"
+  "/root/repo/opennn/evolutionary_algorithm.cpp" "opennn/CMakeFiles/opennn.dir/evolutionary_algorithm.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/evolutionary_algorithm.cpp.o.d"
+  "/root/repo/opennn/f1_score_optimization_threshold.cpp" "opennn/CMakeFiles/opennn.dir/f1_score_optimization_threshold.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/f1_score_optimization_threshold.cpp.o.d"
+  "/root/repo/opennn/file_utilities.cpp" "opennn/CMakeFiles/opennn.dir/file_utilities.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/file_utilities.cpp.o.d"
+  "/root/repo/opennn/genetic_algorithm.cpp" "opennn/CMakeFiles/opennn.dir/genetic_algorithm.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/genetic_algorithm.cpp.o.d"
+  "/root/repo/opennn/golden_section_order.cpp" "opennn/CMakeFiles/opennn.dir/golden_section_order.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/golden_section_order.cpp.o.d"
+  "/root/repo/opennn/gradient_descent.cpp" "opennn/CMakeFiles/opennn.dir/gradient_descent.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/gradient_descent.cpp.o.d"
+  "/root/repo/opennn/growing_inputs.cpp" "opennn/CMakeFiles/opennn.dir/growing_inputs.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/growing_inputs.cpp.o.d"
+  "/root/repo/opennn/incremental_order.cpp" "opennn/CMakeFiles/opennn.dir/incremental_order.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/incremental_order.cpp.o.d"
+  "/root/repo/opennn/inputs.cpp" "opennn/CMakeFiles/opennn.dir/inputs.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/inputs.cpp.o.d"
+  "/root/repo/opennn/inputs_selection_algorithm.cpp" "opennn/CMakeFiles/opennn.dir/inputs_selection_algorithm.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/inputs_selection_algorithm.cpp.o.d"
+  "/root/repo/opennn/inputs_trending_layer.cpp" "opennn/CMakeFiles/opennn.dir/inputs_trending_layer.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/inputs_trending_layer.cpp.o.d"
+  "/root/repo/opennn/instances.cpp" "opennn/CMakeFiles/opennn.dir/instances.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/instances.cpp.o.d"
+  "/root/repo/opennn/kappa_coefficient_optimization_threshold.cpp" "opennn/CMakeFiles/opennn.dir/kappa_coefficient_optimization_threshold.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/kappa_coefficient_optimization_threshold.cpp.o.d"
+  "/root/repo/opennn/levenberg_marquardt_algorithm.cpp" "opennn/CMakeFiles/opennn.dir/levenberg_marquardt_algorithm.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/levenberg_marquardt_algorithm.cpp.o.d"
+  "/root/repo/opennn/loss_index.cpp" "opennn/CMakeFiles/opennn.dir/loss_index.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/loss_index.cpp.o.d"
+  "/root/repo/opennn/matthew_correlation_optimization_threshold.cpp" "opennn/CMakeFiles/opennn.dir/matthew_correlation_optimization_threshold.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/matthew_correlation_optimization_threshold.cpp.o.d"
+  "/root/repo/opennn/mean_squared_error.cpp" "opennn/CMakeFiles/opennn.dir/mean_squared_error.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/mean_squared_error.cpp.o.d"
+  "/root/repo/opennn/minkowski_error.cpp" "opennn/CMakeFiles/opennn.dir/minkowski_error.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/minkowski_error.cpp.o.d"
+  "/root/repo/opennn/missing_values.cpp" "opennn/CMakeFiles/opennn.dir/missing_values.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/missing_values.cpp.o.d"
+  "/root/repo/opennn/model_selection.cpp" "opennn/CMakeFiles/opennn.dir/model_selection.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/model_selection.cpp.o.d"
+  "/root/repo/opennn/multilayer_perceptron.cpp" "opennn/CMakeFiles/opennn.dir/multilayer_perceptron.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/multilayer_perceptron.cpp.o.d"
+  "/root/repo/opennn/neural_network.cpp" "opennn/CMakeFiles/opennn.dir/neural_network.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/neural_network.cpp.o.d"
+  "/root/repo/opennn/normalized_squared_error.cpp" "opennn/CMakeFiles/opennn.dir/normalized_squared_error.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/normalized_squared_error.cpp.o.d"
+  "/root/repo/opennn/numerical_differentiation.cpp" "opennn/CMakeFiles/opennn.dir/numerical_differentiation.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/numerical_differentiation.cpp.o.d"
+  "/root/repo/opennn/numerical_integration.cpp" "opennn/CMakeFiles/opennn.dir/numerical_integration.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/numerical_integration.cpp.o.d"
+  "/root/repo/opennn/order_selection_algorithm.cpp" "opennn/CMakeFiles/opennn.dir/order_selection_algorithm.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/order_selection_algorithm.cpp.o.d"
+  "/root/repo/opennn/outputs.cpp" "opennn/CMakeFiles/opennn.dir/outputs.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/outputs.cpp.o.d"
+  "/root/repo/opennn/outputs_trending_layer.cpp" "opennn/CMakeFiles/opennn.dir/outputs_trending_layer.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/outputs_trending_layer.cpp.o.d"
+  "/root/repo/opennn/perceptron_layer.cpp" "opennn/CMakeFiles/opennn.dir/perceptron_layer.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/perceptron_layer.cpp.o.d"
+  "/root/repo/opennn/principal_components_layer.cpp" "opennn/CMakeFiles/opennn.dir/principal_components_layer.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/principal_components_layer.cpp.o.d"
+  "/root/repo/opennn/probabilistic_layer.cpp" "opennn/CMakeFiles/opennn.dir/probabilistic_layer.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/probabilistic_layer.cpp.o.d"
+  "/root/repo/opennn/pruning_inputs.cpp" "opennn/CMakeFiles/opennn.dir/pruning_inputs.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/pruning_inputs.cpp.o.d"
+  "/root/repo/opennn/quasi_newton_method.cpp" "opennn/CMakeFiles/opennn.dir/quasi_newton_method.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/quasi_newton_method.cpp.o.d"
+  "/root/repo/opennn/random_search.cpp" "opennn/CMakeFiles/opennn.dir/random_search.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/random_search.cpp.o.d"
+  "/root/repo/opennn/roc_curve_optimization_threshold.cpp" "opennn/CMakeFiles/opennn.dir/roc_curve_optimization_threshold.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/roc_curve_optimization_threshold.cpp.o.d"
+  "/root/repo/opennn/root_mean_squared_error.cpp" "opennn/CMakeFiles/opennn.dir/root_mean_squared_error.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/root_mean_squared_error.cpp.o.d"
+  "/root/repo/opennn/scaling_layer.cpp" "opennn/CMakeFiles/opennn.dir/scaling_layer.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/scaling_layer.cpp.o.d"
+  "/root/repo/opennn/selective_pruning.cpp" "opennn/CMakeFiles/opennn.dir/selective_pruning.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/selective_pruning.cpp.o.d"
+  "/root/repo/opennn/simulated_annealing_order.cpp" "opennn/CMakeFiles/opennn.dir/simulated_annealing_order.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/simulated_annealing_order.cpp.o.d"
+  "/root/repo/opennn/stochastic_gradient_descent.cpp" "opennn/CMakeFiles/opennn.dir/stochastic_gradient_descent.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/stochastic_gradient_descent.cpp.o.d"
+  "/root/repo/opennn/sum_squared_error.cpp" "opennn/CMakeFiles/opennn.dir/sum_squared_error.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/sum_squared_error.cpp.o.d"
+  "/root/repo/opennn/testing_analysis.cpp" "opennn/CMakeFiles/opennn.dir/testing_analysis.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/testing_analysis.cpp.o.d"
+  "/root/repo/opennn/text_analytics.cpp" "opennn/CMakeFiles/opennn.dir/text_analytics.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/text_analytics.cpp.o.d"
+  "/root/repo/opennn/threshold_selection_algorithm.cpp" "opennn/CMakeFiles/opennn.dir/threshold_selection_algorithm.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/threshold_selection_algorithm.cpp.o.d"
+  "/root/repo/opennn/tinyxml2.cpp" "opennn/CMakeFiles/opennn.dir/tinyxml2.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/tinyxml2.cpp.o.d"
+  "/root/repo/opennn/training_algorithm.cpp" "opennn/CMakeFiles/opennn.dir/training_algorithm.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/training_algorithm.cpp.o.d"
+  "/root/repo/opennn/training_rate_algorithm.cpp" "opennn/CMakeFiles/opennn.dir/training_rate_algorithm.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/training_rate_algorithm.cpp.o.d"
+  "/root/repo/opennn/training_strategy.cpp" "opennn/CMakeFiles/opennn.dir/training_strategy.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/training_strategy.cpp.o.d"
+  "/root/repo/opennn/unscaling_layer.cpp" "opennn/CMakeFiles/opennn.dir/unscaling_layer.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/unscaling_layer.cpp.o.d"
+  "/root/repo/opennn/variables.cpp" "opennn/CMakeFiles/opennn.dir/variables.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/variables.cpp.o.d"
+  "/root/repo/opennn/weighted_squared_error.cpp" "opennn/CMakeFiles/opennn.dir/weighted_squared_error.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/weighted_squared_error.cpp.o.d"
+  "/root/repo/opennn/youden_index_optimization_threshold.cpp" "opennn/CMakeFiles/opennn.dir/youden_index_optimization_threshold.cpp.o" "gcc" "opennn/CMakeFiles/opennn.dir/youden_index_optimization_threshold.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
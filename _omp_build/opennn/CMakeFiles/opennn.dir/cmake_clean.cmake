@@ -0,0 +1,127 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/opennn.dir/ant_colony_optimization.cpp.o"
+  "CMakeFiles/opennn.dir/ant_colony_optimization.cpp.o.d"
+  "CMakeFiles/opennn.dir/association_rules.cpp.o"
+  "CMakeFiles/opennn.dir/association_rules.cpp.o.d"
+  "CMakeFiles/opennn.dir/bounding_layer.cpp.o"
+  "CMakeFiles/opennn.dir/bounding_layer.cpp.o.d"
+  "CMakeFiles/opennn.dir/conjugate_gradient.cpp.o"
+  "CMakeFiles/opennn.dir/conjugate_gradient.cpp.o.d"
+  "CMakeFiles/opennn.dir/correlation_analysis.cpp.o"
+  "CMakeFiles/opennn.dir/correlation_analysis.cpp.o.d"
+  "CMakeFiles/opennn.dir/cross_entropy_error.cpp.o"
+  "CMakeFiles/opennn.dir/cross_entropy_error.cpp.o.d"
+  "CMakeFiles/opennn.dir/data_set.cpp.o"
+  "CMakeFiles/opennn.dir/data_set.cpp.o.d"
+  "CMakeFiles/opennn.dir/evolutionary_algorithm.cpp.o"
+  "CMakeFiles/opennn.dir/evolutionary_algorithm.cpp.o.d"
+  "CMakeFiles/opennn.dir/f1_score_optimization_threshold.cpp.o"
+  "CMakeFiles/opennn.dir/f1_score_optimization_threshold.cpp.o.d"
+  "CMakeFiles/opennn.dir/file_utilities.cpp.o"
+  "CMakeFiles/opennn.dir/file_utilities.cpp.o.d"
+  "CMakeFiles/opennn.dir/genetic_algorithm.cpp.o"
+  "CMakeFiles/opennn.dir/genetic_algorithm.cpp.o.d"
+  "CMakeFiles/opennn.dir/golden_section_order.cpp.o"
+  "CMakeFiles/opennn.dir/golden_section_order.cpp.o.d"
+  "CMakeFiles/opennn.dir/gradient_descent.cpp.o"
+  "CMakeFiles/opennn.dir/gradient_descent.cpp.o.d"
+  "CMakeFiles/opennn.dir/growing_inputs.cpp.o"
+  "CMakeFiles/opennn.dir/growing_inputs.cpp.o.d"
+  "CMakeFiles/opennn.dir/incremental_order.cpp.o"
+  "CMakeFiles/opennn.dir/incremental_order.cpp.o.d"
+  "CMakeFiles/opennn.dir/inputs.cpp.o"
+  "CMakeFiles/opennn.dir/inputs.cpp.o.d"
+  "CMakeFiles/opennn.dir/inputs_selection_algorithm.cpp.o"
+  "CMakeFiles/opennn.dir/inputs_selection_algorithm.cpp.o.d"
+  "CMakeFiles/opennn.dir/inputs_trending_layer.cpp.o"
+  "CMakeFiles/opennn.dir/inputs_trending_layer.cpp.o.d"
+  "CMakeFiles/opennn.dir/instances.cpp.o"
+  "CMakeFiles/opennn.dir/instances.cpp.o.d"
+  "CMakeFiles/opennn.dir/kappa_coefficient_optimization_threshold.cpp.o"
+  "CMakeFiles/opennn.dir/kappa_coefficient_optimization_threshold.cpp.o.d"
+  "CMakeFiles/opennn.dir/levenberg_marquardt_algorithm.cpp.o"
+  "CMakeFiles/opennn.dir/levenberg_marquardt_algorithm.cpp.o.d"
+  "CMakeFiles/opennn.dir/loss_index.cpp.o"
+  "CMakeFiles/opennn.dir/loss_index.cpp.o.d"
+  "CMakeFiles/opennn.dir/matthew_correlation_optimization_threshold.cpp.o"
+  "CMakeFiles/opennn.dir/matthew_correlation_optimization_threshold.cpp.o.d"
+  "CMakeFiles/opennn.dir/mean_squared_error.cpp.o"
+  "CMakeFiles/opennn.dir/mean_squared_error.cpp.o.d"
+  "CMakeFiles/opennn.dir/minkowski_error.cpp.o"
+  "CMakeFiles/opennn.dir/minkowski_error.cpp.o.d"
+  "CMakeFiles/opennn.dir/missing_values.cpp.o"
+  "CMakeFiles/opennn.dir/missing_values.cpp.o.d"
+  "CMakeFiles/opennn.dir/model_selection.cpp.o"
+  "CMakeFiles/opennn.dir/model_selection.cpp.o.d"
+  "CMakeFiles/opennn.dir/multilayer_perceptron.cpp.o"
+  "CMakeFiles/opennn.dir/multilayer_perceptron.cpp.o.d"
+  "CMakeFiles/opennn.dir/neural_network.cpp.o"
+  "CMakeFiles/opennn.dir/neural_network.cpp.o.d"
+  "CMakeFiles/opennn.dir/normalized_squared_error.cpp.o"
+  "CMakeFiles/opennn.dir/normalized_squared_error.cpp.o.d"
+  "CMakeFiles/opennn.dir/numerical_differentiation.cpp.o"
+  "CMakeFiles/opennn.dir/numerical_differentiation.cpp.o.d"
+  "CMakeFiles/opennn.dir/numerical_integration.cpp.o"
+  "CMakeFiles/opennn.dir/numerical_integration.cpp.o.d"
+  "CMakeFiles/opennn.dir/order_selection_algorithm.cpp.o"
+  "CMakeFiles/opennn.dir/order_selection_algorithm.cpp.o.d"
+  "CMakeFiles/opennn.dir/outputs.cpp.o"
+  "CMakeFiles/opennn.dir/outputs.cpp.o.d"
+  "CMakeFiles/opennn.dir/outputs_trending_layer.cpp.o"
+  "CMakeFiles/opennn.dir/outputs_trending_layer.cpp.o.d"
+  "CMakeFiles/opennn.dir/perceptron_layer.cpp.o"
+  "CMakeFiles/opennn.dir/perceptron_layer.cpp.o.d"
+  "CMakeFiles/opennn.dir/principal_components_layer.cpp.o"
+  "CMakeFiles/opennn.dir/principal_components_layer.cpp.o.d"
+  "CMakeFiles/opennn.dir/probabilistic_layer.cpp.o"
+  "CMakeFiles/opennn.dir/probabilistic_layer.cpp.o.d"
+  "CMakeFiles/opennn.dir/pruning_inputs.cpp.o"
+  "CMakeFiles/opennn.dir/pruning_inputs.cpp.o.d"
+  "CMakeFiles/opennn.dir/quasi_newton_method.cpp.o"
+  "CMakeFiles/opennn.dir/quasi_newton_method.cpp.o.d"
+  "CMakeFiles/opennn.dir/random_search.cpp.o"
+  "CMakeFiles/opennn.dir/random_search.cpp.o.d"
+  "CMakeFiles/opennn.dir/roc_curve_optimization_threshold.cpp.o"
+  "CMakeFiles/opennn.dir/roc_curve_optimization_threshold.cpp.o.d"
+  "CMakeFiles/opennn.dir/root_mean_squared_error.cpp.o"
+  "CMakeFiles/opennn.dir/root_mean_squared_error.cpp.o.d"
+  "CMakeFiles/opennn.dir/scaling_layer.cpp.o"
+  "CMakeFiles/opennn.dir/scaling_layer.cpp.o.d"
+  "CMakeFiles/opennn.dir/selective_pruning.cpp.o"
+  "CMakeFiles/opennn.dir/selective_pruning.cpp.o.d"
+  "CMakeFiles/opennn.dir/simulated_annealing_order.cpp.o"
+  "CMakeFiles/opennn.dir/simulated_annealing_order.cpp.o.d"
+  "CMakeFiles/opennn.dir/stochastic_gradient_descent.cpp.o"
+  "CMakeFiles/opennn.dir/stochastic_gradient_descent.cpp.o.d"
+  "CMakeFiles/opennn.dir/sum_squared_error.cpp.o"
+  "CMakeFiles/opennn.dir/sum_squared_error.cpp.o.d"
+  "CMakeFiles/opennn.dir/testing_analysis.cpp.o"
+  "CMakeFiles/opennn.dir/testing_analysis.cpp.o.d"
+  "CMakeFiles/opennn.dir/text_analytics.cpp.o"
+  "CMakeFiles/opennn.dir/text_analytics.cpp.o.d"
+  "CMakeFiles/opennn.dir/threshold_selection_algorithm.cpp.o"
+  "CMakeFiles/opennn.dir/threshold_selection_algorithm.cpp.o.d"
+  "CMakeFiles/opennn.dir/tinyxml2.cpp.o"
+  "CMakeFiles/opennn.dir/tinyxml2.cpp.o.d"
+  "CMakeFiles/opennn.dir/training_algorithm.cpp.o"
+  "CMakeFiles/opennn.dir/training_algorithm.cpp.o.d"
+  "CMakeFiles/opennn.dir/training_rate_algorithm.cpp.o"
+  "CMakeFiles/opennn.dir/training_rate_algorithm.cpp.o.d"
+  "CMakeFiles/opennn.dir/training_strategy.cpp.o"
+  "CMakeFiles/opennn.dir/training_strategy.cpp.o.d"
+  "CMakeFiles/opennn.dir/unscaling_layer.cpp.o"
+  "CMakeFiles/opennn.dir/unscaling_layer.cpp.o.d"
+  "CMakeFiles/opennn.dir/variables.cpp.o"
+  "CMakeFiles/opennn.dir/variables.cpp.o.d"
+  "CMakeFiles/opennn.dir/weighted_squared_error.cpp.o"
+  "CMakeFiles/opennn.dir/weighted_squared_error.cpp.o.d"
+  "CMakeFiles/opennn.dir/youden_index_optimization_threshold.cpp.o"
+  "CMakeFiles/opennn.dir/youden_index_optimization_threshold.cpp.o.d"
+  "libopennn.a"
+  "libopennn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opennn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,71 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/bounding_layer_test.cpp" "tests/CMakeFiles/tests.dir/bounding_layer_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/bounding_layer_test.cpp.o.d"
+  "/root/repo/tests/conjugate_gradient_test.cpp" "tests/CMakeFiles/tests.dir/conjugate_gradient_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/conjugate_gradient_test.cpp.o.d"
+  "/root/repo/tests/correlation_analysis_test.cpp" "tests/CMakeFiles/tests.dir/correlation_analysis_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/correlation_analysis_test.cpp.o.d"
+  "/root/repo/tests/cross_entropy_error_test.cpp" "tests/CMakeFiles/tests.dir/cross_entropy_error_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/cross_entropy_error_test.cpp.o.d"
+  "/root/repo/tests/data_set_test.cpp" "tests/CMakeFiles/tests.dir/data_set_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/data_set_test.cpp.o.d"
+  "/root/repo/tests/evolutionary_algorithm_test.cpp" "tests/CMakeFiles/tests.dir/evolutionary_algorithm_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/evolutionary_algorithm_test.cpp.o.d"
+  "/root/repo/tests/genetic_algorithm_test.cpp" "tests/CMakeFiles/tests.dir/genetic_algorithm_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/genetic_algorithm_test.cpp.o.d"
+  "/root/repo/tests/golden_section_order_test.cpp" "tests/CMakeFiles/tests.dir/golden_section_order_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/golden_section_order_test.cpp.o.d"
+  "/root/repo/tests/gradient_descent_test.cpp" "tests/CMakeFiles/tests.dir/gradient_descent_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/gradient_descent_test.cpp.o.d"
+  "/root/repo/tests/growing_inputs_test.cpp" "tests/CMakeFiles/tests.dir/growing_inputs_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/growing_inputs_test.cpp.o.d"
+  "/root/repo/tests/incremental_order_test.cpp" "tests/CMakeFiles/tests.dir/incremental_order_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/incremental_order_test.cpp.o.d"
+  "/root/repo/tests/inputs_selection_algorithm_test.cpp" "tests/CMakeFiles/tests.dir/inputs_selection_algorithm_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/inputs_selection_algorithm_test.cpp.o.d"
+  "/root/repo/tests/inputs_test.cpp" "tests/CMakeFiles/tests.dir/inputs_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/inputs_test.cpp.o.d"
+  "/root/repo/tests/inputs_trending_layer_test.cpp" "tests/CMakeFiles/tests.dir/inputs_trending_layer_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/inputs_trending_layer_test.cpp.o.d"
+  "/root/repo/tests/instances_test.cpp" "tests/CMakeFiles/tests.dir/instances_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/instances_test.cpp.o.d"
+  "/root/repo/tests/levenberg_marquardt_algorithm_test.cpp" "tests/CMakeFiles/tests.dir/levenberg_marquardt_algorithm_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/levenberg_marquardt_algorithm_test.cpp.o.d"
+  "/root/repo/tests/loss_index_test.cpp" "tests/CMakeFiles/tests.dir/loss_index_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/loss_index_test.cpp.o.d"
+  "/root/repo/tests/main.cpp" "tests/CMakeFiles/tests.dir/main.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/main.cpp.o.d"
+  "/root/repo/tests/matrix_test.cpp" "tests/CMakeFiles/tests.dir/matrix_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/matrix_test.cpp.o.d"
+  "/root/repo/tests/mean_squared_error_test.cpp" "tests/CMakeFiles/tests.dir/mean_squared_error_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/mean_squared_error_test.cpp.o.d"
+  "/root/repo/tests/minkowski_error_test.cpp" "tests/CMakeFiles/tests.dir/minkowski_error_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/minkowski_error_test.cpp.o.d"
+  "/root/repo/tests/missing_values_test.cpp" "tests/CMakeFiles/tests.dir/missing_values_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/missing_values_test.cpp.o.d"
+  "/root/repo/tests/mock_training_algorithm.cpp" "tests/CMakeFiles/tests.dir/mock_training_algorithm.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/mock_training_algorithm.cpp.o.d"
+  "/root/repo/tests/model_selection_test.cpp" "tests/CMakeFiles/tests.dir/model_selection_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/model_selection_test.cpp.o.d"
+  "/root/repo/tests/multilayer_perceptron_test.cpp" "tests/CMakeFiles/tests.dir/multilayer_perceptron_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/multilayer_perceptron_test.cpp.o.d"
+  "/root/repo/tests/neural_network_test.cpp" "tests/CMakeFiles/tests.dir/neural_network_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/neural_network_test.cpp.o.d"
+  "/root/repo/tests/normalized_squared_error_test.cpp" "tests/CMakeFiles/tests.dir/normalized_squared_error_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/normalized_squared_error_test.cpp.o.d"
+  "/root/repo/tests/numerical_differentiation_test.cpp" "tests/CMakeFiles/tests.dir/numerical_differentiation_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/numerical_differentiation_test.cpp.o.d"
+  "/root/repo/tests/order_selection_algorithm_test.cpp" "tests/CMakeFiles/tests.dir/order_selection_algorithm_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/order_selection_algorithm_test.cpp.o.d"
+  "/root/repo/tests/outputs_test.cpp" "tests/CMakeFiles/tests.dir/outputs_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/outputs_test.cpp.o.d"
+  "/root/repo/tests/outputs_trending_layer_test.cpp" "tests/CMakeFiles/tests.dir/outputs_trending_layer_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/outputs_trending_layer_test.cpp.o.d"
+  "/root/repo/tests/perceptron_layer_test.cpp" "tests/CMakeFiles/tests.dir/perceptron_layer_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/perceptron_layer_test.cpp.o.d"
+  "/root/repo/tests/polynomial.cpp" "tests/CMakeFiles/tests.dir/polynomial.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/polynomial.cpp.o.d"
+  "/root/repo/tests/probabilistic_layer_test.cpp" "tests/CMakeFiles/tests.dir/probabilistic_layer_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/probabilistic_layer_test.cpp.o.d"
+  "/root/repo/tests/pruning_inputs_test.cpp" "tests/CMakeFiles/tests.dir/pruning_inputs_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/pruning_inputs_test.cpp.o.d"
+  "/root/repo/tests/quasi_newton_method_test.cpp" "tests/CMakeFiles/tests.dir/quasi_newton_method_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/quasi_newton_method_test.cpp.o.d"
+  "/root/repo/tests/random_search_test.cpp" "tests/CMakeFiles/tests.dir/random_search_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/random_search_test.cpp.o.d"
+  "/root/repo/tests/root_mean_squared_error_test.cpp" "tests/CMakeFiles/tests.dir/root_mean_squared_error_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/root_mean_squared_error_test.cpp.o.d"
+  "/root/repo/tests/scaling_layer_test.cpp" "tests/CMakeFiles/tests.dir/scaling_layer_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/scaling_layer_test.cpp.o.d"
+  "/root/repo/tests/simulated_annealing_order_test.cpp" "tests/CMakeFiles/tests.dir/simulated_annealing_order_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/simulated_annealing_order_test.cpp.o.d"
+  "/root/repo/tests/sparse_matrix_test.cpp" "tests/CMakeFiles/tests.dir/sparse_matrix_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/sparse_matrix_test.cpp.o.d"
+  "/root/repo/tests/stochastic_gradient_descent_test.cpp" "tests/CMakeFiles/tests.dir/stochastic_gradient_descent_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/stochastic_gradient_descent_test.cpp.o.d"
+  "/root/repo/tests/sum_squared_error_test.cpp" "tests/CMakeFiles/tests.dir/sum_squared_error_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/sum_squared_error_test.cpp.o.d"
+  "/root/repo/tests/testing_analysis_test.cpp" "tests/CMakeFiles/tests.dir/testing_analysis_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/testing_analysis_test.cpp.o.d"
+  "/root/repo/tests/training_algorithm_test.cpp" "tests/CMakeFiles/tests.dir/training_algorithm_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/training_algorithm_test.cpp.o.d"
+  "/root/repo/tests/training_rate_algorithm_test.cpp" "tests/CMakeFiles/tests.dir/training_rate_algorithm_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/training_rate_algorithm_test.cpp.o.d"
+  "/root/repo/tests/training_strategy_test.cpp" "tests/CMakeFiles/tests.dir/training_strategy_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/training_strategy_test.cpp.o.d"
+  "/root/repo/tests/unit_testing.cpp" "tests/CMakeFiles/tests.dir/unit_testing.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/unit_testing.cpp.o.d"
+  "/root/repo/tests/unscaling_layer_test.cpp" "tests/CMakeFiles/tests.dir/unscaling_layer_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/unscaling_layer_test.cpp.o.d"
+  "/root/repo/tests/variables_test.cpp" "tests/CMakeFiles/tests.dir/variables_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/variables_test.cpp.o.d"
+  "/root/repo/tests/vector_test.cpp" "tests/CMakeFiles/tests.dir/vector_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/vector_test.cpp.o.d"
+  "/root/repo/tests/weighted_squared_error_test.cpp" "tests/CMakeFiles/tests.dir/weighted_squared_error_test.cpp.o" "gcc" "tests/CMakeFiles/tests.dir/weighted_squared_error_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/opennn/CMakeFiles/opennn.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,113 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests.dir/bounding_layer_test.cpp.o"
+  "CMakeFiles/tests.dir/bounding_layer_test.cpp.o.d"
+  "CMakeFiles/tests.dir/conjugate_gradient_test.cpp.o"
+  "CMakeFiles/tests.dir/conjugate_gradient_test.cpp.o.d"
+  "CMakeFiles/tests.dir/correlation_analysis_test.cpp.o"
+  "CMakeFiles/tests.dir/correlation_analysis_test.cpp.o.d"
+  "CMakeFiles/tests.dir/cross_entropy_error_test.cpp.o"
+  "CMakeFiles/tests.dir/cross_entropy_error_test.cpp.o.d"
+  "CMakeFiles/tests.dir/data_set_test.cpp.o"
+  "CMakeFiles/tests.dir/data_set_test.cpp.o.d"
+  "CMakeFiles/tests.dir/evolutionary_algorithm_test.cpp.o"
+  "CMakeFiles/tests.dir/evolutionary_algorithm_test.cpp.o.d"
+  "CMakeFiles/tests.dir/genetic_algorithm_test.cpp.o"
+  "CMakeFiles/tests.dir/genetic_algorithm_test.cpp.o.d"
+  "CMakeFiles/tests.dir/golden_section_order_test.cpp.o"
+  "CMakeFiles/tests.dir/golden_section_order_test.cpp.o.d"
+  "CMakeFiles/tests.dir/gradient_descent_test.cpp.o"
+  "CMakeFiles/tests.dir/gradient_descent_test.cpp.o.d"
+  "CMakeFiles/tests.dir/growing_inputs_test.cpp.o"
+  "CMakeFiles/tests.dir/growing_inputs_test.cpp.o.d"
+  "CMakeFiles/tests.dir/incremental_order_test.cpp.o"
+  "CMakeFiles/tests.dir/incremental_order_test.cpp.o.d"
+  "CMakeFiles/tests.dir/inputs_selection_algorithm_test.cpp.o"
+  "CMakeFiles/tests.dir/inputs_selection_algorithm_test.cpp.o.d"
+  "CMakeFiles/tests.dir/inputs_test.cpp.o"
+  "CMakeFiles/tests.dir/inputs_test.cpp.o.d"
+  "CMakeFiles/tests.dir/inputs_trending_layer_test.cpp.o"
+  "CMakeFiles/tests.dir/inputs_trending_layer_test.cpp.o.d"
+  "CMakeFiles/tests.dir/instances_test.cpp.o"
+  "CMakeFiles/tests.dir/instances_test.cpp.o.d"
+  "CMakeFiles/tests.dir/levenberg_marquardt_algorithm_test.cpp.o"
+  "CMakeFiles/tests.dir/levenberg_marquardt_algorithm_test.cpp.o.d"
+  "CMakeFiles/tests.dir/loss_index_test.cpp.o"
+  "CMakeFiles/tests.dir/loss_index_test.cpp.o.d"
+  "CMakeFiles/tests.dir/main.cpp.o"
+  "CMakeFiles/tests.dir/main.cpp.o.d"
+  "CMakeFiles/tests.dir/matrix_test.cpp.o"
+  "CMakeFiles/tests.dir/matrix_test.cpp.o.d"
+  "CMakeFiles/tests.dir/mean_squared_error_test.cpp.o"
+  "CMakeFiles/tests.dir/mean_squared_error_test.cpp.o.d"
+  "CMakeFiles/tests.dir/minkowski_error_test.cpp.o"
+  "CMakeFiles/tests.dir/minkowski_error_test.cpp.o.d"
+  "CMakeFiles/tests.dir/missing_values_test.cpp.o"
+  "CMakeFiles/tests.dir/missing_values_test.cpp.o.d"
+  "CMakeFiles/tests.dir/mock_training_algorithm.cpp.o"
+  "CMakeFiles/tests.dir/mock_training_algorithm.cpp.o.d"
+  "CMakeFiles/tests.dir/model_selection_test.cpp.o"
+  "CMakeFiles/tests.dir/model_selection_test.cpp.o.d"
+  "CMakeFiles/tests.dir/multilayer_perceptron_test.cpp.o"
+  "CMakeFiles/tests.dir/multilayer_perceptron_test.cpp.o.d"
+  "CMakeFiles/tests.dir/neural_network_test.cpp.o"
+  "CMakeFiles/tests.dir/neural_network_test.cpp.o.d"
+  "CMakeFiles/tests.dir/normalized_squared_error_test.cpp.o"
+  "CMakeFiles/tests.dir/normalized_squared_error_test.cpp.o.d"
+  "CMakeFiles/tests.dir/numerical_differentiation_test.cpp.o"
+  "CMakeFiles/tests.dir/numerical_differentiation_test.cpp.o.d"
+  "CMakeFiles/tests.dir/order_selection_algorithm_test.cpp.o"
+  "CMakeFiles/tests.dir/order_selection_algorithm_test.cpp.o.d"
+  "CMakeFiles/tests.dir/outputs_test.cpp.o"
+  "CMakeFiles/tests.dir/outputs_test.cpp.o.d"
+  "CMakeFiles/tests.dir/outputs_trending_layer_test.cpp.o"
+  "CMakeFiles/tests.dir/outputs_trending_layer_test.cpp.o.d"
+  "CMakeFiles/tests.dir/perceptron_layer_test.cpp.o"
+  "CMakeFiles/tests.dir/perceptron_layer_test.cpp.o.d"
+  "CMakeFiles/tests.dir/polynomial.cpp.o"
+  "CMakeFiles/tests.dir/polynomial.cpp.o.d"
+  "CMakeFiles/tests.dir/probabilistic_layer_test.cpp.o"
+  "CMakeFiles/tests.dir/probabilistic_layer_test.cpp.o.d"
+  "CMakeFiles/tests.dir/pruning_inputs_test.cpp.o"
+  "CMakeFiles/tests.dir/pruning_inputs_test.cpp.o.d"
+  "CMakeFiles/tests.dir/quasi_newton_method_test.cpp.o"
+  "CMakeFiles/tests.dir/quasi_newton_method_test.cpp.o.d"
+  "CMakeFiles/tests.dir/random_search_test.cpp.o"
+  "CMakeFiles/tests.dir/random_search_test.cpp.o.d"
+  "CMakeFiles/tests.dir/root_mean_squared_error_test.cpp.o"
+  "CMakeFiles/tests.dir/root_mean_squared_error_test.cpp.o.d"
+  "CMakeFiles/tests.dir/scaling_layer_test.cpp.o"
+  "CMakeFiles/tests.dir/scaling_layer_test.cpp.o.d"
+  "CMakeFiles/tests.dir/simulated_annealing_order_test.cpp.o"
+  "CMakeFiles/tests.dir/simulated_annealing_order_test.cpp.o.d"
+  "CMakeFiles/tests.dir/sparse_matrix_test.cpp.o"
+  "CMakeFiles/tests.dir/sparse_matrix_test.cpp.o.d"
+  "CMakeFiles/tests.dir/stochastic_gradient_descent_test.cpp.o"
+  "CMakeFiles/tests.dir/stochastic_gradient_descent_test.cpp.o.d"
+  "CMakeFiles/tests.dir/sum_squared_error_test.cpp.o"
+  "CMakeFiles/tests.dir/sum_squared_error_test.cpp.o.d"
+  "CMakeFiles/tests.dir/testing_analysis_test.cpp.o"
+  "CMakeFiles/tests.dir/testing_analysis_test.cpp.o.d"
+  "CMakeFiles/tests.dir/training_algorithm_test.cpp.o"
+  "CMakeFiles/tests.dir/training_algorithm_test.cpp.o.d"
+  "CMakeFiles/tests.dir/training_rate_algorithm_test.cpp.o"
+  "CMakeFiles/tests.dir/training_rate_algorithm_test.cpp.o.d"
+  "CMakeFiles/tests.dir/training_strategy_test.cpp.o"
+  "CMakeFiles/tests.dir/training_strategy_test.cpp.o.d"
+  "CMakeFiles/tests.dir/unit_testing.cpp.o"
+  "CMakeFiles/tests.dir/unit_testing.cpp.o.d"
+  "CMakeFiles/tests.dir/unscaling_layer_test.cpp.o"
+  "CMakeFiles/tests.dir/unscaling_layer_test.cpp.o.d"
+  "CMakeFiles/tests.dir/variables_test.cpp.o"
+  "CMakeFiles/tests.dir/variables_test.cpp.o.d"
+  "CMakeFiles/tests.dir/vector_test.cpp.o"
+  "CMakeFiles/tests.dir/vector_test.cpp.o.d"
+  "CMakeFiles/tests.dir/weighted_squared_error_test.cpp.o"
+  "CMakeFiles/tests.dir/weighted_squared_error_test.cpp.o.d"
+  "tests"
+  "tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,379 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   B E N C H M A R K   C L A S S                                                                              */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#include "benchmark.h"
+
+#include <cstdlib>
+#include <new>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Global allocation functions, which count the heap allocations of the whole program
+
+void* operator new(size_t size)
+{
+    OpenNN::Benchmark::count_allocation(size);
+
+    void* pointer = malloc(size == 0 ? 1 : size);
+
+    if(!pointer)
+    {
+        throw bad_alloc();
+    }
+
+    return pointer;
+}
+
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+
+void operator delete(void* pointer) noexcept
+{
+    free(pointer);
+}
+
+
+void operator delete[](void* pointer) noexcept
+{
+    free(pointer);
+}
+
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+
+namespace OpenNN
+{
+
+atomic<size_t> Benchmark::allocations_count(0);
+atomic<size_t> Benchmark::allocated_bytes(0);
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It runs the workloads with all the threads available.
+
+Benchmark::Benchmark()
+{
+    threads_numbers.set(1, get_maximum_threads_number());
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+Benchmark::~Benchmark()
+{
+}
+
+
+/// Returns the minimum time, in seconds, during which each workload is repeated.
+
+const double& Benchmark::get_minimum_time() const
+{
+    return minimum_time;
+}
+
+
+/// Returns the maximum number of timed iterations of each workload.
+
+const size_t& Benchmark::get_maximum_iterations_number() const
+{
+    return maximum_iterations_number;
+}
+
+
+/// Returns the numbers of threads with which each workload is run.
+
+const Vector<size_t>& Benchmark::get_threads_numbers() const
+{
+    return threads_numbers;
+}
+
+
+/// Returns the measurements of all the benchmarks run.
+
+const Vector<Benchmark::Result>& Benchmark::get_results() const
+{
+    return results;
+}
+
+
+/// Sets the minimum time during which each workload is repeated.
+/// @param new_minimum_time Minimum time in seconds.
+
+void Benchmark::set_minimum_time(const double& new_minimum_time)
+{
+    minimum_time = new_minimum_time;
+}
+
+
+/// Sets the maximum number of timed iterations of each workload.
+/// @param new_maximum_iterations_number Maximum number of iterations. It must be greater than zero.
+
+void Benchmark::set_maximum_iterations_number(const size_t& new_maximum_iterations_number)
+{
+    if(new_maximum_iterations_number == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Benchmark class.\n"
+               << "void set_maximum_iterations_number(const size_t&) method.\n"
+               << "Maximum iterations number must be greater than zero.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    maximum_iterations_number = new_maximum_iterations_number;
+}
+
+
+/// Sets the numbers of threads with which each workload is run.
+/// Without OpenMP, only one thread is used.
+/// @param new_threads_numbers Numbers of threads. They must be greater than zero.
+
+void Benchmark::set_threads_numbers(const Vector<size_t>& new_threads_numbers)
+{
+    if(new_threads_numbers.empty() || new_threads_numbers.contains(0))
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Benchmark class.\n"
+               << "void set_threads_numbers(const Vector<size_t>&) method.\n"
+               << "Numbers of threads must be greater than zero.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    threads_numbers = new_threads_numbers;
+}
+
+
+/// Sets the number of threads of the OpenMP parallel regions of the library.
+/// Without OpenMP, it does nothing.
+/// @param new_threads_number Number of threads.
+
+void Benchmark::set_threads_number(const size_t& new_threads_number)
+{
+#ifdef _OPENMP
+    omp_set_num_threads(static_cast<int>(new_threads_number));
+#else
+    (void)new_threads_number;
+#endif
+}
+
+
+/// Returns the maximum number of threads of the OpenMP parallel regions, or one without OpenMP.
+
+size_t Benchmark::get_maximum_threads_number()
+{
+#ifdef _OPENMP
+    return static_cast<size_t>(omp_get_num_procs());
+#else
+    return 1;
+#endif
+}
+
+
+/// Records a heap allocation. It is called by the global operator new of the benchmarks application.
+/// @param size Number of bytes allocated.
+
+void Benchmark::count_allocation(const size_t& size)
+{
+    allocations_count.fetch_add(1, memory_order_relaxed);
+    allocated_bytes.fetch_add(size, memory_order_relaxed);
+}
+
+
+/// Runs a workload with each number of threads, and stores the measurements.
+/// The workload is run once before timing, so that caches and buffers are warm.
+/// @param name Name of the benchmark.
+/// @param parameters Description of the workload size.
+/// @param items_number Number of items processed in each call to the workload.
+/// @param items_name Name of the items, for instance "instances".
+/// @param workload Function which runs one iteration of the workload.
+
+void Benchmark::run(const string& name, const string& parameters, const size_t& items_number, const string& items_name, const function<void()>& workload)
+{
+    double reference_time_per_iteration = 0.0;
+
+    for(size_t i = 0; i < threads_numbers.size(); i++)
+    {
+        set_threads_number(threads_numbers[i]);
+
+        workload();
+
+        Result result = measure(workload);
+
+        result.name = name;
+        result.parameters = parameters;
+        result.threads_number = threads_numbers[i];
+        result.items_number = items_number;
+        result.items_name = items_name;
+        result.items_per_second = static_cast<double>(items_number)/result.time_per_iteration;
+
+        if(i == 0)
+        {
+            reference_time_per_iteration = result.time_per_iteration;
+        }
+
+        result.speedup = reference_time_per_iteration/result.time_per_iteration;
+
+        results.push_back(result);
+    }
+
+    set_threads_number(get_maximum_threads_number());
+}
+
+
+/// Repeats a workload until the minimum time has elapsed or the maximum number of iterations has been reached.
+/// It returns the timing and allocation measurements.
+/// @param workload Function which runs one iteration of the workload.
+
+Benchmark::Result Benchmark::measure(const function<void()>& workload) const
+{
+    Result result;
+
+    result.minimum_time_per_iteration = numeric_limits<double>::max();
+
+    double total_time = 0.0;
+
+    const size_t initial_allocations_count = allocations_count.load();
+    const size_t initial_allocated_bytes = allocated_bytes.load();
+
+    while(result.iterations_number < maximum_iterations_number && (total_time < minimum_time || result.iterations_number == 0))
+    {
+        const chrono::steady_clock::time_point beginning_time = chrono::steady_clock::now();
+
+        workload();
+
+        const chrono::steady_clock::time_point current_time = chrono::steady_clock::now();
+
+        const double iteration_time = chrono::duration<double>(current_time - beginning_time).count();
+
+        total_time += iteration_time;
+
+        result.minimum_time_per_iteration = min(result.minimum_time_per_iteration, iteration_time);
+
+        result.iterations_number++;
+    }
+
+    const double iterations_number = static_cast<double>(result.iterations_number);
+
+    result.time_per_iteration = total_time/iterations_number;
+
+    result.allocations_per_iteration = static_cast<double>(allocations_count.load() - initial_allocations_count)/iterations_number;
+    result.allocated_bytes_per_iteration = static_cast<double>(allocated_bytes.load() - initial_allocated_bytes)/iterations_number;
+
+    return result;
+}
+
+
+/// Writes the measurements as comma separated values, with one header line and one line for each benchmark and number of threads.
+/// Times are in seconds.
+/// @param stream Output stream.
+
+void Benchmark::write_CSV(ostream& stream) const
+{
+    stream << "name,parameters,threads_number,iterations_number,time_per_iteration,minimum_time_per_iteration,"
+           << "items_number,items_name,items_per_second,speedup,allocations_per_iteration,allocated_bytes_per_iteration\n";
+
+    stream << setprecision(6);
+
+    for(size_t i = 0; i < results.size(); i++)
+    {
+        const Result& result = results[i];
+
+        stream << result.name << ","
+               << result.parameters << ","
+               << result.threads_number << ","
+               << result.iterations_number << ","
+               << result.time_per_iteration << ","
+               << result.minimum_time_per_iteration << ","
+               << result.items_number << ","
+               << result.items_name << ","
+               << result.items_per_second << ","
+               << result.speedup << ","
+               << result.allocations_per_iteration << ","
+               << result.allocated_bytes_per_iteration << "\n";
+    }
+}
+
+
+/// Writes the measurements as a JSON array, with one object for each benchmark and number of threads.
+/// Times are in seconds.
+/// @param stream Output stream.
+
+void Benchmark::write_JSON(ostream& stream) const
+{
+    stream << "[\n";
+
+    stream << setprecision(6);
+
+    for(size_t i = 0; i < results.size(); i++)
+    {
+        const Result& result = results[i];
+
+        stream << "  {\"name\": \"" << result.name << "\", "
+               << "\"parameters\": \"" << result.parameters << "\", "
+               << "\"threads_number\": " << result.threads_number << ", "
+               << "\"iterations_number\": " << result.iterations_number << ", "
+               << "\"time_per_iteration\": " << result.time_per_iteration << ", "
+               << "\"minimum_time_per_iteration\": " << result.minimum_time_per_iteration << ", "
+               << "\"items_number\": " << result.items_number << ", "
+               << "\"items_name\": \"" << result.items_name << "\", "
+               << "\"items_per_second\": " << result.items_per_second << ", "
+               << "\"speedup\": " << result.speedup << ", "
+               << "\"allocations_per_iteration\": " << result.allocations_per_iteration << ", "
+               << "\"allocated_bytes_per_iteration\": " << result.allocated_bytes_per_iteration << "}"
+               << (i+1 < results.size() ? ",\n" : "\n");
+    }
+
+    stream << "]\n";
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,189 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   B E N C H M A R K   C L A S S   H E A D E R                                                                */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+// System includes
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <sstream>
+#include <functional>
+#include <chrono>
+#include <atomic>
+
+// OpenNN includes
+
+#include "../opennn/opennn.h"
+
+namespace OpenNN
+{
+
+///
+/// This class times a workload of the library.
+/// It repeats the workload until a minimum time has elapsed,
+/// and records the time per iteration, the throughput and the heap allocations.
+/// The workload can be run with several numbers of threads when OpenMP is available.
+///
+
+class Benchmark
+{
+
+public:
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit Benchmark();
+
+   // DESTRUCTOR
+
+   virtual ~Benchmark();
+
+   /// This structure contains the measurements of a benchmark with a number of threads.
+
+   struct Result
+   {
+       /// Name of the benchmark.
+
+       string name;
+
+       /// Description of the workload size.
+
+       string parameters;
+
+       /// Number of threads.
+
+       size_t threads_number = 1;
+
+       /// Number of timed iterations.
+
+       size_t iterations_number = 0;
+
+       /// Mean time per iteration, in seconds.
+
+       double time_per_iteration = 0.0;
+
+       /// Minimum time of an iteration, in seconds.
+
+       double minimum_time_per_iteration = 0.0;
+
+       /// Number of items, for instance instances, processed in each iteration.
+
+       size_t items_number = 0;
+
+       /// Name of the items processed in each iteration.
+
+       string items_name;
+
+       /// Items processed per second.
+
+       double items_per_second = 0.0;
+
+       /// Mean time per iteration with the first number of threads divided by that with this number of threads.
+
+       double speedup = 1.0;
+
+       /// Mean number of heap allocations per iteration.
+
+       double allocations_per_iteration = 0.0;
+
+       /// Mean number of bytes allocated in the heap per iteration.
+
+       double allocated_bytes_per_iteration = 0.0;
+   };
+
+   // Get methods
+
+   const double& get_minimum_time() const;
+   const size_t& get_maximum_iterations_number() const;
+
+   const Vector<size_t>& get_threads_numbers() const;
+
+   const Vector<Result>& get_results() const;
+
+   // Set methods
+
+   void set_minimum_time(const double&);
+   void set_maximum_iterations_number(const size_t&);
+
+   void set_threads_numbers(const Vector<size_t>&);
+
+   static void set_threads_number(const size_t&);
+   static size_t get_maximum_threads_number();
+
+   // Allocation counting methods
+
+   static void count_allocation(const size_t&);
+
+   // Benchmark methods
+
+   void run(const string&, const string&, const size_t&, const string&, const function<void()>&);
+
+   // Output methods
+
+   void write_CSV(ostream&) const;
+   void write_JSON(ostream&) const;
+
+private:
+
+   Result measure(const function<void()>&) const;
+
+   // MEMBERS
+
+   /// Minimum time, in seconds, during which each workload is repeated.
+
+   double minimum_time = 0.5;
+
+   /// Maximum number of timed iterations of each workload.
+
+   size_t maximum_iterations_number = 1000000;
+
+   /// Numbers of threads with which each workload is run.
+
+   Vector<size_t> threads_numbers;
+
+   /// Measurements of all the benchmarks run.
+
+   Vector<Result> results;
+
+   /// Number of heap allocations since the program started.
+
+   static atomic<size_t> allocations_count;
+
+   /// Number of bytes allocated in the heap since the program started.
+
+   static atomic<size_t> allocated_bytes;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,74 @@
+###################################################################################################
+#                                                                                                 #
+#   OpenNN: Open Neural Networks Library                                                          #
+#   www.artelnics.com/opennn                                                                      #
+#                                                                                                 #
+#   B E N C H M A R K S   P R O J E C T                                                           #
+#                                                                                                 #
+#   Artificial Intelligence Techniques SL (Artelnics)                                             #
+#   artelnics@artelnics.com                                                                       #
+#                                                                                                 #
+###################################################################################################
+
+QT = core# Do not use qt
+
+TEMPLATE = app
+CONFIG += console
+CONFIG += c++11
+
+mac{
+    CONFIG-=app_bundle
+}
+
+TARGET = benchmarks
+
+DESTDIR = "$$PWD/bin"
+
+HEADERS += benchmark.h
+
+SOURCES += main.cpp \
+           benchmark.cpp
+
+win32-g++{
+QMAKE_LFLAGS += -static-libgcc
+QMAKE_LFLAGS += -static-libstdc++
+QMAKE_LFLAGS += -static
+}
+
+# OpenNN library
+
+win32:CONFIG(release, debug|release): LIBS += -L$$OUT_PWD/../opennn/release/ -lopennn
+else:win32:CONFIG(debug, debug|release): LIBS += -L$$OUT_PWD/../opennn/debug/ -lopennn
+else:unix: LIBS += -L$$OUT_PWD/../opennn/ -lopennn
+
+INCLUDEPATH += $$PWD/../opennn
+DEPENDPATH += $$PWD/../opennn
+
+win32-g++:CONFIG(release, debug|release): PRE_TARGETDEPS += $$OUT_PWD/../opennn/release/libopennn.a
+else:win32-g++:CONFIG(debug, debug|release): PRE_TARGETDEPS += $$OUT_PWD/../opennn/debug/libopennn.a
+else:win32:!win32-g++:CONFIG(release, debug|release): PRE_TARGETDEPS += $$OUT_PWD/../opennn/release/opennn.lib
+else:win32:!win32-g++:CONFIG(debug, debug|release): PRE_TARGETDEPS += $$OUT_PWD/../opennn/debug/opennn.lib
+else:unix: PRE_TARGETDEPS += $$OUT_PWD/../opennn/libopennn.a
+
+# OpenMP library
+
+win32:!win32-g++{
+QMAKE_CXXFLAGS += -openmp
+QMAKE_LFLAGS   += -openmp
+}
+
+!win32{
+QMAKE_CXXFLAGS+= -fopenmp
+QMAKE_LFLAGS +=  -fopenmp
+}
+
+mac{
+INCLUDEPATH += /usr/local/Cellar/libiomp/20150701/include/libiomp
+LIBS += -L/usr/local/Cellar/libiomp/20150701/lib -liomp5
+}
+
+# MPI libraries
+#include(../mpi.pri)
+
+# CUDA libraries
+#include(../cuda.pri)
@@ -0,0 +1,480 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   B E N C H M A R K S   A P P L I C A T I O N                                                                */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// This application times the hot paths of the library on synthetic data sets.
+// The results are written as CSV or JSON, so that they can be compared between versions.
+//
+// Usage: benchmarks [--instances n] [--inputs n] [--neurons n] [--threads n,n,...]
+//                   [--minimum-time seconds] [--filter name] [--format csv|json] [--output file]
+
+// System includes
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <time.h>
+
+// OpenNN includes
+
+#include "benchmark.h"
+
+using namespace OpenNN;
+
+
+/// Returns the numbers of threads separated by commas in a string.
+
+Vector<size_t> get_threads_numbers(const string& text)
+{
+    Vector<size_t> threads_numbers;
+
+    istringstream buffer(text);
+
+    string token;
+
+    while(getline(buffer, token, ','))
+    {
+        threads_numbers.push_back(static_cast<size_t>(stoul(token)));
+    }
+
+    return threads_numbers;
+}
+
+
+/// Returns the powers of two up to the maximum number of threads, and that number.
+
+Vector<size_t> get_default_threads_numbers()
+{
+    const size_t maximum_threads_number = Benchmark::get_maximum_threads_number();
+
+    Vector<size_t> threads_numbers;
+
+    for(size_t threads_number = 1; threads_number < maximum_threads_number; threads_number *= 2)
+    {
+        threads_numbers.push_back(threads_number);
+    }
+
+    threads_numbers.push_back(maximum_threads_number);
+
+    return threads_numbers;
+}
+
+
+int main(int argc, char* argv[])
+{
+    try
+    {
+        srand(0);
+
+        size_t instances_number = 10000;
+        size_t inputs_number = 10;
+        size_t neurons_number = 50;
+
+        double minimum_time = 0.5;
+
+        Vector<size_t> threads_numbers = get_default_threads_numbers();
+
+        string filter;
+        string format = "csv";
+        string output_file_name;
+
+        for(int i = 1; i < argc; i++)
+        {
+            const string option = argv[i];
+
+            if(i+1 == argc)
+            {
+                throw logic_error("Missing value of option " + option + ".\n");
+            }
+
+            const string value = argv[++i];
+
+            if(option == "--instances") instances_number = static_cast<size_t>(stoul(value));
+            else if(option == "--inputs") inputs_number = static_cast<size_t>(stoul(value));
+            else if(option == "--neurons") neurons_number = static_cast<size_t>(stoul(value));
+            else if(option == "--threads") threads_numbers = get_threads_numbers(value);
+            else if(option == "--minimum-time") minimum_time = stod(value);
+            else if(option == "--filter") filter = value;
+            else if(option == "--format") format = value;
+            else if(option == "--output") output_file_name = value;
+            else throw logic_error("Unknown option " + option + ".\n");
+        }
+
+        if(format != "csv" && format != "json")
+        {
+            throw logic_error("Unknown format " + format + ".\n");
+        }
+
+        Benchmark benchmark;
+
+        benchmark.set_minimum_time(minimum_time);
+        benchmark.set_threads_numbers(threads_numbers);
+
+        ostringstream workload_parameters;
+
+        workload_parameters << "instances=" << instances_number << " inputs=" << inputs_number << " neurons=" << neurons_number;
+
+        // Synthetic data set, with the inputs followed by one target
+
+        DataSet data_set;
+
+        data_set.generate_Rosenbrock_data(instances_number, inputs_number+1);
+
+        data_set.get_instances_pointer()->set_training();
+
+        const Matrix<double> inputs = data_set.get_training_inputs();
+
+        // Matrix multiplication
+
+        if(filter.empty() || string("matrix_dot").find(filter) != string::npos)
+        {
+            Matrix<double> weights(inputs_number, neurons_number);
+
+            weights.randomize_normal();
+
+            benchmark.run("matrix_dot", workload_parameters.str(), instances_number, "instances",
+                          [&]() { const Matrix<double> product = inputs.dot(weights); });
+        }
+
+        // Perceptron layer outputs
+
+        if(filter.empty() || string("perceptron_layer_calculate_outputs").find(filter) != string::npos)
+        {
+            PerceptronLayer perceptron_layer(inputs_number, neurons_number);
+
+            benchmark.run("perceptron_layer_calculate_outputs", workload_parameters.str(), instances_number, "instances",
+                          [&]() { const Matrix<double> outputs = perceptron_layer.calculate_outputs(inputs); });
+        }
+
+        // Sum squared error gradient
+
+        if(filter.empty() || string("sum_squared_error_gradient").find(filter) != string::npos)
+        {
+            NeuralNetwork neural_network(inputs_number, neurons_number, 1);
+
+            SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+            benchmark.run("sum_squared_error_gradient", workload_parameters.str(), instances_number, "instances",
+                          [&]() { const Vector<double> gradient = sum_squared_error.calculate_training_error_gradient(); });
+        }
+
+        // Sum squared error gradient and Hessian approximation for the Levenberg-Marquardt algorithm
+
+        if(filter.empty() || string("sum_squared_error_second_order_terms").find(filter) != string::npos)
+        {
+            NeuralNetwork neural_network(inputs_number, neurons_number, 1);
+
+            SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+            benchmark.run("sum_squared_error_second_order_terms", workload_parameters.str(), instances_number, "instances",
+                          [&]() { const LossIndex::SecondOrderErrorTerms terms = sum_squared_error.calculate_terms_second_order_loss(); });
+        }
+
+        // Damped system of the Levenberg-Marquardt algorithm, whose size is the number of parameters
+
+        if(filter.empty() || string("levenberg_marquardt_damped_system").find(filter) != string::npos)
+        {
+            NeuralNetwork neural_network(inputs_number, neurons_number, 1);
+
+            SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+            LevenbergMarquardtAlgorithm levenberg_marquardt_algorithm(&sum_squared_error);
+
+            const LossIndex::SecondOrderErrorTerms terms = sum_squared_error.calculate_terms_second_order_loss();
+
+            const size_t parameters_number = neural_network.get_parameters_number();
+
+            const Vector<double> negative_gradient = terms.gradient*(-1.0);
+
+            Eigen::LLT<Eigen::MatrixXd> Cholesky_decomposition(static_cast<Eigen::Index>(parameters_number));
+
+            ostringstream system_parameters;
+
+            system_parameters << workload_parameters.str() << " parameters=" << parameters_number;
+
+            benchmark.run("levenberg_marquardt_damped_system", system_parameters.str(), parameters_number, "parameters",
+                          [&]()
+            {
+                const Vector<double> parameters_increment
+                        = levenberg_marquardt_algorithm.perform_Cholesky_decomposition(terms.Hessian_approximation, 1.0e-3, negative_gradient, Cholesky_decomposition);
+            });
+        }
+
+        // Data file loading
+
+        if(filter.empty() || string("data_set_load_data").find(filter) != string::npos)
+        {
+            ostringstream data_file_name;
+
+            data_file_name << "opennn_benchmark_" << time(nullptr) << ".dat";
+
+            DataSet saved_data_set(data_set);
+
+            saved_data_set.set_data_file_name(data_file_name.str());
+            saved_data_set.set_separator("Comma");
+            saved_data_set.save_data();
+
+            DataSet loaded_data_set;
+
+            loaded_data_set.set_data_file_name(data_file_name.str());
+            loaded_data_set.set_separator("Comma");
+            loaded_data_set.set_display(false);
+
+            benchmark.run("data_set_load_data", workload_parameters.str(), instances_number, "instances",
+                          [&]() { loaded_data_set.load_data(); });
+
+            remove(data_file_name.str().c_str());
+        }
+
+        // Correlations between all pairs of variables
+
+        if(filter.empty() || string("data_set_variables_correlations").find(filter) != string::npos)
+        {
+            benchmark.run("data_set_variables_correlations", workload_parameters.str(), instances_number, "instances",
+                          [&]() { const Matrix<double> correlations = data_set.calculate_variables_correlations(); });
+        }
+
+        // Statistics of all the variables, with one value in twenty missing
+
+        if(filter.empty() || string("data_set_data_statistics").find(filter) != string::npos)
+        {
+            DataSet missing_data_set(data_set);
+
+            MissingValues* missing_values_pointer = missing_data_set.get_missing_values_pointer();
+
+            missing_values_pointer->set(instances_number, inputs_number+1);
+
+            for(size_t j = 0; j < inputs_number+1; j++)
+            {
+                for(size_t i = j%20; i < instances_number; i += 20)
+                {
+                    missing_values_pointer->append(i, j);
+                }
+            }
+
+            benchmark.run("data_set_data_statistics", workload_parameters.str(), instances_number, "instances",
+                          [&]() { const Vector< Statistics<double> > statistics = missing_data_set.calculate_data_statistics(); });
+        }
+
+        // Local outlier factor of all the instances, with the default number of neighbors
+
+        if(filter.empty() || string("data_set_local_outlier_factor").find(filter) != string::npos)
+        {
+            benchmark.run("data_set_local_outlier_factor", workload_parameters.str(), instances_number, "instances",
+                          [&]() { const Vector<double> local_outlier_factor = data_set.calculate_local_outlier_factor(); });
+        }
+
+        // K-nearest neighbors outputs of one query for each hundred instances, one query at a time and in batches
+
+        if(filter.empty() || string("k_nearest_neighbors_calculate_outputs").find(filter) != string::npos)
+        {
+            KNearestNeighbors k_nearest_neighbors(&data_set);
+
+            Matrix<double> queries(max(instances_number/100, static_cast<size_t>(1)), inputs_number);
+
+            queries.randomize_uniform(-2.048, 2.048);
+
+            const size_t queries_number = queries.get_rows_number();
+
+            benchmark.run("k_nearest_neighbors_calculate_outputs_per_query", workload_parameters.str(), queries_number, "queries",
+                          [&]()
+            {
+                for(size_t i = 0; i < queries_number; i++)
+                {
+                    const Vector<double> outputs = k_nearest_neighbors.calculate_outputs(queries.get_row(i));
+                }
+            });
+
+            k_nearest_neighbors.set_search_method(SpatialIndex::Tree);
+
+            benchmark.run("k_nearest_neighbors_calculate_outputs_tree", workload_parameters.str(), queries_number, "queries",
+                          [&]() { const Matrix<double> outputs = k_nearest_neighbors.calculate_outputs(queries); });
+
+            k_nearest_neighbors.set_search_method(SpatialIndex::BruteForce);
+
+            benchmark.run("k_nearest_neighbors_calculate_outputs_brute_force", workload_parameters.str(), queries_number, "queries",
+                          [&]() { const Matrix<double> outputs = k_nearest_neighbors.calculate_outputs(queries); });
+        }
+
+        // Frequent itemsets of one order for each instance, with twice as many items as inputs, each one in a fifth of the orders
+
+        if(filter.empty() || string("association_rules_calculate_frequent_itemsets").find(filter) != string::npos)
+        {
+            const size_t items_number = 2*inputs_number;
+
+            SparseMatrix<int> orders(instances_number, items_number);
+
+            for(size_t i = 0; i < instances_number; i++)
+            {
+                for(size_t j = 0; j < items_number; j++)
+                {
+                    if(rand()%5 == 0)
+                    {
+                        orders.set_element(i, j, 1);
+                    }
+                }
+            }
+
+            AssociationRules association_rules;
+
+            association_rules.set_sparse_matrix(orders);
+            association_rules.set_minimum_support(1.0);
+
+            ostringstream orders_parameters;
+
+            orders_parameters << workload_parameters.str() << " items=" << items_number;
+
+            benchmark.run("association_rules_calculate_frequent_itemsets", orders_parameters.str(), instances_number, "orders",
+                          [&]() { const Vector< Matrix<double> > frequent_itemsets = association_rules.calculate_frequent_itemsets(); });
+        }
+
+        // Quasi-Newton inverse Hessian update, whose size is the number of parameters
+
+        if(filter.empty() || string("quasi_newton_BFGS_inverse_Hessian").find(filter) != string::npos)
+        {
+            NeuralNetwork neural_network(inputs_number, neurons_number, 1);
+
+            SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+            QuasiNewtonMethod quasi_newton_method(&sum_squared_error);
+
+            const size_t parameters_number = neural_network.get_parameters_number();
+
+            Vector<double> old_parameters(parameters_number);
+            Vector<double> parameters(parameters_number);
+            Vector<double> old_gradient(parameters_number);
+            Vector<double> gradient(parameters_number);
+
+            old_parameters.randomize_normal();
+            parameters.randomize_normal();
+            old_gradient.randomize_normal();
+            gradient.randomize_normal();
+
+            Matrix<double> old_inverse_Hessian(parameters_number, parameters_number);
+
+            old_inverse_Hessian.initialize_identity();
+
+            ostringstream Hessian_parameters;
+
+            Hessian_parameters << workload_parameters.str() << " parameters=" << parameters_number;
+
+            benchmark.run("quasi_newton_BFGS_inverse_Hessian", Hessian_parameters.str(), parameters_number, "parameters",
+                          [&]()
+            {
+                const Matrix<double> inverse_Hessian
+                        = quasi_newton_method.calculate_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, old_inverse_Hessian);
+            });
+        }
+
+        // Limited-memory BFGS training direction, with the default number of stored pairs
+
+        if(filter.empty() || string("quasi_newton_LBFGS_training_direction").find(filter) != string::npos)
+        {
+            NeuralNetwork neural_network(inputs_number, neurons_number, 1);
+
+            SumSquaredError sum_squared_error(&neural_network, &data_set);
+
+            QuasiNewtonMethod quasi_newton_method(&sum_squared_error);
+
+            const size_t parameters_number = neural_network.get_parameters_number();
+            const size_t limited_memory_size = quasi_newton_method.get_limited_memory_size();
+
+            QuasiNewtonMethod::LimitedMemoryInverseHessian limited_memory_inverse_Hessian;
+
+            limited_memory_inverse_Hessian.set(parameters_number, limited_memory_size);
+
+            Vector<double> old_parameters(parameters_number);
+            Vector<double> parameters(parameters_number);
+            Vector<double> old_gradient(parameters_number);
+            Vector<double> gradient(parameters_number);
+
+            parameters.randomize_normal();
+            gradient.randomize_normal();
+
+            for(size_t i = 0; i < limited_memory_size; i++)
+            {
+                old_parameters = parameters;
+                old_gradient = gradient;
+
+                parameters.randomize_normal();
+
+                gradient = old_gradient + (parameters - old_parameters);
+
+                limited_memory_inverse_Hessian.update(old_parameters, parameters, old_gradient, gradient);
+            }
+
+            ostringstream Hessian_parameters;
+
+            Hessian_parameters << workload_parameters.str() << " parameters=" << parameters_number << " limited_memory_size=" << limited_memory_size;
+
+            benchmark.run("quasi_newton_LBFGS_training_direction", Hessian_parameters.str(), parameters_number, "parameters",
+                          [&]()
+            {
+                const Vector<double> training_direction
+                        = quasi_newton_method.calculate_training_direction(gradient, limited_memory_inverse_Hessian);
+            });
+        }
+
+        // Output
+
+        ofstream file;
+
+        if(!output_file_name.empty())
+        {
+            file.open(output_file_name.c_str());
+
+            if(!file.is_open())
+            {
+                throw logic_error("Cannot open output file " + output_file_name + ".\n");
+            }
+        }
+
+        ostream& stream = output_file_name.empty() ? cout : file;
+
+        if(format == "json")
+        {
+            benchmark.write_JSON(stream);
+        }
+        else
+        {
+            benchmark.write_CSV(stream);
+        }
+
+        return(0);
+    }
+    catch(exception& e)
+    {
+        cerr << e.what() << endl;
+
+        return(1);
+    }
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -24,4 +24,5 @@ SUBDIRS += opennn
 SUBDIRS += blank
 #SUBDIRS += examples
 #SUBDIRS += tests
+#SUBDIRS += benchmarks
 
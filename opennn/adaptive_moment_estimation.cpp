@@ -0,0 +1,2632 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   A D A P T I V E   M O M E N T   E S T I M A T I O N   C L A S S                                            */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Open NN includes
+
+#include "adaptive_moment_estimation.h"
+
+namespace OpenNN
+{
+
+/// Default constructor.
+/// It creates an adaptive moment estimation training algorithm not associated to any loss index object.
+/// It also initializes the class members to their default values.
+
+AdaptiveMomentEstimation::AdaptiveMomentEstimation()
+:TrainingAlgorithm()
+{
+   set_default();
+}
+
+
+/// Loss index constructor.
+/// It creates an adaptive moment estimation training algorithm associated to a loss index.
+/// It also initializes the class members to their default values.
+/// @param new_loss_index_pointer Pointer to a loss index object.
+
+AdaptiveMomentEstimation::AdaptiveMomentEstimation(LossIndex* new_loss_index_pointer)
+: TrainingAlgorithm(new_loss_index_pointer)
+{
+   set_default();
+}
+
+
+// XML CONSTRUCTOR
+
+/// XML constructor.
+/// It creates an adaptive moment estimation training algorithm not associated to any loss index object.
+/// It also loads the class members from a XML document.
+/// @param document TinyXML document with the members of an adaptive moment estimation object.
+
+AdaptiveMomentEstimation::AdaptiveMomentEstimation(const tinyxml2::XMLDocument& document)
+: TrainingAlgorithm(document)
+{
+   set_default();
+
+   from_XML(document);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+AdaptiveMomentEstimation::~AdaptiveMomentEstimation()
+{
+}
+
+
+// METHODS
+
+/// Returns the rule for updating the parameters from the moment estimates.
+
+const AdaptiveMomentEstimation::AdaptiveMethod& AdaptiveMomentEstimation::get_adaptive_method() const
+{
+   return(adaptive_method);
+}
+
+
+/// Returns the name of the rule for updating the parameters from the moment estimates.
+
+string AdaptiveMomentEstimation::write_adaptive_method() const
+{
+   switch(adaptive_method)
+   {
+      case ADAM:
+      {
+         return("ADAM");
+      }
+
+      case ADAMW:
+      {
+         return("ADAMW");
+      }
+
+      case RMSPROP:
+      {
+         return("RMSPROP");
+      }
+
+      case ADAGRAD:
+      {
+         return("ADAGRAD");
+      }
+   }
+
+   ostringstream buffer;
+
+   buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+          << "string write_adaptive_method() const method.\n"
+          << "Unknown adaptive method.\n";
+
+   throw logic_error(buffer.str());
+}
+
+
+/// Returns the step size of the parameters updates.
+
+const double& AdaptiveMomentEstimation::get_learning_rate() const
+{
+   return(learning_rate);
+}
+
+
+/// Returns the decay rate of the first moment estimates of Adam and AdamW.
+
+const double& AdaptiveMomentEstimation::get_beta_1() const
+{
+   return(beta_1);
+}
+
+
+/// Returns the decay rate of the second moment estimates of Adam and AdamW.
+
+const double& AdaptiveMomentEstimation::get_beta_2() const
+{
+   return(beta_2);
+}
+
+
+/// Returns the decay rate of the second moment estimates of RMSProp.
+
+const double& AdaptiveMomentEstimation::get_decay_rate() const
+{
+   return(decay_rate);
+}
+
+
+/// Returns the constant added to the square root of the second moment estimates.
+
+const double& AdaptiveMomentEstimation::get_epsilon() const
+{
+   return(epsilon);
+}
+
+
+/// Returns the decoupled weight decay of AdamW.
+
+const double& AdaptiveMomentEstimation::get_weight_decay() const
+{
+   return(weight_decay);
+}
+
+
+/// Returns the minimum value for the norm of the parameters vector at wich a warning message is
+/// written to the screen.
+
+const double& AdaptiveMomentEstimation::get_warning_parameters_norm() const
+{
+   return(warning_parameters_norm);
+}
+
+
+/// Returns the minimum value for the norm of the gradient vector at wich a warning message is written
+/// to the screen.
+
+const double& AdaptiveMomentEstimation::get_warning_gradient_norm() const
+{
+   return(warning_gradient_norm);
+}
+
+
+/// Returns the goal value for the loss.
+/// This is used as a stopping criterion when training a neural network
+
+const double& AdaptiveMomentEstimation::get_loss_goal() const
+{
+   return(loss_goal);
+}
+
+
+/// Returns the maximum number of epochs at which the selection error increases.
+
+const size_t& AdaptiveMomentEstimation::get_maximum_selection_failures() const
+{
+   return(maximum_selection_failures);
+}
+
+
+/// Returns the maximum number of epochs for training.
+
+const size_t& AdaptiveMomentEstimation::get_maximum_epochs_number() const
+{
+   return(maximum_epochs_number);
+}
+
+
+/// Returns the maximum training time.
+
+const double& AdaptiveMomentEstimation::get_maximum_time() const
+{
+   return(maximum_time);
+}
+
+
+/// Returns true if the final model will be the neural network with the minimum selection error, false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_return_minimum_selection_error_neural_network() const
+{
+   return(return_minimum_selection_error_neural_network);
+}
+
+
+/// Returns true if the selection error decrease stopping criteria has to be taken in account, false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_apply_early_stopping() const
+{
+   return(apply_early_stopping);
+}
+
+
+/// Returns true if the training instances are shuffled at the beginning of each epoch, false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_shuffle() const
+{
+   return(shuffle);
+}
+
+
+/// Returns the number of consecutive training instances which are shuffled together.
+
+const size_t& AdaptiveMomentEstimation::get_shuffle_block_size() const
+{
+   return(shuffle_block_size);
+}
+
+
+/// Returns the number of batches gathered on a background thread ahead of the batch being trained.
+
+const size_t& AdaptiveMomentEstimation::get_prefetched_batches_number() const
+{
+   return(prefetched_batches_number);
+}
+
+
+/// Returns the seed of the random number generator used for shuffling the training instances.
+
+const unsigned& AdaptiveMomentEstimation::get_shuffle_seed() const
+{
+   return(shuffle_seed);
+}
+
+
+/// Returns true if the selection error is calculated on a background thread while the next epoch is trained, and false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_asynchronous_selection_error() const
+{
+   return(asynchronous_selection_error);
+}
+
+
+/// Returns true if the training error of each epoch is estimated from the errors of its batches, and false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_reuse_batch_errors() const
+{
+   return(reuse_batch_errors);
+}
+
+
+/// Returns true if the parameters norm history vector is to be reserved, and false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_reserve_parameters_norm_history() const
+{
+   return(reserve_parameters_norm_history);
+}
+
+
+/// Returns true if the loss history vector is to be reserved, and false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_reserve_loss_history() const
+{
+   return(reserve_loss_history);
+}
+
+
+/// Returns true if the selection error history vector is to be reserved, and false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_reserve_selection_error_history() const
+{
+   return(reserve_selection_error_history);
+}
+
+
+/// Returns true if the gradient norm history vector is to be reserved, and false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_reserve_gradient_norm_history() const
+{
+   return(reserve_gradient_norm_history);
+}
+
+
+/// Returns true if the elapsed time history vector is to be reserved, and false otherwise.
+
+const bool& AdaptiveMomentEstimation::get_reserve_elapsed_time_history() const
+{
+   return(reserve_elapsed_time_history);
+}
+
+
+/// Sets the members of the adaptive moment estimation object to their default values:
+/// <ul>
+/// <li> Adaptive method: Adam.
+/// <li> Learning rate: 0.001.
+/// <li> Beta 1: 0.9.
+/// <li> Beta 2: 0.999.
+/// <li> Decay rate: 0.9.
+/// <li> Epsilon: 1.0e-8.
+/// <li> Weight decay: 0.01.
+/// </ul>
+
+void AdaptiveMomentEstimation::set_default()
+{
+   // TRAINING OPERATORS
+
+   adaptive_method = ADAM;
+
+   // TRAINING PARAMETERS
+
+   learning_rate = 0.001;
+   beta_1 = 0.9;
+   beta_2 = 0.999;
+   decay_rate = 0.9;
+   epsilon = 1.0e-8;
+   weight_decay = 0.01;
+
+   warning_parameters_norm = 1.0e6;
+   warning_gradient_norm = 1.0e6;
+
+   // BATCHES
+
+   shuffle = false;
+   shuffle_block_size = 1;
+   prefetched_batches_number = 2;
+   shuffle_seed = 0;
+
+   // EPOCH EVALUATION
+
+   asynchronous_selection_error = false;
+   reuse_batch_errors = false;
+
+   // STOPPING CRITERIA
+
+   loss_goal = -numeric_limits<double>::max();
+   maximum_selection_failures = 1000000;
+
+   maximum_epochs_number = 1000;
+   maximum_time = 1000.0;
+
+   return_minimum_selection_error_neural_network = false;
+   apply_early_stopping = true;
+
+   // TRAINING HISTORY
+
+   reserve_parameters_norm_history = false;
+   reserve_loss_history = true;
+   reserve_selection_error_history = false;
+   reserve_gradient_norm_history = false;
+   reserve_elapsed_time_history = false;
+
+   // UTILITIES
+
+   display = true;
+   display_period = 5;
+}
+
+
+/// Makes the training history of all variables to reseved or not in memory.
+/// @param new_reserve_all_training_history True if the training history of all variables is to be reserved, false otherwise.
+
+void AdaptiveMomentEstimation::set_reserve_all_training_history(const bool& new_reserve_all_training_history)
+{
+   reserve_parameters_norm_history = new_reserve_all_training_history;
+   reserve_loss_history = new_reserve_all_training_history;
+   reserve_selection_error_history = new_reserve_all_training_history;
+   reserve_gradient_norm_history = new_reserve_all_training_history;
+   reserve_elapsed_time_history = new_reserve_all_training_history;
+}
+
+
+/// Sets a new rule for updating the parameters from the moment estimates.
+/// @param new_adaptive_method Adaptive method.
+
+void AdaptiveMomentEstimation::set_adaptive_method(const AdaptiveMethod& new_adaptive_method)
+{
+   adaptive_method = new_adaptive_method;
+}
+
+
+/// Sets a new rule for updating the parameters from a string containing the name.
+/// Possible values are:
+/// <ul>
+/// <li> "ADAM"
+/// <li> "ADAMW"
+/// <li> "RMSPROP"
+/// <li> "ADAGRAD"
+/// </ul>
+/// @param new_adaptive_method_name Name of the adaptive method.
+
+void AdaptiveMomentEstimation::set_adaptive_method(const string& new_adaptive_method_name)
+{
+   if(new_adaptive_method_name == "ADAM")
+   {
+      adaptive_method = ADAM;
+   }
+   else if(new_adaptive_method_name == "ADAMW")
+   {
+      adaptive_method = ADAMW;
+   }
+   else if(new_adaptive_method_name == "RMSPROP")
+   {
+      adaptive_method = RMSPROP;
+   }
+   else if(new_adaptive_method_name == "ADAGRAD")
+   {
+      adaptive_method = ADAGRAD;
+   }
+   else
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_adaptive_method(const string&) method.\n"
+             << "Unknown adaptive method: " << new_adaptive_method_name << ".\n";
+
+      throw logic_error(buffer.str());
+   }
+}
+
+
+/// Sets a new step size for the parameters updates.
+/// @param new_learning_rate Learning rate. It must be greater than zero.
+
+void AdaptiveMomentEstimation::set_learning_rate(const double& new_learning_rate)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_learning_rate <= 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_learning_rate(const double&) method.\n"
+             << "Learning rate must be greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   learning_rate = new_learning_rate;
+}
+
+
+/// Sets a new decay rate for the first moment estimates of Adam and AdamW.
+/// @param new_beta_1 Decay rate. It must be in the interval [0, 1).
+
+void AdaptiveMomentEstimation::set_beta_1(const double& new_beta_1)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_beta_1 < 0.0 || new_beta_1 >= 1.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_beta_1(const double&) method.\n"
+             << "Beta 1 must be equal or greater than 0 and less than 1.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   beta_1 = new_beta_1;
+}
+
+
+/// Sets a new decay rate for the second moment estimates of Adam and AdamW.
+/// @param new_beta_2 Decay rate. It must be in the interval [0, 1).
+
+void AdaptiveMomentEstimation::set_beta_2(const double& new_beta_2)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_beta_2 < 0.0 || new_beta_2 >= 1.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_beta_2(const double&) method.\n"
+             << "Beta 2 must be equal or greater than 0 and less than 1.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   beta_2 = new_beta_2;
+}
+
+
+/// Sets a new decay rate for the second moment estimates of RMSProp.
+/// @param new_decay_rate Decay rate. It must be in the interval [0, 1).
+
+void AdaptiveMomentEstimation::set_decay_rate(const double& new_decay_rate)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_decay_rate < 0.0 || new_decay_rate >= 1.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_decay_rate(const double&) method.\n"
+             << "Decay rate must be equal or greater than 0 and less than 1.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   decay_rate = new_decay_rate;
+}
+
+
+/// Sets a new constant to be added to the square root of the second moment estimates.
+/// @param new_epsilon Epsilon value. It must be greater than zero.
+
+void AdaptiveMomentEstimation::set_epsilon(const double& new_epsilon)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_epsilon <= 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_epsilon(const double&) method.\n"
+             << "Epsilon must be greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   epsilon = new_epsilon;
+}
+
+
+/// Sets a new decoupled weight decay for AdamW.
+/// @param new_weight_decay Weight decay. It must be equal or greater than zero.
+
+void AdaptiveMomentEstimation::set_weight_decay(const double& new_weight_decay)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_weight_decay < 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_weight_decay(const double&) method.\n"
+             << "Weight decay must be equal or greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   weight_decay = new_weight_decay;
+}
+
+
+/// Sets a new value for the parameters vector norm at which a warning message is written to the
+/// screen.
+/// @param new_warning_parameters_norm Warning norm of parameters vector value.
+
+void AdaptiveMomentEstimation::set_warning_parameters_norm(const double& new_warning_parameters_norm)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_warning_parameters_norm < 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_warning_parameters_norm(const double&) method.\n"
+             << "Warning parameters norm must be equal or greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   warning_parameters_norm = new_warning_parameters_norm;
+}
+
+
+/// Sets a new value for the gradient vector norm at which
+/// a warning message is written to the screen.
+/// @param new_warning_gradient_norm Warning norm of gradient vector value.
+
+void AdaptiveMomentEstimation::set_warning_gradient_norm(const double& new_warning_gradient_norm)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_warning_gradient_norm < 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_warning_gradient_norm(const double&) method.\n"
+             << "Warning gradient norm must be equal or greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   warning_gradient_norm = new_warning_gradient_norm;
+}
+
+
+/// Sets a new goal value for the loss.
+/// This is used as a stopping criterion when training a neural network
+/// @param new_loss_goal Goal value for the loss.
+
+void AdaptiveMomentEstimation::set_loss_goal(const double& new_loss_goal)
+{
+   loss_goal = new_loss_goal;
+}
+
+
+/// Sets a new maximum number of selection failures.
+/// @param new_maximum_selection_failures Maximum number of epochs in which the selection error increases.
+
+void AdaptiveMomentEstimation::set_maximum_selection_failures(const size_t& new_maximum_selection_failures)
+{
+   maximum_selection_failures = new_maximum_selection_failures;
+}
+
+
+/// Sets a maximum number of epochs for training.
+/// @param new_maximum_epochs_number Maximum number of epochs for training.
+
+void AdaptiveMomentEstimation::set_maximum_epochs_number(const size_t& new_maximum_epochs_number)
+{
+   maximum_epochs_number = new_maximum_epochs_number;
+}
+
+
+/// Sets a new maximum training time.
+/// @param new_maximum_time Maximum training time.
+
+void AdaptiveMomentEstimation::set_maximum_time(const double& new_maximum_time)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_maximum_time < 0.0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void set_maximum_time(const double&) method.\n"
+             << "Maximum time must be equal or greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   maximum_time = new_maximum_time;
+}
+
+
+/// Makes the minimum selection error neural network of all the epochs to be returned or not.
+/// @param new_return_minimum_selection_error_neural_network True if the final model will be the neural network with the minimum selection error, false otherwise.
+
+void AdaptiveMomentEstimation::set_return_minimum_selection_error_neural_network(const bool& new_return_minimum_selection_error_neural_network)
+{
+   return_minimum_selection_error_neural_network = new_return_minimum_selection_error_neural_network;
+}
+
+
+/// Makes the selection error decrease stopping criteria has to be taken in account or not.
+/// @param new_apply_early_stopping True if the selection error decrease stopping criteria has to be taken in account, false otherwise.
+
+void AdaptiveMomentEstimation::set_apply_early_stopping(const bool& new_apply_early_stopping)
+{
+   apply_early_stopping = new_apply_early_stopping;
+}
+
+
+/// Sets whether the training instances are shuffled at the beginning of each epoch.
+/// @param new_shuffle True for shuffling the training instances, false for keeping their order.
+
+void AdaptiveMomentEstimation::set_shuffle(const bool& new_shuffle)
+{
+   shuffle = new_shuffle;
+}
+
+
+/// Sets the number of consecutive training instances which are shuffled together.
+/// @param new_shuffle_block_size Number of instances in each shuffling block.
+
+void AdaptiveMomentEstimation::set_shuffle_block_size(const size_t& new_shuffle_block_size)
+{
+   shuffle_block_size = new_shuffle_block_size;
+}
+
+
+/// Sets the number of batches gathered on a background thread ahead of the batch being trained.
+/// @param new_prefetched_batches_number Number of prefetched batches. Zero gathers each batch in the training loop.
+
+void AdaptiveMomentEstimation::set_prefetched_batches_number(const size_t& new_prefetched_batches_number)
+{
+   prefetched_batches_number = new_prefetched_batches_number;
+}
+
+
+/// Sets the seed of the random number generator used for shuffling the training instances.
+/// @param new_shuffle_seed Seed of the random number generator.
+
+void AdaptiveMomentEstimation::set_shuffle_seed(const unsigned& new_shuffle_seed)
+{
+   shuffle_seed = new_shuffle_seed;
+}
+
+
+/// Sets whether the selection error of each epoch is calculated on a background thread while the next epoch is trained.
+/// In that case, the selection failures and the minimum selection error are updated one epoch late,
+/// and the training can run one epoch past the point where it would otherwise stop.
+/// The error term must implement calculate_selection_error(const Vector<double>&).
+/// With MPI the selection error is always calculated synchronously, since its reduction cannot overlap those of the training.
+/// @param new_asynchronous_selection_error True for calculating the selection error asynchronously, false otherwise.
+
+void AdaptiveMomentEstimation::set_asynchronous_selection_error(const bool& new_asynchronous_selection_error)
+{
+   asynchronous_selection_error = new_asynchronous_selection_error;
+}
+
+
+/// Sets whether the training error of each epoch is estimated from the errors of its batches,
+/// instead of being calculated again over all the training instances.
+/// The estimate mixes the parameters at each batch of the epoch.
+/// @param new_reuse_batch_errors True for estimating the training error from the batches, false otherwise.
+
+void AdaptiveMomentEstimation::set_reuse_batch_errors(const bool& new_reuse_batch_errors)
+{
+   reuse_batch_errors = new_reuse_batch_errors;
+}
+
+
+/// Makes the parameters norm history vector to be reseved or not in memory.
+/// @param new_reserve_parameters_norm_history True if the parameters norm history vector is to be reserved, false otherwise.
+
+void AdaptiveMomentEstimation::set_reserve_parameters_norm_history(const bool& new_reserve_parameters_norm_history)
+{
+   reserve_parameters_norm_history = new_reserve_parameters_norm_history;
+}
+
+
+/// Makes the loss history vector to be reseved or not in memory.
+/// @param new_reserve_loss_history True if the loss history vector is to be reserved, false otherwise.
+
+void AdaptiveMomentEstimation::set_reserve_loss_history(const bool& new_reserve_loss_history)
+{
+   reserve_loss_history = new_reserve_loss_history;
+}
+
+
+/// Makes the selection error history vector to be reseved or not in memory.
+/// @param new_reserve_selection_error_history True if the selection error history vector is to be reserved, false otherwise.
+
+void AdaptiveMomentEstimation::set_reserve_selection_error_history(const bool& new_reserve_selection_error_history)
+{
+   reserve_selection_error_history = new_reserve_selection_error_history;
+}
+
+
+/// Makes the gradient norm history vector to be reseved or not in memory.
+/// @param new_reserve_gradient_norm_history True if the gradient norm history vector is to be reserved, false otherwise.
+
+void AdaptiveMomentEstimation::set_reserve_gradient_norm_history(const bool& new_reserve_gradient_norm_history)
+{
+   reserve_gradient_norm_history = new_reserve_gradient_norm_history;
+}
+
+
+/// Makes the elapsed time over the epochs to be reseved or not in memory.
+/// @param new_reserve_elapsed_time_history True if the elapsed time history vector is to be reserved, false otherwise.
+
+void AdaptiveMomentEstimation::set_reserve_elapsed_time_history(const bool& new_reserve_elapsed_time_history)
+{
+   reserve_elapsed_time_history = new_reserve_elapsed_time_history;
+}
+
+
+/// Sets the moment estimates of a number of parameters to zero, and restarts the bias correction.
+/// @param parameters_number Number of parameters.
+
+void AdaptiveMomentEstimation::MomentEstimates::set(const size_t& parameters_number)
+{
+   first_moment.set(parameters_number, 0.0);
+   second_moment.set(parameters_number, 0.0);
+
+   iteration = 0;
+}
+
+
+/// Updates the moment estimates with a gradient, and takes a step of the parameters according to the adaptive method.
+/// Both the moment estimates and the parameters are updated in place, in a single pass over the parameters.
+/// @param gradient Gradient of the loss with respect to the parameters.
+/// @param moment_estimates Moment estimates, which are updated.
+/// @param parameters Parameters of the neural network, which are updated.
+
+void AdaptiveMomentEstimation::update_parameters(const Vector<double>& gradient,
+                                                 MomentEstimates& moment_estimates,
+                                                 Vector<double>& parameters) const
+{
+   const size_t parameters_number = parameters.size();
+
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(gradient.size() != parameters_number
+   || moment_estimates.first_moment.size() != parameters_number
+   || moment_estimates.second_moment.size() != parameters_number)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+             << "void update_parameters(const Vector<double>&, MomentEstimates&, Vector<double>&) const method.\n"
+             << "Sizes of gradient and moment estimates must be equal to number of parameters.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   moment_estimates.iteration++;
+
+   const double* gradient_data = gradient.data();
+   double* first_moment_data = moment_estimates.first_moment.data();
+   double* second_moment_data = moment_estimates.second_moment.data();
+   double* parameters_data = parameters.data();
+
+   switch(adaptive_method)
+   {
+      case ADAM:
+      case ADAMW:
+      {
+         const double iteration = static_cast<double>(moment_estimates.iteration);
+
+         const double first_moment_correction = 1.0/(1.0 - pow(beta_1, iteration));
+         const double second_moment_correction = 1.0/(1.0 - pow(beta_2, iteration));
+
+         const double decay = adaptive_method == ADAMW ? 1.0 - learning_rate*weight_decay : 1.0;
+
+         for(size_t i = 0; i < parameters_number; i++)
+         {
+            first_moment_data[i] = beta_1*first_moment_data[i] + (1.0 - beta_1)*gradient_data[i];
+            second_moment_data[i] = beta_2*second_moment_data[i] + (1.0 - beta_2)*gradient_data[i]*gradient_data[i];
+
+            parameters_data[i] = decay*parameters_data[i]
+                               - learning_rate*first_moment_data[i]*first_moment_correction
+                                 /(sqrt(second_moment_data[i]*second_moment_correction) + epsilon);
+         }
+      }
+      break;
+
+      case RMSPROP:
+      {
+         for(size_t i = 0; i < parameters_number; i++)
+         {
+            second_moment_data[i] = decay_rate*second_moment_data[i] + (1.0 - decay_rate)*gradient_data[i]*gradient_data[i];
+
+            parameters_data[i] -= learning_rate*gradient_data[i]/(sqrt(second_moment_data[i]) + epsilon);
+         }
+      }
+      break;
+
+      case ADAGRAD:
+      {
+         for(size_t i = 0; i < parameters_number; i++)
+         {
+            second_moment_data[i] += gradient_data[i]*gradient_data[i];
+
+            parameters_data[i] -= learning_rate*gradient_data[i]/(sqrt(second_moment_data[i]) + epsilon);
+         }
+      }
+      break;
+   }
+}
+
+
+/// Returns a string representation of the current adaptive moment estimation results structure.
+
+string AdaptiveMomentEstimation::AdaptiveMomentEstimationResults::object_to_string() const
+{
+   ostringstream buffer;
+
+   // Parameters norm history
+
+   if(!parameters_norm_history.empty())
+   {
+       buffer << "% Parameters norm history:\n"
+              << parameters_norm_history << "\n";
+   }
+
+   // Loss history
+
+   if(!loss_history.empty())
+   {
+       buffer << "% Loss history:\n"
+              << loss_history << "\n";
+   }
+
+   // Selection error history
+
+   if(!selection_error_history.empty())
+   {
+       buffer << "% Selection error history:\n"
+              << selection_error_history << "\n";
+   }
+
+   // Gradient norm history
+
+   if(!gradient_norm_history.empty())
+   {
+       buffer << "% Gradient norm history:\n"
+              << gradient_norm_history << "\n";
+   }
+
+   // Elapsed time history
+
+   if(!elapsed_time_history.empty())
+   {
+       buffer << "% Elapsed time history:\n"
+              << elapsed_time_history << "\n";
+   }
+
+   // Stopping criterion
+
+   buffer << "% Stopping criterion:\n"
+          << write_stopping_condition() << "\n";
+
+   return(buffer.str());
+}
+
+
+/// Returns a default matrix with the names and the values of the final results from training.
+/// @param precision Number of significant digits of the values.
+
+Matrix<string> AdaptiveMomentEstimation::AdaptiveMomentEstimationResults::write_final_results(const int& precision) const
+{
+   ostringstream buffer;
+
+   Vector<string> names;
+   Vector<string> values;
+
+   // Final parameters norm
+
+   names.push_back("Final parameters norm");
+
+   buffer.str("");
+   buffer << setprecision(precision) << final_parameters_norm;
+
+   values.push_back(buffer.str());
+
+   // Final loss
+
+   names.push_back("Final training error");
+
+   buffer.str("");
+   buffer << setprecision(precision) << final_loss;
+
+   values.push_back(buffer.str());
+
+   // Final selection error
+
+   names.push_back("Final selection error");
+
+   buffer.str("");
+   buffer << setprecision(precision) << final_selection_error;
+
+   values.push_back(buffer.str());
+
+   // Final gradient norm
+
+   names.push_back("Final gradient norm");
+
+   buffer.str("");
+   buffer << setprecision(precision) << final_gradient_norm;
+
+   values.push_back(buffer.str());
+
+   // Epochs number
+
+   names.push_back("Epochs number");
+
+   buffer.str("");
+   buffer << epochs_number;
+
+   values.push_back(buffer.str());
+
+   // Elapsed time
+
+   names.push_back("Elapsed time");
+
+   buffer.str("");
+   buffer << write_elapsed_time(elapsed_time);
+
+   values.push_back(buffer.str());
+
+   // Stopping criteria
+
+   names.push_back("Stopping criterion");
+
+   values.push_back(write_stopping_condition());
+
+   const size_t rows_number = names.size();
+   const size_t columns_number = 2;
+
+   Matrix<string> final_results(rows_number, columns_number);
+
+   final_results.set_column(0, names, "name");
+   final_results.set_column(1, values, "value");
+
+   return(final_results);
+}
+
+
+/// Resizes the training history variables which are to be reserved by the training algorithm.
+/// @param new_size Size of training history variables.
+
+void AdaptiveMomentEstimation::AdaptiveMomentEstimationResults::resize_training_history(const size_t& new_size)
+{
+    if(adaptive_moment_estimation_pointer->get_reserve_parameters_norm_history())
+    {
+        parameters_norm_history.resize(new_size);
+    }
+
+    if(adaptive_moment_estimation_pointer->get_reserve_loss_history())
+    {
+        loss_history.resize(new_size);
+    }
+
+    if(adaptive_moment_estimation_pointer->get_reserve_selection_error_history())
+    {
+        selection_error_history.resize(new_size);
+    }
+
+    if(adaptive_moment_estimation_pointer->get_reserve_gradient_norm_history())
+    {
+        gradient_norm_history.resize(new_size);
+    }
+
+    if(adaptive_moment_estimation_pointer->get_reserve_elapsed_time_history())
+    {
+        elapsed_time_history.resize(new_size);
+    }
+}
+
+
+/// Trains a neural network with an associated loss index,
+/// according to the adaptive method.
+/// Each epoch goes through the training instances in batches, and takes one step of the parameters for each batch.
+/// Training occurs according to the training parameters and stopping criteria.
+/// It returns a results structure with the history and the final values of the reserved variables.
+/// If a checkpoint file is set, the parameters, the moment estimates and the state of the method are saved to it every checkpoint period epochs,
+/// and the training can later resume from the last checkpoint, as if it had not been interrupted.
+/// The training history of the results only contains the epochs performed after resuming.
+
+AdaptiveMomentEstimation::AdaptiveMomentEstimationResults* AdaptiveMomentEstimation::perform_training()
+{
+   AdaptiveMomentEstimationResults* results_pointer = new AdaptiveMomentEstimationResults(this);
+
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   check();
+
+   #endif
+
+   // Start training
+
+   if(display) cout << "Training with adaptive moment estimation (" << write_adaptive_method() << ")...\n";
+
+   // Data set stuff
+
+   DataSet* data_set_pointer = loss_index_pointer->get_data_set_pointer();
+
+   const Instances& instances = data_set_pointer->get_instances();
+
+   const size_t selection_instances_number = loss_index_pointer->sum_MPI(instances.get_selection_instances_number());
+
+   // The selection error ends with an MPI reduction, which must not run on a background thread
+   // at the same time as those of the training, so with MPI it is always calculated synchronously.
+
+#ifdef __OPENNN_MPI__
+   const bool background_selection_error = false;
+#else
+   const bool background_selection_error = asynchronous_selection_error && selection_instances_number > 0;
+#endif
+
+   // The selection batches are gathered here, so that the background thread only reads them
+
+   if(background_selection_error)
+   {
+       data_set_pointer->get_selection_batches(loss_index_pointer->get_batch_size());
+   }
+
+   BatchProducer batch_producer(data_set_pointer);
+
+   batch_producer.set_batch_size(training_batch_size);
+   batch_producer.set_shuffle(shuffle);
+   batch_producer.set_shuffle_block_size(shuffle_block_size);
+   batch_producer.set_prefetched_batches_number(prefetched_batches_number);
+   batch_producer.set_seed(shuffle_seed);
+
+   BatchProducer::Batch batch;
+
+   // Neural network stuff
+
+   NeuralNetwork* neural_network_pointer = loss_index_pointer->get_neural_network_pointer();
+
+   const size_t parameters_number = neural_network_pointer->get_parameters_number();
+
+   Vector<double> parameters = neural_network_pointer->get_parameters();
+
+   double parameters_norm = parameters.calculate_L2_norm();
+
+   // Loss index stuff
+
+   double training_error = 0.0;
+
+   double selection_error = 0.0;
+   double old_selection_error = 0.0;
+
+   Vector<double> gradient(parameters_number);
+   double gradient_norm = 0.0;
+
+   Vector<double> batches_errors;
+   Vector<size_t> batches_instances_numbers;
+
+   // Training algorithm stuff
+
+   MomentEstimates moment_estimates;
+
+   moment_estimates.set(parameters_number);
+
+   size_t selection_failures = 0;
+
+   Vector<double> minimum_selection_error_parameters(parameters);
+   double minimum_selection_error = numeric_limits<double>::max();
+
+   // Parameters whose selection error is being calculated in the background, and that of the last selection error
+
+   future<double> selection_error_future;
+   Vector<double> evaluated_parameters;
+   size_t evaluated_epoch = 0;
+
+   Vector<double> selection_parameters;
+
+   bool stop_training = false;
+
+   time_t beginning_time, current_time;
+   time(&beginning_time);
+   double elapsed_time = 0.0;
+
+   results_pointer->resize_training_history(maximum_epochs_number + 1);
+
+   // Checkpoint, from which the training resumes with the state it had at the end of an epoch
+
+   TrainingCheckpoint checkpoint;
+
+   size_t first_epoch = 0;
+
+   if(load_checkpoint(checkpoint))
+   {
+       first_epoch = checkpoint.get_epoch();
+
+       parameters = checkpoint.get_vector("parameters");
+       parameters_norm = parameters.calculate_L2_norm();
+
+       neural_network_pointer->set_parameters(parameters);
+
+       moment_estimates.first_moment = checkpoint.get_vector("first_moment");
+       moment_estimates.second_moment = checkpoint.get_vector("second_moment");
+       moment_estimates.iteration = checkpoint.get_integer("moment_estimates_iteration");
+
+       old_selection_error = checkpoint.get_scalar("old_selection_error");
+
+       minimum_selection_error_parameters = checkpoint.get_vector("minimum_selection_error_parameters");
+       minimum_selection_error = checkpoint.get_scalar("minimum_selection_error");
+       selection_failures = checkpoint.get_integer("selection_failures");
+
+       batch_producer.set_generator_state(checkpoint.get_text("generator_state"));
+
+       // The selection error which was being calculated in the background is calculated again
+
+       if(checkpoint.has_vector("evaluated_parameters") && background_selection_error)
+       {
+           evaluated_parameters = checkpoint.get_vector("evaluated_parameters");
+           evaluated_epoch = checkpoint.get_integer("evaluated_epoch");
+
+           const LossIndex* selection_loss_index_pointer = loss_index_pointer;
+           const Vector<double> pending_parameters = evaluated_parameters;
+
+           selection_error_future = async(launch::async, [selection_loss_index_pointer, pending_parameters]()
+           {
+               return selection_loss_index_pointer->calculate_selection_error(pending_parameters);
+           });
+       }
+
+       beginning_time -= static_cast<time_t>(checkpoint.get_scalar("elapsed_time"));
+
+       if(display) cout << "Resuming training from epoch " << first_epoch << " of " << checkpoint_file_name << ".\n";
+   }
+
+   // Main loop
+
+   for(size_t epoch = first_epoch; epoch <= maximum_epochs_number; epoch++)
+   {
+       batch_producer.start_epoch();
+
+       // With MPI, all the processes run the number of iterations of the process with most batches
+
+       const size_t batches_number = loss_index_pointer->maximum_MPI(batch_producer.get_batches_number());
+
+       batches_errors.set(batches_number, 0.0);
+       batches_instances_numbers.set(batches_number, 0);
+
+       for(size_t iteration = 0; iteration < batches_number; iteration++)
+       {
+           if(!batch_producer.get_next_batch(batch))
+           {
+               batch = BatchProducer::Batch();
+           }
+
+           // Loss and gradient, from a single forward and backward propagation of the batch
+
+           const LossIndex::FirstOrderError first_order_error = loss_index_pointer->calculate_batch_first_order_error(batch.inputs, batch.targets);
+
+           batches_errors[iteration] = first_order_error.error;
+           batches_instances_numbers[iteration] = batch.inputs.get_rows_number();
+
+           gradient = first_order_error.gradient;
+
+           gradient_norm = gradient.calculate_L2_norm();
+
+           if(display && gradient_norm >= warning_gradient_norm) cout << "OpenNN Warning: Gradient norm is " << gradient_norm << ".\n";
+
+           update_parameters(gradient, moment_estimates, parameters);
+
+           neural_network_pointer->set_parameters(parameters);
+       }
+
+       parameters_norm = parameters.calculate_L2_norm();
+
+       if(display && parameters_norm >= warning_parameters_norm) cout << "OpenNN Warning: Parameters norm is " << parameters_norm << ".\n";
+
+       // Loss
+
+       if(reuse_batch_errors)
+       {
+           training_error = loss_index_pointer->combine_batch_errors(batches_errors, batches_instances_numbers);
+       }
+       else
+       {
+           training_error = loss_index_pointer->calculate_training_error();
+       }
+
+       // Selection error. When it is calculated asynchronously, the one available here belongs to the previous epoch
+
+       size_t selection_epoch = epoch;
+       bool selection_error_available = true;
+
+       if(background_selection_error)
+       {
+           selection_error_available = selection_error_future.valid();
+
+           if(selection_error_available)
+           {
+               selection_error = selection_error_future.get();
+               selection_parameters.swap(evaluated_parameters);
+               selection_epoch = evaluated_epoch;
+           }
+
+           evaluated_parameters = parameters;
+           evaluated_epoch = epoch;
+
+           const LossIndex* selection_loss_index_pointer = loss_index_pointer;
+           const Vector<double> pending_parameters = evaluated_parameters;
+
+           selection_error_future = async(launch::async, [selection_loss_index_pointer, pending_parameters]()
+           {
+               return selection_loss_index_pointer->calculate_selection_error(pending_parameters);
+           });
+       }
+       else
+       {
+           if(selection_instances_number > 0) selection_error = loss_index_pointer->calculate_selection_error();
+
+           selection_parameters = parameters;
+       }
+
+       if(selection_error_available)
+       {
+           if(selection_epoch != 0 && selection_error > old_selection_error)
+           {
+              selection_failures++;
+           }
+
+           if(selection_epoch == 0 || selection_error <= minimum_selection_error)
+           {
+              minimum_selection_error = selection_error;
+              minimum_selection_error_parameters = selection_parameters;
+           }
+       }
+
+       // Elapsed time
+
+       time(&current_time);
+       elapsed_time = difftime(current_time, beginning_time);
+
+       // Training history
+
+       if(reserve_parameters_norm_history) results_pointer->parameters_norm_history[epoch - first_epoch] = parameters_norm;
+
+       if(parameters_history_sink) parameters_history_sink->record(epoch, parameters);
+
+       if(gradient_history_sink) gradient_history_sink->record(epoch, gradient);
+
+       if(reserve_loss_history) results_pointer->loss_history[epoch - first_epoch] = training_error;
+
+       if(reserve_selection_error_history && selection_error_available && selection_epoch >= first_epoch) results_pointer->selection_error_history[selection_epoch - first_epoch] = selection_error;
+
+       if(reserve_gradient_norm_history) results_pointer->gradient_norm_history[epoch - first_epoch] = gradient_norm;
+
+       if(reserve_elapsed_time_history) results_pointer->elapsed_time_history[epoch - first_epoch] = elapsed_time;
+
+       // Stopping Criteria
+
+       if(training_error <= loss_goal)
+       {
+          if(display)
+          {
+             cout << "Epoch " << epoch << ": Loss goal reached.\n";
+          }
+
+          stop_training = true;
+
+          results_pointer->stopping_condition = LossGoal;
+       }
+
+       else if(selection_failures >= maximum_selection_failures && apply_early_stopping)
+       {
+          if(display)
+          {
+             cout << "Epoch " << epoch << ": Maximum selection failures reached.\n"
+                  << "Selection failures: " << selection_failures << endl;
+          }
+
+          stop_training = true;
+
+          results_pointer->stopping_condition = MaximumSelectionLossIncreases;
+       }
+
+       else if(epoch == maximum_epochs_number)
+       {
+          if(display)
+          {
+             cout << "Epoch " << epoch << ": Maximum number of epochs reached.\n";
+          }
+
+          stop_training = true;
+
+          results_pointer->stopping_condition = MaximumIterationsNumber;
+       }
+
+       else if(elapsed_time >= maximum_time)
+       {
+          if(display)
+          {
+             cout << "Epoch " << epoch << ": Maximum training time reached.\n";
+          }
+
+          stop_training = true;
+
+          results_pointer->stopping_condition = MaximumTime;
+       }
+
+       if(epoch != 0 && epoch % save_period == 0)
+       {
+          neural_network_pointer->save(neural_network_file_name);
+       }
+
+       if(stop_training)
+       {
+          if(display)
+          {
+             cout << "Parameters norm: " << parameters_norm << "\n"
+                  << "Training loss: " << training_error << "\n"
+                  << "Batch size: " << training_batch_size << "\n"
+                  << "Gradient norm: " << gradient_norm << "\n"
+                  << loss_index_pointer->write_information()
+                  << "Learning rate: " << learning_rate << "\n"
+                  << "Elapsed time: " << write_elapsed_time(elapsed_time) << "\n"
+                  << "Selection error: " << selection_error << endl;
+          }
+
+          results_pointer->resize_training_history(1 + epoch - first_epoch);
+
+          results_pointer->epochs_number = epoch;
+
+          break;
+       }
+       else if(display && epoch % display_period == 0)
+       {
+          cout << "Epoch " << epoch << ";\n"
+               << "Parameters norm: " << parameters_norm << "\n"
+               << "Training loss: " << training_error << "\n"
+               << "Batch size: " << training_batch_size << "\n"
+               << "Gradient norm: " << gradient_norm << "\n"
+               << loss_index_pointer->write_information()
+               << "Learning rate: " << learning_rate << "\n"
+               << "Elapsed time: " << write_elapsed_time(elapsed_time) << "\n"
+               << "Selection error: " << selection_error << endl;
+       }
+
+       // Update stuff
+
+       old_selection_error = selection_error;
+
+       // Checkpoint
+
+       if(is_checkpoint_epoch(epoch))
+       {
+           checkpoint.set();
+
+           checkpoint.set_training_algorithm_type(write_training_algorithm_type());
+           checkpoint.set_epoch(epoch+1);
+
+           checkpoint.set_vector("parameters", parameters);
+
+           checkpoint.set_vector("first_moment", moment_estimates.first_moment);
+           checkpoint.set_vector("second_moment", moment_estimates.second_moment);
+           checkpoint.set_integer("moment_estimates_iteration", moment_estimates.iteration);
+
+           checkpoint.set_scalar("old_selection_error", old_selection_error);
+
+           checkpoint.set_vector("minimum_selection_error_parameters", minimum_selection_error_parameters);
+           checkpoint.set_scalar("minimum_selection_error", minimum_selection_error);
+           checkpoint.set_integer("selection_failures", selection_failures);
+
+           checkpoint.set_text("generator_state", batch_producer.write_generator_state());
+
+           if(selection_error_future.valid())
+           {
+               checkpoint.set_vector("evaluated_parameters", evaluated_parameters);
+               checkpoint.set_integer("evaluated_epoch", evaluated_epoch);
+           }
+
+           checkpoint.set_scalar("elapsed_time", elapsed_time);
+
+           save_checkpoint(checkpoint);
+       }
+   }
+
+   wait_checkpoint();
+
+   // Selection error of the last epoch, when it is calculated asynchronously
+
+   if(selection_error_future.valid())
+   {
+       selection_error = selection_error_future.get();
+
+       if(reserve_selection_error_history && evaluated_epoch >= first_epoch && evaluated_epoch - first_epoch < results_pointer->selection_error_history.size())
+       {
+           results_pointer->selection_error_history[evaluated_epoch - first_epoch] = selection_error;
+       }
+
+       if(evaluated_epoch == 0 || selection_error <= minimum_selection_error)
+       {
+           minimum_selection_error = selection_error;
+           minimum_selection_error_parameters = evaluated_parameters;
+       }
+   }
+
+   if(return_minimum_selection_error_neural_network)
+   {
+       parameters = minimum_selection_error_parameters;
+       parameters_norm = parameters.calculate_L2_norm();
+
+       neural_network_pointer->set_parameters(parameters);
+
+       selection_error = minimum_selection_error;
+   }
+
+   results_pointer->final_parameters = parameters;
+   results_pointer->final_parameters_norm = parameters_norm;
+
+   results_pointer->final_loss = training_error;
+   results_pointer->final_selection_error = selection_error;
+
+   results_pointer->final_gradient_norm = gradient_norm;
+
+   results_pointer->elapsed_time = elapsed_time;
+
+   return(results_pointer);
+}
+
+
+/// Trains the neural network and discards the results structure.
+
+void AdaptiveMomentEstimation::perform_training_void()
+{
+    AdaptiveMomentEstimationResults* results = perform_training();
+
+    delete results;
+}
+
+
+/// Returns a string with the type of this training algorithm.
+
+string AdaptiveMomentEstimation::write_training_algorithm_type() const
+{
+   return("ADAPTIVE_MOMENT_ESTIMATION");
+}
+
+
+/// Writes as matrix of strings the most representative atributes.
+
+Matrix<string> AdaptiveMomentEstimation::to_string_matrix() const
+{
+   ostringstream buffer;
+
+   Vector<string> labels;
+   Vector<string> values;
+
+   // Adaptive method
+
+   labels.push_back("Adaptive method");
+
+   values.push_back(write_adaptive_method());
+
+   // Learning rate
+
+   labels.push_back("Learning rate");
+
+   buffer.str("");
+   buffer << learning_rate;
+
+   values.push_back(buffer.str());
+
+   // Batch size
+
+   labels.push_back("Batch size");
+
+   buffer.str("");
+   buffer << training_batch_size;
+
+   values.push_back(buffer.str());
+
+   // Loss goal
+
+   labels.push_back("Loss goal");
+
+   buffer.str("");
+   buffer << loss_goal;
+
+   values.push_back(buffer.str());
+
+   // Maximum selection error increases
+
+   labels.push_back("Maximum selection error increases");
+
+   buffer.str("");
+   buffer << maximum_selection_failures;
+
+   values.push_back(buffer.str());
+
+   // Maximum epochs number
+
+   labels.push_back("Maximum epochs number");
+
+   buffer.str("");
+   buffer << maximum_epochs_number;
+
+   values.push_back(buffer.str());
+
+   // Maximum time
+
+   labels.push_back("Maximum time");
+
+   buffer.str("");
+   buffer << maximum_time;
+
+   values.push_back(buffer.str());
+
+   // Reserve loss history
+
+   labels.push_back("Reserve loss history");
+
+   buffer.str("");
+
+   if(reserve_loss_history)
+   {
+       buffer << "true";
+   }
+   else
+   {
+       buffer << "false";
+   }
+
+   values.push_back(buffer.str());
+
+   // Reserve selection error history
+
+   labels.push_back("Reserve selection error history");
+
+   buffer.str("");
+
+   if(reserve_selection_error_history)
+   {
+       buffer << "true";
+   }
+   else
+   {
+       buffer << "false";
+   }
+
+   values.push_back(buffer.str());
+
+   const size_t rows_number = labels.size();
+   const size_t columns_number = 2;
+
+   Matrix<string> string_matrix(rows_number, columns_number);
+
+   string_matrix.set_column(0, labels, "name");
+   string_matrix.set_column(1, values, "value");
+
+   return(string_matrix);
+}
+
+
+/// Serializes the training operators, the training parameters, the stopping criteria and other user stuff
+/// concerning the adaptive moment estimation object.
+
+tinyxml2::XMLDocument* AdaptiveMomentEstimation::to_XML() const
+{
+   tinyxml2::XMLDocument* document = new tinyxml2::XMLDocument;
+
+   // Training algorithm
+
+   tinyxml2::XMLElement* root_element = document->NewElement("AdaptiveMomentEstimation");
+
+   document->InsertFirstChild(root_element);
+
+   // The elements are the same as those written without keeping the DOM tree in memory
+
+   tinyxml2::XMLPrinter file_stream;
+
+   write_XML(file_stream);
+
+   tinyxml2::XMLDocument elements_document;
+
+   elements_document.Parse(file_stream.CStr());
+
+   for(const tinyxml2::XMLNode* node = elements_document.FirstChild(); node; node = node->NextSibling())
+   {
+       root_element->InsertEndChild(node->DeepClone(document));
+   }
+
+   return(document);
+}
+
+
+/// Serializes the adaptive moment estimation object into a XML document of the TinyXML library without keep the DOM tree in memory.
+/// See the OpenNN manual for more information about the format of this document.
+
+void AdaptiveMomentEstimation::write_XML(tinyxml2::XMLPrinter& file_stream) const
+{
+    ostringstream buffer;
+
+    // Adaptive method
+
+    file_stream.OpenElement("AdaptiveMethod");
+
+    file_stream.PushText(write_adaptive_method().c_str());
+
+    file_stream.CloseElement();
+
+    // Learning rate
+
+    file_stream.OpenElement("LearningRate");
+
+    buffer.str("");
+    buffer << learning_rate;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Beta 1
+
+    file_stream.OpenElement("Beta1");
+
+    buffer.str("");
+    buffer << beta_1;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Beta 2
+
+    file_stream.OpenElement("Beta2");
+
+    buffer.str("");
+    buffer << beta_2;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Decay rate
+
+    file_stream.OpenElement("DecayRate");
+
+    buffer.str("");
+    buffer << decay_rate;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Epsilon
+
+    file_stream.OpenElement("Epsilon");
+
+    buffer.str("");
+    buffer << epsilon;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Weight decay
+
+    file_stream.OpenElement("WeightDecay");
+
+    buffer.str("");
+    buffer << weight_decay;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Batch size
+
+    file_stream.OpenElement("BatchSize");
+
+    buffer.str("");
+    buffer << training_batch_size;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Shuffle
+
+    file_stream.OpenElement("Shuffle");
+
+    buffer.str("");
+    buffer << shuffle;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Shuffle block size
+
+    file_stream.OpenElement("ShuffleBlockSize");
+
+    buffer.str("");
+    buffer << shuffle_block_size;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Prefetched batches number
+
+    file_stream.OpenElement("PrefetchedBatchesNumber");
+
+    buffer.str("");
+    buffer << prefetched_batches_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Shuffle seed
+
+    file_stream.OpenElement("ShuffleSeed");
+
+    buffer.str("");
+    buffer << shuffle_seed;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Asynchronous selection error
+
+    file_stream.OpenElement("AsynchronousSelectionError");
+
+    buffer.str("");
+    buffer << asynchronous_selection_error;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Reuse batch errors
+
+    file_stream.OpenElement("ReuseBatchErrors");
+
+    buffer.str("");
+    buffer << reuse_batch_errors;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Warning parameters norm
+
+    file_stream.OpenElement("WarningParametersNorm");
+
+    buffer.str("");
+    buffer << warning_parameters_norm;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Warning gradient norm
+
+    file_stream.OpenElement("WarningGradientNorm");
+
+    buffer.str("");
+    buffer << warning_gradient_norm;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Return minimum selection error neural network
+
+    file_stream.OpenElement("ReturnMinimumSelectionErrorNN");
+
+    buffer.str("");
+    buffer << return_minimum_selection_error_neural_network;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Apply early stopping
+
+    file_stream.OpenElement("ApplyEarlyStopping");
+
+    buffer.str("");
+    buffer << apply_early_stopping;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Loss goal
+
+    file_stream.OpenElement("LossGoal");
+
+    buffer.str("");
+    buffer << loss_goal;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Maximum selection error increases
+
+    file_stream.OpenElement("MaximumSelectionErrorIncreases");
+
+    buffer.str("");
+    buffer << maximum_selection_failures;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Maximum epochs number
+
+    file_stream.OpenElement("MaximumEpochsNumber");
+
+    buffer.str("");
+    buffer << maximum_epochs_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Maximum time
+
+    file_stream.OpenElement("MaximumTime");
+
+    buffer.str("");
+    buffer << maximum_time;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Reserve parameters norm history
+
+    file_stream.OpenElement("ReserveParametersNormHistory");
+
+    buffer.str("");
+    buffer << reserve_parameters_norm_history;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Reserve loss history
+
+    file_stream.OpenElement("ReserveLossHistory");
+
+    buffer.str("");
+    buffer << reserve_loss_history;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Reserve selection error history
+
+    file_stream.OpenElement("ReserveSelectionErrorHistory");
+
+    buffer.str("");
+    buffer << reserve_selection_error_history;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Reserve gradient norm history
+
+    file_stream.OpenElement("ReserveGradientNormHistory");
+
+    buffer.str("");
+    buffer << reserve_gradient_norm_history;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Reserve elapsed time history
+
+    file_stream.OpenElement("ReserveElapsedTimeHistory");
+
+    buffer.str("");
+    buffer << reserve_elapsed_time_history;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Display period
+
+    file_stream.OpenElement("DisplayPeriod");
+
+    buffer.str("");
+    buffer << display_period;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Display
+
+    file_stream.OpenElement("Display");
+
+    buffer.str("");
+    buffer << display;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+}
+
+
+/// Loads the members of this adaptive moment estimation object from a XML document.
+/// @param document TinyXML document with the members of an adaptive moment estimation object.
+
+void AdaptiveMomentEstimation::from_XML(const tinyxml2::XMLDocument& document)
+{
+   const tinyxml2::XMLElement* root_element = document.FirstChildElement("AdaptiveMomentEstimation");
+
+   if(!root_element)
+   {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: AdaptiveMomentEstimation class.\n"
+              << "void from_XML(const tinyxml2::XMLDocument&) method.\n"
+              << "Adaptive moment estimation element is nullptr.\n";
+
+       throw logic_error(buffer.str());
+   }
+
+   // Adaptive method
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("AdaptiveMethod");
+
+       if(element)
+       {
+          const string new_adaptive_method = element->GetText();
+
+          try
+          {
+             set_adaptive_method(new_adaptive_method);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Learning rate
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("LearningRate");
+
+       if(element)
+       {
+          const double new_learning_rate = atof(element->GetText());
+
+          try
+          {
+             set_learning_rate(new_learning_rate);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Beta 1
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("Beta1");
+
+       if(element)
+       {
+          const double new_beta_1 = atof(element->GetText());
+
+          try
+          {
+             set_beta_1(new_beta_1);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Beta 2
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("Beta2");
+
+       if(element)
+       {
+          const double new_beta_2 = atof(element->GetText());
+
+          try
+          {
+             set_beta_2(new_beta_2);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Decay rate
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("DecayRate");
+
+       if(element)
+       {
+          const double new_decay_rate = atof(element->GetText());
+
+          try
+          {
+             set_decay_rate(new_decay_rate);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Epsilon
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("Epsilon");
+
+       if(element)
+       {
+          const double new_epsilon = atof(element->GetText());
+
+          try
+          {
+             set_epsilon(new_epsilon);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Weight decay
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("WeightDecay");
+
+       if(element)
+       {
+          const double new_weight_decay = atof(element->GetText());
+
+          try
+          {
+             set_weight_decay(new_weight_decay);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Batch size
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("BatchSize");
+
+       if(element)
+       {
+          const size_t new_batch_size = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_training_batch_size(new_batch_size);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Shuffle
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("Shuffle");
+
+       if(element)
+       {
+          const string new_shuffle = element->GetText();
+
+          try
+          {
+             set_shuffle(new_shuffle != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Shuffle block size
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ShuffleBlockSize");
+
+       if(element)
+       {
+          const size_t new_shuffle_block_size = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_shuffle_block_size(new_shuffle_block_size);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Prefetched batches number
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("PrefetchedBatchesNumber");
+
+       if(element)
+       {
+          const size_t new_prefetched_batches_number = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_prefetched_batches_number(new_prefetched_batches_number);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Shuffle seed
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ShuffleSeed");
+
+       if(element)
+       {
+          const unsigned new_shuffle_seed = static_cast<unsigned>(atoi(element->GetText()));
+
+          try
+          {
+             set_shuffle_seed(new_shuffle_seed);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Asynchronous selection error
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("AsynchronousSelectionError");
+
+       if(element)
+       {
+          const bool new_asynchronous_selection_error = element->GetText() != string("0");
+
+          try
+          {
+             set_asynchronous_selection_error(new_asynchronous_selection_error);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Reuse batch errors
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReuseBatchErrors");
+
+       if(element)
+       {
+          const bool new_reuse_batch_errors = element->GetText() != string("0");
+
+          try
+          {
+             set_reuse_batch_errors(new_reuse_batch_errors);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Warning parameters norm
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarningParametersNorm");
+
+       if(element)
+       {
+          const double new_warning_parameters_norm = atof(element->GetText());
+
+          try
+          {
+             set_warning_parameters_norm(new_warning_parameters_norm);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Warning gradient norm
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarningGradientNorm");
+
+       if(element)
+       {
+          const double new_warning_gradient_norm = atof(element->GetText());
+
+          try
+          {
+             set_warning_gradient_norm(new_warning_gradient_norm);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Return minimum selection error neural network
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReturnMinimumSelectionErrorNN");
+
+       if(element)
+       {
+          const string new_return_minimum_selection_error_neural_network = element->GetText();
+
+          try
+          {
+             set_return_minimum_selection_error_neural_network(new_return_minimum_selection_error_neural_network != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Apply early stopping
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ApplyEarlyStopping");
+
+       if(element)
+       {
+          const string new_apply_early_stopping = element->GetText();
+
+          try
+          {
+             set_apply_early_stopping(new_apply_early_stopping != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Loss goal
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("LossGoal");
+
+       if(element)
+       {
+          const double new_loss_goal = atof(element->GetText());
+
+          try
+          {
+             set_loss_goal(new_loss_goal);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Maximum selection error increases
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("MaximumSelectionErrorIncreases");
+
+       if(element)
+       {
+          const size_t new_maximum_selection_failures = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_maximum_selection_failures(new_maximum_selection_failures);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Maximum epochs number
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("MaximumEpochsNumber");
+
+       if(element)
+       {
+          const size_t new_maximum_epochs_number = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_maximum_epochs_number(new_maximum_epochs_number);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Maximum time
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("MaximumTime");
+
+       if(element)
+       {
+          const double new_maximum_time = atof(element->GetText());
+
+          try
+          {
+             set_maximum_time(new_maximum_time);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Reserve parameters norm history
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReserveParametersNormHistory");
+
+       if(element)
+       {
+          const string new_reserve_parameters_norm_history = element->GetText();
+
+          try
+          {
+             set_reserve_parameters_norm_history(new_reserve_parameters_norm_history != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Reserve loss history
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReserveLossHistory");
+
+       if(element)
+       {
+          const string new_reserve_loss_history = element->GetText();
+
+          try
+          {
+             set_reserve_loss_history(new_reserve_loss_history != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Reserve selection error history
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReserveSelectionErrorHistory");
+
+       if(element)
+       {
+          const string new_reserve_selection_error_history = element->GetText();
+
+          try
+          {
+             set_reserve_selection_error_history(new_reserve_selection_error_history != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Reserve gradient norm history
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReserveGradientNormHistory");
+
+       if(element)
+       {
+          const string new_reserve_gradient_norm_history = element->GetText();
+
+          try
+          {
+             set_reserve_gradient_norm_history(new_reserve_gradient_norm_history != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Reserve elapsed time history
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReserveElapsedTimeHistory");
+
+       if(element)
+       {
+          const string new_reserve_elapsed_time_history = element->GetText();
+
+          try
+          {
+             set_reserve_elapsed_time_history(new_reserve_elapsed_time_history != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Display period
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("DisplayPeriod");
+
+       if(element)
+       {
+          const size_t new_display_period = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_display_period(new_display_period);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Display
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("Display");
+
+       if(element)
+       {
+          const string new_display = element->GetText();
+
+          try
+          {
+             set_display(new_display != "0");
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
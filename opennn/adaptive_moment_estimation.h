@@ -0,0 +1,452 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   A D A P T I V E   M O M E N T   E S T I M A T I O N   C L A S S   H E A D E R                              */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __ADAPTIVEMOMENTESTIMATION_H__
+#define __ADAPTIVEMOMENTESTIMATION_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <cmath>
+#include <ctime>
+#include <future>
+
+// OpenNN includes
+
+#include "loss_index.h"
+
+#include "training_algorithm.h"
+#include "batch_producer.h"
+
+
+namespace OpenNN
+{
+
+/// This concrete class represents the adaptive training algorithms based on mini-batches,
+/// which scale the step of each parameter by running estimates of the moments of its gradient.
+/// The available methods are Adam, AdamW, RMSProp and AdaGrad.
+
+class AdaptiveMomentEstimation : public TrainingAlgorithm
+{
+
+public:
+
+   // ENUMERATIONS
+
+   /// Enumeration of the available rules for updating the parameters from the moment estimates.
+
+   enum AdaptiveMethod{ADAM, ADAMW, RMSPROP, ADAGRAD};
+
+   // DEFAULT CONSTRUCTOR
+
+   explicit AdaptiveMomentEstimation();
+
+   // LOSS INDEX CONSTRUCTOR
+
+   explicit AdaptiveMomentEstimation(LossIndex*);
+
+   // XML CONSTRUCTOR
+
+   explicit AdaptiveMomentEstimation(const tinyxml2::XMLDocument&);
+
+   // DESTRUCTOR
+
+   virtual ~AdaptiveMomentEstimation();
+
+   // STRUCTURES
+
+   ///
+   /// This structure contains the moment estimates of the gradient for each parameter.
+   /// They are kept between training steps and updated in place.
+   ///
+
+   struct MomentEstimates
+   {
+       /// Sets the moment estimates of a number of parameters to zero.
+
+       void set(const size_t&);
+
+       /// Exponential moving average of the gradient.
+
+       Vector<double> first_moment;
+
+       /// Exponential moving average, or sum for AdaGrad, of the squared gradient.
+
+       Vector<double> second_moment;
+
+       /// Number of updates performed, used for the bias correction of Adam.
+
+       size_t iteration = 0;
+   };
+
+   ///
+   /// This structure contains the training results for the adaptive moment estimation.
+   ///
+
+   struct AdaptiveMomentEstimationResults : public TrainingAlgorithm::TrainingAlgorithmResults
+   {
+       /// Default constructor.
+
+       AdaptiveMomentEstimationResults()
+       {
+           adaptive_moment_estimation_pointer = nullptr;
+       }
+
+       /// Adaptive moment estimation constructor.
+
+       AdaptiveMomentEstimationResults(AdaptiveMomentEstimation* new_adaptive_moment_estimation_pointer)
+       {
+           adaptive_moment_estimation_pointer = new_adaptive_moment_estimation_pointer;
+       }
+
+       /// Destructor.
+
+       virtual ~AdaptiveMomentEstimationResults()
+       {
+       }
+
+       /// Pointer to the adaptive moment estimation object for which the training results are to be stored.
+
+      AdaptiveMomentEstimation* adaptive_moment_estimation_pointer;
+
+      // Training history
+
+      /// History of the parameters norm over the training epochs.
+
+      Vector<double> parameters_norm_history;
+
+      /// History of the loss function loss over the training epochs.
+
+      Vector<double> loss_history;
+
+      /// History of the selection error over the training epochs.
+
+      Vector<double> selection_error_history;
+
+      /// History of the gradient norm of the last batch over the training epochs.
+
+      Vector<double> gradient_norm_history;
+
+      /// History of the elapsed time over the training epochs.
+
+      Vector<double> elapsed_time_history;
+
+      // Final values
+
+      /// Final neural network parameters vector.
+
+      Vector<double> final_parameters;
+
+      /// Final neural network parameters norm.
+
+      double final_parameters_norm;
+
+      /// Final loss function evaluation.
+
+      double final_loss;
+
+      /// Final selection error.
+
+      double final_selection_error;
+
+      /// Final gradient norm.
+
+      double final_gradient_norm;
+
+      /// Elapsed time of the training process.
+
+      double elapsed_time;
+
+      /// Number of training epochs.
+
+      size_t epochs_number;
+
+      void resize_training_history(const size_t&);
+
+      string object_to_string() const;
+
+      Matrix<string> write_final_results(const int& precision = 3) const;
+   };
+
+   // METHODS
+
+   // Training operators
+
+   const AdaptiveMethod& get_adaptive_method() const;
+   string write_adaptive_method() const;
+
+   // Training parameters
+
+   const double& get_learning_rate() const;
+   const double& get_beta_1() const;
+   const double& get_beta_2() const;
+   const double& get_decay_rate() const;
+   const double& get_epsilon() const;
+   const double& get_weight_decay() const;
+
+   const double& get_warning_parameters_norm() const;
+   const double& get_warning_gradient_norm() const;
+
+   // Stopping criteria
+
+   const double& get_loss_goal() const;
+   const size_t& get_maximum_selection_failures() const;
+
+   const size_t& get_maximum_epochs_number() const;
+   const double& get_maximum_time() const;
+
+   const bool& get_return_minimum_selection_error_neural_network() const;
+   const bool& get_apply_early_stopping() const;
+
+   // Batches
+
+   const bool& get_shuffle() const;
+   const size_t& get_shuffle_block_size() const;
+   const size_t& get_prefetched_batches_number() const;
+   const unsigned& get_shuffle_seed() const;
+
+   // Epoch evaluation
+
+   const bool& get_asynchronous_selection_error() const;
+   const bool& get_reuse_batch_errors() const;
+
+   // Reserve training history
+
+   const bool& get_reserve_parameters_norm_history() const;
+   const bool& get_reserve_loss_history() const;
+   const bool& get_reserve_selection_error_history() const;
+   const bool& get_reserve_gradient_norm_history() const;
+   const bool& get_reserve_elapsed_time_history() const;
+
+   // Set methods
+
+   void set_default();
+
+   void set_reserve_all_training_history(const bool&);
+
+   // Training operators
+
+   void set_adaptive_method(const AdaptiveMethod&);
+   void set_adaptive_method(const string&);
+
+   // Training parameters
+
+   void set_learning_rate(const double&);
+   void set_beta_1(const double&);
+   void set_beta_2(const double&);
+   void set_decay_rate(const double&);
+   void set_epsilon(const double&);
+   void set_weight_decay(const double&);
+
+   void set_warning_parameters_norm(const double&);
+   void set_warning_gradient_norm(const double&);
+
+   // Stopping criteria
+
+   void set_loss_goal(const double&);
+   void set_maximum_selection_failures(const size_t&);
+
+   void set_maximum_epochs_number(const size_t&);
+   void set_maximum_time(const double&);
+
+   void set_return_minimum_selection_error_neural_network(const bool&);
+   void set_apply_early_stopping(const bool&);
+
+   // Batches
+
+   void set_shuffle(const bool&);
+   void set_shuffle_block_size(const size_t&);
+   void set_prefetched_batches_number(const size_t&);
+   void set_shuffle_seed(const unsigned&);
+
+   // Epoch evaluation
+
+   void set_asynchronous_selection_error(const bool&);
+   void set_reuse_batch_errors(const bool&);
+
+   // Reserve training history
+
+   void set_reserve_parameters_norm_history(const bool&);
+   void set_reserve_loss_history(const bool&);
+   void set_reserve_selection_error_history(const bool&);
+   void set_reserve_gradient_norm_history(const bool&);
+   void set_reserve_elapsed_time_history(const bool&);
+
+   // Training methods
+
+   void update_parameters(const Vector<double>&, MomentEstimates&, Vector<double>&) const;
+
+   AdaptiveMomentEstimationResults* perform_training();
+
+   void perform_training_void();
+
+   string write_training_algorithm_type() const;
+
+   // Serialization methods
+
+   Matrix<string> to_string_matrix() const;
+
+   tinyxml2::XMLDocument* to_XML() const;
+   void from_XML(const tinyxml2::XMLDocument&);
+
+   void write_XML(tinyxml2::XMLPrinter&) const;
+
+private:
+
+   // TRAINING OPERATORS
+
+   /// Rule for updating the parameters from the moment estimates.
+
+   AdaptiveMethod adaptive_method;
+
+   // TRAINING PARAMETERS
+
+   /// Step size of the parameters updates.
+
+   double learning_rate;
+
+   /// Decay rate of the first moment estimates of Adam and AdamW.
+
+   double beta_1;
+
+   /// Decay rate of the second moment estimates of Adam and AdamW.
+
+   double beta_2;
+
+   /// Decay rate of the second moment estimates of RMSProp.
+
+   double decay_rate;
+
+   /// Small constant added to the square root of the second moment, which avoids divisions by zero.
+
+   double epsilon;
+
+   /// Decoupled weight decay of AdamW, relative to the learning rate.
+
+   double weight_decay;
+
+   /// Value for the parameters norm at which a warning message is written to the screen.
+
+   double warning_parameters_norm;
+
+   /// Value for the gradient norm at which a warning message is written to the screen.
+
+   double warning_gradient_norm;
+
+   // BATCHES
+
+   /// True if the training instances are shuffled at the beginning of each epoch, false otherwise.
+
+   bool shuffle;
+
+   /// Number of consecutive training instances which are shuffled together.
+
+   size_t shuffle_block_size;
+
+   /// Number of batches gathered on a background thread ahead of the batch being trained.
+
+   size_t prefetched_batches_number;
+
+   /// Seed of the random number generator used for shuffling the training instances.
+
+   unsigned shuffle_seed;
+
+   // EPOCH EVALUATION
+
+   /// True if the selection error of each epoch is calculated on a background thread while the next epoch is trained, false otherwise.
+   /// The selection error of an epoch is then known at the end of the following one,
+   /// so that early stopping and the minimum selection error neural network lag one epoch behind.
+
+   bool asynchronous_selection_error;
+
+   /// True if the training error of each epoch is estimated from the errors of its batches,
+   /// false if it is calculated again over all the training instances.
+
+   bool reuse_batch_errors;
+
+   // STOPPING CRITERIA
+
+   /// Goal value for the loss. It is used as a stopping criterion.
+
+   double loss_goal;
+
+   /// Maximum number of epochs at which the selection error increases.
+   /// This is an early stopping method for improving selection.
+
+   size_t maximum_selection_failures;
+
+   /// Maximum number of epochs to perform_training. It is used as a stopping criterion.
+
+   size_t maximum_epochs_number;
+
+   /// Maximum training time. It is used as a stopping criterion.
+
+   double maximum_time;
+
+   /// True if the final model will be the neural network with the minimum selection error, false otherwise.
+
+   bool return_minimum_selection_error_neural_network;
+
+   /// True if the selection error increase stopping criteria has to be taken in account, false otherwise.
+
+   bool apply_early_stopping;
+
+   // TRAINING HISTORY
+
+   /// True if the parameters norm history vector is to be reserved, false otherwise.
+
+   bool reserve_parameters_norm_history;
+
+   /// True if the loss history vector is to be reserved, false otherwise.
+
+   bool reserve_loss_history;
+
+   /// True if the selection error history vector is to be reserved, false otherwise.
+
+   bool reserve_selection_error_history;
+
+   /// True if the gradient norm history vector is to be reserved, false otherwise.
+
+   bool reserve_gradient_norm_history;
+
+   /// True if the elapsed time history vector is to be reserved, false otherwise.
+
+   bool reserve_elapsed_time_history;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
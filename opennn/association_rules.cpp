@@ -161,6 +161,13 @@ Matrix<size_t> AssociationRules::calculate_combinations(const Vector<size_t>& it
     return(combinations);
 }
 
+/// Returns the support of every combination of a number of items.
+/// Each row contains the items of a combination, its frequency and its support in percentage,
+/// and the rows are sorted by descending frequency.
+/// The frequencies are counted with a frequent pattern tree, and the combinations which do not appear in any order have zero frequency.
+/// @param order_size Number of items of the combinations.
+/// @param items_index Items of the combinations. By default, all the items.
+
 Matrix<double> AssociationRules::calculate_support(const size_t& order_size, const Vector<size_t>& items_index) const
 {
     Vector<size_t> this_items_index = items_index;
@@ -190,46 +197,29 @@ Matrix<double> AssociationRules::calculate_support(const size_t& order_size, con
 
     const Matrix<size_t> combinations = calculate_combinations(this_items_index, order_size);
 
-    Vector<size_t> frequencies(combinations_number);
-
-    Vector<size_t> current_combination;
-
-    Vector<size_t> previous_combination;
-
-    Matrix<int> sub_matrix(orders_number,order_size);
+    const map< vector<size_t>, size_t > itemsets_frequencies = calculate_itemsets_frequencies(this_items_index, 1, order_size);
 
-    previous_combination = combinations.get_row(0);
-
-    for(size_t i = 0; i < order_size; i++)
-    {
-        const Vector<int> current_column = sparse_matrix.get_column(previous_combination[i]);
-
-        sub_matrix.set_column(i, current_column, "");
-    }
+    Vector<size_t> frequencies(combinations_number, 0);
 
-    frequencies[0] = sub_matrix.count_rows_equal_to(1);
-
-#pragma omp parallel for firstprivate(sub_matrix) private(current_combination,previous_combination)
+#pragma omp parallel for
 
-    for(int i = 1; i < static_cast<int>(combinations_number); i++)
+    for(int i = 0; i < static_cast<int>(combinations_number); i++)
     {
-        current_combination = combinations.get_row(static_cast<size_t>(i));
-
-        const Vector<size_t> intersection = current_combination.get_intersection(previous_combination);
+        vector<size_t> itemset(order_size);
 
         for(size_t j = 0; j < order_size; j++)
         {
-            if(!intersection.contains(current_combination[j]))
-            {
-                const Vector<int> current_column = sparse_matrix.get_column(current_combination[j]);
-
-                sub_matrix.set_column(j, current_column, "");
-            }
+            itemset[j] = combinations(static_cast<size_t>(i), j);
         }
 
-        frequencies[static_cast<size_t>(i)] = sub_matrix.count_rows_equal_to(1);
+        sort(itemset.begin(), itemset.end());
+
+        const map< vector<size_t>, size_t >::const_iterator iterator = itemsets_frequencies.find(itemset);
 
-        previous_combination = current_combination;
+        if(iterator != itemsets_frequencies.end())
+        {
+            frequencies[static_cast<size_t>(i)] = iterator->second;
+        }
     }
 
     const Vector<double> supports = frequencies.to_double_vector()*(100.0/static_cast<double>(orders_number));
@@ -250,6 +240,55 @@ Matrix<double> AssociationRules::calculate_support(const size_t& order_size, con
     return(support_data);
 }
 
+/// Returns the supports of the rows of a support matrix, indexed by their sorted items.
+/// @param support_data Support matrix, whose rows contain the items, the frequency and the support.
+/// @param order_size Number of items of each row.
+
+static map< vector<size_t>, double > get_supports(const Matrix<double>& support_data, const size_t& order_size)
+{
+    map< vector<size_t>, double > supports;
+
+    vector<size_t> itemset(order_size);
+
+    for(size_t i = 0; i < support_data.get_rows_number(); i++)
+    {
+        for(size_t j = 0; j < order_size; j++)
+        {
+            itemset[j] = static_cast<size_t>(support_data(i,j));
+        }
+
+        sort(itemset.begin(), itemset.end());
+
+        supports[itemset] = support_data(i,order_size+1);
+    }
+
+    return(supports);
+}
+
+
+/// Returns the support of some consecutive items of a row, or zero if they are not in a map of supports.
+/// @param supports Supports indexed by their sorted items.
+/// @param row Row which contains the items.
+/// @param first Position of the first item in the row.
+/// @param order_size Number of items.
+
+static double get_support(const map< vector<size_t>, double >& supports, const Vector<double>& row, const size_t& first, const size_t& order_size)
+{
+    vector<size_t> itemset(order_size);
+
+    for(size_t j = 0; j < order_size; j++)
+    {
+        itemset[j] = static_cast<size_t>(row[first+j]);
+    }
+
+    sort(itemset.begin(), itemset.end());
+
+    const map< vector<size_t>, double >::const_iterator iterator = supports.find(itemset);
+
+    return(iterator == supports.end() ? 0.0 : iterator->second);
+}
+
+
 Matrix<double> AssociationRules::calculate_confidence(const size_t& left_order_size, const size_t& right_order_size, const Vector<size_t>& items_index) const
 {
     Vector<size_t> this_items_index = items_index;
@@ -305,62 +344,22 @@ Matrix<double> AssociationRules::calculate_confidence(const size_t& left_order_s
 
     confidence_data.set(rows_number, columns_number);
 
-    const size_t total_support_rows = total_support.get_rows_number();
-    Vector<size_t> combination_indices(0,1,left_order_size+right_order_size-1);
+    const map< vector<size_t>, double > total_supports = get_supports(total_support, left_order_size+right_order_size);
+    const map< vector<size_t>, double > left_supports = get_supports(left_support, left_order_size);
 
 #pragma omp parallel for
 
-    for(int i = 0; i < rows_number; i++)
+    for(int i = 0; i < static_cast<int>(rows_number); i++)
     {
-        double current_total_support = 0.0;
-
-        for(size_t j = 0; j < total_support_rows; j++)
-        {
-            const Vector<double> current_combination = total_support.get_row(j,combination_indices);
+        const Vector<double>& current_row = rows_combinations[static_cast<size_t>(i)];
 
-            if(current_combination.has_same_elements(rows_combinations[i]))
-            {
-                current_total_support = total_support(j,left_order_size+right_order_size+1);
-
-                break;
-            }
-        }
+        double confidence = get_support(total_supports, current_row, 0, left_order_size+right_order_size);
 
-        confidence_data.set_row(i,rows_combinations[i].assemble(Vector<double>(1,current_total_support)));
-    }
-
-    Matrix<double> left_indices = confidence_data.get_submatrix_columns(Vector<size_t>(0,1,left_order_size-1));
-
-#pragma omp parallel for
-
-    for(int i = 0; i < rows_number; i++)
-    {
-        for(size_t j = 0; j < left_support.get_rows_number(); j++)
-        {
-            size_t found = 0;
-
-            for(size_t k = 0; k < left_order_size; k++)
-            {
-                if(fabs(left_indices(i,k) - left_support(j,k)) < std::numeric_limits<double>::min())
-                {
-                    found++;
-                }
-            }
+        const double current_left_support = get_support(left_supports, current_row, 0, left_order_size);
 
-            if(found == left_order_size)
-            {
-                if(left_support(j,left_order_size+1) != 0.0)
-                {
-                    confidence_data(i,left_order_size+right_order_size) /= left_support(j,left_order_size+1);
-                }
-                else
-                {
-                    confidence_data(i,left_order_size+right_order_size) = 0;
-                }
+        confidence = current_left_support != 0.0 ? confidence/current_left_support : 0.0;
 
-                break;
-            }
-        }
+        confidence_data.set_row(static_cast<size_t>(i), current_row.assemble(Vector<double>(1, confidence)));
     }
 
     confidence_data = confidence_data.sort_descending(left_order_size+right_order_size);
@@ -433,249 +432,437 @@ Matrix<double> AssociationRules::calculate_lift(const size_t& left_order_size, c
     const size_t columns_number = left_order_size + right_order_size + 1;
 
     lift_data.set(rows_number, columns_number);
-    Vector<size_t> combination_indices(0,1,left_order_size+right_order_size-1);
+
+    const map< vector<size_t>, double > total_supports = get_supports(total_support, left_order_size+right_order_size);
+    const map< vector<size_t>, double > left_supports = get_supports(left_support, left_order_size);
+    const map< vector<size_t>, double > right_supports = get_supports(right_support, right_order_size);
 
 #pragma omp parallel for
 
-    for(int i = 0; i < rows_number; i++)
+    for(int i = 0; i < static_cast<int>(rows_number); i++)
     {
-        double current_total_support = 0.0;
+        const Vector<double>& current_row = rows_combinations[static_cast<size_t>(i)];
 
-        for(size_t j = 0; j < total_support.get_rows_number(); j++)
-        {
-            const Vector<double> current_combination = total_support.get_row(j,combination_indices);
+        double lift = get_support(total_supports, current_row, 0, left_order_size+right_order_size);
 
-            if(current_combination.has_same_elements(rows_combinations[i]))
-            {
-                current_total_support = total_support(j,left_order_size+right_order_size+1);
+        const double current_left_support = get_support(left_supports, current_row, 0, left_order_size);
 
-                break;
-            }
-        }
+        lift = current_left_support != 0.0 ? lift/current_left_support : 0.0;
+
+        const double current_right_support = get_support(right_supports, current_row, left_order_size, right_order_size);
 
-        lift_data.set_row(i,rows_combinations[i].assemble(Vector<double>(1,current_total_support)));
+        lift = current_right_support != 0.0 ? lift/current_right_support : 0.0;
+
+        lift_data.set_row(static_cast<size_t>(i), current_row.assemble(Vector<double>(1, lift)));
     }
 
-    Matrix<double> left_indices = lift_data.get_submatrix_columns(Vector<size_t>(0,1,left_order_size-1));
-    Matrix<double> right_indices = lift_data.get_submatrix_columns(Vector<size_t>(left_order_size,1,left_order_size+right_order_size-1));
+    lift_data = lift_data.sort_descending(left_order_size+right_order_size);
 
-#pragma omp parallel for
+    return lift_data;
+}
+
+/// Returns the itemsets whose support is greater than the minimum support, for every number of items.
+/// Element i of the result contains the itemsets of i+1 items, in the format of calculate_support,
+/// sorted by descending frequency and then by items. The result ends with the last number of items that has some itemset.
+/// The itemsets are mined with the frequent pattern growth algorithm, without enumerating the combinations of items.
+/// @param maximum_order Maximum number of items of the itemsets. By default, all the items.
+
+Vector< Matrix<double> > AssociationRules::calculate_frequent_itemsets(const size_t& maximum_order) const
+{
+    const size_t items_number = sparse_matrix.get_columns_number();
+    const size_t orders_number = sparse_matrix.get_rows_number();
+
+    const size_t this_maximum_order = maximum_order == 0 ? items_number : maximum_order;
+
+    Vector< Matrix<double> > frequent_itemsets;
+
+    if(items_number == 0 || orders_number == 0 || this_maximum_order == 0)
+    {
+        return(frequent_itemsets);
+    }
+
+    const map< vector<size_t>, size_t > itemsets_frequencies
+            = calculate_itemsets_frequencies(Vector<size_t>(0, 1, items_number-1), calculate_minimum_frequency(), this_maximum_order);
 
-    for(int i = 0; i < rows_number; i++)
+    // Itemsets of each number of items
+
+    Vector< vector< pair<size_t, vector<size_t> > > > orders_itemsets(this_maximum_order);
+
+    for(map< vector<size_t>, size_t >::const_iterator iterator = itemsets_frequencies.begin(); iterator != itemsets_frequencies.end(); ++iterator)
+    {
+        orders_itemsets[iterator->first.size()-1].push_back(make_pair(iterator->second, iterator->first));
+    }
+
+    for(size_t order = 1; order <= this_maximum_order; order++)
     {
-        for(size_t j = 0; j < left_support.get_rows_number(); j++)
+        vector< pair<size_t, vector<size_t> > >& itemsets = orders_itemsets[order-1];
+
+        if(itemsets.empty() && order > 1)
         {
-            size_t found = 0;
+            break;
+        }
 
-            for(size_t k = 0; k < left_order_size; k++)
+        sort(itemsets.begin(), itemsets.end(),
+             [](const pair<size_t, vector<size_t> >& first, const pair<size_t, vector<size_t> >& second)
+             {
+                 return(first.first > second.first || (first.first == second.first && first.second < second.second));
+             });
+
+        Matrix<double> support_data(itemsets.size(), order+2);
+
+        for(size_t i = 0; i < itemsets.size(); i++)
+        {
+            for(size_t j = 0; j < order; j++)
             {
-                if(fabs(left_indices(i,k) - left_support(j,k)) < std::numeric_limits<double>::min())
-                {
-                    found++;
-                }
+                support_data(i,j) = static_cast<double>(itemsets[i].second[j]);
             }
 
-            if(found == left_order_size)
-            {
-                if(left_support(j,left_order_size+1) != 0.0)
-                {
-                    lift_data(i,left_order_size+right_order_size) /= left_support(j,left_order_size+1);
-                }
-                else
-                {
-                    lift_data(i,left_order_size+right_order_size) = 0;
-                }
+            support_data(i,order) = static_cast<double>(itemsets[i].first);
+            support_data(i,order+1) = static_cast<double>(itemsets[i].first)*(100.0/static_cast<double>(orders_number));
+        }
 
-                break;
-            }
+        frequent_itemsets.push_back(support_data);
+    }
+
+    return(frequent_itemsets);
+}
+
+
+/// Returns the smallest frequency whose support is greater than the minimum support, which is at least one.
+
+size_t AssociationRules::calculate_minimum_frequency() const
+{
+    const size_t orders_number = sparse_matrix.get_rows_number();
+
+    const double support_per_order = 100.0/static_cast<double>(orders_number);
+
+    size_t minimum_frequency = static_cast<size_t>(max(0.0, floor(minimum_support/support_per_order)));
+
+    while(minimum_frequency > 0 && static_cast<double>(minimum_frequency)*support_per_order > minimum_support)
+    {
+        minimum_frequency--;
+    }
+
+    while(static_cast<double>(minimum_frequency)*support_per_order <= minimum_support)
+    {
+        minimum_frequency++;
+    }
+
+    return(max(minimum_frequency, static_cast<size_t>(1)));
+}
+
+
+/// Builds a frequent pattern tree from a set of paths of ranks, sorted in ascending order.
+/// The ranks which appear in less than the minimum frequency of transactions are removed from the paths.
+/// @param paths Paths of ranks.
+/// @param paths_frequencies Number of transactions of each path.
+/// @param ranks_number Number of ranks, which are less than it.
+/// @param minimum_frequency Minimum number of transactions of a rank.
+
+AssociationRules::FrequentPatternTree AssociationRules::build_frequent_pattern_tree(const vector< vector<size_t> >& paths,
+                                                                                    const Vector<size_t>& paths_frequencies,
+                                                                                    const size_t& ranks_number,
+                                                                                    const size_t& minimum_frequency) const
+{
+    FrequentPatternTree tree;
+
+    tree.nodes.push_back(FrequentPatternNode());
+
+    tree.heads.set(ranks_number, 0);
+    tree.frequencies.set(ranks_number, 0);
+
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        for(size_t j = 0; j < paths[i].size(); j++)
+        {
+            tree.frequencies[paths[i][j]] += paths_frequencies[i];
         }
+    }
 
-        for(size_t j = 0; j < right_support.get_rows_number(); j++)
+    // Children of each node, indexed by parent and rank
+
+    unordered_map<unsigned long long, size_t> children;
+
+    Vector<size_t> tails(ranks_number, 0);
+
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        size_t node_index = 0;
+
+        for(size_t j = 0; j < paths[i].size(); j++)
         {
-            size_t found = 0;
+            const size_t rank = paths[i][j];
 
-            for(size_t k = 0; k < right_order_size; k++)
+            if(tree.frequencies[rank] < minimum_frequency)
             {
-                if(fabs(right_indices(i,k) - right_support(j,k)) < std::numeric_limits<double>::min())
-                {
-                    found++;
-                }
+                continue;
             }
 
-            if(found == right_order_size)
+            const unsigned long long key = static_cast<unsigned long long>(node_index)*ranks_number + rank;
+
+            const unordered_map<unsigned long long, size_t>::const_iterator iterator = children.find(key);
+
+            if(iterator != children.end())
+            {
+                node_index = iterator->second;
+            }
+            else
             {
-                if(right_support(j,right_order_size+1) != 0.0)
+                FrequentPatternNode node;
+
+                node.rank = rank;
+                node.parent = node_index;
+
+                tree.nodes.push_back(node);
+
+                const size_t child_index = tree.nodes.size()-1;
+
+                children[key] = child_index;
+
+                if(tree.heads[rank] == 0)
                 {
-                    lift_data(i,left_order_size+right_order_size) /= right_support(j,right_order_size+1);
+                    tree.heads[rank] = child_index;
                 }
                 else
                 {
-                    lift_data(i,left_order_size+right_order_size) = 0;
+                    tree.nodes[tails[rank]].next = child_index;
                 }
 
-                break;
+                tails[rank] = child_index;
+
+                node_index = child_index;
             }
+
+            tree.nodes[node_index].frequency += paths_frequencies[i];
         }
     }
 
-    lift_data = lift_data.sort_descending(left_order_size+right_order_size);
-
-    return lift_data;
+    return(tree);
 }
 
-Vector< Matrix<double> > AssociationRules::perform_a_priori_algorithm(const size_t& maximum_order)
+
+/// Adds the frequencies of the itemsets made of one rank of a tree and a suffix of items,
+/// and then mines the conditional tree of that rank for longer itemsets.
+/// The conditional pattern base of the rank are the paths from the root to its nodes, with their frequencies.
+/// @param tree Frequent pattern tree.
+/// @param rank Rank of the item added to the suffix.
+/// @param ranked_items Item of each rank.
+/// @param suffix Items of the itemsets whose conditional tree is being mined.
+/// @param minimum_frequency Minimum number of transactions of the itemsets.
+/// @param maximum_order Maximum number of items of the itemsets.
+/// @param itemsets_frequencies Frequencies of the itemsets, indexed by their sorted items.
+
+void AssociationRules::mine_frequent_pattern_tree(const FrequentPatternTree& tree,
+                                                  const size_t& rank,
+                                                  const Vector<size_t>& ranked_items,
+                                                  const vector<size_t>& suffix,
+                                                  const size_t& minimum_frequency,
+                                                  const size_t& maximum_order,
+                                                  map< vector<size_t>, size_t >& itemsets_frequencies) const
 {
-    size_t this_maximum_order = maximum_order;
+    vector<size_t> itemset(suffix);
+
+    itemset.push_back(ranked_items[rank]);
+
+    vector<size_t> sorted_itemset(itemset);
 
-    if(this_maximum_order == 0)
+    sort(sorted_itemset.begin(), sorted_itemset.end());
+
+    itemsets_frequencies[sorted_itemset] = tree.frequencies[rank];
+
+    if(itemset.size() >= maximum_order || rank == 0)
     {
-        this_maximum_order = sparse_matrix.get_columns_number();
+        return;
     }
 
-    SparseMatrix<int> copy_sparse_matrix(sparse_matrix);
+    // Conditional pattern base
 
-    Vector< Matrix<double> > most_frequent;
+    vector< vector<size_t> > paths;
+    Vector<size_t> paths_frequencies;
 
-    time_t beginning_time, current_time;
-    double elapsed_time;
+    for(size_t node_index = tree.heads[rank]; node_index != 0; node_index = tree.nodes[node_index].next)
+    {
+        vector<size_t> path;
 
-    time(&beginning_time);
+        for(size_t parent = tree.nodes[node_index].parent; parent != 0; parent = tree.nodes[parent].parent)
+        {
+            path.push_back(tree.nodes[parent].rank);
+        }
 
-    Matrix<double> this_order_support = calculate_support(1);
+        if(path.empty())
+        {
+            continue;
+        }
+
+        reverse(path.begin(), path.end());
 
-    Matrix<double> this_unfrequent_items = this_order_support.filter_column_less_than(2,minimum_support);
+        paths.push_back(path);
+        paths_frequencies.push_back(tree.nodes[node_index].frequency);
+    }
 
-    if(!this_unfrequent_items.empty())
+    if(paths.empty())
     {
-        this_unfrequent_items = this_unfrequent_items.get_submatrix_columns(Vector<size_t>(1,0));
+        return;
+    }
 
-        const size_t unfrequent_items_size = this_unfrequent_items.get_rows_number();
+    // The ranks of the paths are less than this one
 
-        Vector<size_t> rows_to_remove;
+    const FrequentPatternTree conditional_tree = build_frequent_pattern_tree(paths, paths_frequencies, rank, minimum_frequency);
 
-#pragma omp parallel for
-        for(int i = 0; i < unfrequent_items_size; i++)
+    for(size_t i = 0; i < rank; i++)
+    {
+        if(conditional_tree.heads[i] != 0)
         {
-            const Vector<size_t> this_rows_to_remove = sparse_matrix.get_row_indices_equal_to(this_unfrequent_items.get_row(i).to_size_t_vector(), 1);
-
-#pragma omp critical
-            {
-                rows_to_remove = rows_to_remove.assemble(this_rows_to_remove);
-            }
+            mine_frequent_pattern_tree(conditional_tree, i, ranked_items, itemset, minimum_frequency, maximum_order, itemsets_frequencies);
         }
+    }
+}
 
-        rows_to_remove = rows_to_remove.get_unique_elements();
 
-        sparse_matrix = sparse_matrix.delete_rows(rows_to_remove);
+/// Returns the frequencies of the itemsets which appear in a minimum number of orders.
+/// The orders are stored in a frequent pattern tree, with the items sorted by descending frequency,
+/// and the conditional trees of the items are mined in parallel.
+/// An order contains an item if the element of the sparse matrix is one.
+/// @param items_index Items of the itemsets.
+/// @param minimum_frequency Minimum number of orders of the itemsets. It must be greater than zero.
+/// @param maximum_order Maximum number of items of the itemsets.
+
+map< vector<size_t>, size_t > AssociationRules::calculate_itemsets_frequencies(const Vector<size_t>& items_index,
+                                                                               const size_t& minimum_frequency,
+                                                                               const size_t& maximum_order) const
+{
+    const size_t orders_number = sparse_matrix.get_rows_number();
+    const size_t items_number = sparse_matrix.get_columns_number();
+
+    const Vector<size_t>& rows_indices = sparse_matrix.get_rows_indices();
+    const Vector<size_t>& columns_indices = sparse_matrix.get_columns_indices();
+    const Vector<int>& matrix_values = sparse_matrix.get_matrix_values();
+
+    map< vector<size_t>, size_t > itemsets_frequencies;
+
+    if(maximum_order == 0)
+    {
+        return(itemsets_frequencies);
     }
 
-    this_order_support = this_order_support.filter_column_greater_than(2,minimum_support);
+    // Frequencies of the items
 
-    Vector<size_t> first_valid_indices = this_order_support.get_column(0).to_size_t_vector();
+    Vector<bool> selected_items(items_number, false);
 
-    most_frequent.push_back(this_order_support);
+    for(size_t i = 0; i < items_index.size(); i++)
+    {
+        selected_items[items_index[i]] = true;
+    }
 
-    time(&current_time);
-    elapsed_time = difftime(current_time, beginning_time);
+    Vector<size_t> items_frequencies(items_number, 0);
 
-    if(elapsed_time > maximum_time)
+    for(size_t i = 0; i < matrix_values.size(); i++)
     {
-        if(display)
+        if(matrix_values[i] == 1 && selected_items[columns_indices[i]])
         {
-            cout << "Maximum time reached\n";
-            cout << "Current order: 1\n";
-            cout << "Current frequent combinations: " << this_order_support.get_rows_number() << endl;
-            cout << "Elapsed time: " << elapsed_time << endl;
+            items_frequencies[columns_indices[i]]++;
         }
+    }
 
-        set_sparse_matrix(copy_sparse_matrix);
+    // Ranks of the frequent items, from the most frequent to the least frequent one
 
-        return most_frequent;
+    Vector<size_t> ranked_items;
+
+    for(size_t i = 0; i < items_number; i++)
+    {
+        if(selected_items[i] && items_frequencies[i] >= minimum_frequency)
+        {
+            ranked_items.push_back(i);
+        }
     }
 
-    if(display)
+    stable_sort(ranked_items.begin(), ranked_items.end(),
+                [&](const size_t& first, const size_t& second) { return(items_frequencies[first] > items_frequencies[second]); });
+
+    const size_t ranks_number = ranked_items.size();
+
+    if(ranks_number == 0)
     {
-        cout << "Current order: 1\n";
-        cout << "Current frequent combinations: " << this_order_support.get_rows_number() << endl;
-        cout << "Elapsed time: " << elapsed_time << endl;
+        return(itemsets_frequencies);
     }
 
+    Vector<size_t> items_ranks(items_number, ranks_number);
 
-    for(size_t current_order = 2; current_order <= this_maximum_order; current_order++)
+    for(size_t i = 0; i < ranks_number; i++)
     {
-        this_order_support = calculate_support(current_order, first_valid_indices);
+        items_ranks[ranked_items[i]] = i;
+    }
+
+    // Frequent pattern tree of the orders
 
-        this_unfrequent_items = this_order_support.filter_column_less_than(current_order+1,minimum_support);
+    vector< vector<size_t> > paths(orders_number);
 
-        if(!this_unfrequent_items.empty())
+    for(size_t i = 0; i < matrix_values.size(); i++)
+    {
+        if(matrix_values[i] == 1 && items_ranks[columns_indices[i]] < ranks_number)
         {
-            this_unfrequent_items = this_unfrequent_items.get_submatrix_columns(Vector<size_t>(0,1,current_order-1));
+            paths[rows_indices[i]].push_back(items_ranks[columns_indices[i]]);
+        }
+    }
 
-            const size_t unfrequent_items_size = this_unfrequent_items.get_rows_number();
+    for(size_t i = 0; i < orders_number; i++)
+    {
+        sort(paths[i].begin(), paths[i].end());
+    }
 
-            Vector<size_t> rows_to_remove;
+    const FrequentPatternTree tree = build_frequent_pattern_tree(paths, Vector<size_t>(orders_number, 1), ranks_number, minimum_frequency);
 
-#pragma omp parallel for
-            for(int i = 0; i < unfrequent_items_size; i++)
-            {
-                Vector<size_t> this_rows_to_remove = sparse_matrix.get_row_indices_equal_to(this_unfrequent_items.get_row(i).to_size_t_vector(), 1);
+    paths.clear();
 
-#pragma omp critical
-                {
-                    rows_to_remove = rows_to_remove.assemble(this_rows_to_remove);
-                }
-            }
+    // Conditional trees of the items
+
+#pragma omp parallel for schedule(dynamic)
+
+    for(int i = static_cast<int>(ranks_number)-1; i >= 0; i--)
+    {
+        map< vector<size_t>, size_t > rank_itemsets_frequencies;
 
-            rows_to_remove = rows_to_remove.get_unique_elements();
+        mine_frequent_pattern_tree(tree, static_cast<size_t>(i), ranked_items, vector<size_t>(), minimum_frequency, maximum_order, rank_itemsets_frequencies);
 
-            sparse_matrix = sparse_matrix.delete_rows(rows_to_remove);
+        #pragma omp critical
+        {
+            itemsets_frequencies.insert(rank_itemsets_frequencies.begin(), rank_itemsets_frequencies.end());
         }
+    }
 
-        this_order_support = this_order_support.filter_column_greater_than(current_order+1,minimum_support);
+    return(itemsets_frequencies);
+}
 
-        time(&current_time);
-        elapsed_time = difftime(current_time, beginning_time);
 
-        if(this_order_support.empty())
-        {
-            if(display)
-            {
-                cout << "No more frequent combinations." << endl;
-                cout << "Algorithm finished." << endl;
-                cout << "Elapsed time: " << elapsed_time << endl;
-            }
+/// Returns the itemsets whose support is greater than the minimum support, for every number of items.
+/// It calls calculate_frequent_itemsets, which mines them with the frequent pattern growth algorithm,
+/// and the supports are those of all the orders in the sparse matrix.
+/// @param maximum_order Maximum number of items of the itemsets. By default, all the items.
 
-            break;
-        }
+Vector< Matrix<double> > AssociationRules::perform_a_priori_algorithm(const size_t& maximum_order)
+{
+    time_t beginning_time, current_time;
 
-        most_frequent.push_back(this_order_support);
+    time(&beginning_time);
 
-        if(elapsed_time > maximum_time)
-        {
-            if(display)
-            {
-                cout << "Maximum time reached\n";
-                cout << "Current order: " << current_order << endl;
-                cout << "Current frequent combinations: " << this_order_support.get_rows_number() << endl;
-                cout << "Elapsed time: " << elapsed_time << endl;
-            }
+    const Vector< Matrix<double> > most_frequent = calculate_frequent_itemsets(maximum_order);
 
-            set_sparse_matrix(copy_sparse_matrix);
+    time(&current_time);
 
-            return most_frequent;
-        }
+    const double elapsed_time = difftime(current_time, beginning_time);
 
-        if(display)
+    if(display)
+    {
+        for(size_t i = 0; i < most_frequent.size(); i++)
         {
-            cout << "Current order: " << current_order << endl;
-            cout << "Current frequent combinations: " << this_order_support.get_rows_number() << endl;
-            cout << "Elapsed time: " << elapsed_time << endl;
+            cout << "Order: " << i+1 << "\n";
+            cout << "Frequent combinations: " << most_frequent[i].get_rows_number() << endl;
         }
 
+        cout << "Algorithm finished." << endl;
+        cout << "Elapsed time: " << elapsed_time << endl;
     }
 
-    set_sparse_matrix(copy_sparse_matrix);
-
     return most_frequent;
 }
 
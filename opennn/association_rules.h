@@ -22,6 +22,11 @@
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <ctime>
 
 // OpenNN includes
 
@@ -83,12 +88,67 @@ public:
 
     Matrix<double> calculate_lift(const size_t&, const size_t&, const Vector<size_t>& = Vector<size_t>()) const;
 
+    Vector< Matrix<double> > calculate_frequent_itemsets(const size_t& = 0) const;
+
     // Algorithms
 
     Vector< Matrix<double> > perform_a_priori_algorithm(const size_t& = 0);
 
 private:
 
+    ///
+    /// Node of a frequent pattern tree, which counts the transactions sharing the path from the root to it.
+    /// Items are identified by their rank, from the most frequent to the least frequent one.
+    ///
+
+    struct FrequentPatternNode
+    {
+        /// Rank of the item of the node.
+
+        size_t rank = 0;
+
+        /// Number of transactions whose path goes through the node.
+
+        size_t frequency = 0;
+
+        /// Index of the parent node.
+
+        size_t parent = 0;
+
+        /// Index of the next node with the same item, or zero for the last one.
+
+        size_t next = 0;
+    };
+
+    ///
+    /// Frequent pattern tree of a set of transactions, whose items are sorted by rank along each path.
+    /// The first node is the root, and the nodes of each item are linked in a list.
+    ///
+
+    struct FrequentPatternTree
+    {
+        /// Nodes of the tree.
+
+        vector<FrequentPatternNode> nodes;
+
+        /// First node of each rank, or zero if there is none.
+
+        Vector<size_t> heads;
+
+        /// Number of transactions which contain each rank.
+
+        Vector<size_t> frequencies;
+    };
+
+    size_t calculate_minimum_frequency() const;
+
+    FrequentPatternTree build_frequent_pattern_tree(const vector< vector<size_t> >&, const Vector<size_t>&, const size_t&, const size_t&) const;
+
+    void mine_frequent_pattern_tree(const FrequentPatternTree&, const size_t&, const Vector<size_t>&, const vector<size_t>&,
+                                    const size_t&, const size_t&, map< vector<size_t>, size_t >&) const;
+
+    map< vector<size_t>, size_t > calculate_itemsets_frequencies(const Vector<size_t>&, const size_t&, const size_t&) const;
+
     // MEMBERS
 
     /// Display messages to screen.
@@ -0,0 +1,402 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   B A T C H   P R O D U C E R   C L A S S                                                                    */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "batch_producer.h"
+
+namespace OpenNN
+{
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a batch producer object which is not associated to any data set.
+
+BatchProducer::BatchProducer()
+{
+}
+
+
+// DATA SET CONSTRUCTOR
+
+/// Data set constructor.
+/// It creates a batch producer object associated to a data set.
+/// @param new_data_set_pointer Pointer to a data set object.
+
+BatchProducer::BatchProducer(DataSet* new_data_set_pointer)
+{
+    data_set_pointer = new_data_set_pointer;
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+/// It stops the producer thread.
+
+BatchProducer::~BatchProducer()
+{
+    stop();
+}
+
+
+// METHODS
+
+/// Returns the pointer to the data set from which the batches are gathered.
+
+DataSet* BatchProducer::get_data_set_pointer() const
+{
+    return(data_set_pointer);
+}
+
+
+/// Returns the number of instances in each batch.
+
+const size_t& BatchProducer::get_batch_size() const
+{
+    return(batch_size);
+}
+
+
+/// Returns true if the training instances are shuffled at the beginning of each epoch, and false otherwise.
+
+const bool& BatchProducer::get_shuffle() const
+{
+    return(shuffle);
+}
+
+
+/// Returns the number of consecutive training instances which are shuffled together.
+
+const size_t& BatchProducer::get_shuffle_block_size() const
+{
+    return(shuffle_block_size);
+}
+
+
+/// Returns the maximum number of batches gathered ahead of the current one.
+
+const size_t& BatchProducer::get_prefetched_batches_number() const
+{
+    return(prefetched_batches_number);
+}
+
+
+/// Returns the instances indices of the batches of the current epoch.
+
+const Vector< Vector<size_t> >& BatchProducer::get_batches_indices() const
+{
+    return(batches_indices);
+}
+
+
+/// Returns the number of batches in the current epoch.
+
+size_t BatchProducer::get_batches_number() const
+{
+    return(batches_indices.size());
+}
+
+
+/// Returns the state of the random number generator used for shuffling, as text.
+/// It can be stored to shuffle the following epochs in the same way after a training is resumed.
+
+string BatchProducer::write_generator_state() const
+{
+    ostringstream buffer;
+
+    buffer << generator;
+
+    return(buffer.str());
+}
+
+
+/// Sets a new data set from which the batches are gathered.
+/// @param new_data_set_pointer Pointer to a data set object.
+
+void BatchProducer::set_data_set_pointer(DataSet* new_data_set_pointer)
+{
+    stop();
+
+    data_set_pointer = new_data_set_pointer;
+}
+
+
+/// Sets a new number of instances in each batch.
+/// @param new_batch_size Number of instances in each batch.
+
+void BatchProducer::set_batch_size(const size_t& new_batch_size)
+{
+    if(new_batch_size == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: BatchProducer class.\n"
+               << "void set_batch_size(const size_t&) method.\n"
+               << "Batch size must be greater than zero.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    batch_size = new_batch_size;
+}
+
+
+/// Sets whether the training instances are shuffled at the beginning of each epoch.
+/// @param new_shuffle True for shuffling the training instances, false for keeping their order.
+
+void BatchProducer::set_shuffle(const bool& new_shuffle)
+{
+    shuffle = new_shuffle;
+}
+
+
+/// Sets the number of consecutive training instances which are shuffled together.
+/// @param new_shuffle_block_size Number of instances in each shuffling block. One shuffles all the instances.
+
+void BatchProducer::set_shuffle_block_size(const size_t& new_shuffle_block_size)
+{
+    shuffle_block_size = new_shuffle_block_size;
+}
+
+
+/// Sets the maximum number of batches gathered ahead of the current one.
+/// @param new_prefetched_batches_number Size of the batches queue. Zero gathers each batch when it is requested.
+
+void BatchProducer::set_prefetched_batches_number(const size_t& new_prefetched_batches_number)
+{
+    stop();
+
+    prefetched_batches_number = new_prefetched_batches_number;
+}
+
+
+/// Seeds the random number generator used for shuffling.
+/// @param new_seed Seed of the random number generator.
+
+void BatchProducer::set_seed(const unsigned& new_seed)
+{
+    generator.seed(new_seed);
+}
+
+
+/// Restores the state of the random number generator used for shuffling,
+/// so that the following epochs are shuffled as they were after that state was written.
+/// @param generator_state State of the generator, as returned by write_generator_state().
+
+void BatchProducer::set_generator_state(const string& generator_state)
+{
+    istringstream buffer(generator_state);
+
+    buffer >> generator;
+
+    if(buffer.fail())
+    {
+        ostringstream message;
+
+        message << "OpenNN Exception: BatchProducer class.\n"
+                << "void set_generator_state(const string&) method.\n"
+                << "Invalid generator state.\n";
+
+        throw logic_error(message.str());
+    }
+}
+
+
+/// Prepares the batches of a new epoch.
+/// It stops the producer of the previous epoch, shuffles the training instances if required,
+/// and starts gathering the first batches on a background thread.
+
+void BatchProducer::start_epoch()
+{
+    if(!data_set_pointer)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: BatchProducer class.\n"
+               << "void start_epoch() method.\n"
+               << "Pointer to data set is nullptr.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    stop();
+
+    const Instances& instances = data_set_pointer->get_instances();
+
+    if(shuffle)
+    {
+        batches_indices = instances.get_shuffled_training_batches(batch_size, shuffle_block_size, generator);
+    }
+    else
+    {
+        batches_indices = instances.get_training_batches(batch_size);
+    }
+
+    next_batch_index = 0;
+
+    if(prefetched_batches_number > 0 && !batches_indices.empty())
+    {
+        stop_requested = false;
+
+        producer_exception = nullptr;
+
+        producer_thread = thread(&BatchProducer::produce_batches, this);
+    }
+}
+
+
+/// Returns the next batch of the current epoch.
+/// If the batch has not been gathered yet, it waits for the producer thread.
+/// @param batch Batch structure where the indices, inputs and targets are moved.
+/// @return False if all the batches of the epoch have already been returned, true otherwise.
+
+bool BatchProducer::get_next_batch(Batch& batch)
+{
+    if(next_batch_index >= batches_indices.size())
+    {
+        return(false);
+    }
+
+    if(prefetched_batches_number == 0)
+    {
+        gather_batch(next_batch_index, batch);
+    }
+    else
+    {
+        unique_lock<mutex> lock(queue_mutex);
+
+        queue_not_empty.wait(lock, [this]{return !batches_queue.empty() || producer_exception;});
+
+        if(batches_queue.empty())
+        {
+            lock.unlock();
+
+            stop();
+
+            rethrow_exception(producer_exception);
+        }
+
+        batch = move(batches_queue.front());
+
+        batches_queue.pop_front();
+
+        lock.unlock();
+
+        queue_not_full.notify_one();
+    }
+
+    next_batch_index++;
+
+    if(next_batch_index == batches_indices.size() && producer_thread.joinable())
+    {
+        producer_thread.join();
+    }
+
+    return(true);
+}
+
+
+/// Stops the producer thread and discards the batches which have been gathered but not returned.
+
+void BatchProducer::stop()
+{
+    if(producer_thread.joinable())
+    {
+        {
+            lock_guard<mutex> lock(queue_mutex);
+
+            stop_requested = true;
+        }
+
+        queue_not_full.notify_all();
+
+        producer_thread.join();
+    }
+
+    batches_queue.clear();
+}
+
+
+/// Gathers the inputs and targets of a batch of the current epoch.
+/// @param index Index of the batch in the current epoch.
+/// @param batch Batch structure to be filled.
+
+void BatchProducer::gather_batch(const size_t& index, Batch& batch) const
+{
+    batch.indices = batches_indices[index];
+
+    batch.inputs = data_set_pointer->get_inputs(batch.indices);
+    batch.targets = data_set_pointer->get_targets(batch.indices);
+}
+
+
+/// Body of the producer thread.
+/// It gathers the batches of the current epoch in order, waiting while the queue is full.
+
+void BatchProducer::produce_batches()
+{
+    try
+    {
+        const size_t batches_number = batches_indices.size();
+
+        for(size_t i = 0; i < batches_number; i++)
+        {
+            Batch batch;
+
+            gather_batch(i, batch);
+
+            unique_lock<mutex> lock(queue_mutex);
+
+            queue_not_full.wait(lock, [this]{return stop_requested || batches_queue.size() < prefetched_batches_number;});
+
+            if(stop_requested) return;
+
+            batches_queue.push_back(move(batch));
+
+            lock.unlock();
+
+            queue_not_empty.notify_one();
+        }
+    }
+    catch(...)
+    {
+        {
+            lock_guard<mutex> lock(queue_mutex);
+
+            producer_exception = current_exception();
+        }
+
+        queue_not_empty.notify_one();
+    }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,205 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   B A T C H   P R O D U C E R   C L A S S   H E A D E R                                                      */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __BATCHPRODUCER_H__
+#define __BATCHPRODUCER_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+#include <random>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+
+#include "data_set.h"
+
+namespace OpenNN
+{
+
+///
+/// This class produces the training batches of a data set for stochastic training.
+/// At the beginning of each epoch the training instances can be shuffled, optionally in blocks of consecutive instances.
+/// The inputs and targets of the next batches are gathered on a background thread and kept in a bounded queue,
+/// so that gathering the data overlaps with training on the current batch.
+/// The data set must not be modified while an epoch is in progress.
+///
+
+class BatchProducer
+{
+
+public:
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit BatchProducer();
+
+    // DATA SET CONSTRUCTOR
+
+    explicit BatchProducer(DataSet*);
+
+    // DESTRUCTOR
+
+    virtual ~BatchProducer();
+
+    // STRUCTURES
+
+    ///
+    /// This structure contains the instances indices, inputs and targets of a batch.
+    ///
+
+    struct Batch
+    {
+        /// Indices of the instances in the batch.
+
+        Vector<size_t> indices;
+
+        /// Inputs of the instances in the batch.
+
+        Matrix<double> inputs;
+
+        /// Targets of the instances in the batch.
+
+        Matrix<double> targets;
+    };
+
+    // Get methods
+
+    DataSet* get_data_set_pointer() const;
+
+    const size_t& get_batch_size() const;
+
+    const bool& get_shuffle() const;
+    const size_t& get_shuffle_block_size() const;
+
+    const size_t& get_prefetched_batches_number() const;
+
+    const Vector< Vector<size_t> >& get_batches_indices() const;
+    size_t get_batches_number() const;
+
+    string write_generator_state() const;
+
+    // Set methods
+
+    void set_data_set_pointer(DataSet*);
+
+    void set_batch_size(const size_t&);
+
+    void set_shuffle(const bool&);
+    void set_shuffle_block_size(const size_t&);
+
+    void set_prefetched_batches_number(const size_t&);
+
+    void set_seed(const unsigned&);
+    void set_generator_state(const string&);
+
+    // Epoch methods
+
+    void start_epoch();
+
+    bool get_next_batch(Batch&);
+
+    void stop();
+
+private:
+
+    void gather_batch(const size_t&, Batch&) const;
+
+    void produce_batches();
+
+    // MEMBERS
+
+    /// Pointer to the data set from which the batches are gathered.
+
+    DataSet* data_set_pointer = nullptr;
+
+    /// Number of instances in each batch.
+
+    size_t batch_size = 1000;
+
+    /// True if the training instances are shuffled at the beginning of each epoch.
+
+    bool shuffle = true;
+
+    /// Number of consecutive training instances which are shuffled together.
+
+    size_t shuffle_block_size = 1;
+
+    /// Maximum number of batches gathered ahead of the current one. Zero gathers each batch when it is requested.
+
+    size_t prefetched_batches_number = 2;
+
+    /// Random number generator used for shuffling.
+
+    mt19937 generator;
+
+    /// Instances indices of the batches of the current epoch.
+
+    Vector< Vector<size_t> > batches_indices;
+
+    /// Index of the next batch to be returned.
+
+    size_t next_batch_index = 0;
+
+    // Producer thread
+
+    thread producer_thread;
+
+    mutex queue_mutex;
+
+    condition_variable queue_not_full;
+    condition_variable queue_not_empty;
+
+    /// Batches already gathered by the producer thread.
+
+    deque<Batch> batches_queue;
+
+    /// True if the producer thread has to finish.
+
+    bool stop_requested = false;
+
+    /// Exception thrown by the producer thread, rethrown when the next batch is requested.
+
+    exception_ptr producer_exception;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,641 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   C O L U M N   S T O R E   C L A S S                                                                        */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "column_store.h"
+
+// System includes
+
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define __OPENNN_MMAP__
+#endif
+
+namespace OpenNN
+{
+
+/// Magic characters at the beginning of every column store file.
+
+static const char column_store_magic[8] = {'O', 'P', 'N', 'N', 'C', 'O', 'L', 'S'};
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a column store object which is not associated to any file.
+
+ColumnStore::ColumnStore()
+{
+}
+
+
+// FILE CONSTRUCTOR
+
+/// File constructor.
+/// It opens and maps a column store file.
+/// @param new_file_name Name of the column store file.
+
+ColumnStore::ColumnStore(const string& new_file_name)
+{
+    open(new_file_name);
+}
+
+
+// COPY CONSTRUCTOR
+
+/// Copy constructor.
+/// The new object maps the same file as the other object.
+/// @param other_column_store Column store object to be copied.
+
+ColumnStore::ColumnStore(const ColumnStore& other_column_store)
+{
+    if(other_column_store.is_open())
+    {
+        open(other_column_store.file_name);
+    }
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+/// It unmaps the file.
+
+ColumnStore::~ColumnStore()
+{
+    close();
+}
+
+
+// ASSIGNMENT OPERATOR
+
+/// Assignment operator.
+/// The object maps the same file as the other object.
+/// @param other_column_store Column store object to be assigned.
+
+ColumnStore& ColumnStore::operator = (const ColumnStore& other_column_store)
+{
+    if(this != &other_column_store)
+    {
+        close();
+
+        if(other_column_store.is_open())
+        {
+            open(other_column_store.file_name);
+        }
+    }
+
+    return(*this);
+}
+
+
+// METHODS
+
+/// Returns true if a column store file is mapped, and false otherwise.
+
+bool ColumnStore::is_open() const
+{
+    return(mapping != nullptr);
+}
+
+
+/// Returns the name of the column store file.
+
+const string& ColumnStore::get_file_name() const
+{
+    return(file_name);
+}
+
+
+/// Returns the number of instances in the column store.
+
+const size_t& ColumnStore::get_instances_number() const
+{
+    return(instances_number);
+}
+
+
+/// Returns the number of variables in the column store.
+
+const size_t& ColumnStore::get_variables_number() const
+{
+    return(variables_number);
+}
+
+
+/// Returns the names of the variables.
+
+const Vector<string>& ColumnStore::get_names() const
+{
+    return(names);
+}
+
+
+/// Returns the uses of the variables.
+
+const Vector<string>& ColumnStore::get_uses() const
+{
+    return(uses);
+}
+
+
+/// Returns the number of missing values of each variable.
+
+const Vector<size_t>& ColumnStore::get_missing_values_numbers() const
+{
+    return(missing_values_numbers);
+}
+
+
+/// Returns a pointer to the values of a variable, which are contiguous in the mapped file.
+/// @param column_index Index of the variable.
+
+const double* ColumnStore::get_column_data(const size_t& column_index) const
+{
+    #ifdef __OPENNN_DEBUG__
+
+    check_column_index(column_index, "const double* get_column_data(const size_t&) const");
+
+    #endif
+
+    return(reinterpret_cast<const double*>(mapping + data_offset + column_index*column_stride));
+}
+
+
+/// Returns a copy of the values of a variable.
+/// @param column_index Index of the variable.
+
+Vector<double> ColumnStore::get_column(const size_t& column_index) const
+{
+    check_column_index(column_index, "Vector<double> get_column(const size_t&) const");
+
+    const double* column_data = get_column_data(column_index);
+
+    return(Vector<double>(column_data, column_data + instances_number));
+}
+
+
+/// Returns a copy of the values of a variable on a subset of instances.
+/// @param column_index Index of the variable.
+/// @param rows_indices Indices of the instances.
+
+Vector<double> ColumnStore::get_column(const size_t& column_index, const Vector<size_t>& rows_indices) const
+{
+    check_column_index(column_index, "Vector<double> get_column(const size_t&, const Vector<size_t>&) const");
+
+    const double* column_data = get_column_data(column_index);
+
+    const size_t rows_number = rows_indices.size();
+
+    Vector<double> column(rows_number);
+
+    for(size_t i = 0; i < rows_number; i++)
+    {
+        column[i] = column_data[rows_indices[i]];
+    }
+
+    return(column);
+}
+
+
+/// Returns all the values of the column store in a matrix.
+/// Note that this loads the whole file in memory.
+
+Matrix<double> ColumnStore::get_matrix() const
+{
+    Matrix<double> matrix(instances_number, variables_number);
+
+    for(size_t j = 0; j < variables_number; j++)
+    {
+        const double* column_data = get_column_data(j);
+
+        copy(column_data, column_data + instances_number, matrix.begin() + static_cast<long>(j*instances_number));
+    }
+
+    return(matrix);
+}
+
+
+/// Returns the values of a subset of instances and variables in a matrix.
+/// @param rows_indices Indices of the instances.
+/// @param columns_indices Indices of the variables.
+
+Matrix<double> ColumnStore::get_submatrix(const Vector<size_t>& rows_indices, const Vector<size_t>& columns_indices) const
+{
+    Matrix<double> submatrix;
+
+    get_submatrix(rows_indices, columns_indices, submatrix);
+
+    return(submatrix);
+}
+
+
+/// Reads the values of a subset of instances and variables into a given matrix.
+/// The matrix is resized, so that a matrix reused for batches of the same size is not reallocated.
+/// @param rows_indices Indices of the instances.
+/// @param columns_indices Indices of the variables.
+/// @param submatrix Matrix where the values are read.
+
+void ColumnStore::get_submatrix(const Vector<size_t>& rows_indices, const Vector<size_t>& columns_indices, Matrix<double>& submatrix) const
+{
+    const size_t rows_number = rows_indices.size();
+    const size_t columns_number = columns_indices.size();
+
+    if(submatrix.get_rows_number() != rows_number || submatrix.get_columns_number() != columns_number)
+    {
+        submatrix.set(rows_number, columns_number);
+    }
+
+    for(size_t j = 0; j < columns_number; j++)
+    {
+        #ifdef __OPENNN_DEBUG__
+
+        check_column_index(columns_indices[j], "void get_submatrix(const Vector<size_t>&, const Vector<size_t>&, Matrix<double>&) const");
+
+        #endif
+
+        const double* column_data = get_column_data(columns_indices[j]);
+
+        for(size_t i = 0; i < rows_number; i++)
+        {
+            submatrix(i,j) = column_data[rows_indices[i]];
+        }
+    }
+}
+
+
+/// Maps a column store file and reads its header and the metadata of the variables.
+/// @param new_file_name Name of the column store file.
+
+void ColumnStore::open(const string& new_file_name)
+{
+    close();
+
+    #ifdef __OPENNN_MMAP__
+
+    const int file_descriptor = ::open(new_file_name.c_str(), O_RDONLY);
+
+    struct stat file_status;
+
+    if(file_descriptor < 0 || fstat(file_descriptor, &file_status) != 0 || file_status.st_size == 0)
+    {
+        if(file_descriptor >= 0) ::close(file_descriptor);
+
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: ColumnStore class.\n"
+               << "void open(const string&) method.\n"
+               << "Cannot open column store file: " << new_file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    mapping_size = static_cast<size_t>(file_status.st_size);
+
+    void* new_mapping = mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+
+    ::close(file_descriptor);
+
+    if(new_mapping == MAP_FAILED)
+    {
+        mapping_size = 0;
+
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: ColumnStore class.\n"
+               << "void open(const string&) method.\n"
+               << "Cannot map column store file: " << new_file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    mapping = static_cast<char*>(new_mapping);
+
+    #else
+
+    ifstream file(new_file_name.c_str(), ios::binary | ios::ate);
+
+    if(!file.is_open() || file.tellg() <= 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: ColumnStore class.\n"
+               << "void open(const string&) method.\n"
+               << "Cannot open column store file: " << new_file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    mapping_size = static_cast<size_t>(file.tellg());
+
+    file_buffer.set(mapping_size);
+
+    file.seekg(0, ios::beg);
+    file.read(file_buffer.data(), static_cast<streamsize>(mapping_size));
+
+    mapping = file_buffer.data();
+
+    #endif
+
+    file_name = new_file_name;
+
+    // Header
+
+    size_t position = 0;
+
+    // The sizes read from the header are checked against the file before anything is allocated with them
+
+    auto check_bytes = [&](const uint64_t& items_number, const size_t& item_size)
+    {
+        if(items_number > (mapping_size - position)/item_size)
+        {
+            close();
+
+            ostringstream buffer;
+
+            buffer << "OpenNN Exception: ColumnStore class.\n"
+                   << "void open(const string&) method.\n"
+                   << "Column store file is truncated: " << new_file_name << "\n";
+
+            throw logic_error(buffer.str());
+        }
+    };
+
+    auto read_bytes = [&](void* destination, const size_t& size)
+    {
+        check_bytes(size, 1);
+
+        memcpy(destination, mapping + position, size);
+
+        position += size;
+    };
+
+    char magic[8];
+    uint32_t file_version;
+    uint32_t file_alignment;
+    uint64_t file_instances_number;
+    uint64_t file_variables_number;
+
+    read_bytes(magic, sizeof(magic));
+    read_bytes(&file_version, sizeof(file_version));
+    read_bytes(&file_alignment, sizeof(file_alignment));
+    read_bytes(&file_instances_number, sizeof(file_instances_number));
+    read_bytes(&file_variables_number, sizeof(file_variables_number));
+    read_bytes(&data_offset, sizeof(data_offset));
+    read_bytes(&column_stride, sizeof(column_stride));
+
+    if(memcmp(magic, column_store_magic, sizeof(magic)) != 0 || file_version == 0 || file_version > version)
+    {
+        close();
+
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: ColumnStore class.\n"
+               << "void open(const string&) method.\n"
+               << "Unknown column store format or version: " << new_file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    instances_number = static_cast<size_t>(file_instances_number);
+    variables_number = static_cast<size_t>(file_variables_number);
+
+    // Variables metadata, with at least the missing values number and the sizes of the name and the use of each one
+
+    check_bytes(file_variables_number, 3*sizeof(uint64_t));
+
+    names.set(variables_number);
+    uses.set(variables_number);
+    missing_values_numbers.set(variables_number);
+
+    for(size_t j = 0; j < variables_number; j++)
+    {
+        uint64_t missing_values_number;
+        uint64_t name_size;
+        uint64_t use_size;
+
+        read_bytes(&missing_values_number, sizeof(missing_values_number));
+
+        read_bytes(&name_size, sizeof(name_size));
+        check_bytes(name_size, 1);
+        names[j].resize(static_cast<size_t>(name_size));
+        read_bytes(&names[j][0], static_cast<size_t>(name_size));
+
+        read_bytes(&use_size, sizeof(use_size));
+        check_bytes(use_size, 1);
+        uses[j].resize(static_cast<size_t>(use_size));
+        read_bytes(&uses[j][0], static_cast<size_t>(use_size));
+
+        missing_values_numbers[j] = static_cast<size_t>(missing_values_number);
+    }
+
+    // The comparisons are written with divisions, so that large values in a corrupt header do not overflow
+
+    if(data_offset < position
+    || data_offset > mapping_size
+    || column_stride/sizeof(double) < instances_number
+    || (variables_number != 0 && column_stride > (mapping_size - data_offset)/variables_number))
+    {
+        close();
+
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: ColumnStore class.\n"
+               << "void open(const string&) method.\n"
+               << "Column blocks do not match the size of the file: " << new_file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+
+/// Unmaps the column store file, if any, and clears the metadata.
+
+void ColumnStore::close()
+{
+    #ifdef __OPENNN_MMAP__
+
+    if(mapping)
+    {
+        munmap(mapping, mapping_size);
+    }
+
+    #endif
+
+    mapping = nullptr;
+    mapping_size = 0;
+
+    file_buffer.clear();
+
+    file_name.clear();
+
+    instances_number = 0;
+    variables_number = 0;
+
+    names.clear();
+    uses.clear();
+    missing_values_numbers.clear();
+
+    data_offset = 0;
+    column_stride = 0;
+}
+
+
+/// Returns the basic statistics of a set of variables, each one on its own set of instances.
+/// Only one variable is loaded in memory at a time.
+/// @param rows_indices Indices of the instances to be used for each variable.
+/// @param columns_indices Indices of the variables.
+
+Vector< Statistics<double> > ColumnStore::calculate_statistics(const Vector< Vector<size_t> >& rows_indices, const Vector<size_t>& columns_indices) const
+{
+    const size_t columns_number = columns_indices.size();
+
+    Vector< Statistics<double> > statistics(columns_number);
+
+    for(size_t j = 0; j < columns_number; j++)
+    {
+        statistics[j] = get_column(columns_indices[j], rows_indices[j]).calculate_statistics();
+    }
+
+    return(statistics);
+}
+
+
+/// Writes the header and the metadata of the variables of a column store file.
+/// The stream is left at the beginning of the first column block, whose offset is returned.
+/// @param file Binary output file stream, positioned at the beginning of the file.
+/// @param new_instances_number Number of instances.
+/// @param new_names Names of the variables.
+/// @param new_uses Uses of the variables.
+/// @param new_missing_values_numbers Number of missing values of each variable.
+
+uint64_t ColumnStore::write_header(ofstream& file,
+                                   const size_t& new_instances_number,
+                                   const Vector<string>& new_names,
+                                   const Vector<string>& new_uses,
+                                   const Vector<size_t>& new_missing_values_numbers)
+{
+    const size_t new_variables_number = new_names.size();
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(new_uses.size() != new_variables_number || new_missing_values_numbers.size() != new_variables_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: ColumnStore class.\n"
+               << "static uint64_t write_header(ofstream&, const size_t&, const Vector<string>&, const Vector<string>&, const Vector<size_t>&) method.\n"
+               << "Sizes of names, uses and missing values numbers must be equal.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    const uint32_t file_version = version;
+    const uint32_t file_alignment = static_cast<uint32_t>(alignment);
+    const uint64_t file_instances_number = new_instances_number;
+    const uint64_t file_variables_number = new_variables_number;
+    const uint64_t new_column_stride = calculate_column_stride(new_instances_number);
+
+    uint64_t header_size = sizeof(column_store_magic) + 2*sizeof(uint32_t) + 4*sizeof(uint64_t);
+
+    for(size_t j = 0; j < new_variables_number; j++)
+    {
+        header_size += 3*sizeof(uint64_t) + new_names[j].size() + new_uses[j].size();
+    }
+
+    const uint64_t new_data_offset = (header_size + alignment - 1)/alignment*alignment;
+
+    file.write(column_store_magic, sizeof(column_store_magic));
+    file.write(reinterpret_cast<const char*>(&file_version), sizeof(file_version));
+    file.write(reinterpret_cast<const char*>(&file_alignment), sizeof(file_alignment));
+    file.write(reinterpret_cast<const char*>(&file_instances_number), sizeof(file_instances_number));
+    file.write(reinterpret_cast<const char*>(&file_variables_number), sizeof(file_variables_number));
+    file.write(reinterpret_cast<const char*>(&new_data_offset), sizeof(new_data_offset));
+    file.write(reinterpret_cast<const char*>(&new_column_stride), sizeof(new_column_stride));
+
+    for(size_t j = 0; j < new_variables_number; j++)
+    {
+        const uint64_t missing_values_number = new_missing_values_numbers[j];
+        const uint64_t name_size = new_names[j].size();
+        const uint64_t use_size = new_uses[j].size();
+
+        file.write(reinterpret_cast<const char*>(&missing_values_number), sizeof(missing_values_number));
+        file.write(reinterpret_cast<const char*>(&name_size), sizeof(name_size));
+        file.write(new_names[j].data(), static_cast<streamsize>(name_size));
+        file.write(reinterpret_cast<const char*>(&use_size), sizeof(use_size));
+        file.write(new_uses[j].data(), static_cast<streamsize>(use_size));
+    }
+
+    const string padding(static_cast<size_t>(new_data_offset - header_size), '\0');
+
+    file.write(padding.data(), static_cast<streamsize>(padding.size()));
+
+    return(new_data_offset);
+}
+
+
+/// Returns the distance in bytes between two consecutive column blocks for a given number of instances.
+/// @param new_instances_number Number of instances.
+
+uint64_t ColumnStore::calculate_column_stride(const size_t& new_instances_number)
+{
+    const uint64_t column_size = new_instances_number*sizeof(double);
+
+    return((column_size + alignment - 1)/alignment*alignment);
+}
+
+
+/// Throws an exception if a variable index is not less than the number of variables.
+/// @param column_index Index of the variable.
+/// @param method Signature of the calling method.
+
+void ColumnStore::check_column_index(const size_t& column_index, const string& method) const
+{
+    if(column_index >= variables_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: ColumnStore class.\n"
+               << method << " method.\n"
+               << "Index of variable (" << column_index << ") must be less than number of variables (" << variables_number << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,181 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   C O L U M N   S T O R E   C L A S S   H E A D E R                                                          */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __COLUMNSTORE_H__
+#define __COLUMNSTORE_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <cstdint>
+#include <stdexcept>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+
+namespace OpenNN
+{
+
+///
+/// This class provides read only access to a binary column store file.
+/// The file contains a versioned header, the metadata of the variables (name, use and number of missing values),
+/// and one block of doubles for each variable, aligned to ColumnStore::alignment bytes.
+/// The file is memory mapped, so that the data does not need to fit in memory.
+///
+
+class ColumnStore
+{
+
+public:
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit ColumnStore();
+
+    // FILE CONSTRUCTOR
+
+    explicit ColumnStore(const string&);
+
+    // COPY CONSTRUCTOR
+
+    ColumnStore(const ColumnStore&);
+
+    // DESTRUCTOR
+
+    virtual ~ColumnStore();
+
+    // ASSIGNMENT OPERATOR
+
+    ColumnStore& operator = (const ColumnStore&);
+
+    /// Version of the file format written by this class.
+
+    static const uint32_t version = 1;
+
+    /// Alignment in bytes of the header and of each column block.
+
+    static const uint64_t alignment = 64;
+
+    // Get methods
+
+    bool is_open() const;
+
+    const string& get_file_name() const;
+
+    const size_t& get_instances_number() const;
+    const size_t& get_variables_number() const;
+
+    const Vector<string>& get_names() const;
+    const Vector<string>& get_uses() const;
+    const Vector<size_t>& get_missing_values_numbers() const;
+
+    const double* get_column_data(const size_t&) const;
+
+    Vector<double> get_column(const size_t&) const;
+    Vector<double> get_column(const size_t&, const Vector<size_t>&) const;
+
+    Matrix<double> get_matrix() const;
+    Matrix<double> get_submatrix(const Vector<size_t>&, const Vector<size_t>&) const;
+    void get_submatrix(const Vector<size_t>&, const Vector<size_t>&, Matrix<double>&) const;
+
+    // File methods
+
+    void open(const string&);
+    void close();
+
+    // Statistics methods
+
+    Vector< Statistics<double> > calculate_statistics(const Vector< Vector<size_t> >&, const Vector<size_t>&) const;
+
+    // Serialization methods
+
+    static uint64_t write_header(ofstream&, const size_t&, const Vector<string>&, const Vector<string>&, const Vector<size_t>&);
+
+    static uint64_t calculate_column_stride(const size_t&);
+
+private:
+
+    void check_column_index(const size_t&, const string&) const;
+
+    // MEMBERS
+
+    /// Name of the column store file.
+
+    string file_name;
+
+    /// Number of instances, which is the number of values in each column.
+
+    size_t instances_number = 0;
+
+    /// Number of variables, which is the number of columns.
+
+    size_t variables_number = 0;
+
+    /// Names of the variables.
+
+    Vector<string> names;
+
+    /// Uses of the variables, as written by Variables::write_uses().
+
+    Vector<string> uses;
+
+    /// Number of missing values in each variable.
+
+    Vector<size_t> missing_values_numbers;
+
+    /// Offset in bytes of the first column block.
+
+    uint64_t data_offset = 0;
+
+    /// Distance in bytes between the beginnings of two consecutive column blocks.
+
+    uint64_t column_stride = 0;
+
+    /// Pointer to the beginning of the mapped file.
+
+    char* mapping = nullptr;
+
+    /// Size in bytes of the mapped file.
+
+    size_t mapping_size = 0;
+
+    /// File contents, used instead of the mapping on platforms without mmap.
+
+    Vector<char> file_buffer;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -1652,6 +1652,9 @@ Matrix<string> ConjugateGradient::ConjugateGradientResults::write_final_results(
 
 /// Trains a neural network with an associated loss index according to the conjugate gradient algorithm.
 /// Training occurs according to the training operators, training parameters and stopping criteria.
+/// If a checkpoint file is set, the parameters and the state of the method are saved to it every checkpoint period epochs,
+/// and the training can later resume from the last checkpoint, as if it had not been interrupted.
+/// The training history of the results only contains the epochs performed after resuming.
 
 ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training()
 {
@@ -1682,7 +1685,7 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t selection_instances_number = instances.get_selection_instances_number();
+   const size_t selection_instances_number = loss_index_pointer->sum_MPI(instances.get_selection_instances_number());
 
    // Neural network stuff
 
@@ -1733,9 +1736,39 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
    
    double first_training_rate = 0.01;
 
+   // Checkpoint, from which the training resumes with the state it had at the end of an epoch
+
+   TrainingCheckpoint checkpoint;
+
+   size_t first_epoch = 0;
+
+   if(load_checkpoint(checkpoint))
+   {
+       first_epoch = checkpoint.get_epoch();
+
+       neural_network_pointer->set_parameters(checkpoint.get_vector("parameters"));
+
+       old_training_loss = checkpoint.get_scalar("old_training_loss");
+       old_gradient = checkpoint.get_vector("old_gradient");
+       old_selection_error = checkpoint.get_scalar("old_selection_error");
+
+       old_training_direction = checkpoint.get_vector("old_training_direction");
+       old_training_rate = checkpoint.get_scalar("old_training_rate");
+
+       directional_point = checkpoint.get_vector("directional_point");
+
+       minimum_selection_error_parameters = checkpoint.get_vector("minimum_selection_error_parameters");
+       minimum_selection_error = checkpoint.get_scalar("minimum_selection_error");
+       selection_failures = checkpoint.get_integer("selection_failures");
+
+       beginning_time -= static_cast<time_t>(checkpoint.get_scalar("elapsed_time"));
+
+       if(display) cout << "Resuming training from epoch " << first_epoch << " of " << checkpoint_file_name << ".\n";
+   }
+
    // Main loop    
    
-   for(size_t epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   for(size_t epoch = first_epoch; epoch <= maximum_epochs_number; epoch++)
    {
       // Neural network
 
@@ -1760,9 +1793,11 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
 
       // Loss index stuff
 
+      const LossIndex::FirstOrderError first_order_loss = loss_index_pointer->calculate_training_first_order_loss();
+
       if(epoch == 0)
       {      
-         training_loss = loss_index_pointer->calculate_training_loss();
+         training_loss = first_order_loss.error;
          training_loss_decrease = 0.0;
       }
       else
@@ -1771,7 +1806,7 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
          training_loss_decrease = training_loss - old_training_loss;
       }
 
-      gradient = loss_index_pointer->calculate_training_loss_gradient();
+      gradient = first_order_loss.gradient;
 
       gradient_norm = gradient.calculate_L2_norm();
 
@@ -1875,51 +1910,66 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
 
       if(reserve_parameters_history)
       {
-         results_pointer->parameters_history[epoch] = parameters;
+         results_pointer->parameters_history[epoch - first_epoch] = parameters;
+      }
+
+      if(parameters_history_sink)
+      {
+         parameters_history_sink->record(epoch, parameters);
       }
 
       if(reserve_parameters_norm_history)
       {
-         results_pointer->parameters_norm_history[epoch] = parameters_norm;
+         results_pointer->parameters_norm_history[epoch - first_epoch] = parameters_norm;
       }
 
       // Training history loss index
 
       if(reserve_loss_history)
       {
-         results_pointer->loss_history[epoch] = training_loss;
+         results_pointer->loss_history[epoch - first_epoch] = training_loss;
       }
 
       if(reserve_selection_error_history)
       {
-         results_pointer->selection_error_history[epoch] = selection_error;
+         results_pointer->selection_error_history[epoch - first_epoch] = selection_error;
       }
 
       if(reserve_gradient_history)
       {
-         results_pointer->gradient_history[epoch] = gradient;
+         results_pointer->gradient_history[epoch - first_epoch] = gradient;
+      }
+
+      if(gradient_history_sink)
+      {
+         gradient_history_sink->record(epoch, gradient);
       }
 
       if(reserve_gradient_norm_history)
       {
-         results_pointer->gradient_norm_history[epoch] = gradient_norm;
+         results_pointer->gradient_norm_history[epoch - first_epoch] = gradient_norm;
       }
 
       // Training history training algorithm
 
       if(reserve_training_direction_history)
       {
-         results_pointer->training_direction_history[epoch] = training_direction;
+         results_pointer->training_direction_history[epoch - first_epoch] = training_direction;
+      }
+
+      if(training_direction_history_sink)
+      {
+         training_direction_history_sink->record(epoch, training_direction);
       }
 
       if(reserve_training_rate_history)
       {
-         results_pointer->training_rate_history[epoch] = training_rate;
+         results_pointer->training_rate_history[epoch - first_epoch] = training_rate;
       }
 
       if(reserve_elapsed_time_history)
       {
-         results_pointer->elapsed_time_history[epoch] = elapsed_time;
+         results_pointer->elapsed_time_history[epoch - first_epoch] = elapsed_time;
       }
 
       // Stopping Criteria
@@ -2035,7 +2085,7 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
              }
           }
 
-         results_pointer->resize_training_history(1+epoch);
+         results_pointer->resize_training_history(1 + epoch - first_epoch);
 
          results_pointer->final_parameters = parameters;
          results_pointer->final_parameters_norm = parameters_norm;
@@ -2087,8 +2137,39 @@ ConjugateGradient::ConjugateGradientResults* ConjugateGradient::perform_training
 
       old_training_direction = training_direction;   
       old_training_rate = training_rate;
+
+      // Checkpoint
+
+      if(is_checkpoint_epoch(epoch))
+      {
+          checkpoint.set();
+
+          checkpoint.set_training_algorithm_type(write_training_algorithm_type());
+          checkpoint.set_epoch(epoch+1);
+
+          checkpoint.set_vector("parameters", parameters);
+
+          checkpoint.set_scalar("old_training_loss", old_training_loss);
+          checkpoint.set_vector("old_gradient", old_gradient);
+          checkpoint.set_scalar("old_selection_error", old_selection_error);
+
+          checkpoint.set_vector("old_training_direction", old_training_direction);
+          checkpoint.set_scalar("old_training_rate", old_training_rate);
+
+          checkpoint.set_vector("directional_point", directional_point);
+
+          checkpoint.set_vector("minimum_selection_error_parameters", minimum_selection_error_parameters);
+          checkpoint.set_scalar("minimum_selection_error", minimum_selection_error);
+          checkpoint.set_integer("selection_failures", selection_failures);
+
+          checkpoint.set_scalar("elapsed_time", elapsed_time);
+
+          save_checkpoint(checkpoint);
+      }
    } 
 
+   wait_checkpoint();
+
    if(return_minimum_selection_error_neural_network)
    {
        parameters = minimum_selection_error_parameters;
@@ -87,33 +87,6 @@ double CorrelationAnalysis::calculate_linear_correlation(const Vector<double>& x
     s_xy += y[i] * x[i];
   }
 
-#ifdef __OPENNN_MPI__
-
-  int n_send = (int)n;
-  int n_mpi;
-
-  double s_x_mpi = s_x;
-  double s_y_mpi = s_y;
-
-  double s_xx_mpi = s_xx;
-  double s_yy_mpi = s_yy;
-
-  double s_xy_mpi = s_xy;
-
-  MPI_Allreduce(&n_send,&n_mpi,1,MPI_INT,MPI_SUM,MPI_COMM_WORLD);
-
-  MPI_Allreduce(&s_x_mpi,&s_x,1,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
-  MPI_Allreduce(&s_y_mpi,&s_y,1,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
-
-  MPI_Allreduce(&s_xx_mpi,&s_xx,1,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
-  MPI_Allreduce(&s_yy_mpi,&s_yy,1,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
-
-  MPI_Allreduce(&s_xy_mpi,&s_xy,1,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
-
-  n = n_mpi;
-
-#endif
-
   double linear_correlation;
 
   if(fabs(s_x - 0) < numeric_limits<double>::epsilon() && fabs(s_y - 0) < numeric_limits<double>::epsilon() && fabs(s_xx - 0) < numeric_limits<double>::epsilon()
@@ -959,65 +932,470 @@ Matrix<double> CorrelationAnalysis::calculate_correlations(const Matrix<double>&
 }
 
 
-/// Calculates the linear correlations between each input and each target variable.
-/// For nominal input variables it calculates the multiple linear correlation between all the classes of
-/// the input variable and the target.
-/// @param nominal_variables Vector containing the classes of each nominal variable.
+/// Returns, for each variable, the sorted positions in a list of instances of the instances in which the variable is missing.
+/// @param instances_indices Sorted indices of the instances.
+/// @param variables_indices Indices of the variables.
+/// @param missing_indices Indices of the missing instances of each variable in the data.
 
-Matrix<double> CorrelationAnalysis::calculate_multiple_linear_correlations(const DataSet& data_set, const Vector<size_t> & nominal_variables)
+static Vector< Vector<size_t> > get_missing_positions(const Vector<size_t>& instances_indices,
+                                                      const Vector<size_t>& variables_indices,
+                                                      const Vector< Vector<size_t> >& missing_indices)
 {
-    const Variables& variables = data_set.get_variables();
-    const Instances& instances = data_set.get_instances();
-    const MissingValues& missing_values = data_set.get_missing_values();
+    const size_t variables_number = variables_indices.size();
 
-    const Vector<size_t> targets_indices = variables.get_targets_indices();
-    const size_t targets_number = variables.get_targets_number();
+    Vector< Vector<size_t> > missing_positions(variables_number);
 
-    const Vector<size_t> used_instances_indices = instances.get_used_indices();
+    for(size_t j = 0; j < variables_number; j++)
+    {
+        if(variables_indices[j] >= missing_indices.size()) continue;
 
-    const size_t inputs_number = data_set.calculate_input_variables_number(nominal_variables);
-    const Vector< Vector<size_t> > new_input_indices = data_set.get_inputs_indices(inputs_number, nominal_variables);
+        const Vector<size_t>& variable_missing_indices = missing_indices[variables_indices[j]];
 
-    // Calculate correlations
+        for(size_t k = 0; k < variable_missing_indices.size(); k++)
+        {
+            const auto position = lower_bound(instances_indices.begin(), instances_indices.end(), variable_missing_indices[k]);
 
-    Matrix<double> multiple_linear_correlations(inputs_number, targets_number);
+            if(position != instances_indices.end() && *position == variable_missing_indices[k])
+            {
+                missing_positions[j].push_back(static_cast<size_t>(position - instances_indices.begin()));
+            }
+        }
 
-    Matrix<double> input_variables;
-    Vector<size_t> input_indices;
+        sort(missing_positions[j].begin(), missing_positions[j].end());
 
-    Vector<double> target_variable;
-    size_t target_index;
+        missing_positions[j].erase(unique(missing_positions[j].begin(), missing_positions[j].end()), missing_positions[j].end());
+    }
 
-    for(size_t i = 0; i < inputs_number; i++)
+    return(missing_positions);
+}
+
+
+/// Calculates the mean of each variable over the instances in which it is not missing, and the inverse of its standard deviation.
+/// The inverse of the standard deviation of a constant variable is zero, so that its standardized values are exactly zero.
+/// @param data Data matrix.
+/// @param instances_indices Sorted indices of the instances.
+/// @param variables_indices Indices of the variables.
+/// @param missing_positions Sorted positions of the missing instances of each variable.
+/// @param means Mean of each variable.
+/// @param scales Inverse of the standard deviation of each variable.
+
+static void calculate_standardization(const Matrix<double>& data,
+                                      const Vector<size_t>& instances_indices,
+                                      const Vector<size_t>& variables_indices,
+                                      const Vector< Vector<size_t> >& missing_positions,
+                                      Vector<double>& means,
+                                      Vector<double>& scales)
+{
+    const size_t instances_number = instances_indices.size();
+    const size_t variables_number = variables_indices.size();
+
+    means.set(variables_number, 0.0);
+    scales.set(variables_number, 0.0);
+
+    #pragma omp parallel for
+
+    for(int j = 0; j < static_cast<int>(variables_number); j++)
+    {
+        const size_t variable_index = variables_indices[static_cast<size_t>(j)];
+
+        const Vector<size_t>& positions = missing_positions[static_cast<size_t>(j)];
+
+        double sum = 0.0;
+        double minimum = numeric_limits<double>::max();
+        double maximum = -numeric_limits<double>::max();
+
+        size_t count = 0;
+        size_t next_missing = 0;
+
+        for(size_t i = 0; i < instances_number; i++)
+        {
+            if(next_missing < positions.size() && positions[next_missing] == i)
+            {
+                next_missing++;
+                continue;
+            }
+
+            const double value = data(instances_indices[i], variable_index);
+
+            sum += value;
+            minimum = min(minimum, value);
+            maximum = max(maximum, value);
+
+            count++;
+        }
+
+        if(count == 0) continue;
+
+        const double mean = sum/static_cast<double>(count);
+
+        means[static_cast<size_t>(j)] = mean;
+
+        if(maximum == minimum) continue;
+
+        double squares_sum = 0.0;
+
+        next_missing = 0;
+
+        for(size_t i = 0; i < instances_number; i++)
+        {
+            if(next_missing < positions.size() && positions[next_missing] == i)
+            {
+                next_missing++;
+                continue;
+            }
+
+            const double deviation = data(instances_indices[i], variable_index) - mean;
+
+            squares_sum += deviation*deviation;
+        }
+
+        scales[static_cast<size_t>(j)] = 1.0/sqrt(squares_sum/static_cast<double>(count));
+    }
+}
+
+
+/// Copies the standardized values of some variables in a block of consecutive instances, with zeros in the missing values,
+/// together with a mask which is one for the values which are not missing and zero for the missing ones.
+/// @param data Data matrix.
+/// @param instances_indices Sorted indices of the instances.
+/// @param first_position Position of the first instance of the block.
+/// @param block_instances_number Number of instances of the block.
+/// @param variables_indices Indices of the variables.
+/// @param missing_positions Sorted positions of the missing instances of each variable.
+/// @param means Mean of each variable.
+/// @param scales Inverse of the standard deviation of each variable.
+/// @param values Standardized values of the block, in its first rows.
+/// @param mask Mask of the block, in its first rows.
+
+static void gather_standardized_block(const Matrix<double>& data,
+                                      const Vector<size_t>& instances_indices,
+                                      const size_t& first_position,
+                                      const size_t& block_instances_number,
+                                      const Vector<size_t>& variables_indices,
+                                      const Vector< Vector<size_t> >& missing_positions,
+                                      const Vector<double>& means,
+                                      const Vector<double>& scales,
+                                      Eigen::MatrixXd& values,
+                                      Eigen::MatrixXd& mask)
+{
+    const size_t variables_number = variables_indices.size();
+
+    #pragma omp parallel for
+
+    for(int j = 0; j < static_cast<int>(variables_number); j++)
+    {
+        const size_t column = static_cast<size_t>(j);
+
+        const size_t variable_index = variables_indices[column];
+
+        const Vector<size_t>& positions = missing_positions[column];
+
+        auto next_missing = lower_bound(positions.begin(), positions.end(), first_position);
+
+        for(size_t i = 0; i < block_instances_number; i++)
+        {
+            const size_t position = first_position + i;
+
+            if(next_missing != positions.end() && *next_missing == position)
+            {
+                values(static_cast<Eigen::Index>(i), j) = 0.0;
+                mask(static_cast<Eigen::Index>(i), j) = 0.0;
+
+                ++next_missing;
+            }
+            else
+            {
+                values(static_cast<Eigen::Index>(i), j) = (data(instances_indices[position], variable_index) - means[column])*scales[column];
+                mask(static_cast<Eigen::Index>(i), j) = 1.0;
+            }
+        }
+    }
+}
+
+
+/// Returns the linear correlation coefficient from the sums over the instances in which both variables are not missing.
+/// It follows the conventions of calculate_linear_correlation for constant variables.
+/// @param n Number of instances.
+/// @param s_x Sum of the first variable.
+/// @param s_y Sum of the second variable.
+/// @param s_xx Sum of the squares of the first variable.
+/// @param s_yy Sum of the squares of the second variable.
+/// @param s_xy Sum of the products of both variables.
+
+static double calculate_linear_correlation_sums(const double& n,
+                                                const double& s_x, const double& s_y,
+                                                const double& s_xx, const double& s_yy,
+                                                const double& s_xy)
+{
+    if(n < 1.0)
     {
-        for(size_t j = 0; j < targets_number; j++)
+        return(0.0);
+    }
+
+    const double radicand = (n*s_xx - s_x*s_x)*(n*s_yy - s_y*s_y);
+
+    if(radicand <= 0.0)
+    {
+        return(1.0);
+    }
+
+    const double denominator = sqrt(radicand);
+
+    if(denominator < 1.0e-50)
+    {
+        return(0.0);
+    }
+
+    const double linear_correlation = (n*s_xy - s_x*s_y)/denominator;
+
+    return(max(-1.0, min(1.0, linear_correlation)));
+}
+
+
+/// Calculates the linear correlations between two sets of variables of a data matrix, for the given instances.
+/// The correlation of each pair of variables only uses the instances in which both of them are not missing.
+/// The variables are standardized once, and the sums of all the pairs are accumulated over blocks of instances
+/// with matrix products. When both sets of variables are the same, the symmetric products are calculated only once.
+/// @param data Data matrix.
+/// @param instances_indices Indices of the instances.
+/// @param rows_variables_indices Indices of the variables in the rows of the correlations matrix.
+/// @param columns_variables_indices Indices of the variables in the columns of the correlations matrix.
+/// @param missing_indices Indices of the missing instances of each variable in the data.
+
+Matrix<double> CorrelationAnalysis::calculate_linear_correlations_missing_values(const Matrix<double>& data,
+                                                                                 const Vector<size_t>& instances_indices,
+                                                                                 const Vector<size_t>& rows_variables_indices,
+                                                                                 const Vector<size_t>& columns_variables_indices,
+                                                                                 const Vector< Vector<size_t> >& missing_indices)
+{
+    const size_t rows_number = rows_variables_indices.size();
+    const size_t columns_number = columns_variables_indices.size();
+
+    const bool symmetric = (rows_variables_indices == columns_variables_indices);
+
+    Vector<size_t> sorted_instances_indices(instances_indices);
+
+    sort(sorted_instances_indices.begin(), sorted_instances_indices.end());
+
+    const size_t instances_number = sorted_instances_indices.size();
+
+    // Standardization
+
+    const Vector< Vector<size_t> > rows_missing_positions = get_missing_positions(sorted_instances_indices, rows_variables_indices, missing_indices);
+    const Vector< Vector<size_t> > columns_missing_positions = symmetric
+            ? rows_missing_positions
+            : get_missing_positions(sorted_instances_indices, columns_variables_indices, missing_indices);
+
+    bool missing = false;
+
+    for(size_t i = 0; i < rows_number && !missing; i++) missing = !rows_missing_positions[i].empty();
+    for(size_t j = 0; j < columns_number && !missing; j++) missing = !columns_missing_positions[j].empty();
+
+    Vector<double> rows_means;
+    Vector<double> rows_scales;
+
+    Vector<double> columns_means;
+    Vector<double> columns_scales;
+
+    calculate_standardization(data, sorted_instances_indices, rows_variables_indices, rows_missing_positions, rows_means, rows_scales);
+
+    if(!symmetric)
+    {
+        calculate_standardization(data, sorted_instances_indices, columns_variables_indices, columns_missing_positions, columns_means, columns_scales);
+    }
+
+    // Sums over blocks of instances
+
+    const Eigen::Index rows = static_cast<Eigen::Index>(rows_number);
+    const Eigen::Index columns = static_cast<Eigen::Index>(columns_number);
+
+    const size_t block_size = min(static_cast<size_t>(1024), max(static_cast<size_t>(1), instances_number));
+
+    const Eigen::Index block_rows = static_cast<Eigen::Index>(block_size);
+
+    Eigen::MatrixXd rows_values(block_rows, rows);
+    Eigen::MatrixXd rows_mask(block_rows, rows);
+
+    Eigen::MatrixXd columns_values(symmetric ? 0 : block_rows, symmetric ? 0 : columns);
+    Eigen::MatrixXd columns_mask(symmetric ? 0 : block_rows, symmetric ? 0 : columns);
+
+    Eigen::MatrixXd products = Eigen::MatrixXd::Zero(rows, columns);
+
+    // Sums of each variable over the instances in which the other one is not missing
+
+    Eigen::MatrixXd pairs_numbers;
+    Eigen::MatrixXd rows_sums;
+    Eigen::MatrixXd columns_sums;
+    Eigen::MatrixXd rows_squares_sums;
+    Eigen::MatrixXd columns_squares_sums;
+
+    if(missing)
+    {
+        pairs_numbers.setZero(rows, columns);
+        rows_sums.setZero(rows, columns);
+        rows_squares_sums.setZero(rows, columns);
+
+        if(!symmetric)
+        {
+            columns_sums.setZero(rows, columns);
+            columns_squares_sums.setZero(rows, columns);
+        }
+    }
+
+    // Sums of each variable over all the instances, when there are no missing values
+
+    Eigen::VectorXd rows_totals = Eigen::VectorXd::Zero(rows);
+    Eigen::VectorXd rows_squares_totals = Eigen::VectorXd::Zero(rows);
+    Eigen::VectorXd columns_totals = Eigen::VectorXd::Zero(symmetric ? 0 : columns);
+    Eigen::VectorXd columns_squares_totals = Eigen::VectorXd::Zero(symmetric ? 0 : columns);
+
+    for(size_t first_position = 0; first_position < instances_number; first_position += block_size)
+    {
+        const size_t block_instances_number = min(block_size, instances_number - first_position);
+
+        const Eigen::Index current_rows = static_cast<Eigen::Index>(block_instances_number);
+
+        gather_standardized_block(data, sorted_instances_indices, first_position, block_instances_number,
+                                  rows_variables_indices, rows_missing_positions, rows_means, rows_scales,
+                                  rows_values, rows_mask);
+
+        const auto x = rows_values.topRows(current_rows);
+        const auto x_mask = rows_mask.topRows(current_rows);
+
+        if(symmetric)
         {
-            input_indices = new_input_indices[i];
+            products.selfadjointView<Eigen::Lower>().rankUpdate(x.transpose());
 
-            target_index = targets_indices[j];
+            if(missing)
+            {
+                const Eigen::MatrixXd x_squares = x.array().square().matrix();
 
-            Vector<size_t> current_missing_values = missing_values.get_missing_instances(input_indices);
+                pairs_numbers.selfadjointView<Eigen::Lower>().rankUpdate(x_mask.transpose());
+                rows_sums.noalias() += x.transpose()*x_mask;
+                rows_squares_sums.noalias() += x_squares.transpose()*x_mask;
+            }
+            else
+            {
+                rows_totals += x.colwise().sum().transpose();
+                rows_squares_totals += x.colwise().squaredNorm().transpose();
+            }
+        }
+        else
+        {
+            gather_standardized_block(data, sorted_instances_indices, first_position, block_instances_number,
+                                      columns_variables_indices, columns_missing_positions, columns_means, columns_scales,
+                                      columns_values, columns_mask);
 
-            current_missing_values = current_missing_values.get_union(missing_values.get_missing_instances(target_index));
+            const auto y = columns_values.topRows(current_rows);
+            const auto y_mask = columns_mask.topRows(current_rows);
 
-            const Vector<size_t> current_used_indices = used_instances_indices.get_difference(current_missing_values);
+            products.noalias() += x.transpose()*y;
 
-            input_variables = data_set.get_data().get_submatrix(current_used_indices, input_indices);
+            if(missing)
+            {
+                const Eigen::MatrixXd x_squares = x.array().square().matrix();
+                const Eigen::MatrixXd y_squares = y.array().square().matrix();
+
+                pairs_numbers.noalias() += x_mask.transpose()*y_mask;
+                rows_sums.noalias() += x.transpose()*y_mask;
+                columns_sums.noalias() += x_mask.transpose()*y;
+                rows_squares_sums.noalias() += x_squares.transpose()*y_mask;
+                columns_squares_sums.noalias() += x_mask.transpose()*y_squares;
+            }
+            else
+            {
+                rows_totals += x.colwise().sum().transpose();
+                rows_squares_totals += x.colwise().squaredNorm().transpose();
+                columns_totals += y.colwise().sum().transpose();
+                columns_squares_totals += y.colwise().squaredNorm().transpose();
+            }
+        }
+    }
 
-            target_variable = data_set.get_data().get_column(target_index, current_used_indices);
+    // Correlations
 
-            if(input_variables.get_columns_number() == 1)
+    Matrix<double> correlations(rows_number, columns_number);
+
+    const double n = static_cast<double>(instances_number);
+
+    #pragma omp parallel for
+
+    for(int j = 0; j < static_cast<int>(columns_number); j++)
+    {
+        const Eigen::Index column = static_cast<Eigen::Index>(j);
+
+        for(Eigen::Index i = 0; i < rows; i++)
+        {
+            double pairs_number;
+            double s_x;
+            double s_y;
+            double s_xx;
+            double s_yy;
+            double s_xy;
+
+            if(symmetric)
             {
-                multiple_linear_correlations(i,j) = calculate_linear_correlation(input_variables.to_vector(), target_variable);
+                const Eigen::Index lower_row = max(i, column);
+                const Eigen::Index lower_column = min(i, column);
+
+                s_xy = products(lower_row, lower_column);
+
+                if(missing)
+                {
+                    pairs_number = pairs_numbers(lower_row, lower_column);
+                    s_x = rows_sums(i, column);
+                    s_y = rows_sums(column, i);
+                    s_xx = rows_squares_sums(i, column);
+                    s_yy = rows_squares_sums(column, i);
+                }
+                else
+                {
+                    pairs_number = n;
+                    s_x = rows_totals(i);
+                    s_y = rows_totals(column);
+                    s_xx = rows_squares_totals(i);
+                    s_yy = rows_squares_totals(column);
+                }
             }
             else
             {
-                multiple_linear_correlations(i,j) = calculate_multiple_linear_correlation(input_variables,target_variable);
+                s_xy = products(i, column);
+
+                if(missing)
+                {
+                    pairs_number = pairs_numbers(i, column);
+                    s_x = rows_sums(i, column);
+                    s_y = columns_sums(i, column);
+                    s_xx = rows_squares_sums(i, column);
+                    s_yy = columns_squares_sums(i, column);
+                }
+                else
+                {
+                    pairs_number = n;
+                    s_x = rows_totals(i);
+                    s_y = columns_totals(column);
+                    s_xx = rows_squares_totals(i);
+                    s_yy = columns_squares_totals(column);
+                }
             }
+
+            correlations(static_cast<size_t>(i), static_cast<size_t>(j))
+                    = calculate_linear_correlation_sums(pairs_number, s_x, s_y, s_xx, s_yy, s_xy);
         }
     }
 
-    return multiple_linear_correlations;
+    return(correlations);
+}
+
+
+/// Calculates the linear correlations between each input and each target variable.
+/// For nominal input variables it calculates the multiple linear correlation between all the classes of
+/// the input variable and the target.
+/// @param nominal_variables Vector containing the classes of each nominal variable.
+
+Matrix<double> CorrelationAnalysis::calculate_multiple_linear_correlations(const DataSet& data_set, const Vector<size_t> & nominal_variables)
+{
+    return data_set.calculate_multiple_linear_correlations(nominal_variables);
 }
 
 
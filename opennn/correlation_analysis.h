@@ -132,6 +132,12 @@ public:
 
     static Matrix<double> calculate_correlations(const Matrix<double>&, const Vector<size_t>&);
 
+    static Matrix<double> calculate_linear_correlations_missing_values(const Matrix<double>&,
+                                                                       const Vector<size_t>&,
+                                                                       const Vector<size_t>&,
+                                                                       const Vector<size_t>&,
+                                                                       const Vector< Vector<size_t> >&);
+
     // Multiple correlation methods
 
     static Matrix<double> calculate_multiple_linear_correlations(const DataSet&, const Vector<size_t>&);
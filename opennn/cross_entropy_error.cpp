@@ -162,27 +162,33 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     double training_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : training_error)
-
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+            Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
-        const double batch_error = outputs.calculate_cross_entropy_error(targets);
+            const double batch_error = outputs.calculate_cross_entropy_error(targets);
 
-        training_error += batch_error;
+            training_error += batch_error;
+        }
     }
 
-    return training_error;
+    return sum_MPI(training_error);
 }
 
 
@@ -200,31 +206,41 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > selection_batches = data_set_pointer->get_instances_pointer()->get_selection_batches(batch_size);
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
 
-    const size_t batches_number = selection_batches.size();
+    const size_t batches_number = selection_batches.get_batches_number();
 
     double selection_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : selection_error)
-
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(selection_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(selection_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+        #pragma omp for reduction(+ : selection_error)
 
-        const double batch_error = outputs.calculate_cross_entropy_error(targets);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = selection_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = selection_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+
+            const double batch_error = outputs.calculate_cross_entropy_error(targets);
 
-        selection_error += batch_error;
+            selection_error += batch_error;
+        }
     }
 
-    return selection_error;
+    return sum_MPI(selection_error);
 }
 
 
-double CrossEntropyError::calculate_training_error(const Vector<double>& parameters) const
+/// Returns the cross entropy error on the selection instances for a given parameters vector.
+/// The neural network is not modified, so this can be evaluated while the neural network is being trained.
+/// @param parameters Parameters vector of the neural network.
+
+double CrossEntropyError::calculate_selection_error(const Vector<double>& parameters) const
 {
 #ifdef __OPENNN_DEBUG__
 
@@ -238,31 +254,37 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = selection_batches.get_batches_number();
 
-    double training_error = 0.0;
-
-    #pragma omp parallel for reduction(+ : training_error)
+    double selection_error = 0.0;
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for reduction(+ : selection_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = selection_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = selection_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+            Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-        const double batch_error = outputs.calculate_cross_entropy_error(targets);
+            const double batch_error = outputs.calculate_cross_entropy_error(targets);
 
-        training_error += batch_error;
+            selection_error += batch_error;
+        }
     }
 
-    return training_error;
+    return sum_MPI(selection_error);
 }
 
 
-double CrossEntropyError::calculate_batch_error(const Vector<size_t>& batch_indices) const
+double CrossEntropyError::calculate_training_error(const Vector<double>& parameters) const
 {
 #ifdef __OPENNN_DEBUG__
 
@@ -276,14 +298,80 @@ check();
 
     // Data set
 
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    double training_error = 0.0;
+
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+
+            const double batch_error = outputs.calculate_cross_entropy_error(targets);
+
+            training_error += batch_error;
+        }
+    }
+
+    return sum_MPI(training_error);
+}
+
+
+double CrossEntropyError::calculate_batch_error(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
     const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
     const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
 
-    Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+    return calculate_batch_error(inputs, targets);
+}
+
+
+/// Returns the cross entropy error of the multilayer perceptron on a batch which has already been gathered.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+double CrossEntropyError::calculate_batch_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
 
-    const double batch_error = outputs.calculate_cross_entropy_error(targets);
+#endif
 
-    return batch_error;
+    // Multilayer perceptron
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    double batch_error = 0.0;
+
+    if(inputs.get_rows_number() > 0)
+    {
+        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+
+        batch_error = outputs.calculate_cross_entropy_error(targets);
+    }
+
+    return sum_MPI(batch_error);
 }
 
 
@@ -302,46 +390,46 @@ check();
 
     const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
-    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
     const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
 
     // Data set
 
-    const size_t training_instances_number = data_set_pointer->get_instances().get_training_instances_number();
+    const size_t training_instances_number = sum_MPI(data_set_pointer->get_instances().get_training_instances_number());
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     // Loss index
 
-    Vector<double> training_error_gradient(parameters_number, 0.0);
+    Vector<double> training_error_gradient;
 
-    #pragma omp parallel for
+    set_back_propagations(batch_size);
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
-    {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+    set_gradient_accumulators(parameters_number);
 
-        const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-                = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> output_gradient
-                = calculate_output_gradient(first_order_forward_propagation.layers_activations[layers_number-1], targets);
+        #pragma omp for schedule(static)
 
-        const Vector< Matrix<double> > layers_delta
-                = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const Vector<double> batch_gradient
-                = calculate_error_gradient(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+            BackPropagation& back_propagation = get_back_propagation();
 
-        #pragma omp critical
+            calculate_back_propagation(inputs, targets, back_propagation);
 
-        training_error_gradient += batch_gradient;
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
     }
 
+    reduce_gradient_accumulators(training_error_gradient);
+
     return training_error_gradient / static_cast<double>(training_instances_number);
 }
 
@@ -363,6 +451,173 @@ check();
 }
 
 
+/// Calculates the output gradient of a batch and writes it into a given matrix, which is resized only if its dimensions change.
+/// @param outputs Matrix of outputs of the neural network.
+/// @param targets Matrix of targets of the data set.
+/// @param output_gradient Matrix where the output gradient is written.
+
+void CrossEntropyError::calculate_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets, Matrix<double>& output_gradient) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    if(output_gradient.get_rows_number() != outputs.get_rows_number() || output_gradient.get_columns_number() != outputs.get_columns_number())
+    {
+        output_gradient.set(outputs.get_rows_number(), outputs.get_columns_number());
+    }
+
+    const size_t size = outputs.size();
+
+    for(size_t i = 0; i < size; i++)
+    {
+        output_gradient[i] = -targets[i]/outputs[i] + (1.0-targets[i])/(1.0-outputs[i]);
+    }
+}
+
+
+/// Returns the cross entropy error and its gradient on the training instances.
+/// Both are computed in a single forward and backward propagation of each batch.
+
+LossIndex::FirstOrderError CrossEntropyError::calculate_training_first_order_error() const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+    // Data set
+
+    const size_t training_instances_number = sum_MPI(data_set_pointer->get_instances().get_training_instances_number());
+
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    // Loss index
+
+    FirstOrderError first_order_error(0);
+
+    double training_error = 0.0;
+
+    set_back_propagations(batch_size);
+
+    set_gradient_accumulators(parameters_number);
+
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for schedule(static) reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            BackPropagation& back_propagation = get_back_propagation();
+
+            calculate_back_propagation(inputs, targets, back_propagation);
+
+            training_error += back_propagation.get_outputs().calculate_cross_entropy_error(targets);
+
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
+    }
+
+    first_order_error.error = sum_MPI(training_error);
+
+    reduce_gradient_accumulators(first_order_error.gradient);
+
+    first_order_error.gradient /= static_cast<double>(training_instances_number);
+
+    return first_order_error;
+}
+
+
+/// Returns the cross entropy error and its gradient on a batch of instances.
+/// @param batch_indices Indices of the instances in the batch.
+
+LossIndex::FirstOrderError CrossEntropyError::calculate_batch_first_order_error(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
+    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
+    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+
+    return calculate_batch_first_order_error(inputs, targets);
+}
+
+
+/// Returns the cross entropy error and its gradient on a batch which has already been gathered.
+/// Both are computed in a single forward and backward propagation.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+LossIndex::FirstOrderError CrossEntropyError::calculate_batch_first_order_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const size_t parameters_number = neural_network_pointer->get_multilayer_perceptron_pointer()->get_parameters_number();
+
+    // Data set
+
+    const size_t instances_number = inputs.get_rows_number();
+
+    const size_t batch_instances_number = sum_MPI(instances_number);
+
+    // Loss index
+
+    FirstOrderError first_order_error(parameters_number);
+
+    double batch_error = 0.0;
+
+    if(instances_number > 0)
+    {
+        set_back_propagations(instances_number);
+
+        BackPropagation& back_propagation = get_back_propagation();
+
+        calculate_back_propagation(inputs, targets, back_propagation);
+
+        batch_error = back_propagation.get_outputs().calculate_cross_entropy_error(targets);
+
+        first_order_error.gradient = back_propagation.gradient;
+    }
+
+    first_order_error.error = sum_MPI(batch_error);
+
+    sum_MPI(first_order_error.gradient);
+
+    first_order_error.gradient /= static_cast<double>(batch_instances_number);
+
+    return first_order_error;
+}
+
+
 /// Returns a string with the name of the cross entropy error loss type, "CROSS_ENTROPY_ERROR".
 
 string CrossEntropyError::write_error_term_type() const
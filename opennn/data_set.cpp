@@ -152,12 +152,16 @@ DataSet& DataSet::operator = (const DataSet& other_data_set)
 {
    if(this != &other_data_set)
    {
+      clear_batches();
+
       data_file_name = other_data_set.data_file_name;
 
       // Data matrix
 
       data = other_data_set.data;
 
+      column_store = other_data_set.column_store;
+
       // Variables
 
       variables = other_data_set.variables;
@@ -353,7 +357,7 @@ bool DataSet::is_binary_variable(const string& variable_name) const
 
 bool DataSet::empty() const
 {
-   return(data.empty());
+   return(data.empty() && !column_store.is_open());
 }
 
 
@@ -730,7 +734,7 @@ Matrix<double> DataSet::get_training_data() const
 
    const Vector<size_t> training_indices = instances.get_training_indices();
 
-   return(data.get_submatrix(training_indices, variables_indices));
+   return(get_data_submatrix(training_indices, variables_indices));
 }
 
 
@@ -746,7 +750,7 @@ Matrix<double> DataSet::get_selection_data() const
 
    Vector<size_t> variables_indices(0, 1,variables_number-1);
 
-   return(data.get_submatrix(selection_indices, variables_indices));
+   return(get_data_submatrix(selection_indices, variables_indices));
 }
 
 
@@ -761,7 +765,7 @@ Matrix<double> DataSet::get_testing_data() const
 
    const Vector<size_t> testing_indices = instances.get_testing_indices();
 
-   return(data.get_submatrix(testing_indices, variables_indices));
+   return(get_data_submatrix(testing_indices, variables_indices));
 }
 
 
@@ -776,7 +780,7 @@ Matrix<double> DataSet::get_inputs() const
 
    const Vector<size_t> input_indices = variables.get_inputs_indices();
 
-   return(data.get_submatrix(indices, input_indices));
+   return(get_data_submatrix(indices, input_indices));
 }
 
 
@@ -791,7 +795,7 @@ Matrix<double> DataSet::get_targets() const
 
    const Vector<size_t> targets_indices = variables.get_targets_indices();
 
-   return(data.get_submatrix(indices, targets_indices));
+   return(get_data_submatrix(indices, targets_indices));
 }
 
 
@@ -799,7 +803,7 @@ Matrix<double> DataSet::get_inputs(const Vector<size_t>& instances_indices) cons
 {
     const Vector<size_t> input_indices = variables.get_inputs_indices();
 
-    return data.get_submatrix(instances_indices, input_indices);
+    return get_data_submatrix(instances_indices, input_indices);
 }
 
 
@@ -807,7 +811,62 @@ Matrix<double> DataSet::get_targets(const Vector<size_t>& instances_indices) con
 {
     const Vector<size_t> target_indices = variables.get_targets_indices();
 
-    return data.get_submatrix(instances_indices, target_indices);
+    return get_data_submatrix(instances_indices, target_indices);
+}
+
+
+/// Returns true if the data is held in a memory mapped column store instead of the data matrix,
+/// and false otherwise.
+
+bool DataSet::has_column_store() const
+{
+    return(column_store.is_open());
+}
+
+
+/// Returns a reference to the column store which holds the data, if any.
+
+const ColumnStore& DataSet::get_column_store() const
+{
+    return(column_store);
+}
+
+
+/// Returns the training instances split into batches of a given size, together with their inputs and targets.
+/// The batches are gathered the first time they are requested and reused in subsequent calls,
+/// as long as the data, the training instances and the input and target variables do not change.
+/// With a column store, each batch is read when it is used, with Batches::get_inputs() and Batches::get_targets().
+/// @param batch_size Maximum number of instances in each batch.
+
+const DataSet::Batches& DataSet::get_training_batches(const size_t& batch_size) const
+{
+    update_batches(training_batches, instances.get_training_batches(batch_size), batch_size);
+
+    return training_batches;
+}
+
+
+/// Returns the selection instances split into batches of a given size, together with their inputs and targets.
+/// The batches are gathered the first time they are requested and reused in subsequent calls,
+/// as long as the data, the selection instances and the input and target variables do not change.
+/// With a column store, each batch is read when it is used, with Batches::get_inputs() and Batches::get_targets().
+/// @param batch_size Maximum number of instances in each batch.
+
+const DataSet::Batches& DataSet::get_selection_batches(const size_t& batch_size) const
+{
+    update_batches(selection_batches, instances.get_selection_batches(batch_size), batch_size);
+
+    return selection_batches;
+}
+
+
+/// Releases the inputs and targets gathered for the training and selection batches.
+/// This method is called by every method which modifies the data matrix.
+
+void DataSet::clear_batches() const
+{
+    training_batches = Batches();
+    selection_batches = Batches();
 }
 
 Matrix<double> DataSet::get_used_data() const
@@ -816,7 +875,7 @@ Matrix<double> DataSet::get_used_data() const
 
    const Vector<size_t> variables_indices = variables.get_used_indices();
 
-   return(data.get_submatrix(instances_indices, variables_indices));
+   return(get_data_submatrix(instances_indices, variables_indices));
 }
 
 
@@ -830,7 +889,7 @@ Matrix<double> DataSet::get_used_inputs() const
 
    const Vector<size_t> input_indices = variables.get_inputs_indices();
 
-   return(data.get_submatrix(indices, input_indices));
+   return(get_data_submatrix(indices, input_indices));
 }
 
 
@@ -844,7 +903,7 @@ Matrix<double> DataSet::get_used_targets() const
 
    const Vector<size_t> targets_indices = variables.get_targets_indices();
 
-   return(data.get_submatrix(indices, targets_indices));
+   return(get_data_submatrix(indices, targets_indices));
 }
 
 
@@ -858,7 +917,7 @@ Matrix<double> DataSet::get_training_inputs() const
 
    const Vector<size_t> training_indices = instances.get_training_indices();
 
-   return(data.get_submatrix(training_indices, inputs_indices));
+   return(get_data_submatrix(training_indices, inputs_indices));
 }
 
 
@@ -872,7 +931,7 @@ Matrix<double> DataSet::get_training_targets() const
 
    const Vector<size_t> targets_indices = variables.get_targets_indices();
 
-   return(data.get_submatrix(training_indices, targets_indices));
+   return(get_data_submatrix(training_indices, targets_indices));
 }
 
 
@@ -886,7 +945,7 @@ Matrix<double> DataSet::get_selection_inputs() const
 
    const Vector<size_t> inputs_indices = variables.get_inputs_indices();
 
-   return(data.get_submatrix(selection_indices, inputs_indices));
+   return(get_data_submatrix(selection_indices, inputs_indices));
 }
 
 
@@ -900,7 +959,7 @@ Matrix<double> DataSet::get_selection_targets() const
 
    const Vector<size_t> targets_indices = variables.get_targets_indices();
 
-   return(data.get_submatrix(selection_indices, targets_indices));
+   return(get_data_submatrix(selection_indices, targets_indices));
 }
 
 
@@ -914,7 +973,7 @@ Matrix<double> DataSet::get_testing_inputs() const
 
    const Vector<size_t> testing_indices = instances.get_testing_indices();
 
-   return(data.get_submatrix(testing_indices, inputs_indices));
+   return(get_data_submatrix(testing_indices, inputs_indices));
 }
 
 
@@ -928,7 +987,7 @@ Matrix<double> DataSet::get_testing_targets() const
 
    const Vector<size_t> testing_indices = instances.get_testing_indices();
 
-   return(data.get_submatrix(testing_indices, targets_indices));
+   return(get_data_submatrix(testing_indices, targets_indices));
 }
 
 
@@ -1272,7 +1331,7 @@ Matrix<double> DataSet::get_variables(const Vector<size_t>& variables_indices, c
 
    // Get variables
 
-   return(data.get_submatrix(instances_indices, variables_indices));
+   return(get_data_submatrix(instances_indices, variables_indices));
 }
 
 
@@ -1280,6 +1339,8 @@ Matrix<double> DataSet::get_variables(const Vector<size_t>& variables_indices, c
 
 void DataSet::set()
 {
+   clear_batches();
+
    data_file_name = "";
 
    first_cell = "";
@@ -1287,6 +1348,8 @@ void DataSet::set()
 
    data.set();
 
+   column_store.close();
+
    variables.set();
    instances.set();
 
@@ -1303,6 +1366,8 @@ void DataSet::set()
 
 void DataSet::set(const Matrix<double>& new_data)
 {
+   clear_batches();
+
    data_file_name = "";
 
    const size_t variables_number = new_data.get_columns_number();
@@ -1322,6 +1387,8 @@ void DataSet::set(const Matrix<double>& new_data)
 
 void DataSet::set(const Eigen::MatrixXd& new_data)
 {
+   clear_batches();
+
    data_file_name = "";
 
    const size_t variables_number = static_cast<size_t>(new_data.cols());
@@ -1351,6 +1418,8 @@ void DataSet::set(const Eigen::MatrixXd& new_data)
 
 void DataSet::set(const size_t& new_instances_number, const size_t& new_variables_number)
 {
+    clear_batches();
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -1381,6 +1450,8 @@ void DataSet::set(const size_t& new_instances_number, const size_t& new_variable
 
    data.set(new_instances_number, new_variables_number);
 
+   column_store.close();
+
    instances.set(new_instances_number);
 
    variables.set(new_variables_number);
@@ -1401,6 +1472,8 @@ void DataSet::set(const size_t& new_instances_number, const size_t& new_variable
 
 void DataSet::set(const size_t& new_instances_number, const size_t& new_inputs_number, const size_t& new_targets_number)
 {
+   clear_batches();
+
    data_file_name = "";
 
    const size_t new_variables_number = new_inputs_number + new_targets_number;
@@ -1424,6 +1497,8 @@ void DataSet::set(const size_t& new_instances_number, const size_t& new_inputs_n
 
 void DataSet::set(const DataSet& other_data_set)
 {
+   clear_batches();
+
    data_file_name = other_data_set.data_file_name;
 
    header_line = other_data_set.header_line;
@@ -1434,6 +1509,8 @@ void DataSet::set(const DataSet& other_data_set)
 
    data = other_data_set.data;
 
+   column_store = other_data_set.column_store;
+
    variables = other_data_set.variables;
 
    instances = other_data_set.instances;
@@ -1506,7 +1583,48 @@ void DataSet::set_default()
 }
 
 
-/// Send the DataSet to all the processors using MPI.
+#ifdef __OPENNN_MPI__
+
+/// Sends a block of values to another MPI process, in messages of at most INT_MAX values,
+/// which is the largest count that MPI accepts.
+/// @param data Pointer to the first value.
+/// @param values_number Number of values.
+/// @param destination Rank of the receiving process.
+
+static void send_MPI(const double* data, const size_t& values_number, const int& destination)
+{
+    for(size_t first = 0; first < values_number; first += static_cast<size_t>(INT_MAX))
+    {
+        const int count = static_cast<int>(min(values_number - first, static_cast<size_t>(INT_MAX)));
+
+        MPI_Send(data + first, count, MPI_DOUBLE, destination, 0, MPI_COMM_WORLD);
+    }
+}
+
+
+/// Receives a block of values sent by another MPI process with send_MPI.
+/// @param data Pointer to the first value, which must have room for all of them.
+/// @param values_number Number of values.
+/// @param source Rank of the sending process.
+
+static void receive_MPI(double* data, const size_t& values_number, const int& source)
+{
+    for(size_t first = 0; first < values_number; first += static_cast<size_t>(INT_MAX))
+    {
+        const int count = static_cast<int>(min(values_number - first, static_cast<size_t>(INT_MAX)));
+
+        MPI_Recv(data + first, count, MPI_DOUBLE, source, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    }
+}
+
+#endif
+
+
+/// Distributes the training and selection instances of a data set among all the MPI processes.
+/// Each process receives a contiguous shard of the training instances and of the selection instances.
+/// The first process gathers and sends the shards one at a time, so that it only holds one of them besides the data set.
+/// The variables are broadcast from the first process.
+/// The loss indices then sum the errors and gradients of all the shards with MPI_Allreduce.
 /// @param data_set Original DataSet object, initialized by processor 0.
 
 void DataSet::set_MPI(const DataSet* data_set)
@@ -1519,204 +1637,198 @@ void DataSet::set_MPI(const DataSet* data_set)
     int rank;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-    int training_instances_number;
-    int selection_instances_number;
+    // Variables and instances numbers
 
-    int inputs_number;
-    int outputs_number;
+    Vector<char> variables_XML;
 
-    Vector<int> inputs_indices;
-    Vector<int> targets_indices;
+    Vector<unsigned long long> numbers(3, 0);
 
     Vector<size_t> training_indices;
     Vector<size_t> selection_indices;
 
     if(rank == 0)
     {
-        // Variables to send initialization
-
-        const Instances& instances = data_set->get_instances();
+        const tinyxml2::XMLDocument* document = data_set->get_variables().to_XML();
 
-        training_instances_number = (int)instances.get_training_instances_number();
-        selection_instances_number = (int)instances.get_selection_instances_number();
+        tinyxml2::XMLPrinter printer;
 
-        training_indices = instances.get_training_indices();
-        selection_indices = instances.get_selection_indices();
+        document->Print(&printer);
 
-        const Variables& variables = data_set->get_variables();
+        delete document;
 
-        inputs_indices = variables.get_inputs_indices_int();
-        targets_indices = variables.get_targets_indices_int();
+        const string buffer(printer.CStr());
 
-        inputs_number = (int)variables.get_inputs_number();
-        outputs_number = (int)variables.get_targets_number();
-    }
+        variables_XML = Vector<char>(buffer.begin(), buffer.end());
 
-    // Send variables
+        training_indices = data_set->get_instances().get_training_indices();
+        selection_indices = data_set->get_instances().get_selection_indices();
 
-    MPI_Barrier(MPI_COMM_WORLD);
+        numbers[0] = static_cast<unsigned long long>(data_set->get_variables().get_variables_number());
+        numbers[1] = static_cast<unsigned long long>(training_indices.size());
+        numbers[2] = static_cast<unsigned long long>(selection_indices.size());
+    }
 
-    if(rank > 0)
-    {
-        MPI_Request req[4];
+    variables_XML.set_MPI(MPI_CHAR);
 
-        MPI_Irecv(&inputs_number, 1, MPI_INT, rank-1, 1, MPI_COMM_WORLD, &req[0]);
-        MPI_Irecv(&outputs_number, 1, MPI_INT, rank-1, 2, MPI_COMM_WORLD, &req[1]);
+    numbers.set_MPI(MPI_UNSIGNED_LONG_LONG);
 
-        MPI_Waitall(2, req, MPI_STATUS_IGNORE);
+    const size_t variables_number = static_cast<size_t>(numbers[0]);
+    const size_t training_instances_number = static_cast<size_t>(numbers[1]);
+    const size_t selection_instances_number = static_cast<size_t>(numbers[2]);
 
-        inputs_indices.set(inputs_number);
-        targets_indices.set(outputs_number);
+    // Shards, which are the same as those of get_MPI_shard_indices
 
-        MPI_Irecv(&training_instances_number, 1, MPI_INT, rank-1, 5, MPI_COMM_WORLD, &req[0]);
-        MPI_Irecv(&selection_instances_number, 1, MPI_INT, rank-1, 6, MPI_COMM_WORLD, &req[1]);
+    const size_t processes_number = static_cast<size_t>(size);
 
-        MPI_Irecv(inputs_indices.data(),(int)inputs_number, MPI_INT, rank-1, 7, MPI_COMM_WORLD, &req[2]);
-        MPI_Irecv(targets_indices.data(),(int)outputs_number, MPI_INT, rank-1, 8, MPI_COMM_WORLD, &req[3]);
+    Vector<size_t> training_shards_begins(processes_number+1);
+    Vector<size_t> selection_shards_begins(processes_number+1);
 
-        MPI_Waitall(4, req, MPI_STATUS_IGNORE);
+    for(size_t i = 0; i <= processes_number; i++)
+    {
+        training_shards_begins[i] = i*training_instances_number/processes_number;
+        selection_shards_begins[i] = i*selection_instances_number/processes_number;
     }
 
-    if(rank < size-1)
-    {
-        MPI_Request req[6];
+    const size_t process = static_cast<size_t>(rank);
 
-        MPI_Isend(&inputs_number, 1, MPI_INT, rank+1, 1, MPI_COMM_WORLD, &req[0]);
-        MPI_Isend(&outputs_number, 1, MPI_INT, rank+1, 2, MPI_COMM_WORLD, &req[1]);
+    const size_t training_shard_size = training_shards_begins[process+1] - training_shards_begins[process];
+    const size_t selection_shard_size = selection_shards_begins[process+1] - selection_shards_begins[process];
 
-        MPI_Isend(&training_instances_number, 1, MPI_INT, rank+1, 5, MPI_COMM_WORLD, &req[2]);
-        MPI_Isend(&selection_instances_number, 1, MPI_INT, rank+1, 6, MPI_COMM_WORLD, &req[3]);
+    Matrix<double> shard_data;
 
-        MPI_Isend(inputs_indices.data(),(int)inputs_number, MPI_INT, rank+1, 7, MPI_COMM_WORLD, &req[4]);
-        MPI_Isend(targets_indices.data(),(int)outputs_number, MPI_INT, rank+1, 8, MPI_COMM_WORLD, &req[5]);
+    if(rank == 0)
+    {
+        const Vector<size_t> variables_indices(0, 1, variables_number-1);
 
-        MPI_Waitall(6, req, MPI_STATUS_IGNORE);
-    }
+        // The shard of the first process is sent last, and kept
 
-    size = min(size,static_cast<int>(training_instances_number));
+        for(size_t i = 1; i <= processes_number; i++)
+        {
+            const size_t destination = i%processes_number;
+
+            Vector<size_t> shard_indices(training_indices.begin() + static_cast<long>(training_shards_begins[destination]),
+                                         training_indices.begin() + static_cast<long>(training_shards_begins[destination+1]));
 
-    // Get the group of processes in MPI_COMM_WORLD
-    MPI_Group world_group;
-    MPI_Comm_group(MPI_COMM_WORLD, &world_group);
+            shard_indices = shard_indices.assemble(Vector<size_t>(selection_indices.begin() + static_cast<long>(selection_shards_begins[destination]),
+                                                                  selection_indices.begin() + static_cast<long>(selection_shards_begins[destination+1])));
 
-    int* ranks = (int*)malloc(size*sizeof(int));
+            shard_data = data_set->get_data_submatrix(shard_indices, variables_indices);
 
-    for(int i = 0; i < size; i++)
+            if(destination != 0)
+            {
+                send_MPI(shard_data.data(), shard_data.size(), static_cast<int>(destination));
+            }
+        }
+    }
+    else
     {
-        ranks[i] = i;
+        shard_data.set(training_shard_size + selection_shard_size, variables_number);
+
+        receive_MPI(shard_data.data(), shard_data.size(), 0);
     }
 
-    // Construct a group containing all of the prime ranks in world_group
-    MPI_Group error_group;
-    MPI_Group_incl(world_group, size, ranks, &error_group);
+    if(data_set != this)
+    {
+        const string buffer(variables_XML.begin(), variables_XML.end());
 
-    // Create a new communicator based on the group
-    MPI_Comm error_comm;
-    MPI_Comm_create(MPI_COMM_WORLD, error_group, &error_comm);
+        tinyxml2::XMLDocument document;
 
-    int i = 0;
+        document.Parse(buffer.c_str());
 
-    Vector<size_t> training_instances_per_processor(size);
-    Vector<size_t> selection_instances_per_processor(size);
+        variables.from_XML(document);
+    }
 
-    for(i = 0; i < size; i++)
-    {
-        training_instances_per_processor[i] = (size_t)(training_instances_number/size);
-        selection_instances_per_processor[i] = (size_t)(selection_instances_number/size);
+    set_shard(shard_data, training_shard_size, selection_shard_size);
 
-        if(i < training_instances_number%size)
-        {
-            training_instances_per_processor[i]++;
-        }
-        if(i < selection_instances_number%size)
-        {
-            selection_instances_per_processor[i]++;
-        }
-    }
+#else
 
-    Matrix<double> processor_data;
+    set(*data_set);
 
-    // Append training instances
+#endif
+}
 
-    if(rank != 0 && rank < size)
-    {
-        processor_data.set(inputs_number+outputs_number, training_instances_per_processor[rank]+selection_instances_per_processor[rank]);
 
-        for(int j = 0; j < training_instances_per_processor[rank]; j++)
-        {
-            MPI_Recv(processor_data.data()+ (j*(inputs_number+outputs_number)),(int)(inputs_number+outputs_number), MPI_DOUBLE, 0, j, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-        }
+/// Keeps in each MPI process only its contiguous shard of the training instances and of the selection instances.
+/// All the processes must have loaded the same data set, for instance with load_data().
+/// Scaling statistics should be computed before calling this method, since they would then only refer to one shard.
+/// Without MPI, the data set does not change.
 
-        for(int j = 0; j < selection_instances_per_processor[rank]; j++)
-        {
-            MPI_Recv(processor_data.data()+ ((j+training_instances_per_processor[rank])*(inputs_number+outputs_number)),
-                     (int)(inputs_number+outputs_number), MPI_DOUBLE, 0, j+ (int)training_instances_per_processor[rank], MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-        }
+void DataSet::set_MPI_shard()
+{
+#ifdef __OPENNN_MPI__
 
-        processor_data = processor_data.calculate_transpose();
-    }
-    else if(rank == 0)
-    {
-        size_t training_instances_sent = training_instances_per_processor[rank];
-        size_t selection_instances_sent = selection_instances_per_processor[rank];
+    const Vector<size_t> training_indices = get_MPI_shard_indices(instances.get_training_indices());
+    const Vector<size_t> selection_indices = get_MPI_shard_indices(instances.get_selection_indices());
 
-        for(i = 1; i < size; i++)
-        {
-            for(int j = 0; j < training_instances_per_processor[i]; j++)
-            {
-                const Vector<double> instance_to_send = data_set->get_instance(training_indices[training_instances_sent]);
+    const Vector<size_t> variables_indices(0, 1, variables.get_variables_number()-1);
 
-                MPI_Send(instance_to_send.data(),(int)(inputs_number+outputs_number), MPI_DOUBLE, i, j, MPI_COMM_WORLD);
+    const Matrix<double> shard_data = get_data_submatrix(training_indices.assemble(selection_indices), variables_indices);
 
-                training_instances_sent++;
-            }
-            for(int j = 0; j < selection_instances_per_processor[i]; j++)
-            {
-                const Vector<double> instance_to_send = data_set->get_instance(selection_indices[selection_instances_sent]);
+    set_shard(shard_data, training_indices.size(), selection_indices.size());
 
-                MPI_Send(instance_to_send.data(),(int)(inputs_number+outputs_number), MPI_DOUBLE, i, j+ (int)training_instances_per_processor[i], MPI_COMM_WORLD);
+#endif
+}
 
-                selection_instances_sent++;
-            }
-        }
 
-        processor_data.set(training_instances_per_processor[rank]+selection_instances_per_processor[rank],inputs_number+outputs_number);
+/// Returns the contiguous part of a list of instances indices which corresponds to this MPI process.
+/// The sizes of the parts of two processes differ at most in one.
+/// Without MPI, it returns all the indices.
+/// @param indices Indices of the instances to be distributed.
 
-        for(i = 0; i < training_instances_per_processor[rank]; i++)
-        {
-            const Vector<double> instance_to_append = data_set->get_instance(training_indices[i]);
+Vector<size_t> DataSet::get_MPI_shard_indices(const Vector<size_t>& indices) const
+{
+#ifdef __OPENNN_MPI__
 
-            processor_data.set_row(i, instance_to_append);
-        }
-        for(i = 0; i < selection_instances_per_processor[rank]; i++)
-        {
-            const Vector<double> instance_to_append = data_set->get_instance(selection_indices[i]);
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
 
-            processor_data.set_row(i+training_instances_per_processor[rank], instance_to_append);
-        }
-    }
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    const size_t indices_number = indices.size();
 
-    if(rank < size)
-    {
-        set_data(processor_data);
-        get_variables_pointer()->set_unuse();
-        get_variables_pointer()->set_input_indices(inputs_indices);
-        get_variables_pointer()->set_target_indices(targets_indices);
-        get_instances_pointer()->split_sequential_indices(static_cast<double>(training_instances_per_processor[rank]),static_cast<double>(selection_instances_per_processor[rank]), 0.0);
-    }
+    const size_t first = static_cast<size_t>(rank)*indices_number/static_cast<size_t>(size);
+    const size_t last = static_cast<size_t>(rank+1)*indices_number/static_cast<size_t>(size);
 
-    free(ranks);
+    return Vector<size_t>(indices.begin() + static_cast<long>(first), indices.begin() + static_cast<long>(last));
 
 #else
 
-    set(*data_set);
+    return indices;
 
 #endif
 }
 
 
+/// Replaces the data by a shard of instances, keeping the variables.
+/// The first instances of the shard are used for training, and the rest for selection.
+/// @param shard_data Data of the instances in the shard.
+/// @param training_instances_number Number of training instances in the shard.
+/// @param selection_instances_number Number of selection instances in the shard.
+
+void DataSet::set_shard(const Matrix<double>& shard_data, const size_t& training_instances_number, const size_t& selection_instances_number)
+{
+    const Variables shard_variables(variables);
+
+    column_store.close();
+
+    set_data(shard_data);
+
+    variables = shard_variables;
+
+    missing_values.set(shard_data.get_rows_number(), shard_data.get_columns_number());
+
+    Vector<Instances::Use> uses(training_instances_number + selection_instances_number, Instances::Training);
+
+    for(size_t i = training_instances_number; i < uses.size(); i++)
+    {
+        uses[i] = Instances::Selection;
+    }
+
+    instances.set_uses(uses);
+}
+
+
 /// Sets a new data matrix.
 /// The number of rows must be equal to the number of instances.
 /// The number of columns must be equal to the number of variables.
@@ -1725,6 +1837,8 @@ void DataSet::set_MPI(const DataSet* data_set)
 
 void DataSet::set_data(const Matrix<double>& new_data)
 {
+   clear_batches();
+
    // Control sentence(if debug)
 /*
    #ifdef __OPENNN_DEBUG__
@@ -1761,6 +1875,8 @@ void DataSet::set_data(const Matrix<double>& new_data)
 */
    // Set data
 
+   column_store.close();
+
    data = new_data;
 
    instances.set_instances_number(data.get_rows_number());
@@ -2032,6 +2148,10 @@ void DataSet::set_angular_units(AngularUnits& new_angular_units)
 
 void DataSet::set_instances_number(const size_t& new_instances_number)
 {
+   check_data_in_memory("void set_instances_number(const size_t&) method");
+
+   clear_batches();
+
    const size_t variables_number = variables.get_variables_number();
 
    data.set(new_instances_number, variables_number);
@@ -2047,6 +2167,10 @@ void DataSet::set_instances_number(const size_t& new_instances_number)
 
 void DataSet::set_variables_number(const size_t& new_variables_number)
 {
+   check_data_in_memory("void set_variables_number(const size_t&) method");
+
+   clear_batches();
+
    const size_t instances_number = instances.get_instances_number();
 
    data.set(instances_number, new_variables_number);
@@ -2061,6 +2185,10 @@ void DataSet::set_variables_number(const size_t& new_variables_number)
 
 void DataSet::set_instance(const size_t& instance_index, const Vector<double>& instance)
 {
+   check_data_in_memory("void set_instance(const size_t&, const Vector<double>&) method");
+
+   clear_batches();
+
    // Control sentence(if debug)
 
    #ifdef __OPENNN_DEBUG__
@@ -2108,6 +2236,10 @@ void DataSet::set_instance(const size_t& instance_index, const Vector<double>& i
 
 void DataSet::add_instance(const Vector<double>& instance)
 {
+   check_data_in_memory("void add_instance(const Vector<double>&) method");
+
+   clear_batches();
+
    // Control sentence(if debug)
 
    #ifdef __OPENNN_DEBUG__
@@ -2143,6 +2275,10 @@ void DataSet::add_instance(const Vector<double>& instance)
 
 void DataSet::remove_instance(const size_t& instance_index)
 {
+    check_data_in_memory("void remove_instance(const size_t&) method");
+
+    clear_batches();
+
     const size_t instances_number = instances.get_instances_number();
 
    // Control sentence(if debug)
@@ -2174,6 +2310,10 @@ void DataSet::remove_instance(const size_t& instance_index)
 
 void DataSet::append_variable(const Vector<double>& variable, const string& variable_name)
 {
+   check_data_in_memory("void append_variable(const Vector<double>&, const string&) method");
+
+   clear_batches();
+
    // Control sentence(if debug)
 
    #ifdef __OPENNN_DEBUG__
@@ -2222,6 +2362,10 @@ void DataSet::append_variable(const Vector<double>& variable, const string& vari
 
 void DataSet::remove_variable(const size_t& variable_index)
 {
+   check_data_in_memory("void remove_variable(const size_t&) method");
+
+   clear_batches();
+
    const size_t variables_number = variables.get_variables_number();
 
    // Control sentence(if debug)
@@ -2260,6 +2404,8 @@ void DataSet::remove_variable(const size_t& variable_index)
 
 void DataSet::remove_variable(const string& variable_name)
 {
+    check_data_in_memory("void remove_variable(const string&) method");
+
     const Vector<string> variable_names = variables.get_names();
 
     const Vector<size_t> variable_index = variable_names.calculate_equal_to_indices(variable_name);
@@ -2595,8 +2741,6 @@ Vector< Histogram<double> > DataSet::calculate_targets_histograms(const size_t&
    const size_t used_instances_number = instances.get_used_instances_number();
    const Vector<size_t> used_instances_indices = instances.get_used_indices();
 
-   const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
-
    Vector< Histogram<double> > histograms(targets_number);
 
    Vector<double> column(used_instances_number);
@@ -2605,7 +2749,7 @@ Vector< Histogram<double> > DataSet::calculate_targets_histograms(const size_t&
    {
        column = data.get_column(targets_indices[i], used_instances_indices);
 
-       histograms[i] = column.calculate_histogram_missing_values(missing_indices[i], bins_number);
+       histograms[i] = column.calculate_histogram_missing_mask(missing_values.get_missing_mask(targets_indices[i], used_instances_indices), bins_number);
    }
 
    return(histograms);
@@ -2768,9 +2912,9 @@ size_t DataSet::calculate_testing_negatives(const size_t& target_index) const
 
 Vector< Statistics<double> > DataSet::calculate_data_statistics() const
 {
-    const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
+    const Vector<size_t> instances_indices(0, 1, instances.get_instances_number()-1);
 
-    return(data.calculate_statistics_missing_values(missing_indices));
+    return(calculate_instances_statistics(instances_indices));
 }
 
 
@@ -3011,9 +3155,7 @@ Vector< Statistics<double> > DataSet::calculate_training_instances_statistics()
 {
    const Vector<size_t> training_indices = instances.get_training_indices();
 
-   const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
-
-   return(data.calculate_rows_statistics_missing_values(training_indices, missing_indices));
+   return(calculate_instances_statistics(training_indices));
 }
 
 
@@ -3030,9 +3172,7 @@ Vector< Statistics<double> > DataSet::calculate_selection_instances_statistics()
 {
     const Vector<size_t> selection_indices = instances.get_selection_indices();
 
-    const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
-
-   return(data.calculate_rows_statistics_missing_values(selection_indices, missing_indices));
+    return(calculate_instances_statistics(selection_indices));
 }
 
 
@@ -3049,9 +3189,7 @@ Vector< Statistics<double> > DataSet::calculate_testing_instances_statistics() c
 {
     const Vector<size_t> testing_indices = instances.get_testing_indices();
 
-    const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
-
-   return(data.calculate_rows_statistics_missing_values(testing_indices, missing_indices));
+    return(calculate_instances_statistics(testing_indices));
 }
 
 
@@ -3132,6 +3270,11 @@ Vector< Statistics<double> > DataSet::calculate_inputs_statistics() const
         used_indices[static_cast<size_t>(i)] = used_instances.get_difference(missing_values.get_missing_instances(inputs_indices[static_cast<size_t>(i)]));
     }
 
+    if(column_store.is_open())
+    {
+        return(column_store.calculate_statistics(used_indices, inputs_indices));
+    }
+
     return(data.calculate_statistics(used_indices, inputs_indices));
 }
 
@@ -3162,6 +3305,11 @@ Vector< Statistics<double> > DataSet::calculate_targets_statistics() const
        used_indices[static_cast<size_t>(i)] = used_instances.get_difference(missing_values.get_missing_instances(targets_indices[static_cast<size_t>(i)]));
    }
 
+   if(column_store.is_open())
+   {
+       return(column_store.calculate_statistics(used_indices, targets_indices));
+   }
+
    return(data.calculate_statistics(used_indices, targets_indices));
 }
 
@@ -3199,16 +3347,9 @@ Vector<double> DataSet::calculate_variables_means(const Vector<size_t>& variable
 
 Statistics<double> DataSet::calculate_input_statistics(const size_t& input_index) const
 {
-    Vector<size_t> missing_indices = missing_values.get_missing_indices()[input_index];
-
-    const Vector<size_t> unused_instances_indices = instances.get_unused_indices();
-
-    for(size_t i = 0; i < unused_instances_indices.size(); i++)
-    {
-        missing_indices.push_back(unused_instances_indices[i]);
-    }
+    const Vector<size_t> used_instances_indices = instances.get_used_indices();
 
-   return(data.get_column(input_index).calculate_statistics_missing_values(missing_indices));
+    return(data.get_column(input_index, used_instances_indices).calculate_statistics_missing_mask(missing_values.get_missing_mask(input_index, used_instances_indices)));
 }
 
 
@@ -3285,6 +3426,8 @@ Vector< Vector< Vector<double> > > DataSet::calculate_means_columns() const
 /// Calculates the linear correlations between all outputs and all inputs.
 /// It returns a matrix with number of rows the targets number and number of columns the inputs number.
 /// Each element contains the linear correlation between a single target and a single output.
+/// The linear correlations are calculated all together from the used instances, and the logistic correlation is used instead
+/// when only one of the variables is binary.
 
 Matrix<double> DataSet::calculate_input_target_correlations() const
 {
@@ -3294,9 +3437,27 @@ Matrix<double> DataSet::calculate_input_target_correlations() const
    const Vector<size_t> input_indices = variables.get_inputs_indices();
    const Vector<size_t> target_indices = variables.get_targets_indices();
 
+   const Vector<size_t> used_instances_indices = instances.get_used_indices();
    const Vector<size_t> unused_instances_indices = instances.get_unused_indices();
 
-   Matrix<double> correlations(inputs_number, targets_number);
+   const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
+
+   Matrix<double> correlations = CorrelationAnalysis::calculate_linear_correlations_missing_values(data, used_instances_indices,
+                                                                                                   input_indices, target_indices,
+                                                                                                   missing_indices);
+
+   Vector<bool> binary_inputs(inputs_number);
+   Vector<bool> binary_targets(targets_number);
+
+   for(size_t i = 0; i < inputs_number; i++)
+   {
+       binary_inputs[i] = data.get_column(input_indices[i]).is_binary();
+   }
+
+   for(size_t j = 0; j < targets_number; j++)
+   {
+       binary_targets[j] = data.get_column(target_indices[j]).is_binary();
+   }
 
     #ifndef __OPENNN_MPI__
     #pragma omp parallel for
@@ -3306,25 +3467,34 @@ Matrix<double> DataSet::calculate_input_target_correlations() const
    {
        const size_t input_index = input_indices[static_cast<size_t>(i)];
 
-       Vector<double> input_variable = data.get_column(input_index);
-
-       const bool binary_input = input_variable.is_binary();
+       const bool binary_input = binary_inputs[static_cast<size_t>(i)];
 
-       if(binary_input && input_variable.contains(-1))
-       {
-           input_variable = input_variable.replace_value(-1,0);
-       }
+       Vector<double> input_variable;
 
-       const Vector<size_t> input_missing_instances = missing_values.get_missing_instances(input_index);
+       Vector<size_t> input_missing_instances;
 
        for(size_t j = 0; j < targets_number; j++)
        {
+           const bool binary_target = binary_targets[j];
+
+           if(binary_input == binary_target) continue;
+
+           if(input_variable.empty())
+           {
+               input_variable = data.get_column(input_index);
+
+               if(binary_input && input_variable.contains(-1))
+               {
+                   input_variable = input_variable.replace_value(-1,0);
+               }
+
+               input_missing_instances = missing_values.get_missing_instances(input_index);
+           }
+
            const size_t target_index = target_indices[j];
 
            Vector<double> target_variable = data.get_column(target_index);
 
-           const bool binary_target = target_variable.is_binary();
-
            if(binary_target && target_variable.contains(-1))
            {
                target_variable = target_variable.replace_value(-1,0);
@@ -3336,25 +3506,13 @@ Matrix<double> DataSet::calculate_input_target_correlations() const
 
            const Vector<size_t> this_unused_instances = missing_instances.get_union(unused_instances_indices);
 
-           if(!binary_input && !binary_target)
-           {
-               correlations(static_cast<size_t>(i),j) = CorrelationAnalysis::calculate_linear_correlation_missing_values(input_variable,target_variable, this_unused_instances);
-           }
-           else if(!binary_input && binary_target)
+           if(binary_target)
            {
                correlations(static_cast<size_t>(i),j) = CorrelationAnalysis::calculate_logistic_correlation_missing_values(input_variable,target_variable, this_unused_instances);
            }
-           else if(binary_input && !binary_target)
-           {// asda
-               correlations(static_cast<size_t>(i),j) = CorrelationAnalysis::calculate_logistic_correlation_missing_values(target_variable,input_variable, this_unused_instances);
-           }
-           else if(binary_input && binary_target)
-           {
-               correlations(static_cast<size_t>(i),j) = CorrelationAnalysis::calculate_linear_correlation_missing_values(target_variable,target_variable, this_unused_instances);
-           }
            else
            {
-               cout << "Unknown case" << endl;
+               correlations(static_cast<size_t>(i),j) = CorrelationAnalysis::calculate_logistic_correlation_missing_values(target_variable,input_variable, this_unused_instances);
            }
        }
    }
@@ -3463,47 +3621,25 @@ void DataSet::print_top_input_target_correlations(const size_t& number) const
 }
 
 
+/// Calculates the linear correlations between all pairs of variables, over all the instances.
+/// The correlation of each pair only uses the instances in which both variables are not missing.
+
 Matrix<double> DataSet::calculate_variables_correlations() const
 {
     const size_t variables_number = variables.get_variables_number();
+    const size_t instances_number = instances.get_instances_number();
 
-    const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
-
-    Matrix<double> correlations(variables_number, variables_number, -99.9);
-
-    correlations.initialize_identity();
-
-    Vector<double> variable_i;
-    Vector<double> variable_j;
-
-    Vector<size_t> missing_indices_i;
-    Vector<size_t> missing_indices_j;
-
-    for(size_t i = 0; i < variables_number; i++)
-    {
-        variable_i = get_variable(i);
-
-        missing_indices_i = missing_indices[i];
-
-        for(size_t j = i; j < variables_number; j++)
-        {
-            variable_j = get_variable(j);
-
-            missing_indices_j = missing_indices[j];
+    Vector<size_t> variables_indices(variables_number);
+    variables_indices.initialize_sequential();
 
-            correlations(i,j) = CorrelationAnalysis::calculate_linear_correlation_missing_values(variable_i,variable_j, missing_indices_i.get_union(missing_indices_j));
-        }
-    }
+    Vector<size_t> instances_indices(instances_number);
+    instances_indices.initialize_sequential();
 
-    for(size_t i = 0; i < variables_number; i++)
-    {
-        for(size_t j = 0; j < i; j++)
-        {
-            correlations(i,j) = correlations(j,i);
-        }
-    }
+    const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
 
-    return(correlations);
+    return(CorrelationAnalysis::calculate_linear_correlations_missing_values(data, instances_indices,
+                                                                             variables_indices, variables_indices,
+                                                                             missing_indices));
 }
 
 
@@ -3563,6 +3699,7 @@ void DataSet::print_top_variables_correlations(const size_t& number) const
 /// Calculates the linear correlations between each input and each target variable.
 /// For nominal input variables it calculates the multiple linear correlation between all the classes of
 /// the input variable and the target.
+/// The multiple linear correlations are obtained from the linear correlations among the classes and with the target.
 /// @param nominal_variables Vector containing the classes of each nominal variable.
 
 Matrix<double> DataSet::calculate_multiple_linear_correlations(const Vector<size_t> & nominal_variables) const
@@ -3575,45 +3712,93 @@ Matrix<double> DataSet::calculate_multiple_linear_correlations(const Vector<size
     const size_t inputs_number = calculate_input_variables_number(nominal_variables);
     const Vector< Vector<size_t> > new_input_indices = get_inputs_indices(inputs_number, nominal_variables);
 
-    // Calculate correlations
+    const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
 
-    Matrix<double> multiple_linear_correlations(inputs_number, targets_number);
+    // Columns of all the inputs, and of the inputs with several classes
 
-    Matrix<double> input_variables;
-    Vector<size_t> input_indices;
+    Vector<size_t> columns_indices;
+    Vector<size_t> classes_indices;
 
-    Vector<double> target_variable;
-    size_t target_index;
+    Vector<size_t> first_columns(inputs_number);
+    Vector<size_t> first_classes(inputs_number);
 
     for(size_t i = 0; i < inputs_number; i++)
     {
-        for(size_t j = 0; j < targets_number; j++)
+        first_columns[i] = columns_indices.size();
+        first_classes[i] = classes_indices.size();
+
+        columns_indices.insert(columns_indices.end(), new_input_indices[i].begin(), new_input_indices[i].end());
+
+        if(new_input_indices[i].size() > 1)
         {
-            input_indices = new_input_indices[i];
+            classes_indices.insert(classes_indices.end(), new_input_indices[i].begin(), new_input_indices[i].end());
+        }
+    }
 
-            target_index = targets_indices[j];
+    // Calculate correlations
 
-            const Vector<size_t> current_missing_values = missing_values.get_missing_instances(input_indices)
-                                          .get_union(missing_values.get_missing_instances(target_index));
+    const Matrix<double> target_correlations = CorrelationAnalysis::calculate_linear_correlations_missing_values(data, used_instances_indices,
+                                                                                                                 columns_indices, targets_indices,
+                                                                                                                 missing_indices);
 
-            const Vector<size_t> current_used_indices = used_instances_indices.get_difference(current_missing_values);
+    Matrix<double> classes_correlations;
 
-            input_variables = data.get_submatrix(current_used_indices, input_indices);
+    if(!classes_indices.empty())
+    {
+        classes_correlations = CorrelationAnalysis::calculate_linear_correlations_missing_values(data, used_instances_indices,
+                                                                                                classes_indices, classes_indices,
+                                                                                                missing_indices);
+    }
 
-            target_variable = data.get_column(target_index, current_used_indices);
+    Matrix<double> multiple_linear_correlations(inputs_number, targets_number);
 
-            if(input_variables.get_columns_number() == 1)
-            {
-                multiple_linear_correlations(i,j) = CorrelationAnalysis::calculate_linear_correlation(input_variables.to_vector(), target_variable);
-            }
-            else
+    for(size_t i = 0; i < inputs_number; i++)
+    {
+        const size_t classes_number = new_input_indices[i].size();
+
+        if(classes_number == 1)
+        {
+            for(size_t j = 0; j < targets_number; j++)
             {
-                multiple_linear_correlations(i,j) = CorrelationAnalysis::calculate_multiple_linear_correlation(input_variables,target_variable);
+                multiple_linear_correlations(i,j) = target_correlations(first_columns[i],j);
             }
+
+            continue;
         }
-    }
 
-    return multiple_linear_correlations;
+        // The squared multiple correlation is c'R^+c, with R the correlations among the classes and c their correlations with the target.
+        // The pseudoinverse accounts for classes which add up to a constant.
+
+        const Eigen::Index classes = static_cast<Eigen::Index>(classes_number);
+
+        Eigen::MatrixXd classes_correlations_eigen(classes, classes);
+
+        for(Eigen::Index k = 0; k < classes; k++)
+        {
+            for(Eigen::Index l = 0; l < classes; l++)
+            {
+                classes_correlations_eigen(k,l) = classes_correlations(first_classes[i] + static_cast<size_t>(k), first_classes[i] + static_cast<size_t>(l));
+            }
+        }
+
+        const Eigen::CompleteOrthogonalDecomposition<Eigen::MatrixXd> decomposition(classes_correlations_eigen);
+
+        Eigen::VectorXd classes_target_correlations(classes);
+
+        for(size_t j = 0; j < targets_number; j++)
+        {
+            for(Eigen::Index k = 0; k < classes; k++)
+            {
+                classes_target_correlations(k) = target_correlations(first_columns[i] + static_cast<size_t>(k), j);
+            }
+
+            const double determination = classes_target_correlations.dot(decomposition.solve(classes_target_correlations));
+
+            multiple_linear_correlations(i,j) = sqrt(max(0.0, min(1.0, determination)));
+        }
+    }
+
+    return multiple_linear_correlations;
 }
 
 
@@ -3965,6 +4150,10 @@ Matrix<double> DataSet::perform_principal_components_analysis(const Matrix<doubl
 
 void DataSet::transform_principal_components_data(const Matrix<double>& principal_components)
 {
+    check_data_in_memory("void transform_principal_components_data(const Matrix<double>&) method");
+
+    clear_batches();
+
     const Matrix<double> targets = get_targets();
 
     remove_inputs_mean();
@@ -4004,6 +4193,10 @@ void DataSet::transform_principal_components_data(const Matrix<double>& principa
 
 void DataSet::scale_data_mean_standard_deviation(const Vector< Statistics<double> >& data_statistics)
 {
+   check_data_in_memory("void scale_data_mean_standard_deviation(const Vector< Statistics<double> >&) method");
+
+   clear_batches();
+
    // Control sentence(if debug)
 
    #ifdef __OPENNN_DEBUG__
@@ -4048,6 +4241,8 @@ void DataSet::scale_data_mean_standard_deviation(const Vector< Statistics<double
 
 Vector< Statistics<double> > DataSet::scale_data_minimum_maximum()
 {
+    check_data_in_memory("Vector< Statistics<double> > scale_data_minimum_maximum() method");
+
     const Vector< Statistics<double> > data_statistics = calculate_data_statistics();
 
     scale_data_minimum_maximum(data_statistics);
@@ -4062,6 +4257,8 @@ Vector< Statistics<double> > DataSet::scale_data_minimum_maximum()
 
 Vector< Statistics<double> > DataSet::scale_data_mean_standard_deviation()
 {
+    check_data_in_memory("Vector< Statistics<double> > scale_data_mean_standard_deviation() method");
+
     const Vector< Statistics<double> > data_statistics = calculate_data_statistics();
 
     scale_data_mean_standard_deviation(data_statistics);
@@ -4074,6 +4271,10 @@ Vector< Statistics<double> > DataSet::scale_data_mean_standard_deviation()
 
 void DataSet::remove_inputs_mean()
 {
+    check_data_in_memory("void remove_inputs_mean() method");
+
+    clear_batches();
+
     Vector< Statistics<double> > input_statistics = calculate_inputs_statistics();
 
     Vector<size_t> inputs_indices = variables.get_inputs_indices();
@@ -4149,6 +4350,10 @@ Vector<string> DataSet::calculate_default_scaling_methods() const
 
 void DataSet::scale_data_minimum_maximum(const Vector< Statistics<double> >& data_statistics)
 {
+    check_data_in_memory("void scale_data_minimum_maximum(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     const size_t variables_number = variables.get_variables_number();
 
    // Control sentence(if debug)
@@ -4198,6 +4403,8 @@ void DataSet::scale_data_minimum_maximum(const Vector< Statistics<double> >& dat
 
 void DataSet::scale_data(const string& scaling_unscaling_method_string, const Vector< Statistics<double> >& data_statistics)
 {
+   check_data_in_memory("void scale_data(const string&, const Vector< Statistics<double> >&) method");
+
    switch(get_scaling_unscaling_method(scaling_unscaling_method_string))
    {
       case MinimumMaximum:
@@ -4234,6 +4441,8 @@ void DataSet::scale_data(const string& scaling_unscaling_method_string, const Ve
 
 Vector< Statistics<double> > DataSet::scale_data(const string& scaling_unscaling_method)
 {
+   check_data_in_memory("Vector< Statistics<double> > scale_data(const string&) method");
+
    const Vector< Statistics<double> > statistics = data.calculate_statistics();
 
    switch(get_scaling_unscaling_method(scaling_unscaling_method))
@@ -4275,6 +4484,10 @@ Vector< Statistics<double> > DataSet::scale_data(const string& scaling_unscaling
 
 void DataSet::scale_inputs_mean_standard_deviation(const Vector< Statistics<double> >& inputs_statistics)
 {
+    check_data_in_memory("void scale_inputs_mean_standard_deviation(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     const Vector<size_t> inputs_indices = variables.get_inputs_indices();
 
     data.scale_columns_mean_standard_deviation(inputs_statistics, inputs_indices);
@@ -4287,6 +4500,8 @@ void DataSet::scale_inputs_mean_standard_deviation(const Vector< Statistics<doub
 
 Vector< Statistics<double> > DataSet::scale_inputs_mean_standard_deviation()
 {
+    check_data_in_memory("Vector< Statistics<double> > scale_inputs_mean_standard_deviation() method");
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -4319,6 +4534,10 @@ Vector< Statistics<double> > DataSet::scale_inputs_mean_standard_deviation()
 
 void DataSet::scale_input_mean_standard_deviation(const Statistics<double>& input_statistics, const size_t& input_index)
 {
+    check_data_in_memory("void scale_input_mean_standard_deviation(const Statistics<double>&, const size_t&) method");
+
+    clear_batches();
+
     Vector<double> column = data.get_column(input_index);
     column.scale_mean_standard_deviation(input_statistics);
 
@@ -4333,6 +4552,10 @@ void DataSet::scale_input_mean_standard_deviation(const Statistics<double>& inpu
 
 Statistics<double> DataSet::scale_input_mean_standard_deviation(const size_t& input_index)
 {
+    check_data_in_memory("Statistics<double> scale_input_mean_standard_deviation(const size_t&) method");
+
+    clear_batches();
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -4365,6 +4588,10 @@ Statistics<double> DataSet::scale_input_mean_standard_deviation(const size_t& in
 
 void DataSet::scale_input_standard_deviation(const Statistics<double>& input_statistics, const size_t& input_index)
 {
+    check_data_in_memory("void scale_input_standard_deviation(const Statistics<double>&, const size_t&) method");
+
+    clear_batches();
+
     Vector<double> column = data.get_column(input_index);
     column.scale_standard_deviation(input_statistics);
 
@@ -4379,6 +4606,10 @@ void DataSet::scale_input_standard_deviation(const Statistics<double>& input_sta
 
 Statistics<double> DataSet::scale_input_standard_deviation(const size_t& input_index)
 {
+    check_data_in_memory("Statistics<double> scale_input_standard_deviation(const size_t&) method");
+
+    clear_batches();
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -4411,6 +4642,10 @@ Statistics<double> DataSet::scale_input_standard_deviation(const size_t& input_i
 
 void DataSet::scale_inputs_minimum_maximum(const Vector< Statistics<double> >& inputs_statistics)
 {
+    check_data_in_memory("void scale_inputs_minimum_maximum(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     const Vector<size_t> inputs_indices = variables.get_inputs_indices();
 
     data.scale_columns_minimum_maximum(inputs_statistics, inputs_indices);
@@ -4423,6 +4658,8 @@ void DataSet::scale_inputs_minimum_maximum(const Vector< Statistics<double> >& i
 
 Vector< Statistics<double> > DataSet::scale_inputs_minimum_maximum()
 {
+    check_data_in_memory("Vector< Statistics<double> > scale_inputs_minimum_maximum() method");
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -4450,6 +4687,10 @@ Vector< Statistics<double> > DataSet::scale_inputs_minimum_maximum()
 
 Eigen::MatrixXd DataSet::scale_inputs_minimum_maximum_eigen()
 {
+    check_data_in_memory("Eigen::MatrixXd scale_inputs_minimum_maximum_eigen() method");
+
+    clear_batches();
+
     const Vector< Statistics<double> > inputs_statistics = scale_inputs_minimum_maximum();
 
     const size_t inputs_number = inputs_statistics.size();
@@ -4476,6 +4717,10 @@ Eigen::MatrixXd DataSet::scale_inputs_minimum_maximum_eigen()
 
 void DataSet::scale_input_minimum_maximum(const Statistics<double>& input_statistics, const size_t & input_index)
 {
+    check_data_in_memory("void scale_input_minimum_maximum(const Statistics<double>&, const size_t&) method");
+
+    clear_batches();
+
     Vector<double> column = data.get_column(input_index);
     column.scale_minimum_maximum(input_statistics);
 
@@ -4489,6 +4734,10 @@ void DataSet::scale_input_minimum_maximum(const Statistics<double>& input_statis
 
 Statistics<double> DataSet::scale_input_minimum_maximum(const size_t& input_index)
 {
+    check_data_in_memory("Statistics<double> scale_input_minimum_maximum(const size_t&) method");
+
+    clear_batches();
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -4521,6 +4770,8 @@ Statistics<double> DataSet::scale_input_minimum_maximum(const size_t& input_inde
 
 Vector< Statistics<double> > DataSet::scale_inputs(const string& scaling_unscaling_method)
 {
+    check_data_in_memory("Vector< Statistics<double> > scale_inputs(const string&) method");
+
     switch(get_scaling_unscaling_method(scaling_unscaling_method))
     {
     case NoScaling:
@@ -4563,6 +4814,8 @@ Vector< Statistics<double> > DataSet::scale_inputs(const string& scaling_unscali
 
 void DataSet::scale_inputs(const string& scaling_unscaling_method, const Vector< Statistics<double> >& inputs_statistics)
 {
+   check_data_in_memory("void scale_inputs(const string&, const Vector< Statistics<double> >&) method");
+
    switch(get_scaling_unscaling_method(scaling_unscaling_method))
    {
       case NoScaling:
@@ -4602,6 +4855,8 @@ void DataSet::scale_inputs(const string& scaling_unscaling_method, const Vector<
 
 void DataSet::scale_inputs(const Vector<string>& scaling_unscaling_methods, const Vector< Statistics<double> >& inputs_statistics)
 {
+    check_data_in_memory("void scale_inputs(const Vector<string>&, const Vector< Statistics<double> >&) method");
+
     const Vector<size_t> inputs_indices = variables.get_inputs_indices();
 
    for(size_t i = 0; i < scaling_unscaling_methods.size(); i++)
@@ -4654,6 +4909,10 @@ void DataSet::scale_inputs(const Vector<string>& scaling_unscaling_methods, cons
 
 void DataSet::scale_targets_mean_standard_deviation(const Vector< Statistics<double> >& targets_statistics)
 {
+    check_data_in_memory("void scale_targets_mean_standard_deviation(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     const Vector<size_t> targets_indices = variables.get_targets_indices();
 
     data.scale_columns_mean_standard_deviation(targets_statistics, targets_indices);
@@ -4666,6 +4925,8 @@ void DataSet::scale_targets_mean_standard_deviation(const Vector< Statistics<dou
 
 Vector< Statistics<double> > DataSet::scale_targets_mean_standard_deviation()
 {
+    check_data_in_memory("Vector< Statistics<double> > scale_targets_mean_standard_deviation() method");
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -4698,6 +4959,10 @@ Vector< Statistics<double> > DataSet::scale_targets_mean_standard_deviation()
 
 void DataSet::scale_targets_minimum_maximum(const Vector< Statistics<double> >& targets_statistics)
 {
+    check_data_in_memory("void scale_targets_minimum_maximum(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -4727,6 +4992,8 @@ void DataSet::scale_targets_minimum_maximum(const Vector< Statistics<double> >&
 
 Vector< Statistics<double> > DataSet::scale_targets_minimum_maximum()
 {
+   check_data_in_memory("Vector< Statistics<double> > scale_targets_minimum_maximum() method");
+
    const Vector< Statistics<double> > targets_statistics = calculate_targets_statistics();
 
    scale_targets_minimum_maximum(targets_statistics);
@@ -4737,6 +5004,10 @@ Vector< Statistics<double> > DataSet::scale_targets_minimum_maximum()
 
 Eigen::MatrixXd DataSet::scale_targets_minimum_maximum_eigen()
 {
+    check_data_in_memory("Eigen::MatrixXd scale_targets_minimum_maximum_eigen() method");
+
+    clear_batches();
+
     const Vector< Statistics<double> > targets_statistics = scale_targets_minimum_maximum();
 
     const size_t inputs_number = targets_statistics.size();
@@ -4762,6 +5033,10 @@ Eigen::MatrixXd DataSet::scale_targets_minimum_maximum_eigen()
 
 void DataSet::scale_targets_logarithmic(const Vector< Statistics<double> >& targets_statistics)
 {
+    check_data_in_memory("void scale_targets_logarithmic(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -4792,6 +5067,8 @@ void DataSet::scale_targets_logarithmic(const Vector< Statistics<double> >& targ
 
 Vector< Statistics<double> > DataSet::scale_targets_logarithmic()
 {
+   check_data_in_memory("Vector< Statistics<double> > scale_targets_logarithmic() method");
+
    const Vector< Statistics<double> > targets_statistics = calculate_targets_statistics();
 
    scale_targets_logarithmic(targets_statistics);
@@ -4807,6 +5084,8 @@ Vector< Statistics<double> > DataSet::scale_targets_logarithmic()
 
 Vector< Statistics<double> > DataSet::scale_targets(const string& scaling_unscaling_method)
 {
+    check_data_in_memory("Vector< Statistics<double> > scale_targets(const string&) method");
+
     switch(get_scaling_unscaling_method(scaling_unscaling_method))
    {
     case NoUnscaling:
@@ -4848,6 +5127,8 @@ Vector< Statistics<double> > DataSet::scale_targets(const string& scaling_unscal
 
 void DataSet::scale_targets(const string& scaling_unscaling_method, const Vector< Statistics<double> >& targets_statistics)
 {
+    check_data_in_memory("void scale_targets(const string&, const Vector< Statistics<double> >&) method");
+
     switch(get_scaling_unscaling_method(scaling_unscaling_method))
    {
     case NoUnscaling:
@@ -4894,6 +5175,10 @@ void DataSet::scale_targets(const string& scaling_unscaling_method, const Vector
 
 void DataSet::unscale_data_mean_standard_deviation(const Vector< Statistics<double> >& data_statistics)
 {
+   check_data_in_memory("void unscale_data_mean_standard_deviation(const Vector< Statistics<double> >&) method");
+
+   clear_batches();
+
    data.unscale_mean_standard_deviation(data_statistics);
 }
 
@@ -4905,6 +5190,10 @@ void DataSet::unscale_data_mean_standard_deviation(const Vector< Statistics<doub
 
 void DataSet::unscale_data_minimum_maximum(const Vector< Statistics<double> >& data_statistics)
 {
+   check_data_in_memory("void unscale_data_minimum_maximum(const Vector< Statistics<double> >&) method");
+
+   clear_batches();
+
    data.unscale_minimum_maximum(data_statistics);
 }
 
@@ -4916,6 +5205,10 @@ void DataSet::unscale_data_minimum_maximum(const Vector< Statistics<double> >& d
 
 void DataSet::unscale_inputs_mean_standard_deviation(const Vector< Statistics<double> >& data_statistics)
 {
+    check_data_in_memory("void unscale_inputs_mean_standard_deviation(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     const Vector<size_t> inputs_indices = variables.get_inputs_indices();
 
     data.unscale_columns_mean_standard_deviation(data_statistics, inputs_indices);
@@ -4929,6 +5222,10 @@ void DataSet::unscale_inputs_mean_standard_deviation(const Vector< Statistics<do
 
 void DataSet::unscale_inputs_minimum_maximum(const Vector< Statistics<double> >& data_statistics)
 {
+    check_data_in_memory("void unscale_inputs_minimum_maximum(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     const Vector<size_t> inputs_indices = variables.get_inputs_indices();
 
     data.unscale_columns_minimum_maximum(data_statistics, inputs_indices);
@@ -4942,6 +5239,10 @@ void DataSet::unscale_inputs_minimum_maximum(const Vector< Statistics<double> >&
 
 void DataSet::unscale_targets_mean_standard_deviation(const Vector< Statistics<double> >& targets_statistics)
 {    
+    check_data_in_memory("void unscale_targets_mean_standard_deviation(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     const Vector<size_t> targets_indices = variables.get_targets_indices();
 
     data.unscale_columns_mean_standard_deviation(targets_statistics, targets_indices);
@@ -4955,6 +5256,10 @@ void DataSet::unscale_targets_mean_standard_deviation(const Vector< Statistics<d
 
 void DataSet::unscale_targets_minimum_maximum(const Vector< Statistics<double> >& targets_statistics)
 {
+    check_data_in_memory("void unscale_targets_minimum_maximum(const Vector< Statistics<double> >&) method");
+
+    clear_batches();
+
     const Vector<size_t> targets_indices = variables.get_targets_indices();
 
     data.unscale_columns_minimum_maximum(targets_statistics, targets_indices);
@@ -4966,6 +5271,10 @@ void DataSet::unscale_targets_minimum_maximum(const Vector< Statistics<double> >
 
 void DataSet::initialize_data(const double& new_value)
 {
+   check_data_in_memory("void initialize_data(const double&) method");
+
+   clear_batches();
+
    data.initialize(new_value);
 }
 
@@ -4975,6 +5284,10 @@ void DataSet::initialize_data(const double& new_value)
 
 void DataSet::randomize_data_uniform(const double& minimum, const double& maximum)
 {
+   check_data_in_memory("void randomize_data_uniform(const double&, const double&) method");
+
+   clear_batches();
+
    data.randomize_uniform(minimum, maximum);
 }
 
@@ -4984,6 +5297,10 @@ void DataSet::randomize_data_uniform(const double& minimum, const double& maximu
 
 void DataSet::randomize_data_normal(const double& mean, const double& standard_deviation)
 {
+   check_data_in_memory("void randomize_data_normal(const double&, const double&) method");
+
+   clear_batches();
+
    data.randomize_normal(mean, standard_deviation);
 }
 
@@ -5399,6 +5716,8 @@ void DataSet::write_XML(tinyxml2::XMLPrinter& file_stream) const
 
 void DataSet::from_XML(const tinyxml2::XMLDocument& data_set_document)
 {
+   clear_batches();
+
    ostringstream buffer;
 
    // Data set element
@@ -5950,67 +6269,87 @@ void DataSet::save_data() const
 }
 
 
-/// Returns the index of a variable when reading the data file.
-/// @param nominal_labels Values of all nominal variables in the data file.
-/// @param column_index Index of column.
+/// Saves the data to a binary column store file, together with the names and uses of the variables
+/// and the number of missing values of each variable.
+/// The file can be loaded later with load_data_column_store().
+/// @param column_store_file_name Name of the column store file.
 
-size_t DataSet::get_column_index(const Vector< Vector<string> >& nominal_labels, const size_t column_index) const
+void DataSet::save_data_column_store(const string& column_store_file_name) const
 {
-    size_t variable_index = 0;
+    ofstream file(column_store_file_name.c_str(), ios::binary);
 
-    for(size_t i = 0; i < column_index; i++)
+    if(!file.is_open())
     {
-        if(nominal_labels[i].size() <= 2)
-        {
-            variable_index++;
-        }
-        else
-        {
-            variable_index += nominal_labels[i].size();
-        }
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void save_data_column_store(const string&) const method.\n"
+               << "Cannot open column store file: " << column_store_file_name << "\n";
+
+        throw logic_error(buffer.str());
     }
 
-    return variable_index;
-}
+    const size_t instances_number = instances.get_instances_number();
+    const size_t variables_number = variables.get_variables_number();
 
+    const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
 
-/// Verifies that a given line in the data file contains the separator characer.
-/// If the line does not contain the separator, this method throws an exception.
-/// @param line Data file line.
+    Vector<size_t> missing_values_numbers(variables_number);
 
-void DataSet::check_separator(const string& line) const
-{
-    if(line.empty())
+    for(size_t j = 0; j < variables_number; j++)
     {
-        return;
+        missing_values_numbers[j] = missing_indices[j].size();
     }
 
-//    const char separator_char = get_separator_char();
+    ColumnStore::write_header(file, instances_number, variables.get_names(), variables.write_uses(), missing_values_numbers);
 
-//    if(line.find(separator_string) == string::npos)
-//    {
-//        ostringstream buffer;
+    const size_t column_size = instances_number*sizeof(double);
 
-//        buffer << "OpenNN Exception: DataSet class.\n"
-//               << "void check_separator(const string&) method.\n"
-//               << "Separator '" << write_separator() << "' not found in data file " << data_file_name << ".\n";
+    const string padding(static_cast<size_t>(ColumnStore::calculate_column_stride(instances_number)) - column_size, '\0');
 
-//        throw logic_error(buffer.str());
-//    }
+    for(size_t j = 0; j < variables_number; j++)
+    {
+        const double* column_data = column_store.is_open() ? column_store.get_column_data(j) : data.data() + j*instances_number;
+
+        file.write(reinterpret_cast<const char*>(column_data), static_cast<streamsize>(column_size));
+        file.write(padding.data(), static_cast<streamsize>(padding.size()));
+    }
+
+    file.close();
 }
 
 
-/// Returns the number of tokens in the first line of the data file.
-/// That will be interpreted as the number of columns in the data file.
+/// Converts the data file, as read by load_data() or written by save_data(), into a binary column store file.
+/// The data file is read twice, first to count the instances and then to write the values in blocks of rows,
+/// so that it does not need to fit in memory.
+/// All the columns must be numeric. Missing values are stored as in the data matrix.
+/// @param column_store_file_name Name of the column store file.
 
-size_t DataSet::count_data_file_columns_number() const
+void DataSet::convert_data_file_to_column_store(const string& column_store_file_name) const
 {
     ifstream file(data_file_name.c_str());
 
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void convert_data_file_to_column_store(const string&) const method.\n"
+               << "Cannot open data file: " << data_file_name << "\n";
+
+        throw logic_error(buffer.str());
+    }
+
     string line;
+    Vector<string> tokens;
+
+    // First pass: count instances and columns
 
+    size_t instances_number = 0;
     size_t columns_number = 0;
 
+    bool header_read = !header_line;
+
     while(file.good())
     {
         getline(file, line);
@@ -6027,108 +6366,116 @@ size_t DataSet::count_data_file_columns_number() const
             continue;
         }
 
-        check_separator(line);
+        if(!header_read)
+        {
+            header_read = true;
 
-        columns_number = count_tokens(line);
+            continue;
+        }
 
-        break;
-    }
+        const size_t tokens_number = get_tokens(line).size();
 
-    file.close();
+        if(columns_number == 0)
+        {
+            columns_number = tokens_number;
+        }
+        else if(tokens_number != columns_number)
+        {
+            ostringstream buffer;
 
-    return columns_number;
+            buffer << "OpenNN Exception: DataSet class.\n"
+                   << "void convert_data_file_to_column_store(const string&) const method.\n"
+                   << "Row " << instances_number << ": Size of tokens (" << tokens_number << ") is not equal to "
+                   << "number of columns (" << columns_number << ").\n";
 
-}
+            throw logic_error(buffer.str());
+        }
 
+        instances_number++;
+    }
 
-/// Verifies that the data file has a header line.
-/// All elements in a header line must be strings.
-/// This method can change the value of the header line member.
-/// It throws an exception if some inconsistencies are found.
+    if(instances_number == 0 || columns_number == 0)
+    {
+        ostringstream buffer;
 
-void DataSet::check_header_line()
-{
-    ifstream file(data_file_name.c_str());
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void convert_data_file_to_column_store(const string&) const method.\n"
+               << "Data file is empty: " << data_file_name << "\n";
 
-    string line;
-    Vector<string> tokens;
+        throw logic_error(buffer.str());
+    }
 
-    while(file.good())
-    {
-        getline(file, line);
+    // Variables metadata
 
-        if(separator != Tab)
+    Vector<string> names;
+
+    if(header_line)
+    {
+        names = read_header_line();
+    }
+    else
+    {
+        for(size_t j = 0; j < columns_number; j++)
         {
-            replace(line.begin(), line.end(), '\t', ' ');
-        }
+            ostringstream buffer;
 
-        trim(line);
+            buffer << "variable_" << j;
 
-        if(line.empty())
-        {
-            continue;
+            names.push_back(buffer.str());
         }
-
-        break;
     }
 
-    file.close();
+    const Vector<string> uses = Variables(columns_number).write_uses();
 
-    check_separator(line);
+    Vector<size_t> missing_values_numbers(columns_number, 0);
 
-    tokens = get_tokens(line);
+    // Column store header, with the final size of the file
 
-    if(header_line && is_not_numeric(tokens))
-    {
-        return;
-    }
-    if(header_line && is_numeric(tokens))
-    {
-        if(display)
-        {
-            cout << "OpenNN Warning: DataSet class.\n"
-                      << "void check_header_line() method.\n"
-                      << "First line of data file interpreted as not header.\n";
-        }
+    ofstream column_store_file(column_store_file_name.c_str(), ios::binary);
 
-        header_line = false;
-    }
-    else if(header_line && is_mixed(tokens))
+    if(!column_store_file.is_open())
     {
         ostringstream buffer;
 
         buffer << "OpenNN Exception: DataSet class.\n"
-               << "void check_header_line() method.\n"
-               << "Header line contains numeric values: \n"
-               << line << "\n";
+               << "void convert_data_file_to_column_store(const string&) const method.\n"
+               << "Cannot open column store file: " << column_store_file_name << "\n";
 
         throw logic_error(buffer.str());
     }
-    else if(!header_line && is_not_numeric(tokens))
-    {
-        if(display)
-        {
-            cout << "OpenNN Warning: DataSet class.\n"
-                      << "void check_header_line() method.\n"
-                      << "First line of data file interpreted as header.\n";
-        }
 
-        header_line = true;
-    }
-}
+    const uint64_t data_offset = ColumnStore::write_header(column_store_file, instances_number, names, uses, missing_values_numbers);
+    const uint64_t column_stride = ColumnStore::calculate_column_stride(instances_number);
 
+    column_store_file.seekp(static_cast<streamoff>(data_offset + columns_number*column_stride - 1));
+    column_store_file.put('\0');
 
-/// Returns the name of the columns in the data set as a list of strings.
+    // Second pass: write the values in blocks of rows
 
-Vector<string> DataSet::read_header_line() const
-{
-    Vector<string> header_line;
+    const size_t block_instances_number = min(instances_number, static_cast<size_t>(65536));
 
-    string line;
+    Matrix<double> block(block_instances_number, columns_number);
 
-    ifstream file(data_file_name.c_str());
+    size_t instance_index = 0;
+    size_t block_instance_index = 0;
 
-    // First line
+    const auto write_block = [&]()
+    {
+        const size_t first_instance_index = instance_index - block_instance_index;
+
+        for(size_t j = 0; j < columns_number; j++)
+        {
+            column_store_file.seekp(static_cast<streamoff>(data_offset + j*column_stride + first_instance_index*sizeof(double)));
+            column_store_file.write(reinterpret_cast<const char*>(block.data() + j*block_instances_number), static_cast<streamsize>(block_instance_index*sizeof(double)));
+        }
+
+        block_instance_index = 0;
+    };
+
+    file.clear();
+    file.seekg(0, ios::beg);
+
+    header_read = !header_line;
 
     while(file.good())
     {
@@ -6146,9 +6493,283 @@ Vector<string> DataSet::read_header_line() const
             continue;
         }
 
-        check_separator(line);
+        if(!header_read)
+        {
+            header_read = true;
 
-        header_line = get_tokens(line);
+            continue;
+        }
+
+        tokens = get_tokens(line);
+
+        for(size_t j = 0; j < columns_number; j++)
+        {
+            if(tokens[j] == missing_values_label)
+            {
+                block(block_instance_index, j) = -99.9;
+
+                missing_values_numbers[j]++;
+            }
+            else if(is_numeric(tokens[j]))
+            {
+                block(block_instance_index, j) = atof(tokens[j].c_str());
+            }
+            else
+            {
+                ostringstream buffer;
+
+                buffer << "OpenNN Exception: DataSet class.\n"
+                       << "void convert_data_file_to_column_store(const string&) const method.\n"
+                       << "Row " << instance_index << ", column " << j << ": Nominal values are not supported (" << tokens[j] << ").\n";
+
+                throw logic_error(buffer.str());
+            }
+        }
+
+        instance_index++;
+        block_instance_index++;
+
+        if(block_instance_index == block_instances_number)
+        {
+            write_block();
+        }
+    }
+
+    if(block_instance_index != 0)
+    {
+        write_block();
+    }
+
+    file.close();
+
+    // Header with the number of missing values
+
+    column_store_file.seekp(0, ios::beg);
+
+    ColumnStore::write_header(column_store_file, instances_number, names, uses, missing_values_numbers);
+
+    column_store_file.close();
+}
+
+
+/// Returns the index of a variable when reading the data file.
+/// @param nominal_labels Values of all nominal variables in the data file.
+/// @param column_index Index of column.
+
+size_t DataSet::get_column_index(const Vector< Vector<string> >& nominal_labels, const size_t column_index) const
+{
+    size_t variable_index = 0;
+
+    for(size_t i = 0; i < column_index; i++)
+    {
+        if(nominal_labels[i].size() <= 2)
+        {
+            variable_index++;
+        }
+        else
+        {
+            variable_index += nominal_labels[i].size();
+        }
+    }
+
+    return variable_index;
+}
+
+
+/// Verifies that the data is held in memory, and not read from a column store.
+/// The column store is mapped read-only, so methods which modify the data throw an exception if it is open.
+/// @param method Signature of the calling method, for the exception message.
+
+void DataSet::check_data_in_memory(const string& method) const
+{
+    if(column_store.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << method << ".\n"
+               << "Data is read from a column store, which cannot be modified.\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+
+/// Verifies that a given line in the data file contains the separator characer.
+/// If the line does not contain the separator, this method throws an exception.
+/// @param line Data file line.
+
+void DataSet::check_separator(const string& line) const
+{
+    if(line.empty())
+    {
+        return;
+    }
+
+//    const char separator_char = get_separator_char();
+
+//    if(line.find(separator_string) == string::npos)
+//    {
+//        ostringstream buffer;
+
+//        buffer << "OpenNN Exception: DataSet class.\n"
+//               << "void check_separator(const string&) method.\n"
+//               << "Separator '" << write_separator() << "' not found in data file " << data_file_name << ".\n";
+
+//        throw logic_error(buffer.str());
+//    }
+}
+
+
+/// Returns the number of tokens in the first line of the data file.
+/// That will be interpreted as the number of columns in the data file.
+
+size_t DataSet::count_data_file_columns_number() const
+{
+    ifstream file(data_file_name.c_str());
+
+    string line;
+
+    size_t columns_number = 0;
+
+    while(file.good())
+    {
+        getline(file, line);
+
+        if(separator != Tab)
+        {
+            replace(line.begin(), line.end(), '\t', ' ');
+        }
+
+        trim(line);
+
+        if(line.empty())
+        {
+            continue;
+        }
+
+        check_separator(line);
+
+        columns_number = count_tokens(line);
+
+        break;
+    }
+
+    file.close();
+
+    return columns_number;
+
+}
+
+
+/// Verifies that the data file has a header line.
+/// All elements in a header line must be strings.
+/// This method can change the value of the header line member.
+/// It throws an exception if some inconsistencies are found.
+
+void DataSet::check_header_line()
+{
+    ifstream file(data_file_name.c_str());
+
+    string line;
+    Vector<string> tokens;
+
+    while(file.good())
+    {
+        getline(file, line);
+
+        if(separator != Tab)
+        {
+            replace(line.begin(), line.end(), '\t', ' ');
+        }
+
+        trim(line);
+
+        if(line.empty())
+        {
+            continue;
+        }
+
+        break;
+    }
+
+    file.close();
+
+    check_separator(line);
+
+    tokens = get_tokens(line);
+
+    if(header_line && is_not_numeric(tokens))
+    {
+        return;
+    }
+    if(header_line && is_numeric(tokens))
+    {
+        if(display)
+        {
+            cout << "OpenNN Warning: DataSet class.\n"
+                      << "void check_header_line() method.\n"
+                      << "First line of data file interpreted as not header.\n";
+        }
+
+        header_line = false;
+    }
+    else if(header_line && is_mixed(tokens))
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: DataSet class.\n"
+               << "void check_header_line() method.\n"
+               << "Header line contains numeric values: \n"
+               << line << "\n";
+
+        throw logic_error(buffer.str());
+    }
+    else if(!header_line && is_not_numeric(tokens))
+    {
+        if(display)
+        {
+            cout << "OpenNN Warning: DataSet class.\n"
+                      << "void check_header_line() method.\n"
+                      << "First line of data file interpreted as header.\n";
+        }
+
+        header_line = true;
+    }
+}
+
+
+/// Returns the name of the columns in the data set as a list of strings.
+
+Vector<string> DataSet::read_header_line() const
+{
+    Vector<string> header_line;
+
+    string line;
+
+    ifstream file(data_file_name.c_str());
+
+    // First line
+
+    while(file.good())
+    {
+        getline(file, line);
+
+        if(separator != Tab)
+        {
+            replace(line.begin(), line.end(), '\t', ' ');
+        }
+
+        trim(line);
+
+        if(line.empty())
+        {
+            continue;
+        }
+
+        check_separator(line);
+
+        header_line = get_tokens(line);
 
         break;
     }
@@ -6293,19 +6914,133 @@ void DataSet::read_instance(const string& line, const Vector< Vector<string> >&
 }
 
 
-/// Performs a first data file read in which the format is checked,
-/// and the numbers of variables, instances and missing values are set.
+/// Returns the values of a subset of instances and variables,
+/// taken from the column store if it is open, or from the data matrix otherwise.
+/// @param instances_indices Indices of the instances.
+/// @param variables_indices Indices of the variables.
 
-Vector< Vector<string> > DataSet::set_from_data_file()
+Matrix<double> DataSet::get_data_submatrix(const Vector<size_t>& instances_indices, const Vector<size_t>& variables_indices) const
 {
-    const size_t columns_number = count_data_file_columns_number();
+    if(column_store.is_open())
+    {
+        return(column_store.get_submatrix(instances_indices, variables_indices));
+    }
 
-    Vector< Vector<string> > nominal_labels(columns_number);
+    return(data.get_submatrix(instances_indices, variables_indices));
+}
 
-    string line;
-    Vector<string> tokens;
 
-    check_header_line();
+/// Returns the basic statistics of all the variables on a subset of instances.
+/// The missing values are skipped with the bitmask of each variable restricted to those instances.
+/// If the column store is open, only one variable is loaded in memory at a time.
+/// @param instances_indices Indices of the instances.
+
+Vector< Statistics<double> > DataSet::calculate_instances_statistics(const Vector<size_t>& instances_indices) const
+{
+    if(column_store.is_open())
+    {
+        const size_t variables_number = column_store.get_variables_number();
+
+        Vector< Statistics<double> > statistics(variables_number);
+
+        for(size_t j = 0; j < variables_number; j++)
+        {
+            statistics[j] = column_store.get_column(j, instances_indices).calculate_statistics_missing_mask(missing_values.get_missing_mask(j, instances_indices));
+        }
+
+        return(statistics);
+    }
+
+    const size_t variables_number = data.get_columns_number();
+
+    Vector< Statistics<double> > statistics(variables_number);
+
+    #pragma omp parallel for schedule(dynamic)
+
+    for(int j = 0; j < static_cast<int>(variables_number); j++)
+    {
+        const size_t variable_index = static_cast<size_t>(j);
+
+        statistics[variable_index] = data.get_column(variable_index, instances_indices).calculate_statistics_missing_mask(missing_values.get_missing_mask(variable_index, instances_indices));
+    }
+
+    return(statistics);
+}
+
+
+/// Gathers the inputs and targets of a set of batches, unless they are already up to date.
+/// If the data is held in the column store, only the indices are kept, and the batches are read from the store when they are used.
+/// @param batches Batches structure to be updated.
+/// @param batches_indices Indices of the instances in each batch.
+/// @param batch_size Maximum number of instances in each batch.
+
+void DataSet::update_batches(Batches& batches, const Vector< Vector<size_t> >& batches_indices, const size_t& batch_size) const
+{
+    const Vector<size_t> inputs_indices = variables.get_inputs_indices();
+    const Vector<size_t> targets_indices = variables.get_targets_indices();
+
+    const size_t batches_number = batches_indices.size();
+
+    bool up_to_date = batches.batch_size == batch_size
+                   && batches.get_batches_number() == batches_number
+                   && batches.inputs_indices.size() == inputs_indices.size()
+                   && batches.targets_indices.size() == targets_indices.size()
+                   && equal(inputs_indices.begin(), inputs_indices.end(), batches.inputs_indices.begin())
+                   && equal(targets_indices.begin(), targets_indices.end(), batches.targets_indices.begin());
+
+    for(size_t i = 0; up_to_date && i < batches_number; i++)
+    {
+        up_to_date = batches.indices[i].size() == batches_indices[i].size()
+                  && equal(batches_indices[i].begin(), batches_indices[i].end(), batches.indices[i].begin());
+    }
+
+    if(up_to_date) return;
+
+    batches.batch_size = batch_size;
+    batches.indices = batches_indices;
+    batches.inputs_indices = inputs_indices;
+    batches.targets_indices = targets_indices;
+
+    // The batches of a column store are read when they are used
+
+    if(column_store.is_open())
+    {
+        batches.column_store_pointer = &column_store;
+
+        batches.inputs.set();
+        batches.targets.set();
+
+        return;
+    }
+
+    batches.column_store_pointer = nullptr;
+
+    batches.inputs.set(batches_number);
+    batches.targets.set(batches_number);
+
+    #pragma omp parallel for
+
+    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    {
+        batches.inputs[static_cast<size_t>(i)] = get_data_submatrix(batches_indices[static_cast<size_t>(i)], inputs_indices);
+        batches.targets[static_cast<size_t>(i)] = get_data_submatrix(batches_indices[static_cast<size_t>(i)], targets_indices);
+    }
+}
+
+
+/// Performs a first data file read in which the format is checked,
+/// and the numbers of variables, instances and missing values are set.
+
+Vector< Vector<string> > DataSet::set_from_data_file()
+{
+    const size_t columns_number = count_data_file_columns_number();
+
+    Vector< Vector<string> > nominal_labels(columns_number);
+
+    string line;
+    Vector<string> tokens;
+
+    check_header_line();
 
     int instances_count;
 
@@ -6381,142 +7116,551 @@ Vector< Vector<string> > DataSet::set_from_data_file()
         }*/
 
 
-    }
+    }
+
+    file.close();
+
+    size_t variables_count = 0;
+
+    for(size_t i = 0; i < columns_number; i++)
+    {
+        if(nominal_labels[i].size() == 0 || nominal_labels[i].size() == 2)
+        {
+            variables_count++;
+        }
+        else
+        {
+            variables_count += nominal_labels[i].size();
+        }
+    }
+
+    // Fix label case
+
+    for(size_t i = 0; i < columns_number; i++)
+    {
+        if(nominal_labels[i].size() == static_cast<size_t>(instances_count))
+        {
+            ostringstream buffer;
+
+            buffer << "OpenNN Exception: DataSet class.\n"
+                   << "Vector< Vector<string> > DataSet::set_from_data_file().\n"
+                   << "Column " << i << ": All elements are nominal and different. It contains meaningless data.\n";
+
+            throw logic_error(buffer.str());
+        }
+    }
+
+    // Set instances and variables number
+
+    if(instances_count == 0 || variables_count == 0)
+    {
+        set();
+
+        return(nominal_labels);
+    }
+
+    data.set(static_cast<size_t>(instances_count), variables_count);
+
+    if(variables.get_variables_number() != variables_count)
+    {
+        variables.set(variables_count);
+
+        if(nominal_labels[columns_number-1].size() > 2)
+        {
+            for(size_t i = variables_count-1; i >= variables_count - nominal_labels[columns_number-1].size(); i--)
+            {
+                variables.set_use(i, Variables::Target);
+            }
+        }
+    }
+
+    if(instances.get_instances_number() != static_cast<size_t>(instances_count))
+    {
+        instances.set(static_cast<size_t>(instances_count));
+    }
+
+    missing_values.set(instances.get_instances_number(), variables.get_variables_number());
+
+    return(nominal_labels);
+}
+
+
+/// Performs a second data file read in which the data is set.
+
+void DataSet::read_from_data_file(const Vector< Vector<string> >& nominal_labels)
+{
+    ifstream file(data_file_name.c_str());
+
+    file.clear();
+    file.seekg(0, ios::beg);
+
+    string line;
+
+    if(header_line)
+    {
+        while(file.good())
+        {
+            getline(file, line);
+
+            if(separator != Tab)
+            {
+                replace(line.begin(), line.end(), '\t', ' ');
+            }
+
+            trim(line);
+
+            if(line.empty())
+            {
+                continue;
+            }
+
+            break;
+        }
+    }
+
+    size_t i = 0;
+
+    while(file.good())
+    {
+        getline(file, line);
+
+        if(separator != Tab)
+        {
+            replace(line.begin(), line.end(), '\t', ' ');
+        }
+
+        const Vector<string> tokens = get_tokens(line);
+
+        trim(line);
+
+        if(line.empty())
+        {
+            continue;
+        }
+
+        // #pragma omp task
+/*
+        if(tokens.size() == nominal_labels.size())
+        {
+            read_instance(line, nominal_labels, i);
+            i++;
+        }*/
+// caixa
+        read_instance(line, nominal_labels, i);
+        i++;
+
+    }
+
+    file.close();
+}
+
+
+/// Powers of ten which are exactly representable in double precision.
+
+static const double exact_powers_of_ten[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                             1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+
+/// Returns the value of a token of the data file, which is the same as atof() on that token.
+/// Plain decimal numbers with up to 18 significant digits and small exponents are converted exactly with one rounding;
+/// the rest of tokens fall back to atof().
+/// @param begin Pointer to the first character of the token.
+/// @param end Pointer past the last character of the token.
+
+static double parse_data_file_token(const char* begin, const char* end)
+{
+    const char* pointer = begin;
+
+    bool negative = false;
+
+    if(pointer != end && (*pointer == '+' || *pointer == '-'))
+    {
+        negative = (*pointer == '-');
+
+        pointer++;
+    }
+
+    uint64_t mantissa = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+
+    for(; pointer != end && *pointer >= '0' && *pointer <= '9'; pointer++)
+    {
+        mantissa = mantissa*10 + static_cast<uint64_t>(*pointer - '0');
+
+        if(mantissa != 0) significant_digits++;
+
+        has_digits = true;
+    }
+
+    if(pointer != end && *pointer == '.')
+    {
+        pointer++;
+
+        for(; pointer != end && *pointer >= '0' && *pointer <= '9'; pointer++)
+        {
+            mantissa = mantissa*10 + static_cast<uint64_t>(*pointer - '0');
+
+            if(mantissa != 0) significant_digits++;
+
+            exponent--;
+
+            has_digits = true;
+        }
+    }
+
+    if(has_digits && pointer != end && (*pointer == 'e' || *pointer == 'E'))
+    {
+        const char* exponent_pointer = pointer + 1;
+
+        bool negative_exponent = false;
+
+        if(exponent_pointer != end && (*exponent_pointer == '+' || *exponent_pointer == '-'))
+        {
+            negative_exponent = (*exponent_pointer == '-');
+
+            exponent_pointer++;
+        }
+
+        int explicit_exponent = 0;
+
+        bool has_exponent_digits = false;
+
+        for(; exponent_pointer != end && *exponent_pointer >= '0' && *exponent_pointer <= '9' && explicit_exponent < 1000; exponent_pointer++)
+        {
+            explicit_exponent = explicit_exponent*10 + (*exponent_pointer - '0');
+
+            has_exponent_digits = true;
+        }
+
+        if(has_exponent_digits)
+        {
+            exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+
+            pointer = exponent_pointer;
+        }
+    }
+
+    if(has_digits
+    && pointer == end
+    && significant_digits <= 18
+    && mantissa <= (static_cast<uint64_t>(1) << 53)
+    && exponent >= -22 && exponent <= 22)
+    {
+        double value = static_cast<double>(mantissa);
+
+        value = exponent < 0 ? value/exact_powers_of_ten[-exponent] : value*exact_powers_of_ten[exponent];
+
+        return(negative ? -value : value);
+    }
+
+    const string token(begin, end);
+
+    return(atof(token.c_str()));
+}
+
+
+/// Reads the data file and sets the numbers of variables and instances, the data and the missing values.
+/// A first pass over the file counts the instances, so that the data matrix is allocated once.
+/// The second pass reads the file in blocks which end at a line boundary,
+/// and the lines of each block are tokenized in place and parsed in parallel straight into their rows of the data matrix.
+/// The result is the same as set_from_data_file() followed by read_from_data_file().
+
+Vector< Vector<string> > DataSet::read_data_file()
+{
+    const size_t columns_number = count_data_file_columns_number();
+
+    Vector< Vector<string> > nominal_labels(columns_number);
+
+    check_header_line();
+
+    ifstream file(data_file_name.c_str(), ios::binary);
+
+    const char separator_char = get_separator_char();
+    const bool replace_tabs = (separator != Tab);
+
+    const auto is_blank = [&](const char& c)
+    {
+        return(c == ' ' || (replace_tabs && c == '\t'));
+    };
+
+    const auto is_separator = [&](const char& c)
+    {
+        return(c == separator_char || (separator == Space && c == '\t'));
+    };
+
+    const size_t block_size = 64*1024*1024;
+
+    string block;
+    string remainder;
+
+    Vector<const char*> lines_begin;
+    Vector<const char*> lines_end;
+
+    // Reads the next block of the file, which ends at a line boundary, and returns true at the end of the file
+
+    const auto read_block = [&]()
+    {
+        while(true)
+        {
+            block.swap(remainder);
+
+            const size_t previous_size = block.size();
+
+            block.resize(previous_size + block_size);
+
+            file.read(&block[previous_size], static_cast<streamsize>(block_size));
+
+            block.resize(previous_size + static_cast<size_t>(file.gcount()));
+
+            remainder.clear();
+
+            if(!file.good())
+            {
+                return(true);
+            }
+
+            const size_t last_line_end = block.find_last_of('\n');
+
+            if(last_line_end == string::npos)
+            {
+                remainder.swap(block);
+
+                continue;
+            }
+
+            remainder.assign(block, last_line_end + 1, string::npos);
+
+            block.resize(last_line_end + 1);
+
+            return(false);
+        }
+    };
+
+    // Splits the block in lines, without the blank characters at both ends
+
+    const auto split_lines = [&]()
+    {
+        lines_begin.clear();
+        lines_end.clear();
+
+        const char* pointer = block.data();
+        const char* block_end = block.data() + block.size();
+
+        while(pointer != block_end)
+        {
+            const char* line_end = static_cast<const char*>(memchr(pointer, '\n', static_cast<size_t>(block_end - pointer)));
 
-    file.close();
+            if(!line_end) line_end = block_end;
 
-    size_t variables_count = 0;
+            const char* begin = pointer;
+            const char* end = line_end;
 
-    for(size_t i = 0; i < columns_number; i++)
-    {
-        if(nominal_labels[i].size() == 0 || nominal_labels[i].size() == 2)
-        {
-            variables_count++;
-        }
-        else
-        {
-            variables_count += nominal_labels[i].size();
+            while(begin != end && is_blank(*begin)) begin++;
+            while(end != begin && is_blank(*(end-1))) end--;
+
+            lines_begin.push_back(begin);
+            lines_end.push_back(end);
+
+            pointer = (line_end == block_end) ? block_end : line_end + 1;
         }
-    }
+    };
 
-    // Fix label case
+    // Instances number
 
-    for(size_t i = 0; i < columns_number; i++)
+    size_t instances_number = 0;
+
+    bool end_of_file = false;
+
+    while(!end_of_file)
     {
-        if(nominal_labels[i].size() == static_cast<size_t>(instances_count))
-        {
-            ostringstream buffer;
+        end_of_file = read_block();
 
-            buffer << "OpenNN Exception: DataSet class.\n"
-                   << "Vector< Vector<string> > DataSet::set_from_data_file().\n"
-                   << "Column " << i << ": All elements are nominal and different. It contains meaningless data.\n";
+        split_lines();
 
-            throw logic_error(buffer.str());
+        for(size_t i = 0; i < lines_begin.size(); i++)
+        {
+            if(lines_begin[i] != lines_end[i]) instances_number++;
         }
     }
 
+    if(header_line && instances_number != 0)
+    {
+        instances_number--;
+    }
+
     // Set instances and variables number
 
-    if(instances_count == 0 || variables_count == 0)
+    if(instances_number == 0 || columns_number == 0)
     {
+        file.close();
+
         set();
 
         return(nominal_labels);
     }
 
-    data.set(static_cast<size_t>(instances_count), variables_count);
+    data.set(instances_number, columns_number);
 
-    if(variables.get_variables_number() != variables_count)
+    if(variables.get_variables_number() != columns_number)
     {
-        variables.set(variables_count);
-
-        if(nominal_labels[columns_number-1].size() > 2)
-        {
-            for(size_t i = variables_count-1; i >= variables_count - nominal_labels[columns_number-1].size(); i--)
-            {
-                variables.set_use(i, Variables::Target);
-            }
-        }
+        variables.set(columns_number);
     }
 
-    if(instances.get_instances_number() != static_cast<size_t>(instances_count))
+    if(instances.get_instances_number() != instances_number)
     {
-        instances.set(static_cast<size_t>(instances_count));
+        instances.set(instances_number);
     }
 
     missing_values.set(instances.get_instances_number(), variables.get_variables_number());
 
-    return(nominal_labels);
-}
+    // Data
 
+    file.clear();
+    file.seekg(0, ios::beg);
 
-/// Performs a second data file read in which the data is set.
+    block.clear();
+    remainder.clear();
 
-void DataSet::read_from_data_file(const Vector< Vector<string> >& nominal_labels)
-{
-    ifstream file(data_file_name.c_str());
+    Vector<size_t> lines_instance;
 
-    file.clear();
-    file.seekg(0, ios::beg);
+    Vector<size_t> lines_tokens_number;
 
-    string line;
+    Vector< Vector<size_t> > lines_missing_columns;
 
-    if(header_line)
+    bool header_pending = header_line;
+
+    size_t instances_count = 0;
+
+    end_of_file = false;
+
+    while(!end_of_file)
     {
-        while(file.good())
-        {
-            getline(file, line);
+        end_of_file = read_block();
 
-            if(separator != Tab)
-            {
-                replace(line.begin(), line.end(), '\t', ' ');
-            }
+        split_lines();
 
-            trim(line);
+        const size_t lines_number = lines_begin.size();
 
-            if(line.empty())
+        // Instance of each line, which is the number of instances for the blank lines and the header
+
+        lines_instance.set(lines_number);
+
+        for(size_t i = 0; i < lines_number; i++)
+        {
+            if(lines_begin[i] == lines_end[i] || header_pending || instances_count == instances_number)
             {
+                if(lines_begin[i] != lines_end[i]) header_pending = false;
+
+                lines_instance[i] = instances_number;
+
                 continue;
             }
 
-            break;
+            lines_instance[i] = instances_count;
+
+            instances_count++;
         }
-    }
 
-    size_t i = 0;
+        lines_tokens_number.set(lines_number);
+        lines_missing_columns.set(lines_number);
 
-    while(file.good())
-    {
-        getline(file, line);
+        // Tokens
 
-        if(separator != Tab)
+        #pragma omp parallel for schedule(static)
+
+        for(int i = 0; i < static_cast<int>(lines_number); i++)
         {
-            replace(line.begin(), line.end(), '\t', ' ');
-        }
+            const size_t line_index = static_cast<size_t>(i);
 
-        const Vector<string> tokens = get_tokens(line);
+            lines_tokens_number[line_index] = 0;
+            lines_missing_columns[line_index].clear();
 
-        trim(line);
+            const size_t instance_index = lines_instance[line_index];
 
-        if(line.empty())
-        {
-            continue;
+            if(instance_index == instances_number)
+            {
+                continue;
+            }
+
+            const char* end = lines_end[line_index];
+
+            size_t column_index = 0;
+
+            const char* token_begin = lines_begin[line_index];
+
+            while(true)
+            {
+                while(token_begin != end && is_separator(*token_begin)) token_begin++;
+
+                if(token_begin == end) break;
+
+                const char* token_end = token_begin;
+
+                while(token_end != end && !is_separator(*token_end)) token_end++;
+
+                const char* next_token_begin = token_end;
+
+                while(token_begin != token_end && is_blank(*token_begin)) token_begin++;
+                while(token_end != token_begin && is_blank(*(token_end-1))) token_end--;
+
+                if(column_index < columns_number)
+                {
+                    if(static_cast<size_t>(token_end - token_begin) == missing_values_label.size()
+                    && equal(token_begin, token_end, missing_values_label.begin()))
+                    {
+                        data(instance_index, column_index) = -99.9;
+
+                        lines_missing_columns[line_index].push_back(column_index);
+                    }
+                    else
+                    {
+                        data(instance_index, column_index) = parse_data_file_token(token_begin, token_end);
+                    }
+                }
+
+                column_index++;
+
+                token_begin = next_token_begin;
+            }
+
+            lines_tokens_number[line_index] = column_index;
         }
 
-        // #pragma omp task
-/*
-        if(tokens.size() == nominal_labels.size())
+        // Columns number and missing values
+
+        for(size_t i = 0; i < lines_number; i++)
         {
-            read_instance(line, nominal_labels, i);
-            i++;
-        }*/
-// caixa
-        read_instance(line, nominal_labels, i);
-        i++;
+            const size_t instance_index = lines_instance[i];
+
+            if(instance_index == instances_number)
+            {
+                continue;
+            }
+
+            if(lines_tokens_number[i] != columns_number)
+            {
+                ostringstream buffer;
+
+                buffer << "OpenNN Exception: DataSet class.\n"
+                       << "Vector< Vector<string> > read_data_file() method.\n"
+                       << "Row " << instance_index << ": Size of tokens (" << lines_tokens_number[i] << ") is not equal to "
+                       << "number of columns (" << columns_number << ").\n";
 
+                throw logic_error(buffer.str());
+            }
+
+            for(size_t j = 0; j < lines_missing_columns[i].size(); j++)
+            {
+                missing_values.append(instance_index, lines_missing_columns[i][j]);
+            }
+        }
     }
 
     file.close();
+
+    return(nominal_labels);
 }
 
 
@@ -6564,6 +7708,10 @@ Vector<string> DataSet::get_association_names(const Vector<string>&) const
 
 void DataSet::convert_time_series()
 {
+    check_data_in_memory("void convert_time_series() method");
+
+    clear_batches();
+
     if(lags_number == 0)
     {
         return;
@@ -6586,6 +7734,10 @@ void DataSet::convert_time_series()
 
 void DataSet::convert_association()
 {
+    check_data_in_memory("void convert_association() method");
+
+    clear_batches();
+
     data.convert_association();
 
     variables.convert_association();
@@ -6595,9 +7747,32 @@ void DataSet::convert_association()
 
 
 /// This method loads the data file.
+/// The file is read in a single pass, in blocks which are split on line boundaries and parsed in parallel.
 
 void DataSet::load_data()
 {
+    load_data_file(false);
+}
+
+
+/// This method loads the data file line by line, in two sequential passes.
+/// It gives the same data set as load_data(), and it is kept as a reference.
+
+void DataSet::load_data_sequential()
+{
+    load_data_file(true);
+}
+
+
+/// Loads the data file, sets the variables names and applies the angular, time series and association conversions.
+/// @param sequential True to read the data file line by line in two passes, false to read it in parallel blocks.
+
+void DataSet::load_data_file(const bool& sequential)
+{
+    clear_batches();
+
+    column_store.close();
+
     if(data_file_name.empty())
     {
        ostringstream buffer;
@@ -6624,9 +7799,18 @@ void DataSet::load_data()
 
     file.close();
 
-    const Vector< Vector<string> > nominal_labels = set_from_data_file();
+    Vector< Vector<string> > nominal_labels;
+
+    if(sequential)
+    {
+        nominal_labels = set_from_data_file();
 
-    read_from_data_file(nominal_labels);
+        read_from_data_file(nominal_labels);
+    }
+    else
+    {
+        nominal_labels = read_data_file();
+    }
 
     // Variables name
 
@@ -6677,6 +7861,10 @@ void DataSet::load_data()
 
 void DataSet::load_data_binary()
 {
+    clear_batches();
+
+    column_store.close();
+
     ifstream file;
 
     file.open(data_file_name.c_str(), ios::binary);
@@ -6721,6 +7909,8 @@ void DataSet::load_data_binary()
 
 void DataSet::load_time_series_data_binary()
 {
+    clear_batches();
+
     ifstream file;
 
     file.open(data_file_name.c_str(), ios::binary);
@@ -6787,10 +7977,58 @@ void DataSet::load_time_series_data_binary()
 }
 
 
+/// Opens the data file as a binary column store, written by save_data_column_store() or convert_data_file_to_column_store().
+/// The file is memory mapped instead of being read into the data matrix, so that the data does not need to fit in memory.
+/// The instances, the variables and the missing values are set from the column store.
+/// Batches, statistics and the inputs and targets getters read the values from the mapped file.
+
+void DataSet::load_data_column_store()
+{
+    clear_batches();
+
+    column_store.open(data_file_name);
+
+    const size_t instances_number = column_store.get_instances_number();
+    const size_t variables_number = column_store.get_variables_number();
+
+    data.set();
+
+    instances.set(instances_number);
+
+    variables.set(variables_number);
+    variables.set_names(column_store.get_names());
+    variables.set_uses(column_store.get_uses());
+
+    missing_values.set(instances_number, variables_number);
+
+    const Vector<size_t>& missing_values_numbers = column_store.get_missing_values_numbers();
+
+    for(size_t j = 0; j < variables_number; j++)
+    {
+        if(missing_values_numbers[j] == 0)
+        {
+            continue;
+        }
+
+        const double* column_data = column_store.get_column_data(j);
+
+        for(size_t i = 0; i < instances_number; i++)
+        {
+            if(fabs(column_data[i] - -99.9) < numeric_limits<double>::epsilon())
+            {
+                missing_values.append(i, j);
+            }
+        }
+    }
+}
+
+
 /// @todo This method is not implemented.
 /*
 void DataSet::load_time_series_data()
 {
+    clear_batches();
+
     if(lags_number <= 0)
     {
        ostringstream buffer;
@@ -7336,6 +8574,8 @@ Vector<size_t> DataSet::get_real_inputs_indices() const
 
 void DataSet::sum_binary_inputs()
 {
+   clear_batches();
+
 //    const size_t inputs_number = variables.get_inputs_number();
 
 //    const size_t instances_number = instances.get_instances_number();
@@ -7360,42 +8600,104 @@ void DataSet::sum_binary_inputs()
 //    new_data = new_data.assemble_columns(get_targets());
 }
 
-/*
+/// Returns the nearest neighbors of every used instance among the other used instances.
+/// The distance is the Euclidean distance between the values of the used variables,
+/// and the neighbors are found with a spatial index instead of the matrix of all the distances.
+/// Row i of the result corresponds to the used instance i, and the neighbors indices are positions among the used instances.
+/// @param nearest_neighbors_number Number of neighbors of each instance.
+
+SpatialIndex::Neighbors DataSet::calculate_instances_nearest_neighbors(const size_t& nearest_neighbors_number) const
+{
+    const Vector<size_t> used_instances_indices = instances.get_used_indices();
+    const Vector<size_t> used_variables_indices = variables.get_used_indices();
+
+    const SpatialIndex spatial_index(get_data_submatrix(used_instances_indices, used_variables_indices));
+
+    return(spatial_index.calculate_k_nearest_neighbors(nearest_neighbors_number));
+}
+
+
+/// Returns the local reachability density of every used instance.
+/// The reachability distance from an instance to a neighbor is the largest of their distance
+/// and the distance from the neighbor to its own farthest neighbor.
+/// The density is the inverse of the mean reachability distance to the neighbors.
+/// A small distance is added to that mean, so that the density of duplicated instances,
+/// whose reachability distances are all zero, is large but finite.
+/// @param nearest_neighbors Nearest neighbors of the used instances.
+
+Vector<double> DataSet::calculate_reachability_density(const SpatialIndex::Neighbors& nearest_neighbors) const
+{
+    const size_t instances_number = nearest_neighbors.distances.get_rows_number();
+    const size_t nearest_neighbors_number = nearest_neighbors.distances.get_columns_number();
+
+    Vector<double> reachability_density(instances_number, 0.0);
+
+    if(nearest_neighbors_number == 0)
+    {
+        return(reachability_density);
+    }
+
+    const Vector<double> k_distances = nearest_neighbors.distances.get_column(nearest_neighbors_number-1);
+
+    for(size_t i = 0; i < instances_number; i++)
+    {
+        double reachability_distances_sum = 0.0;
+
+        for(size_t j = 0; j < nearest_neighbors_number; j++)
+        {
+            const size_t neighbor_index = nearest_neighbors.indices(i, j);
+
+            reachability_distances_sum += max(nearest_neighbors.distances(i, j), k_distances[neighbor_index]);
+        }
+
+        reachability_density[i] = 1.0/(reachability_distances_sum/static_cast<double>(nearest_neighbors_number) + 1.0e-10);
+    }
+
+    return(reachability_density);
+}
 
-// Vector<double> calculate_local_outlier_factor(const size_t&) const
 
 /// Returns a vector with the local outlier factors for every used instance.
+/// Values close to one correspond to instances as dense as their neighbors,
+/// and values much greater than one to outliers.
 /// @param nearest_neighbours_number Number of neighbors to be calculated.
 
 Vector<double> DataSet::calculate_local_outlier_factor(const size_t& nearest_neighbours_number) const
 {
-    const size_t instances_number = instances.get_used_instances_number();
+    const SpatialIndex::Neighbors nearest_neighbors = calculate_instances_nearest_neighbors(nearest_neighbours_number);
 
-    const Matrix<double> distances = calculate_instances_distances(nearest_neighbours_number);
-    const Vector<double> reachability_density = calculate_reachability_density(distances, nearest_neighbours_number);
+    const Vector<double> reachability_density = calculate_reachability_density(nearest_neighbors);
 
-    const Matrix<size_t> nearest_neighbors = calculate_k_nearest_neighbors(distances, nearest_neighbours_number);
+    const size_t instances_number = nearest_neighbors.indices.get_rows_number();
+    const size_t nearest_neighbors_number = nearest_neighbors.indices.get_columns_number();
 
-    Vector<size_t> instance_nearest_neighbors(nearest_neighbours_number);
+    Vector<double> local_outlier_factor(instances_number, 1.0);
 
-    Vector<double> local_outlier_factor(instances_number);
+    if(nearest_neighbors_number == 0)
+    {
+        return(local_outlier_factor);
+    }
 
     for(size_t i = 0; i < instances_number; i++)
     {
-        instance_nearest_neighbors = nearest_neighbors.get_row(i);
+        double neighbors_density_sum = 0.0;
+
+        for(size_t j = 0; j < nearest_neighbors_number; j++)
+        {
+            neighbors_density_sum += reachability_density[nearest_neighbors.indices(i, j)];
+        }
 
-        local_outlier_factor[i] = (reachability_density.calculate_partial_sum(instance_nearest_neighbors))/(nearest_neighbours_number*reachability_density[i]);
+        local_outlier_factor[i] = neighbors_density_sum/(nearest_neighbors_number*reachability_density[i]);
     }
 
     return(local_outlier_factor);
 }
 
 
-// Vector<size_t> clean_local_outlier_factor(const size_t&)
-
 /// Removes the outliers from the data set using the local outlier factor method.
-/// @param nearest_neighbours_number Number of nearest neighbours to calculate
-/// @todo
+/// The used instances whose local outlier factor is greater than 1.6 are set unused.
+/// Returns the indices of those instances.
+/// @param nearest_neighbours_number Number of nearest neighbours to calculate.
 
 Vector<size_t> DataSet::clean_local_outlier_factor(const size_t& nearest_neighbours_number)
 {
@@ -7417,7 +8719,7 @@ Vector<size_t> DataSet::clean_local_outlier_factor(const size_t& nearest_neighbo
     }
 
     return(unused_instances);
-}*/
+}
 
 
 /// Calculate the outliers from the data set using the Tukey's test for a single variable.
@@ -7673,6 +8975,10 @@ Matrix<double> DataSet::calculate_lag_plot(const size_t& maximum_lags_number)
 
 Vector< LinearRegressionParameters<double> > DataSet::perform_trends_transformation()
 {
+    check_data_in_memory("Vector< LinearRegressionParameters<double> > perform_trends_transformation() method");
+
+    clear_batches();
+
     const Vector<size_t> used_instances_indices = instances.get_used_indices();
     const size_t used_instances_number = used_instances_indices.size();
 
@@ -7717,6 +9023,10 @@ Vector< LinearRegressionParameters<double> > DataSet::perform_trends_transformat
 
 Vector< LinearRegressionParameters<double> > DataSet::perform_inputs_trends_transformation()
 {
+    check_data_in_memory("Vector< LinearRegressionParameters<double> > perform_inputs_trends_transformation() method");
+
+    clear_batches();
+
     const Vector<size_t> used_instances_indices = instances.get_used_indices();
     const size_t used_instances_number = used_instances_indices.size();
 
@@ -7760,6 +9070,10 @@ Vector< LinearRegressionParameters<double> > DataSet::perform_inputs_trends_tran
 
 Vector< LinearRegressionParameters<double> > DataSet::perform_outputs_trends_transformation()
 {
+    check_data_in_memory("Vector< LinearRegressionParameters<double> > perform_outputs_trends_transformation() method");
+
+    clear_batches();
+
     const Vector<size_t> used_instances_indices = instances.get_used_indices();
     const size_t used_instances_number = used_instances_indices.size();
 
@@ -7927,7 +9241,7 @@ void DataSet::generate_data_multiple_classification(const size_t&, const size_t&
 
 bool DataSet::has_data() const
 {
-    if(data.empty())
+    if(data.empty() && !column_store.is_open())
     {
         return(false);
     }
@@ -8076,6 +9390,10 @@ Vector<size_t> DataSet::filter_variable(const string& variable_name, const doubl
 
 void DataSet::convert_angular_variable_degrees(const size_t& variable_index)
 {
+    check_data_in_memory("void convert_angular_variable_degrees(const size_t&) method");
+
+    clear_batches();
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -8120,6 +9438,10 @@ void DataSet::convert_angular_variable_degrees(const size_t& variable_index)
 
 void DataSet::convert_angular_variable_radians(const size_t& variable_index)
 {
+    check_data_in_memory("void convert_angular_variable_radians(const size_t&) method");
+
+    clear_batches();
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -8164,6 +9486,8 @@ void DataSet::convert_angular_variable_radians(const size_t& variable_index)
 
 void DataSet::convert_angular_variables_degrees(const Vector<size_t>& indices)
 {
+    check_data_in_memory("void convert_angular_variables_degrees(const Vector<size_t>&) method");
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -8210,6 +9534,8 @@ void DataSet::convert_angular_variables_degrees(const Vector<size_t>& indices)
 
 void DataSet::convert_angular_variables_radians(const Vector<size_t>& indices)
 {
+    check_data_in_memory("void convert_angular_variables_radians(const Vector<size_t>&) method");
+
     // Control sentence(if debug)
 
     #ifdef __OPENNN_DEBUG__
@@ -8255,6 +9581,8 @@ void DataSet::convert_angular_variables_radians(const Vector<size_t>& indices)
 
 void DataSet::convert_angular_variables()
 {
+    check_data_in_memory("void convert_angular_variables() method");
+
     switch(angular_units)
     {
        case DataSet::Radians:
@@ -8293,6 +9621,10 @@ void DataSet::impute_missing_values_unuse()
 
 void DataSet::impute_missing_values_mean()
 {
+    check_data_in_memory("void impute_missing_values_mean() method");
+
+    clear_batches();
+
     const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
 
     const Vector<double> means = data.calculate_mean_missing_values(missing_indices);
@@ -8317,6 +9649,10 @@ void DataSet::impute_missing_values_mean()
 
 void DataSet::impute_missing_values_time_series_mean()
 {
+    check_data_in_memory("void impute_missing_values_time_series_mean() method");
+
+    clear_batches();
+
     const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
 
     const Matrix<double> means = data.calculate_time_series_mean_missing_values(missing_indices);
@@ -8339,6 +9675,10 @@ void DataSet::impute_missing_values_time_series_mean()
 
 void DataSet::impute_missing_values_time_series_regression()
 {
+   check_data_in_memory("void impute_missing_values_time_series_regression() method");
+
+   clear_batches();
+
 //    const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
 
 //    const size_t variables_number = variables.get_variables_number();
@@ -8418,6 +9758,10 @@ void DataSet::impute_missing_values_time_series_regression()
 
 void DataSet::impute_missing_values_median()
 {
+    check_data_in_memory("void impute_missing_values_median() method");
+
+    clear_batches();
+
     const Vector< Vector<size_t> > missing_indices = missing_values.get_missing_indices();
 
     const Vector<double> medians = data.calculate_median_missing_values(missing_indices);
@@ -8444,6 +9788,8 @@ void DataSet::impute_missing_values_median()
 
 void DataSet::scrub_missing_values()
 {
+    clear_batches();
+
     const MissingValues::ScrubbingMethod scrubbing_method = missing_values.get_scrubbing_method();
 
     switch(scrubbing_method)
@@ -22,9 +22,11 @@
 #include <cmath>
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <stdexcept>
 #include <ctime>
 #include <exception>
+#include <climits>
 
 #ifdef __OPENNN_MPI__
 #include <mpi.h>
@@ -37,6 +39,8 @@
 #include "missing_values.h"
 #include "variables.h"
 #include "instances.h"
+#include "column_store.h"
+#include "spatial_index.h"
 
 // TinyXml includes
 
@@ -122,6 +126,102 @@ public:
 
    enum ProjectType{Approximation, Classification, Forecasting, Association};
 
+   // STRUCTURES
+
+   ///
+   /// This structure contains the inputs and targets of a subset of instances split into batches.
+   /// Each batch is gathered once into contiguous matrices, which are reused until the data, the instances uses or the variables uses change.
+   /// When the data is held in a column store, only the indices are kept, and each batch is read from the store when it is used,
+   /// so that the memory does not grow with the number of instances.
+   ///
+
+   struct Batches
+   {
+       /// Default constructor.
+
+       Batches()
+       {
+           batch_size = 0;
+           column_store_pointer = nullptr;
+       }
+
+       /// Destructor.
+
+       virtual ~Batches()
+       {
+       }
+
+       /// Returns the number of batches.
+
+       inline size_t get_batches_number() const
+       {
+           return indices.size();
+       }
+
+       /// Returns the input values of a batch.
+       /// If the batches are read from a column store, the batch is read into a given matrix, which is returned.
+       /// That matrix keeps its storage between calls, so each thread should reuse one for all its batches.
+       /// @param i Index of the batch.
+       /// @param buffer Matrix where the batch is read, if it has not been gathered.
+
+       inline const Matrix<double>& get_inputs(const size_t& i, Matrix<double>& buffer) const
+       {
+           if(column_store_pointer == nullptr)
+           {
+               return inputs[i];
+           }
+
+           column_store_pointer->get_submatrix(indices[i], inputs_indices, buffer);
+
+           return buffer;
+       }
+
+       /// Returns the target values of a batch.
+       /// If the batches are read from a column store, the batch is read into a given matrix, which is returned.
+       /// @param i Index of the batch.
+       /// @param buffer Matrix where the batch is read, if it has not been gathered.
+
+       inline const Matrix<double>& get_targets(const size_t& i, Matrix<double>& buffer) const
+       {
+           if(column_store_pointer == nullptr)
+           {
+               return targets[i];
+           }
+
+           column_store_pointer->get_submatrix(indices[i], targets_indices, buffer);
+
+           return buffer;
+       }
+
+       /// Maximum number of instances in each batch.
+
+       size_t batch_size;
+
+       /// Indices of the instances in each batch.
+
+       Vector< Vector<size_t> > indices;
+
+       /// Indices of the input variables used to build the batches.
+
+       Vector<size_t> inputs_indices;
+
+       /// Indices of the target variables used to build the batches.
+
+       Vector<size_t> targets_indices;
+
+       /// Input values of each batch.
+
+       Vector< Matrix<double> > inputs;
+
+       /// Target values of each batch.
+
+       Vector< Matrix<double> > targets;
+
+       /// Column store from which the batches are read when they are used, or null if they have been gathered.
+
+       const ColumnStore* column_store_pointer;
+   };
+
    // METHODS
 
    // Get methods
@@ -198,6 +298,18 @@ public:
    Matrix<double> get_inputs(const Vector<size_t>&) const;
    Matrix<double> get_targets(const Vector<size_t>&) const;
 
+   // Column store methods
+
+   bool has_column_store() const;
+   const ColumnStore& get_column_store() const;
+
+   // Batch methods
+
+   const Batches& get_training_batches(const size_t&) const;
+   const Batches& get_selection_batches(const size_t&) const;
+
+   void clear_batches() const;
+
    Matrix<double> get_used_data() const;
    Matrix<double> get_used_inputs() const;
    Matrix<double> get_used_targets() const;
@@ -282,6 +394,7 @@ public:
    void set_default();
 
    void set_MPI(const DataSet*);
+   void set_MPI_shard();
 
    // Instance methods
 
@@ -497,11 +610,8 @@ public:
 
    // Outlier detection
 
-   Matrix<double> calculate_instances_distances(const size_t&) const;
-   Matrix<size_t> calculate_k_nearest_neighbors(const Matrix<double>&, const size_t&) const;
-   Vector<double> calculate_k_distances(const Matrix<double>&, const size_t&) const;
-   Matrix<double> calculate_reachability_distances(const Matrix<double>&, const Vector<double>&) const;
-   Vector<double> calculate_reachability_density(const Matrix<double>&, const size_t&) const;
+   SpatialIndex::Neighbors calculate_instances_nearest_neighbors(const size_t&) const;
+   Vector<double> calculate_reachability_density(const SpatialIndex::Neighbors&) const;
    Vector<double> calculate_local_outlier_factor(const size_t& = 5) const;
 
    Vector<size_t> clean_local_outlier_factor(const size_t& = 5);
@@ -557,14 +667,19 @@ public:
    void print_data_preview() const;
 
    void save_data() const;
+   void save_data_column_store(const string&) const;
+
+   void convert_data_file_to_column_store(const string&) const;
 
    bool has_data() const;
 
    // Data load methods
 
    void load_data();
+   void load_data_sequential();
    void load_data_binary();
    void load_time_series_data_binary();
+   void load_data_column_store();
 
    Vector<string> get_time_series_names(const Vector<string>&) const;
 
@@ -714,11 +829,32 @@ private:
 
    size_t time_index;
 
+   /// Training instances gathered into batches.
+
+   mutable Batches training_batches;
+
+   /// Selection instances gathered into batches.
+
+   mutable Batches selection_batches;
+
+   /// Memory mapped column store which holds the data instead of the data matrix, if open.
+
+   ColumnStore column_store;
+
    // METHODS
 
+   Matrix<double> get_data_submatrix(const Vector<size_t>&, const Vector<size_t>&) const;
+
+   Vector<size_t> get_MPI_shard_indices(const Vector<size_t>&) const;
+
+   void set_shard(const Matrix<double>&, const size_t&, const size_t&);
+
+   Vector< Statistics<double> > calculate_instances_statistics(const Vector<size_t>&) const;
+
    size_t get_column_index(const Vector< Vector<string> >&, const size_t) const;
 
    void check_separator(const string&) const;
+   void check_data_in_memory(const string&) const;
 
    size_t count_data_file_columns_number() const;
    void check_header_line();
@@ -726,9 +862,15 @@ private:
 
    void read_instance(const string&, const Vector< Vector<string> >&, const size_t&);
 
+   void update_batches(Batches&, const Vector< Vector<size_t> >&, const size_t&) const;
+
    Vector< Vector<string> > set_from_data_file();
    void read_from_data_file(const Vector< Vector<string> >&);
 
+   Vector< Vector<string> > read_data_file();
+
+   void load_data_file(const bool&);
+
 };
 
 }
@@ -1169,6 +1169,9 @@ void GradientDescent::GradientDescentResults::resize_training_history(const size
 /// according to the gradient descent method.
 /// Training occurs according to the training parameters and stopping criteria.
 /// It returns a results structure with the history and the final values of the reserved variables.
+/// If a checkpoint file is set, the parameters and the state of the method are saved to it every checkpoint period epochs,
+/// and the training can later resume from the last checkpoint, as if it had not been interrupted.
+/// The training history of the results only contains the iterations performed after resuming.
 
 GradientDescent::GradientDescentResults* GradientDescent::perform_training()
 {
@@ -1248,15 +1251,44 @@ GradientDescent::GradientDescentResults* GradientDescent::perform_training()
 
    results_pointer->resize_training_history(maximum_iterations_number+1);
 
-   size_t current_batch_size = training_initial_batch_size;
+   size_t current_batch_size = max(static_cast<size_t>(1), min(training_batch_size, training_instances_number));
 
    Vector<size_t> batch_history;
 
-    size_t current_iteration = 0;
+   size_t current_iteration = 0;
+
+   // Checkpoint, from which the training resumes with the state it had at the end of an epoch
+
+   TrainingCheckpoint checkpoint;
+
+   size_t first_epoch = 0;
+   size_t first_iteration = 0;
+
+   if(load_checkpoint(checkpoint))
+   {
+       first_epoch = checkpoint.get_epoch();
+
+       neural_network_pointer->set_parameters(checkpoint.get_vector("parameters"));
+
+       current_iteration = checkpoint.get_integer("current_iteration");
+       first_iteration = current_iteration;
+
+       old_training_loss = checkpoint.get_scalar("old_training_loss");
+       old_selection_error = checkpoint.get_scalar("old_selection_error");
+       old_training_rate = checkpoint.get_scalar("old_training_rate");
+
+       minimum_selection_error_parameters = checkpoint.get_vector("minimum_selection_error_parameters");
+       minimum_selection_error = checkpoint.get_scalar("minimum_selection_error");
+       selection_failures = checkpoint.get_integer("selection_failures");
+
+       beginning_time -= static_cast<time_t>(checkpoint.get_scalar("elapsed_time"));
+
+       if(display) cout << "Resuming training from epoch " << first_epoch << " of " << checkpoint_file_name << ".\n";
+   }
 
    // Main loop
 
-   for(size_t epoch = 0; epoch < epochs_number; epoch++)
+   for(size_t epoch = first_epoch; epoch < epochs_number; epoch++)
    {
       Vector<size_t> random_indices(0, 1, training_instances_number);
       random_shuffle(random_indices.begin(), random_indices.end());
@@ -1296,7 +1328,11 @@ GradientDescent::GradientDescentResults* GradientDescent::perform_training()
 
           // Loss index stuff
 
-//          training_loss = loss_index_pointer->calculate_training_loss(training_batch_indices);
+          const LossIndex::FirstOrderError first_order_loss = loss_index_pointer->calculate_training_first_order_loss();
+
+          training_loss = first_order_loss.error;
+
+          gradient = first_order_loss.gradient;
 
           if(/*iteration*/current_iteration == 0)
           {
@@ -1323,8 +1359,6 @@ GradientDescent::GradientDescentResults* GradientDescent::perform_training()
               batch_history.push_back(current_batch_size);
           }
 
-          gradient = loss_index_pointer->calculate_training_loss_gradient();
-
           if(gradient == 0.0) throw logic_error("Gradient is zero");
 
           gradient_norm = gradient.calculate_L2_norm();
@@ -1395,51 +1429,66 @@ GradientDescent::GradientDescentResults* GradientDescent::perform_training()
 
           if(reserve_parameters_history)
           {
-             results_pointer->parameters_history[/*iteration*/current_iteration] = parameters;
+             results_pointer->parameters_history[current_iteration - first_iteration] = parameters;
+          }
+
+          if(parameters_history_sink)
+          {
+             parameters_history_sink->record(current_iteration, parameters);
           }
 
           if(reserve_parameters_norm_history)
           {
-             results_pointer->parameters_norm_history[/*iteration*/current_iteration] = parameters_norm;
+             results_pointer->parameters_norm_history[current_iteration - first_iteration] = parameters_norm;
           }
 
           // Training history loss index
 
           if(reserve_loss_history)
           {
-             results_pointer->loss_history[/*iteration*/current_iteration] = training_loss;
+             results_pointer->loss_history[current_iteration - first_iteration] = training_loss;
           }
 
           if(reserve_gradient_history)
           {
-             results_pointer->gradient_history[/*iteration*/current_iteration] = gradient;
+             results_pointer->gradient_history[current_iteration - first_iteration] = gradient;
+          }
+
+          if(gradient_history_sink)
+          {
+             gradient_history_sink->record(current_iteration, gradient);
           }
 
           if(reserve_gradient_norm_history)
           {
-             results_pointer->gradient_norm_history[/*iteration*/current_iteration] = gradient_norm;
+             results_pointer->gradient_norm_history[current_iteration - first_iteration] = gradient_norm;
           }
 
           if(reserve_selection_error_history)
           {
-             results_pointer->selection_error_history[/*iteration*/current_iteration] = selection_error;
+             results_pointer->selection_error_history[current_iteration - first_iteration] = selection_error;
           }
 
           // Training history training algorithm
 
           if(reserve_training_direction_history)
           {
-             results_pointer->training_direction_history[/*iteration*/current_iteration] = training_direction;
+             results_pointer->training_direction_history[current_iteration - first_iteration] = training_direction;
+          }
+
+          if(training_direction_history_sink)
+          {
+             training_direction_history_sink->record(current_iteration, training_direction);
           }
 
           if(reserve_training_rate_history)
           {
-             results_pointer->training_rate_history[/*iteration*/current_iteration] = training_rate;
+             results_pointer->training_rate_history[current_iteration - first_iteration] = training_rate;
           }
 
           if(reserve_elapsed_time_history)
           {
-             results_pointer->elapsed_time_history[/*iteration*/current_iteration] = elapsed_time;
+             results_pointer->elapsed_time_history[current_iteration - first_iteration] = elapsed_time;
           }
 
           // Stopping Criteria
@@ -1554,7 +1603,7 @@ GradientDescent::GradientDescentResults* GradientDescent::perform_training()
                 }
              }
 
-             results_pointer->resize_training_history(1+iteration);
+             results_pointer->resize_training_history(1 + current_iteration - first_iteration);
 
              results_pointer->final_parameters = parameters;
 
@@ -1612,9 +1661,37 @@ GradientDescent::GradientDescentResults* GradientDescent::perform_training()
           current_iteration++;
        }
 
+       // Checkpoint
+
+       if(!stop_training && is_checkpoint_epoch(epoch))
+       {
+           checkpoint.set();
+
+           checkpoint.set_training_algorithm_type(write_training_algorithm_type());
+           checkpoint.set_epoch(epoch+1);
+
+           checkpoint.set_vector("parameters", neural_network_pointer->get_parameters());
+
+           checkpoint.set_integer("current_iteration", current_iteration);
+
+           checkpoint.set_scalar("old_training_loss", old_training_loss);
+           checkpoint.set_scalar("old_selection_error", old_selection_error);
+           checkpoint.set_scalar("old_training_rate", old_training_rate);
+
+           checkpoint.set_vector("minimum_selection_error_parameters", minimum_selection_error_parameters);
+           checkpoint.set_scalar("minimum_selection_error", minimum_selection_error);
+           checkpoint.set_integer("selection_failures", selection_failures);
+
+           checkpoint.set_scalar("elapsed_time", elapsed_time);
+
+           save_checkpoint(checkpoint);
+       }
+
        if(stop_training) {break;}
    }
 
+   wait_checkpoint();
+
    if(return_minimum_selection_error_neural_network)
    {
        parameters = minimum_selection_error_parameters;
@@ -364,10 +364,6 @@ private:
 
    size_t maximum_iterations_number;
 
-   /// Initial batch size
-
-   size_t training_initial_batch_size;
-
    /// Maximum training batch size
 
    size_t training_maximum_batch_size;
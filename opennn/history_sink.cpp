@@ -0,0 +1,522 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   H I S T O R Y   S I N K   C L A S S E S                                                                    */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "history_sink.h"
+
+namespace OpenNN
+{
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a history sink which records every epoch.
+
+HistorySink::HistorySink()
+{
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+HistorySink::~HistorySink()
+{
+}
+
+
+// METHODS
+
+/// Returns the number of epochs between two records.
+
+const size_t& HistorySink::get_sampling_period() const
+{
+    return(sampling_period);
+}
+
+
+/// Returns the number of records received since the sink was created or cleared.
+
+const size_t& HistorySink::get_records_number() const
+{
+    return(records_number);
+}
+
+
+/// Sets the number of epochs between two records.
+/// Only the epochs which are a multiple of it are recorded.
+/// @param new_sampling_period Sampling period. It must be greater than zero.
+
+void HistorySink::set_sampling_period(const size_t& new_sampling_period)
+{
+    // Control sentence(if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(new_sampling_period == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: HistorySink class.\n"
+               << "void set_sampling_period(const size_t&) method.\n"
+               << "Sampling period must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    sampling_period = new_sampling_period;
+}
+
+
+/// Records the values of an epoch, if the epoch is a multiple of the sampling period.
+/// @param epoch Epoch of the values.
+/// @param values Values to be recorded.
+
+void HistorySink::record(const size_t& epoch, const Vector<double>& values)
+{
+    if(epoch%sampling_period != 0)
+    {
+        return;
+    }
+
+    write_record(epoch, values.data(), values.size());
+
+    records_number++;
+}
+
+
+/// Records the values of a matrix at an epoch, such as a Hessian approximation, if the epoch is a multiple of the sampling period.
+/// The values are recorded in the column-major order in which the matrix stores them.
+/// @param epoch Epoch of the values.
+/// @param matrix Matrix to be recorded.
+
+void HistorySink::record(const size_t& epoch, const Matrix<double>& matrix)
+{
+    if(epoch%sampling_period != 0)
+    {
+        return;
+    }
+
+    write_record(epoch, matrix.data(), matrix.size());
+
+    records_number++;
+}
+
+
+/// Discards the records received so far.
+
+void HistorySink::clear()
+{
+    records_number = 0;
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a ring buffer history sink with the default capacity.
+
+RingBufferHistorySink::RingBufferHistorySink() : HistorySink()
+{
+    set_capacity(capacity);
+}
+
+
+// CAPACITY CONSTRUCTOR
+
+/// Capacity constructor.
+/// @param new_capacity Maximum number of records kept.
+
+RingBufferHistorySink::RingBufferHistorySink(const size_t& new_capacity) : HistorySink()
+{
+    set_capacity(new_capacity);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+RingBufferHistorySink::~RingBufferHistorySink()
+{
+}
+
+
+/// Returns the maximum number of records kept.
+
+const size_t& RingBufferHistorySink::get_capacity() const
+{
+    return(capacity);
+}
+
+
+/// Returns the epochs of the records kept, from the oldest to the newest.
+
+Vector<size_t> RingBufferHistorySink::get_epochs() const
+{
+    const size_t kept_records_number = min(records_number, capacity);
+
+    const size_t first_index = records_number < capacity ? 0 : next_index;
+
+    Vector<size_t> chronological_epochs(kept_records_number);
+
+    for(size_t i = 0; i < kept_records_number; i++)
+    {
+        chronological_epochs[i] = epochs[(first_index + i)%capacity];
+    }
+
+    return(chronological_epochs);
+}
+
+
+/// Returns the records kept, from the oldest to the newest.
+
+Vector< Vector<double> > RingBufferHistorySink::get_records() const
+{
+    const size_t kept_records_number = min(records_number, capacity);
+
+    const size_t first_index = records_number < capacity ? 0 : next_index;
+
+    Vector< Vector<double> > chronological_records(kept_records_number);
+
+    for(size_t i = 0; i < kept_records_number; i++)
+    {
+        chronological_records[i] = records[(first_index + i)%capacity];
+    }
+
+    return(chronological_records);
+}
+
+
+/// Sets the maximum number of records kept, and discards the records received so far.
+/// @param new_capacity Maximum number of records. It must be greater than zero.
+
+void RingBufferHistorySink::set_capacity(const size_t& new_capacity)
+{
+    // Control sentence(if debug)
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(new_capacity == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: RingBufferHistorySink class.\n"
+               << "void set_capacity(const size_t&) method.\n"
+               << "Capacity must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    capacity = new_capacity;
+
+    clear();
+}
+
+
+/// Discards the records received so far.
+
+void RingBufferHistorySink::clear()
+{
+    HistorySink::clear();
+
+    epochs.set(capacity, 0);
+    records.set(capacity);
+
+    next_index = 0;
+}
+
+
+/// Overwrites the oldest record, or fills the next free position of the buffer.
+/// The memory of the overwritten record is reused.
+
+void RingBufferHistorySink::write_record(const size_t& epoch, const double* values, const size_t& values_number)
+{
+    epochs[next_index] = epoch;
+    records[next_index].assign(values, values + values_number);
+
+    next_index = (next_index + 1)%capacity;
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a sampled history sink which records every epoch.
+
+SampledHistorySink::SampledHistorySink() : HistorySink()
+{
+}
+
+
+// SAMPLING PERIOD CONSTRUCTOR
+
+/// Sampling period constructor.
+/// @param new_sampling_period Number of epochs between two records.
+
+SampledHistorySink::SampledHistorySink(const size_t& new_sampling_period) : HistorySink()
+{
+    set_sampling_period(new_sampling_period);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+SampledHistorySink::~SampledHistorySink()
+{
+}
+
+
+/// Returns the epochs of the records.
+
+const Vector<size_t>& SampledHistorySink::get_epochs() const
+{
+    return(epochs);
+}
+
+
+/// Returns the records, in the order in which they were received.
+
+const Vector< Vector<double> >& SampledHistorySink::get_records() const
+{
+    return(records);
+}
+
+
+/// Discards the records received so far.
+
+void SampledHistorySink::clear()
+{
+    HistorySink::clear();
+
+    epochs.clear();
+    records.clear();
+}
+
+
+/// Appends a record.
+
+void SampledHistorySink::write_record(const size_t& epoch, const double* values, const size_t& values_number)
+{
+    epochs.push_back(epoch);
+    records.push_back(Vector<double>(values, values + values_number));
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates a binary file history sink without a file. A file name must be set before recording.
+
+BinaryFileHistorySink::BinaryFileHistorySink() : HistorySink()
+{
+}
+
+
+// FILE NAME CONSTRUCTOR
+
+/// File name constructor.
+/// It opens the file for appending records.
+/// @param new_file_name Name of the file.
+
+BinaryFileHistorySink::BinaryFileHistorySink(const string& new_file_name) : HistorySink()
+{
+    set_file_name(new_file_name);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+/// It closes the file.
+
+BinaryFileHistorySink::~BinaryFileHistorySink()
+{
+    if(file.is_open())
+    {
+        file.close();
+    }
+}
+
+
+/// Returns the name of the file to which the records are appended.
+
+const string& BinaryFileHistorySink::get_file_name() const
+{
+    return(file_name);
+}
+
+
+/// Sets the file to which the records are appended, and opens it.
+/// The records already in the file are kept.
+/// @param new_file_name Name of the file.
+
+void BinaryFileHistorySink::set_file_name(const string& new_file_name)
+{
+    if(file.is_open())
+    {
+        file.close();
+    }
+
+    file_name = new_file_name;
+
+    file.open(file_name.c_str(), ios::binary | ios::app);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: BinaryFileHistorySink class.\n"
+               << "void set_file_name(const string&) method.\n"
+               << "Cannot open history file: " << file_name << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+
+/// Removes the records in the file.
+
+void BinaryFileHistorySink::clear()
+{
+    HistorySink::clear();
+
+    if(file_name.empty())
+    {
+        return;
+    }
+
+    file.close();
+
+    file.open(file_name.c_str(), ios::binary | ios::trunc);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: BinaryFileHistorySink class.\n"
+               << "void clear() method.\n"
+               << "Cannot open history file: " << file_name << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+
+/// Reads the records written to a file by a binary file history sink.
+/// @param file_name Name of the file.
+/// @param epochs Epochs of the records.
+/// @param records Records, in the order in which they were written.
+
+void BinaryFileHistorySink::load(const string& file_name, Vector<size_t>& epochs, Vector< Vector<double> >& records)
+{
+    ifstream file(file_name.c_str(), ios::binary);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: BinaryFileHistorySink class.\n"
+               << "static void load(const string&, Vector<size_t>&, Vector< Vector<double> >&) method.\n"
+               << "Cannot open history file: " << file_name << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    epochs.clear();
+    records.clear();
+
+    uint64_t header[2];
+
+    while(file.read(reinterpret_cast<char*>(header), sizeof(header)))
+    {
+        Vector<double> values(static_cast<size_t>(header[1]));
+
+        if(!file.read(reinterpret_cast<char*>(values.data()), static_cast<streamsize>(values.size()*sizeof(double))))
+        {
+            ostringstream buffer;
+
+            buffer << "OpenNN Exception: BinaryFileHistorySink class.\n"
+                   << "static void load(const string&, Vector<size_t>&, Vector< Vector<double> >&) method.\n"
+                   << "History file " << file_name << " ends in the middle of a record.\n";
+
+            throw logic_error(buffer.str());
+        }
+
+        epochs.push_back(static_cast<size_t>(header[0]));
+        records.push_back(values);
+    }
+}
+
+
+/// Appends a record to the file and flushes it.
+/// It throws an exception if the record cannot be written, for instance because the disk is full.
+
+void BinaryFileHistorySink::write_record(const size_t& epoch, const double* values, const size_t& values_number)
+{
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: BinaryFileHistorySink class.\n"
+               << "void write_record(const size_t&, const double*, const size_t&) method.\n"
+               << "History file is not open.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    const uint64_t header[2] = {static_cast<uint64_t>(epoch), static_cast<uint64_t>(values_number)};
+
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(values), static_cast<streamsize>(values_number*sizeof(double)));
+
+    file.flush();
+
+    if(!file.good())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: BinaryFileHistorySink class.\n"
+               << "void write_record(const size_t&, const double*, const size_t&) method.\n"
+               << "Cannot write record of epoch " << epoch << " to history file: " << file_name << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,271 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   H I S T O R Y   S I N K   C L A S S E S   H E A D E R                                                      */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __HISTORYSINK_H__
+#define __HISTORYSINK_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <cstdint>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+
+namespace OpenNN
+{
+
+///
+/// This abstract class receives the values of a training history, such as the parameters or the gradient, one epoch at a time.
+/// Unlike the history vectors of the training results, which keep every epoch in memory,
+/// its derived classes bound the memory used, or write the records to a file as they arrive.
+/// Only the epochs which are a multiple of the sampling period are recorded.
+///
+
+class HistorySink
+{
+
+public:
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit HistorySink();
+
+    // DESTRUCTOR
+
+    virtual ~HistorySink();
+
+    // Get methods
+
+    const size_t& get_sampling_period() const;
+
+    const size_t& get_records_number() const;
+
+    // Set methods
+
+    void set_sampling_period(const size_t&);
+
+    // Record methods
+
+    void record(const size_t&, const Vector<double>&);
+    void record(const size_t&, const Matrix<double>&);
+
+    virtual void clear();
+
+protected:
+
+    /// Stores the values of an epoch which has passed the sampling.
+
+    virtual void write_record(const size_t&, const double*, const size_t&) = 0;
+
+    // MEMBERS
+
+    /// Number of epochs between two records.
+
+    size_t sampling_period = 1;
+
+    /// Number of records received since the sink was created or cleared.
+
+    size_t records_number = 0;
+};
+
+
+///
+/// This class keeps in memory the records of the last epochs, up to a fixed capacity.
+/// When it is full, each new record overwrites the oldest one.
+///
+
+class RingBufferHistorySink : public HistorySink
+{
+
+public:
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit RingBufferHistorySink();
+
+    // CAPACITY CONSTRUCTOR
+
+    explicit RingBufferHistorySink(const size_t&);
+
+    // DESTRUCTOR
+
+    virtual ~RingBufferHistorySink();
+
+    // Get methods
+
+    const size_t& get_capacity() const;
+
+    Vector<size_t> get_epochs() const;
+    Vector< Vector<double> > get_records() const;
+
+    // Set methods
+
+    void set_capacity(const size_t&);
+
+    void clear();
+
+protected:
+
+    void write_record(const size_t&, const double*, const size_t&);
+
+private:
+
+    // MEMBERS
+
+    /// Maximum number of records kept.
+
+    size_t capacity = 100;
+
+    /// Epochs of the records kept, in the order of the buffer.
+
+    Vector<size_t> epochs;
+
+    /// Records kept, in the order of the buffer.
+
+    Vector< Vector<double> > records;
+
+    /// Position in the buffer of the next record.
+
+    size_t next_index = 0;
+};
+
+
+///
+/// This class keeps in memory the records of every k-th epoch, where k is the sampling period.
+/// The memory used grows with the number of epochs divided by the sampling period.
+///
+
+class SampledHistorySink : public HistorySink
+{
+
+public:
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit SampledHistorySink();
+
+    // SAMPLING PERIOD CONSTRUCTOR
+
+    explicit SampledHistorySink(const size_t&);
+
+    // DESTRUCTOR
+
+    virtual ~SampledHistorySink();
+
+    // Get methods
+
+    const Vector<size_t>& get_epochs() const;
+    const Vector< Vector<double> >& get_records() const;
+
+    void clear();
+
+protected:
+
+    void write_record(const size_t&, const double*, const size_t&);
+
+private:
+
+    // MEMBERS
+
+    /// Epochs of the records.
+
+    Vector<size_t> epochs;
+
+    /// Records, in the order in which they were received.
+
+    Vector< Vector<double> > records;
+};
+
+
+///
+/// This class appends the records to a binary file, so that no record is kept in memory.
+/// Each record is written as the epoch and the number of values, both as 64 bit unsigned integers,
+/// followed by the values as doubles, in the byte order of the machine.
+/// The file is flushed after each record, so that it can be read while the training is running or after it stops unexpectedly.
+///
+
+class BinaryFileHistorySink : public HistorySink
+{
+
+public:
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit BinaryFileHistorySink();
+
+    // FILE NAME CONSTRUCTOR
+
+    explicit BinaryFileHistorySink(const string&);
+
+    // DESTRUCTOR
+
+    virtual ~BinaryFileHistorySink();
+
+    // Get methods
+
+    const string& get_file_name() const;
+
+    // Set methods
+
+    void set_file_name(const string&);
+
+    void clear();
+
+    // File methods
+
+    static void load(const string&, Vector<size_t>&, Vector< Vector<double> >&);
+
+protected:
+
+    void write_record(const size_t&, const double*, const size_t&);
+
+private:
+
+    // MEMBERS
+
+    /// Name of the file to which the records are appended.
+
+    string file_name;
+
+    /// Stream of the file, open while the sink has a file name.
+
+    ofstream file;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
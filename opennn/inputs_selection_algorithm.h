@@ -23,6 +23,7 @@
 #include <cmath>
 #include <ctime>
 #include <limits>
+#include <thread>
 
 // OpenNN includes
 
@@ -162,6 +163,7 @@ public:
     bool has_training_strategy() const;
 
     const size_t& get_trials_number() const;
+    const size_t& get_threads_number() const;
 
     const bool& get_reserve_parameters_data() const;
     const bool& get_reserve_loss_data() const;
@@ -190,6 +192,7 @@ public:
     void set_default();
 
     void set_trials_number(const size_t&);
+    void set_threads_number(const size_t&);
 
     void set_reserve_parameters_data(const bool&);
     void set_reserve_loss_data(const bool&);
@@ -237,6 +240,10 @@ public:
 
 protected:
 
+    // Trials methods
+
+    Matrix<double> perform_trials(Vector< Vector<double> >&);
+
     // MEMBERS
 
     /// True if this is a function regression problem.
@@ -267,6 +274,10 @@ protected:
 
     size_t trials_number;
 
+    /// Maximum number of threads used to perform the trials of each neural network.
+
+    size_t threads_number;
+
     /// Method used for the calculation of the loss and the generalizaton loss.
 
     PerformanceCalculationMethod loss_calculation_method;
@@ -1536,6 +1536,79 @@ Vector< Vector<size_t> > Instances::get_training_batches(const size_t& batch_siz
 }
 
 
+/// Returns the training instances indices in a random order, split into batches.
+/// The training indices are grouped into blocks of consecutive instances, the order of the blocks is shuffled
+/// and the instances within each block are shuffled.
+/// Blocks larger than one keep the instances of a batch close in memory, at the cost of less randomness.
+/// @param batch_size Number of instances in each batch.
+/// @param shuffle_block_size Number of consecutive training instances in each block. One shuffles all the instances.
+/// @param generator Random number generator, which is advanced by the shuffling.
+
+Vector< Vector<size_t> > Instances::get_shuffled_training_batches(const size_t& batch_size,
+                                                                   const size_t& shuffle_block_size,
+                                                                   mt19937& generator) const
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(batch_size == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: Instances class.\n"
+               << "Vector< Vector<size_t> > get_shuffled_training_batches(const size_t&, const size_t&, mt19937&) const method.\n"
+               << "Batch size must be greater than zero.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const Vector<size_t> training_indices = get_training_indices();
+
+    const size_t training_instances_number = training_indices.size();
+
+    if(training_instances_number == 0)
+    {
+        return Vector< Vector<size_t> >();
+    }
+
+    const size_t block_size = shuffle_block_size == 0 ? 1 : shuffle_block_size;
+
+    if(block_size == 1)
+    {
+        Vector<size_t> shuffled_indices(training_indices);
+
+        shuffle(shuffled_indices.begin(), shuffled_indices.end(), generator);
+
+        return shuffled_indices.split(batch_size);
+    }
+
+    const size_t blocks_number = (training_instances_number + block_size - 1)/block_size;
+
+    Vector<size_t> blocks_order(0, 1, blocks_number-1);
+
+    shuffle(blocks_order.begin(), blocks_order.end(), generator);
+
+    Vector<size_t> shuffled_indices;
+
+    shuffled_indices.reserve(training_instances_number);
+
+    for(size_t i = 0; i < blocks_number; i++)
+    {
+        const size_t first = blocks_order[i]*block_size;
+        const size_t last = min(first + block_size, training_instances_number);
+
+        const size_t position = shuffled_indices.size();
+
+        shuffled_indices.insert(shuffled_indices.end(), training_indices.begin() + first, training_indices.begin() + last);
+
+        shuffle(shuffled_indices.begin() + position, shuffled_indices.end(), generator);
+    }
+
+    return shuffled_indices.split(batch_size);
+}
+
+
 Vector< Vector<size_t> > Instances::get_selection_batches(const size_t& batch_size) const
 {
     const Vector<size_t> selection_indices = get_selection_indices();
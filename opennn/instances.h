@@ -26,6 +26,7 @@
 #include <stdexcept>
 #include <ctime>
 #include <exception>
+#include <random>
 
 // OpenNN includes
 
@@ -165,6 +166,7 @@ public:
    Vector<size_t> get_testing_indices() const;
 
    Vector< Vector<size_t> > get_training_batches(const size_t&) const;
+   Vector< Vector<size_t> > get_shuffled_training_batches(const size_t&, const size_t&, mt19937&) const;
    Vector< Vector<size_t> > get_selection_batches(const size_t&) const;
    Vector< Vector<size_t> > get_testing_batches(const size_t&) const;
 
@@ -30,6 +30,8 @@ KNearestNeighbors::KNearestNeighbors()
 
     distance_method = Euclidean;
 
+    search_method = SpatialIndex::Automatic;
+
     k = 3;
 }
 
@@ -48,7 +50,11 @@ KNearestNeighbors::KNearestNeighbors(DataSet* new_data_set_pointer)
 
     distance_method = Euclidean;
 
+    search_method = SpatialIndex::Automatic;
+
     k = 3;
+
+    update_spatial_indices();
 }
 
 // DESTRUCTOR
@@ -78,6 +84,8 @@ size_t KNearestNeighbors::get_k() const
 void KNearestNeighbors::set_dataset(DataSet* dataset)
 {
     data_set_pointer = dataset;
+
+    update_spatial_indices();
 }
 
 
@@ -96,6 +104,8 @@ void KNearestNeighbors::set_k(const size_t& k_new)
 void KNearestNeighbors::set_weights(const Matrix<double>& new_weights)
 {
     weights = new_weights;
+
+    update_spatial_indices();
 }
 
 
@@ -148,6 +158,8 @@ void KNearestNeighbors::set_scaling_method(const string& new_method_string)
 void KNearestNeighbors::set_distance_method(const DistanceMethod& new_method)
 {
     distance_method = new_method;
+
+    update_spatial_indices();
 }
 
 
@@ -158,11 +170,11 @@ void KNearestNeighbors::set_distance_method(const string& new_method_string)
 {
     if(new_method_string == "Euclidean")
     {
-        distance_method = Euclidean;
+        set_distance_method(Euclidean);
     }
     else if(new_method_string == "Manhattan")
     {
-        distance_method = Manhattan;
+        set_distance_method(Manhattan);
     }
     else
     {
@@ -177,6 +189,107 @@ void KNearestNeighbors::set_distance_method(const string& new_method_string)
 }
 
 
+/// Sets the method for searching the neighbors of batches of inputs.
+/// The automatic method compares each batch with all the training instances, using matrix products,
+/// when there are many inputs, and otherwise it searches the k-d trees.
+/// @param new_search_method Search method.
+
+void KNearestNeighbors::set_search_method(const SpatialIndex::SearchMethod& new_search_method)
+{
+    search_method = new_search_method;
+
+    for(size_t i = 0; i < spatial_indices.size(); i++)
+    {
+        spatial_indices[i].set_search_method(search_method);
+    }
+}
+
+
+/// Builds the spatial indices of the training inputs, and stores the training targets.
+/// There is an index for each column of weights, which weights the distances of the corresponding target.
+/// The indices are built by the set methods, and this method must be called again if the data set changes.
+
+void KNearestNeighbors::update_spatial_indices()
+{
+    spatial_indices.clear();
+
+    training_targets.set();
+
+    if(data_set_pointer == nullptr)
+    {
+        return;
+    }
+
+    const Matrix<double> training_inputs = data_set_pointer->get_training_inputs();
+
+    const size_t inputs_number = training_inputs.get_columns_number();
+
+    if(weights.get_rows_number() < inputs_number || weights.get_columns_number() == 0)
+    {
+        return;
+    }
+
+    training_targets = data_set_pointer->get_training_targets();
+
+    const size_t indices_number = min(weights.get_columns_number(), max(training_targets.get_columns_number(), static_cast<size_t>(1)));
+
+    const SpatialIndex::DistanceMethod index_distance_method = distance_method == Manhattan ? SpatialIndex::Manhattan : SpatialIndex::Euclidean;
+
+    spatial_indices.set(indices_number);
+
+    for(size_t i = 0; i < indices_number; i++)
+    {
+        spatial_indices[i].set(training_inputs, weights.get_column(i).get_first(inputs_number), index_distance_method);
+        spatial_indices[i].set_search_method(search_method);
+    }
+}
+
+
+/// Returns the spatial index used to search the neighbors of a target.
+/// Targets beyond the last column of weights use the last one.
+/// @param target_index Index of the target.
+
+const SpatialIndex& KNearestNeighbors::get_spatial_index(const size_t& target_index) const
+{
+    if(spatial_indices.empty())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: KNearestNeighbors class.\n"
+               << "const SpatialIndex& get_spatial_index(const size_t&) const method.\n"
+               << "Spatial indices are not built. Data set must be set and weights must have a row for each input.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    return spatial_indices[min(target_index, spatial_indices.size()-1)];
+}
+
+
+/// Returns the weighted mean of the training targets of some neighbors, for a single target variable.
+/// @param neighbors_indices Indices of the neighbors among the training instances.
+/// @param neighbors_distances Distances to the neighbors.
+/// @param target_index Index of the target.
+
+double KNearestNeighbors::calculate_output(const Vector<size_t>& neighbors_indices,
+                                           const Vector<double>& neighbors_distances,
+                                           const size_t& target_index) const
+{
+    const Vector<double> k_distances_weights = calculate_distances_weights(neighbors_distances);
+
+    const double norm = k_distances_weights.calculate_sum();
+
+    double output = 0.0;
+
+    for(size_t j = 0; j < neighbors_indices.size(); j++)
+    {
+        output += training_targets(neighbors_indices[j], target_index)*k_distances_weights[j];
+    }
+
+    return output/norm;
+}
+
+
 /// Returns the matrix of attributes weights
 
 Matrix<double> KNearestNeighbors::calculate_correlation_weights(void) const
@@ -236,24 +349,37 @@ Vector<double> KNearestNeighbors::calculate_distances_weights(const Vector<doubl
 
 /// Calculates a set of outputs from the KNN in response to a set of inputs.
 /// The format is a matrix, where each row contains the output for a single input.
+/// The neighbors of all the inputs are searched in a batch for each spatial index.
 /// @param inputs Matrix of inputs to the KNN.
 
 Matrix<double> KNearestNeighbors::calculate_outputs(const Matrix<double>& input_data) const
 {
     const size_t instances_number = input_data.get_rows_number();
-    const size_t targets_number = data_set_pointer->get_variables().get_targets_number();
+    const size_t targets_number = training_targets.get_columns_number();
 
     Matrix<double> output_data(instances_number, targets_number, 0.0);
 
-    #pragma omp parallel for
+    Vector<SpatialIndex::Neighbors> neighbors(spatial_indices.size());
 
-    for(int i = 0; i < static_cast<int>(instances_number); i++)
+    for(size_t j = 0; j < targets_number && j < spatial_indices.size(); j++)
     {
-        const Vector<double> inputs = input_data.get_row(static_cast<size_t>(i));
+        neighbors[j] = get_spatial_index(j).calculate_k_nearest_neighbors(input_data, k);
+    }
+
+    for(size_t j = 0; j < targets_number; j++)
+    {
+        const SpatialIndex::Neighbors& target_neighbors = neighbors[min(j, neighbors.size()-1)];
 
-        const Vector<double> outputs = calculate_outputs(inputs);
+        #pragma omp parallel for
+
+        for(int i = 0; i < static_cast<int>(instances_number); i++)
+        {
+            const size_t instance_index = static_cast<size_t>(i);
 
-        output_data.set_row(static_cast<size_t>(i), outputs);
+            output_data(instance_index, j) = calculate_output(target_neighbors.indices.get_row(instance_index),
+                                                              target_neighbors.distances.get_row(instance_index),
+                                                              j);
+        }
     }
 
     return output_data;
@@ -298,32 +424,24 @@ Vector<double> KNearestNeighbors::calculate_outputs(const Vector<double>& inputs
 
 KNearestNeighbors::Neighbors KNearestNeighbors::calculate_k_nearest_neighbors_supervised(const Vector<double>& inputs) const
 {
-    const Matrix<double> training_inputs = data_set_pointer->get_training_inputs();
+    const size_t targets_number = training_targets.get_columns_number();
+
+    const size_t neighbors_number = min(k, get_spatial_index(0).get_points_number());
 
-    const size_t targets_number = data_set_pointer->get_variables().get_targets_number();
+    Matrix<double> k_nearest_distances(neighbors_number,targets_number);
+    Matrix<size_t> k_nearest_neighbors(neighbors_number,targets_number);
 
-    Matrix<double> k_nearest_distances(k,targets_number);
-    Matrix<size_t> k_nearest_neighbors(k,targets_number);
+    SpatialIndex::Neighbors index_neighbors;
 
     for (size_t i = 0; i < targets_number; i++)
     {
-        Vector<double> weighted_distances;
-
-        if (distance_method == Euclidean)
-        {
-            weighted_distances = training_inputs.calculate_euclidean_weighted_distance(inputs, weights.get_column(i));
-        }
-        else if (distance_method == Manhattan)
+        if(i < spatial_indices.size())
         {
-            weighted_distances = training_inputs.calculate_manhattan_weighted_distance(inputs, weights.get_column(i));
+            index_neighbors = get_spatial_index(i).calculate_k_nearest_neighbors(inputs, k);
         }
 
-        const Vector<size_t> nearest_neighbors = weighted_distances.calculate_lower_indices(k);
-
-        const Vector<double> nearest_distances = weighted_distances.calculate_lower_values(k);
-
-        k_nearest_distances.set_column(i,nearest_distances);
-        k_nearest_neighbors.set_column(i,nearest_neighbors);
+        k_nearest_distances.set_column(i,index_neighbors.distances.get_row(0));
+        k_nearest_neighbors.set_column(i,index_neighbors.indices.get_row(0));
     }
 
     Neighbors neighbors;
@@ -340,28 +458,15 @@ KNearestNeighbors::Neighbors KNearestNeighbors::calculate_k_nearest_neighbors_su
 
 KNearestNeighbors::Neighbors KNearestNeighbors::calculate_k_nearest_neighbors_unsupervised(const Vector<double>& inputs) const
 {
-    const Matrix<double> training_inputs = data_set_pointer->get_training_inputs();
+    const SpatialIndex::Neighbors index_neighbors = get_spatial_index(0).calculate_k_nearest_neighbors(inputs, k);
 
-    Matrix<double> k_nearest_distances(k,1);
-    Matrix<size_t> k_nearest_neighbors(k,1);
+    const size_t neighbors_number = index_neighbors.indices.get_columns_number();
 
-    Vector<double> weighted_distances;
+    Matrix<double> k_nearest_distances(neighbors_number,1);
+    Matrix<size_t> k_nearest_neighbors(neighbors_number,1);
 
-    if (distance_method == Euclidean)
-    {
-        weighted_distances = training_inputs.calculate_euclidean_weighted_distance(inputs, weights.get_column(0));
-    }
-    else if (distance_method == Manhattan)
-    {
-        weighted_distances = training_inputs.calculate_manhattan_weighted_distance(inputs, weights.get_column(0));
-    }
-
-    const Vector<size_t> nearest_neighbors = weighted_distances.calculate_lower_indices(k);
-
-    const Vector<double> nearest_distances = weighted_distances.calculate_lower_values(k);
-
-    k_nearest_distances.set_column(0,nearest_distances);
-    k_nearest_neighbors.set_column(0,nearest_neighbors);
+    k_nearest_distances.set_column(0,index_neighbors.distances.get_row(0));
+    k_nearest_neighbors.set_column(0,index_neighbors.indices.get_row(0));
 
     Neighbors neighbors;
     neighbors.distances = k_nearest_distances;
@@ -377,23 +482,13 @@ KNearestNeighbors::Neighbors KNearestNeighbors::calculate_k_nearest_neighbors_un
 
 Vector<double> KNearestNeighbors::calculate_outputs(const Neighbors& k_nearest_neighbors) const
 {
-    const Matrix<double> targets = data_set_pointer->get_training_targets();
-
-    const size_t targets_number = data_set_pointer->get_variables().get_targets_number();
+    const size_t targets_number = training_targets.get_columns_number();
 
     Vector<double> output(targets_number,0.0);
 
     for (size_t i = 0; i < targets_number; i++)
     {
-        const Vector<size_t> current_k_nearest_neighbors = k_nearest_neighbors.indices.get_column(i);
-
-        const Vector<double> k_nearest_targets = targets.get_column(i).get_subvector(current_k_nearest_neighbors);
-
-        const Vector<double> k_distances_weights = calculate_distances_weights(k_nearest_neighbors.distances.get_column(i));
-
-        const double norm = k_distances_weights.calculate_sum();
-
-        output[i] = (k_nearest_targets*k_distances_weights).calculate_sum()/norm;
+        output[i] = calculate_output(k_nearest_neighbors.indices.get_column(i), k_nearest_neighbors.distances.get_column(i), i);
     }
 
     return output;
@@ -29,7 +29,11 @@
 
 // OpenNN includes
 
-#include "opennn.h"
+#include "vector.h"
+#include "matrix.h"
+#include "data_set.h"
+#include "spatial_index.h"
+#include "testing_analysis.h"
 
 // TinyXml includes
 
@@ -92,6 +96,10 @@ public:
 
     void set_distance_method(const string&);
 
+    void set_search_method(const SpatialIndex::SearchMethod&);
+
+    void update_spatial_indices();
+
     // Algorithm methods
 
     Matrix<double> calculate_correlation_weights(void) const;
@@ -136,6 +144,10 @@ public:
 
 private:
 
+    const SpatialIndex& get_spatial_index(const size_t&) const;
+
+    double calculate_output(const Vector<size_t>&, const Vector<double>&, const size_t&) const;
+
     DataSet* data_set_pointer;
 
     size_t k;
@@ -144,6 +156,18 @@ private:
 
     ScalingMethod scaling_method;
     DistanceMethod distance_method;
+
+    /// Method for searching the neighbors of batches of inputs.
+
+    SpatialIndex::SearchMethod search_method;
+
+    /// Spatial indices of the training inputs, one for each column of weights.
+
+    Vector<SpatialIndex> spatial_indices;
+
+    /// Targets of the training instances, in the order of the spatial indices points.
+
+    Matrix<double> training_targets;
 };
 
 }
@@ -1146,6 +1146,9 @@ Matrix<string> LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults::
 
 /// Trains a neural network with an associated loss index according to the Levenberg-Marquardt algorithm.
 /// Training occurs according to the training parameters.
+/// If a checkpoint file is set, the parameters, the damping parameter and the state of the method are saved to it every checkpoint period epochs,
+/// and the training can later resume from the last checkpoint, as if it had not been interrupted.
+/// The training history of the results only contains the epochs performed after resuming.
 
 LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarquardtAlgorithm::perform_training()
 {
@@ -1167,7 +1170,7 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
 
    results_pointer->resize_training_history(1+maximum_epochs_number);
 
-   const size_t selection_instances_number = loss_index_pointer->get_data_set_pointer()->get_instances().get_selection_instances_number();
+   const size_t selection_instances_number = loss_index_pointer->sum_MPI(loss_index_pointer->get_data_set_pointer()->get_instances().get_selection_instances_number());
 
    // Neural network stuff
 
@@ -1200,6 +1203,8 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
    Vector<double> parameters_increment(parameters_number);
    double parameters_increment_norm;
 
+   Eigen::LLT<Eigen::MatrixXd> Cholesky_decomposition(static_cast<Eigen::Index>(parameters_number));
+
    Vector<double> minimum_selection_error_parameters(parameters_number);
    double minimum_selection_error = 0.0;
 
@@ -1209,9 +1214,37 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
    time(&beginning_time);
    double elapsed_time = 0.0;
 
+   // Checkpoint, from which the training resumes with the state it had at the end of an epoch
+
+   TrainingCheckpoint checkpoint;
+
+   size_t first_epoch = 0;
+
+   if(load_checkpoint(checkpoint))
+   {
+       first_epoch = checkpoint.get_epoch();
+
+       parameters = checkpoint.get_vector("parameters");
+
+       neural_network_pointer->set_parameters(parameters);
+
+       set_damping_parameter(checkpoint.get_scalar("damping_parameter"));
+
+       old_training_loss = checkpoint.get_scalar("old_training_loss");
+       old_selection_error = checkpoint.get_scalar("old_selection_error");
+
+       minimum_selection_error_parameters = checkpoint.get_vector("minimum_selection_error_parameters");
+       minimum_selection_error = checkpoint.get_scalar("minimum_selection_error");
+       selection_failures = checkpoint.get_integer("selection_failures");
+
+       beginning_time -= static_cast<time_t>(checkpoint.get_scalar("elapsed_time"));
+
+       if(display) cout << "Resuming training from epoch " << first_epoch << " of " << checkpoint_file_name << ".\n";
+   }
+
    // Main loop
 
-   for(size_t epoch = 0; epoch <= maximum_epochs_number; epoch++)
+   for(size_t epoch = first_epoch; epoch <= maximum_epochs_number; epoch++)
    {
       // Neural network
 
@@ -1235,11 +1268,11 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
          cout << "OpenNN Warning: Gradient norm is " << gradient_norm << "." << endl;
       }
 
+      const Vector<double> negative_gradient = terms_second_order_loss.gradient*(-1.0);
+
       do
       {        
-         terms_second_order_loss.Hessian_approximation.sum_diagonal(damping_parameter);
-
-         parameters_increment = perform_Householder_QR_decomposition(terms_second_order_loss.Hessian_approximation, terms_second_order_loss.gradient*(-1.0));
+         parameters_increment = perform_Cholesky_decomposition(terms_second_order_loss.Hessian_approximation, damping_parameter, negative_gradient, Cholesky_decomposition);
 
          const double new_loss = loss_index_pointer->calculate_training_loss(parameters+parameters_increment);
 
@@ -1257,7 +1290,6 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
          }
          else
          {
-             terms_second_order_loss.Hessian_approximation.sum_diagonal(-damping_parameter);
              set_damping_parameter(damping_parameter*damping_parameter_factor);
          }
       }while(damping_parameter < maximum_damping_parameter);
@@ -1301,51 +1333,66 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
 
       if(reserve_parameters_history)
       {
-         results_pointer->parameters_history[epoch] = parameters;
+         results_pointer->parameters_history[epoch - first_epoch] = parameters;
+      }
+
+      if(parameters_history_sink)
+      {
+         parameters_history_sink->record(epoch, parameters);
       }
 
       if(reserve_parameters_norm_history)
       {
-         results_pointer->parameters_norm_history[epoch] = parameters_norm;
+         results_pointer->parameters_norm_history[epoch - first_epoch] = parameters_norm;
       }
 
       // Training history loss index
 
       if(reserve_loss_history)
       {
-         results_pointer->loss_history[epoch] = training_loss;
+         results_pointer->loss_history[epoch - first_epoch] = training_loss;
       }
 
       if(reserve_selection_error_history)
       {
-         results_pointer->selection_error_history[epoch] = selection_error;
+         results_pointer->selection_error_history[epoch - first_epoch] = selection_error;
       }
 
       if(reserve_gradient_history)
       {
-         results_pointer->gradient_history[epoch] = terms_second_order_loss.gradient;
+         results_pointer->gradient_history[epoch - first_epoch] = terms_second_order_loss.gradient;
+      }
+
+      if(gradient_history_sink)
+      {
+         gradient_history_sink->record(epoch, terms_second_order_loss.gradient);
       }
 
       if(reserve_gradient_norm_history)
       {
-         results_pointer->gradient_norm_history[epoch] = gradient_norm;
+         results_pointer->gradient_norm_history[epoch - first_epoch] = gradient_norm;
       }
 
       if(reserve_Hessian_approximation_history)
       {
-         results_pointer->Hessian_approximation_history[epoch] = terms_second_order_loss.Hessian_approximation; // as computed by linear algebraic equations object
+         results_pointer->Hessian_approximation_history[epoch - first_epoch] = terms_second_order_loss.Hessian_approximation; // as computed by linear algebraic equations object
+      }
+
+      if(Hessian_approximation_history_sink)
+      {
+         Hessian_approximation_history_sink->record(epoch, terms_second_order_loss.Hessian_approximation);
       }
 
       // Training history training algorithm
 
       if(reserve_damping_parameter_history)
       {
-         results_pointer->damping_parameter_history[epoch] = damping_parameter;
+         results_pointer->damping_parameter_history[epoch - first_epoch] = damping_parameter;
       }
 
       if(reserve_elapsed_time_history)
       {
-         results_pointer->elapsed_time_history[epoch] = elapsed_time;
+         results_pointer->elapsed_time_history[epoch - first_epoch] = elapsed_time;
       }
 
 	  // Stopping Criteria
@@ -1461,7 +1508,7 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
 
 //          neural_network_pointer->set_parameters(parameters);
 
-          results_pointer->resize_training_history(1+epoch);
+          results_pointer->resize_training_history(1 + epoch - first_epoch);
 
          results_pointer->final_parameters = parameters;
          results_pointer->final_parameters_norm = parameters_norm;
@@ -1502,8 +1549,35 @@ LevenbergMarquardtAlgorithm::LevenbergMarquardtAlgorithmResults* LevenbergMarqua
       // Set new parameters
 
 //      neural_network_pointer->set_parameters(parameters);
+
+      // Checkpoint
+
+      if(is_checkpoint_epoch(epoch))
+      {
+          checkpoint.set();
+
+          checkpoint.set_training_algorithm_type(write_training_algorithm_type());
+          checkpoint.set_epoch(epoch+1);
+
+          checkpoint.set_vector("parameters", parameters);
+
+          checkpoint.set_scalar("damping_parameter", damping_parameter);
+
+          checkpoint.set_scalar("old_training_loss", old_training_loss);
+          checkpoint.set_scalar("old_selection_error", old_selection_error);
+
+          checkpoint.set_vector("minimum_selection_error_parameters", minimum_selection_error_parameters);
+          checkpoint.set_scalar("minimum_selection_error", minimum_selection_error);
+          checkpoint.set_integer("selection_failures", selection_failures);
+
+          checkpoint.set_scalar("elapsed_time", elapsed_time);
+
+          save_checkpoint(checkpoint);
+      }
    } 
 
+   wait_checkpoint();
+
    if(return_minimum_selection_error_neural_network)
    {
        parameters = minimum_selection_error_parameters;
@@ -2811,6 +2885,45 @@ Vector<double> LevenbergMarquardtAlgorithm::perform_Householder_QR_decomposition
     return(x);
 }
 
+
+/// Uses Eigen to solve the damped system of equations(A + damping*I)x = b by means of the Cholesky decomposition.
+/// The matrix A must be symmetric, as the Hessian approximation of the Levenberg-Marquardt algorithm is.
+/// The damped matrix is formed inside the storage of the decomposition, so A is not modified and,
+/// when the same decomposition object is passed again, no memory is allocated.
+/// If the damped matrix is not numerically positive definite, the Householder QR decomposition is used instead.
+/// @param A Symmetric matrix of the system.
+/// @param damping Value added to the diagonal of A.
+/// @param b Independent terms of the system.
+/// @param Cholesky_decomposition Decomposition object, whose storage is reused between calls.
+
+Vector<double> LevenbergMarquardtAlgorithm::perform_Cholesky_decomposition(const Matrix<double>& A, const double& damping, const Vector<double>& b,
+                                                                           Eigen::LLT<Eigen::MatrixXd>& Cholesky_decomposition) const
+{
+    const size_t n = A.get_rows_number();
+
+    const Eigen::Map<const Eigen::MatrixXd> A_eigen(A.data(), static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(n));
+
+    Cholesky_decomposition.compute(A_eigen + damping*Eigen::MatrixXd::Identity(static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(n)));
+
+    if(Cholesky_decomposition.info() != Eigen::Success)
+    {
+        Matrix<double> damped_A(A);
+
+        damped_A.sum_diagonal(damping);
+
+        return(perform_Householder_QR_decomposition(damped_A, b));
+    }
+
+    Vector<double> x(n);
+
+    const Eigen::Map<const Eigen::VectorXd> b_eigen(b.data(), static_cast<Eigen::Index>(n));
+    Eigen::Map<Eigen::VectorXd> x_eigen(x.data(), static_cast<Eigen::Index>(n));
+
+    x_eigen = Cholesky_decomposition.solve(b_eigen);
+
+    return(x);
+}
+
 }
 
 // OpenNN: Open Neural Networks Library.
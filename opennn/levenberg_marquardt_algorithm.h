@@ -303,6 +303,8 @@ public:
 
    Vector<double> perform_Householder_QR_decomposition(const Matrix<double>&, const Vector<double>&) const;
 
+   Vector<double> perform_Cholesky_decomposition(const Matrix<double>&, const double&, const Vector<double>&, Eigen::LLT<Eigen::MatrixXd>&) const;
+
 private:
 
    // MEMBERS
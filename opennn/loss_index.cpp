@@ -111,6 +111,12 @@ LossIndex::LossIndex(const LossIndex& other_error_term)
 
    data_set_pointer = other_error_term.data_set_pointer;
 
+   regularization_method = other_error_term.regularization_method;
+
+   regularization_weight = other_error_term.regularization_weight;
+
+   batch_size = other_error_term.batch_size;
+
    display = other_error_term.display;
 }
 
@@ -139,6 +145,12 @@ LossIndex& LossIndex::operator = (const LossIndex& other_error_term)
 
       data_set_pointer = other_error_term.data_set_pointer;
 
+      regularization_method = other_error_term.regularization_method;
+
+      regularization_weight = other_error_term.regularization_weight;
+
+      batch_size = other_error_term.batch_size;
+
       display = other_error_term.display;
    }
 
@@ -179,6 +191,14 @@ const double& LossIndex::get_regularization_weight() const
 }
 
 
+/// Returns the maximum number of instances in the batches of the data set in which the error is calculated.
+
+const size_t& LossIndex::get_batch_size() const
+{
+   return(batch_size);
+}
+
+
 /// Returns true if messages from this class can be displayed on the screen, or false if messages
 /// from this class can't be displayed on the screen.
 
@@ -284,6 +304,10 @@ void LossIndex::set(const LossIndex& other_error_term)
 
    regularization_method = other_error_term.regularization_method;
 
+   regularization_weight = other_error_term.regularization_weight;
+
+   batch_size = other_error_term.batch_size;
+
    display = other_error_term.display;
 }
 
@@ -796,6 +820,106 @@ Matrix<double> LossIndex::calculate_error_terms_Jacobian
 }
 
 
+/// Adds the squared error terms of a batch, the gradient J'e and the Hessian approximation J'J to an accumulator,
+/// where J is the Jacobian of the error terms with respect to the parameters.
+/// The Jacobian is computed for a few instances at a time, and the Hessian approximation is updated with a symmetric rank update,
+/// so the Jacobian of the whole batch, its transpose and a temporary Hessian are never formed.
+/// Only the upper triangle of the Hessian approximation is accumulated, the lower one is filled in by reduce_second_order_accumulators().
+/// @param inputs Inputs of the batch.
+/// @param layers_activations Activations of each layer for the batch.
+/// @param layers_delta Derivatives of the error terms with respect to the combinations of each layer.
+/// @param error_terms Error terms of the batch.
+/// @param accumulator Loss, gradient and Hessian approximation to which the batch terms are added.
+
+void LossIndex::accumulate_second_order_terms(const Matrix<double>& inputs,
+                                              const Vector< Matrix<double> >& layers_activations,
+                                              const Vector< Matrix<double> >& layers_delta,
+                                              const Vector<double>& error_terms,
+                                              SecondOrderErrorTerms& accumulator) const
+{
+   const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+   const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+   const size_t parameters_number = accumulator.gradient.size();
+   const size_t instances_number = inputs.get_rows_number();
+
+   // Number of instances whose Jacobian rows are held at the same time
+
+   const size_t block_instances_number = min(instances_number, static_cast<size_t>(64));
+
+   Matrix<double> Jacobian_block(block_instances_number, parameters_number);
+
+   Eigen::Map<Eigen::MatrixXd> Hessian_approximation(accumulator.Hessian_approximation.data(),
+                                                     static_cast<Eigen::Index>(parameters_number),
+                                                     static_cast<Eigen::Index>(parameters_number));
+
+   Eigen::Map<Eigen::VectorXd> gradient(accumulator.gradient.data(), static_cast<Eigen::Index>(parameters_number));
+
+   for(size_t first_instance = 0; first_instance < instances_number; first_instance += block_instances_number)
+   {
+      const size_t rows_number = min(block_instances_number, instances_number - first_instance);
+
+      double* Jacobian_data = Jacobian_block.data();
+
+      size_t parameter = 0;
+
+      for(size_t layer = 0; layer < layers_number; layer++)
+      {
+         const Matrix<double>& layer_inputs = layer == 0 ? inputs : layers_activations[layer-1];
+         const Matrix<double>& layer_deltas = layers_delta[layer];
+
+         const size_t inputs_number = layer_inputs.get_columns_number();
+         const size_t perceptrons_number = layer_deltas.get_columns_number();
+
+         // Synaptic weights
+
+         for(size_t perceptron = 0; perceptron < perceptrons_number; perceptron++)
+         {
+            const double* perceptron_deltas = layer_deltas.data() + perceptron*instances_number + first_instance;
+
+            for(size_t input = 0; input < inputs_number; input++)
+            {
+               const double* input_values = layer_inputs.data() + input*instances_number + first_instance;
+
+               double* Jacobian_column = Jacobian_data + parameter*rows_number;
+
+               for(size_t i = 0; i < rows_number; i++)
+               {
+                  Jacobian_column[i] = perceptron_deltas[i]*input_values[i];
+               }
+
+               parameter++;
+            }
+         }
+
+         // Biases
+
+         for(size_t perceptron = 0; perceptron < perceptrons_number; perceptron++)
+         {
+            const double* perceptron_deltas = layer_deltas.data() + perceptron*instances_number + first_instance;
+
+            copy(perceptron_deltas, perceptron_deltas + rows_number, Jacobian_data + parameter*rows_number);
+
+            parameter++;
+         }
+      }
+
+      const Eigen::Map<const Eigen::MatrixXd> Jacobian(Jacobian_data,
+                                                       static_cast<Eigen::Index>(rows_number),
+                                                       static_cast<Eigen::Index>(parameters_number));
+
+      const Eigen::Map<const Eigen::VectorXd> block_error_terms(error_terms.data() + first_instance, static_cast<Eigen::Index>(rows_number));
+
+      Hessian_approximation.selfadjointView<Eigen::Upper>().rankUpdate(Jacobian.transpose());
+
+      gradient.noalias() += Jacobian.transpose()*block_error_terms;
+   }
+
+   accumulator.loss += error_terms.dot(error_terms);
+}
+
+
 Vector<double> LossIndex::calculate_layer_error_gradient(const Matrix<double>& layer_deltas, const Matrix<double>& layer_inputs) const
 {
     const size_t inputs_number = layer_inputs.get_columns_number();
@@ -893,6 +1017,542 @@ Matrix<double> LossIndex::calculate_layer_error_terms_Jacobian(const Matrix<doub
 
 
 
+/// Makes sure that there is one back-propagation workspace for each thread,
+/// allocated for the current architecture of the multilayer perceptron.
+/// Workspaces which are already allocated for that architecture are kept, so that their memory is reused.
+/// This method must be called outside parallel regions.
+/// @param instances_number Maximum number of instances in a batch.
+
+void LossIndex::set_back_propagations(const size_t& instances_number) const
+{
+#ifdef _OPENMP
+    const size_t threads_number = static_cast<size_t>(omp_get_max_threads());
+#else
+    const size_t threads_number = 1;
+#endif
+
+    if(back_propagations.size() != threads_number)
+    {
+        back_propagations.set(threads_number);
+    }
+
+    const Vector<size_t> architecture = neural_network_pointer->get_multilayer_perceptron_pointer()->get_architecture();
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        if(back_propagations[i].architecture.size() != architecture.size()
+        || !equal(architecture.begin(), architecture.end(), back_propagations[i].architecture.begin()))
+        {
+            back_propagations[i].set(architecture, instances_number);
+        }
+    }
+}
+
+
+/// Returns the back-propagation workspace of the calling thread.
+/// The workspaces must have been allocated with set_back_propagations() before entering the parallel region.
+
+LossIndex::BackPropagation& LossIndex::get_back_propagation() const
+{
+#ifdef _OPENMP
+    return back_propagations[static_cast<size_t>(omp_get_thread_num())];
+#else
+    return back_propagations[0];
+#endif
+}
+
+
+/// Calculates the derivatives of the error with respect to the outputs of a batch, and writes them into a given matrix.
+/// Error terms which support the back-propagation workspaces must override this method.
+/// @param outputs Outputs of the multilayer perceptron for the batch.
+/// @param targets Targets of the batch.
+/// @param output_gradient Matrix where the output gradient is written.
+
+void LossIndex::calculate_output_gradient(const Matrix<double>&, const Matrix<double>&, Matrix<double>&) const
+{
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: LossIndex class.\n"
+           << "void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&, Matrix<double>&) const method.\n"
+           << "This method is not implemented for the " << write_error_term_type() << " error term.\n";
+
+    throw logic_error(buffer.str());
+}
+
+
+/// Calculates the derivatives of the error with respect to the combinations of each layer, and writes them into given matrices.
+/// @param layers_activation_derivative Activation derivatives of each layer.
+/// @param output_gradient Derivatives of the error with respect to the outputs.
+/// @param layers_delta Matrices where the deltas of each layer are written.
+
+void LossIndex::calculate_layers_delta(const Vector< Matrix<double> >& layers_activation_derivative,
+                                       const Matrix<double>& output_gradient,
+                                       Vector< Matrix<double> >& layers_delta) const
+{
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+    if(layers_number == 0) return;
+
+    if(layers_delta.size() != layers_number) layers_delta.set(layers_number);
+
+    const size_t instances_number = output_gradient.get_rows_number();
+
+    // Output layer
+
+    Matrix<double>& output_layer_delta = layers_delta[layers_number-1];
+
+    if(output_layer_delta.get_rows_number() != instances_number || output_layer_delta.get_columns_number() != output_gradient.get_columns_number())
+    {
+        output_layer_delta.set(instances_number, output_gradient.get_columns_number());
+    }
+
+    transform(layers_activation_derivative[layers_number-1].begin(), layers_activation_derivative[layers_number-1].end(),
+              output_gradient.begin(), output_layer_delta.begin(), multiplies<double>());
+
+    // Rest of hidden layers
+
+    for(int i = static_cast<int>(layers_number)-2; i >= 0; i--)
+    {
+        const Matrix<double>& next_layer_synaptic_weights = multilayer_perceptron_pointer->get_layer(static_cast<size_t>(i+1)).get_synaptic_weights();
+
+        const Matrix<double>& next_layer_delta = layers_delta[static_cast<size_t>(i+1)];
+
+        Matrix<double>& layer_delta = layers_delta[static_cast<size_t>(i)];
+
+        const size_t perceptrons_number = next_layer_synaptic_weights.get_rows_number();
+        const size_t next_perceptrons_number = next_layer_synaptic_weights.get_columns_number();
+
+        if(layer_delta.get_rows_number() != instances_number || layer_delta.get_columns_number() != perceptrons_number)
+        {
+            layer_delta.set(instances_number, perceptrons_number);
+        }
+
+        const Eigen::Map<Eigen::MatrixXd> next_layer_delta_eigen((double*)next_layer_delta.data(), instances_number, next_perceptrons_number);
+        const Eigen::Map<Eigen::MatrixXd> synaptic_weights_eigen((double*)next_layer_synaptic_weights.data(), perceptrons_number, next_perceptrons_number);
+        const Eigen::Map<Eigen::MatrixXd> activation_derivative_eigen((double*)layers_activation_derivative[static_cast<size_t>(i)].data(), instances_number, perceptrons_number);
+
+        Eigen::Map<Eigen::MatrixXd> layer_delta_eigen(layer_delta.data(), instances_number, perceptrons_number);
+
+        layer_delta_eigen.noalias() = next_layer_delta_eigen*synaptic_weights_eigen.transpose();
+
+        layer_delta_eigen.array() *= activation_derivative_eigen.array();
+    }
+}
+
+
+/// Calculates the error gradient of a batch from the layers deltas, and writes it into a given vector.
+/// @param inputs Inputs of the batch.
+/// @param layers_activations Activations of each layer.
+/// @param layers_delta Deltas of each layer.
+/// @param error_gradient Vector where the gradient is written.
+
+void LossIndex::calculate_error_gradient(const Matrix<double>& inputs,
+                                         const Vector< Matrix<double> >& layers_activations,
+                                         const Vector< Matrix<double> >& layers_delta,
+                                         Vector<double>& error_gradient) const
+{
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+    const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+    if(error_gradient.size() != parameters_number) error_gradient.set(parameters_number);
+
+    const size_t instances_number = inputs.get_rows_number();
+
+    size_t index = 0;
+
+    for(size_t i = 0; i < layers_number; i++)
+    {
+        const Matrix<double>& layer_inputs = i == 0 ? inputs : layers_activations[i-1];
+
+        const size_t inputs_number = layer_inputs.get_columns_number();
+        const size_t perceptrons_number = layers_delta[i].get_columns_number();
+
+        const Eigen::Map<Eigen::MatrixXd> layer_inputs_eigen((double*)layer_inputs.data(), instances_number, inputs_number);
+        const Eigen::Map<Eigen::MatrixXd> layer_delta_eigen((double*)layers_delta[i].data(), instances_number, perceptrons_number);
+
+        // Synaptic weights
+
+        Eigen::Map<Eigen::MatrixXd> synaptic_weights_gradient_eigen(error_gradient.data() + index, inputs_number, perceptrons_number);
+
+        synaptic_weights_gradient_eigen.noalias() = layer_inputs_eigen.transpose()*layer_delta_eigen;
+
+        index += inputs_number*perceptrons_number;
+
+        // Biases
+
+        Eigen::Map<Eigen::VectorXd> biases_gradient_eigen(error_gradient.data() + index, perceptrons_number);
+
+        biases_gradient_eigen.noalias() = layer_delta_eigen.colwise().sum().transpose();
+
+        index += perceptrons_number;
+    }
+}
+
+
+/// Propagates a batch forward and backward through the multilayer perceptron using a back-propagation workspace.
+/// On return, the workspace contains the forward propagation, the layers deltas and the error gradient of the batch.
+/// @param inputs Inputs of the batch.
+/// @param targets Targets of the batch.
+/// @param back_propagation Workspace where the results are written.
+
+void LossIndex::calculate_back_propagation(const Matrix<double>& inputs, const Matrix<double>& targets, BackPropagation& back_propagation) const
+{
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+
+    if(layers_number == 0) return;
+
+    multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs, back_propagation.forward_propagation);
+
+    calculate_output_gradient(back_propagation.forward_propagation.layers_activations[layers_number-1], targets, back_propagation.output_gradient);
+
+    calculate_layers_delta(back_propagation.forward_propagation.layers_activation_derivatives, back_propagation.output_gradient, back_propagation.layers_delta);
+
+    calculate_error_gradient(inputs, back_propagation.forward_propagation.layers_activations, back_propagation.layers_delta, back_propagation.gradient);
+}
+
+
+/// Makes sure that there is one error gradient accumulator for each thread, and sets all of them to zero.
+/// The accumulators are only reallocated when the number of parameters changes.
+/// This method must be called outside parallel regions.
+/// @param parameters_number Number of parameters of the neural network.
+
+void LossIndex::set_gradient_accumulators(const size_t& parameters_number) const
+{
+#ifdef _OPENMP
+    const size_t threads_number = static_cast<size_t>(omp_get_max_threads());
+#else
+    const size_t threads_number = 1;
+#endif
+
+    if(gradient_accumulators.size() != threads_number)
+    {
+        gradient_accumulators.set(threads_number);
+    }
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        if(gradient_accumulators[i].size() != parameters_number)
+        {
+            gradient_accumulators[i].set(parameters_number, 0.0);
+        }
+        else
+        {
+            gradient_accumulators[i].initialize(0.0);
+        }
+    }
+}
+
+
+/// Returns the error gradient accumulator of the calling thread.
+
+Vector<double>& LossIndex::get_gradient_accumulator() const
+{
+#ifdef _OPENMP
+    return gradient_accumulators[static_cast<size_t>(omp_get_thread_num())];
+#else
+    return gradient_accumulators[0];
+#endif
+}
+
+
+/// Sums the error gradient accumulators of all the threads with a parallel tree reduction.
+/// With MPI, the gradients of all the processes are then summed.
+/// @param gradient Vector where the total gradient is written.
+
+void LossIndex::reduce_gradient_accumulators(Vector<double>& gradient) const
+{
+    const size_t threads_number = gradient_accumulators.size();
+
+    Vector<double*> accumulators(threads_number);
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        accumulators[i] = gradient_accumulators[i].data();
+    }
+
+    calculate_tree_reduction(accumulators, gradient_accumulators[0].size());
+
+    gradient = gradient_accumulators[0];
+
+    sum_MPI(gradient);
+}
+
+
+/// Makes sure that there is one loss, gradient and Hessian approximation accumulator for each thread,
+/// and sets all of them to zero.
+/// The accumulators are only reallocated when the number of parameters changes.
+/// This method must be called outside parallel regions.
+/// @param parameters_number Number of parameters of the neural network.
+
+void LossIndex::set_second_order_accumulators(const size_t& parameters_number) const
+{
+#ifdef _OPENMP
+    const size_t threads_number = static_cast<size_t>(omp_get_max_threads());
+#else
+    const size_t threads_number = 1;
+#endif
+
+    if(second_order_accumulators.size() != threads_number)
+    {
+        second_order_accumulators.set(threads_number);
+    }
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        SecondOrderErrorTerms& accumulator = second_order_accumulators[i];
+
+        accumulator.loss = 0.0;
+
+        if(accumulator.gradient.size() != parameters_number)
+        {
+            accumulator.gradient.set(parameters_number, 0.0);
+            accumulator.Hessian_approximation.set(parameters_number, parameters_number, 0.0);
+        }
+        else
+        {
+            accumulator.gradient.initialize(0.0);
+            accumulator.Hessian_approximation.initialize(0.0);
+        }
+    }
+}
+
+
+/// Returns the loss, gradient and Hessian approximation accumulator of the calling thread.
+
+LossIndex::SecondOrderErrorTerms& LossIndex::get_second_order_accumulator() const
+{
+#ifdef _OPENMP
+    return second_order_accumulators[static_cast<size_t>(omp_get_thread_num())];
+#else
+    return second_order_accumulators[0];
+#endif
+}
+
+
+/// Sums the loss, gradient and Hessian approximation accumulators of all the threads with a parallel tree reduction.
+/// The lower triangle of the Hessian approximation is then filled in from the upper one.
+/// @param terms_second_order_loss Structure where the totals are written.
+
+void LossIndex::reduce_second_order_accumulators(SecondOrderErrorTerms& terms_second_order_loss) const
+{
+    const size_t threads_number = second_order_accumulators.size();
+
+    Vector<double*> gradients(threads_number);
+    Vector<double*> Hessian_approximations(threads_number);
+
+    terms_second_order_loss.loss = 0.0;
+
+    for(size_t i = 0; i < threads_number; i++)
+    {
+        terms_second_order_loss.loss += second_order_accumulators[i].loss;
+
+        gradients[i] = second_order_accumulators[i].gradient.data();
+        Hessian_approximations[i] = second_order_accumulators[i].Hessian_approximation.data();
+    }
+
+    calculate_tree_reduction(gradients, second_order_accumulators[0].gradient.size());
+    calculate_tree_reduction(Hessian_approximations, second_order_accumulators[0].Hessian_approximation.size());
+
+    // The accumulators only hold the upper triangle of the Hessian approximation
+
+    Matrix<double>& Hessian_approximation = second_order_accumulators[0].Hessian_approximation;
+
+    const size_t parameters_number = Hessian_approximation.get_rows_number();
+
+    for(size_t j = 0; j < parameters_number; j++)
+    {
+        for(size_t i = j+1; i < parameters_number; i++)
+        {
+            Hessian_approximation(i,j) = Hessian_approximation(j,i);
+        }
+    }
+
+    terms_second_order_loss.gradient = second_order_accumulators[0].gradient;
+    terms_second_order_loss.Hessian_approximation = second_order_accumulators[0].Hessian_approximation;
+
+    terms_second_order_loss.loss = sum_MPI(terms_second_order_loss.loss);
+
+    sum_MPI(terms_second_order_loss.gradient);
+    sum_MPI(terms_second_order_loss.Hessian_approximation);
+}
+
+
+/// Adds a set of arrays of the same size into the first one, by summing them pairwise in a binary tree.
+/// Each level of the tree is split among the threads by elements, so no locks are needed.
+/// The order of the additions only depends on the number of arrays,
+/// so that the result is bit-reproducible for a fixed number of threads.
+/// @param accumulators Pointers to the arrays to be added. The result is written to the first one.
+/// @param size Number of elements of each array.
+
+void LossIndex::calculate_tree_reduction(const Vector<double*>& accumulators, const size_t& size)
+{
+    const size_t accumulators_number = accumulators.size();
+
+    for(size_t stride = 1; stride < accumulators_number; stride *= 2)
+    {
+        #pragma omp parallel
+
+        for(size_t i = 0; i + stride < accumulators_number; i += 2*stride)
+        {
+            double* destination = accumulators[i];
+            const double* source = accumulators[i+stride];
+
+            #pragma omp for schedule(static)
+
+            for(int j = 0; j < static_cast<int>(size); j++)
+            {
+                destination[j] += source[j];
+            }
+        }
+    }
+}
+
+
+/// Returns the sum of a value over all the MPI processes.
+/// Without MPI, it returns the value of this process.
+/// All the processes must call this method.
+/// @param value Value of this process.
+
+double LossIndex::sum_MPI(const double& value) const
+{
+#ifdef __OPENNN_MPI__
+
+    double sum = 0.0;
+
+    MPI_Allreduce(&value, &sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    return sum;
+
+#else
+
+    return value;
+
+#endif
+}
+
+
+/// Returns the sum of a count over all the MPI processes.
+/// Without MPI, it returns the count of this process.
+/// All the processes must call this method.
+/// @param value Count of this process.
+
+size_t LossIndex::sum_MPI(const size_t& value) const
+{
+#ifdef __OPENNN_MPI__
+
+    const unsigned long long local_value = static_cast<unsigned long long>(value);
+
+    unsigned long long sum = 0;
+
+    MPI_Allreduce(&local_value, &sum, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+    return static_cast<size_t>(sum);
+
+#else
+
+    return value;
+
+#endif
+}
+
+
+/// Sums a vector element by element over all the MPI processes, and writes the result in place.
+/// Without MPI, the vector does not change.
+/// All the processes must call this method with vectors of the same size.
+/// @param vector Vector of this process, which is replaced by the sum.
+
+void LossIndex::sum_MPI(Vector<double>& vector) const
+{
+#ifdef __OPENNN_MPI__
+
+    sum_MPI(vector.data(), vector.size());
+
+#else
+
+    (void)vector;
+
+#endif
+}
+
+
+/// Sums a matrix element by element over all the MPI processes, and writes the result in place.
+/// Without MPI, the matrix does not change.
+/// All the processes must call this method with matrices of the same size.
+/// @param matrix Matrix of this process, which is replaced by the sum.
+
+void LossIndex::sum_MPI(Matrix<double>& matrix) const
+{
+#ifdef __OPENNN_MPI__
+
+    sum_MPI(matrix.data(), matrix.size());
+
+#else
+
+    (void)matrix;
+
+#endif
+}
+
+
+/// Sums a block of values element by element over all the MPI processes, and writes the result in place.
+/// The values are reduced in parts of at most INT_MAX values, which is the largest count that MPI accepts.
+/// Without MPI, the values do not change.
+/// All the processes must call this method with blocks of the same size.
+/// @param data Pointer to the first value of this process.
+/// @param values_number Number of values.
+
+void LossIndex::sum_MPI(double* data, const size_t& values_number) const
+{
+#ifdef __OPENNN_MPI__
+
+    for(size_t first = 0; first < values_number; first += static_cast<size_t>(INT_MAX))
+    {
+        const int count = static_cast<int>(min(values_number - first, static_cast<size_t>(INT_MAX)));
+
+        MPI_Allreduce(MPI_IN_PLACE, data + first, count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    }
+
+#else
+
+    (void)data;
+    (void)values_number;
+
+#endif
+}
+
+
+/// Returns the maximum of a count over all the MPI processes.
+/// Without MPI, it returns the count of this process.
+/// All the processes must call this method.
+/// @param value Count of this process.
+
+size_t LossIndex::maximum_MPI(const size_t& value) const
+{
+#ifdef __OPENNN_MPI__
+
+    const unsigned long long local_value = static_cast<unsigned long long>(value);
+
+    unsigned long long maximum = 0;
+
+    MPI_Allreduce(&local_value, &maximum, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, MPI_COMM_WORLD);
+
+    return static_cast<size_t>(maximum);
+
+#else
+
+    return value;
+
+#endif
+}
+
+
 double LossIndex::calculate_training_loss() const
 {
     if(regularization_method == None)
@@ -927,6 +1587,87 @@ double LossIndex::calculate_training_loss(const Vector<double>& direction, const
 }
 
 
+/// Returns the training loss at several points along a direction from the current parameters.
+/// All the points are evaluated together, so that error terms which override calculate_training_errors()
+/// go through the training instances only once.
+/// @param direction Direction from the current parameters.
+/// @param rates Distances along the direction at which the loss is evaluated.
+
+Vector<double> LossIndex::calculate_training_losses(const Vector<double>& direction, const Vector<double>& rates) const
+{
+    const Vector<double> parameters = neural_network_pointer->get_parameters();
+
+    const size_t rates_number = rates.size();
+
+    Vector< Vector<double> > rates_parameters(rates_number);
+
+    for(size_t i = 0; i < rates_number; i++)
+    {
+        rates_parameters[i] = parameters + direction*rates[i];
+    }
+
+    Vector<double> losses = calculate_training_errors(rates_parameters);
+
+    if(regularization_method != None)
+    {
+        for(size_t i = 0; i < rates_number; i++)
+        {
+            losses[i] += regularization_weight*calculate_regularization(rates_parameters[i]);
+        }
+    }
+
+    return losses;
+}
+
+
+/// Returns the training error for each of a set of parameters vectors.
+/// This default implementation evaluates them one after the other.
+/// @param parameters Parameters vectors of the neural network.
+
+Vector<double> LossIndex::calculate_training_errors(const Vector< Vector<double> >& parameters) const
+{
+    const size_t parameters_vectors_number = parameters.size();
+
+    Vector<double> training_errors(parameters_vectors_number);
+
+    for(size_t i = 0; i < parameters_vectors_number; i++)
+    {
+        training_errors[i] = calculate_training_error(parameters[i]);
+    }
+
+    return training_errors;
+}
+
+
+/// Returns the selection error for a given parameters vector, without modifying the neural network.
+/// Error terms override this method so that it can be evaluated on a background thread while the neural network is being trained.
+/// This default implementation throws an exception.
+
+double LossIndex::calculate_selection_error(const Vector<double>&) const
+{
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: LossIndex class.\n"
+           << "double calculate_selection_error(const Vector<double>&) const method.\n"
+           << "Selection error for a parameters vector is not implemented for the " << write_error_term_type() << " error term.\n";
+
+    throw logic_error(buffer.str());
+}
+
+
+/// Returns the training error estimated from the errors of the batches of an epoch,
+/// as returned by calculate_batch_first_order_error().
+/// Since the parameters change from one batch to the next, this is only an estimate of the training error at the end of the epoch.
+/// This default implementation returns the sum of the batch errors, which holds for error terms normalized over all the training instances.
+/// @param batches_errors Error of each batch.
+/// @param batches_instances_numbers Number of instances in each batch.
+
+double LossIndex::combine_batch_errors(const Vector<double>& batches_errors, const Vector<size_t>&) const
+{
+    return batches_errors.calculate_sum();
+}
+
+
 Vector<double> LossIndex::calculate_training_loss_gradient() const
 {
     #ifdef __OPENNN_DEBUG__
@@ -946,6 +1687,74 @@ Vector<double> LossIndex::calculate_training_loss_gradient() const
 }
 
 
+/// Returns the loss and the loss gradient on the training instances.
+/// The error and its gradient are computed in a single forward and backward propagation of each batch,
+/// and the regularization term is added to both.
+
+LossIndex::FirstOrderError LossIndex::calculate_training_first_order_loss() const
+{
+    #ifdef __OPENNN_DEBUG__
+
+    check();
+
+    #endif
+
+    FirstOrderError first_order_loss = calculate_training_first_order_error();
+
+    if(regularization_method != None)
+    {
+        first_order_loss.error += regularization_weight*calculate_regularization();
+        first_order_loss.gradient += calculate_regularization_gradient()*regularization_weight;
+    }
+
+    return first_order_loss;
+}
+
+
+/// Returns the error and the error gradient on the training instances.
+/// This default implementation evaluates them separately.
+/// Error terms which support the back-propagation workspaces override it to compute both in a single pass.
+
+LossIndex::FirstOrderError LossIndex::calculate_training_first_order_error() const
+{
+    FirstOrderError first_order_error(0);
+
+    first_order_error.error = calculate_training_error();
+    first_order_error.gradient = calculate_training_error_gradient();
+
+    return first_order_error;
+}
+
+
+/// Returns the error and the error gradient on a batch of instances.
+/// @param batch_indices Indices of the instances in the batch.
+
+LossIndex::FirstOrderError LossIndex::calculate_batch_first_order_error(const Vector<size_t>& batch_indices) const
+{
+    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
+    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+
+    return calculate_batch_first_order_error(inputs, targets);
+}
+
+
+/// Returns the error and the error gradient on a batch which has already been gathered.
+/// This default implementation evaluates them separately.
+/// Error terms which support the back-propagation workspaces override it to compute both in a single pass.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+LossIndex::FirstOrderError LossIndex::calculate_batch_first_order_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+    FirstOrderError first_order_error(0);
+
+    first_order_error.error = calculate_batch_error(inputs, targets);
+    first_order_error.gradient = calculate_batch_error_gradient(inputs, targets);
+
+    return first_order_error;
+}
+
+
 /// Returns a string with the default type of error term, "USER_PERFORMANCE_TERM".
 
 string LossIndex::write_error_term_type() const
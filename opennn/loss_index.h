@@ -19,6 +19,11 @@
 #include <sstream>
 #include <iostream>
 #include <cmath>
+#include <climits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // OpenNN includes
 
@@ -81,9 +86,13 @@ public:
 
    enum RegularizationMethod{L1, L2, None};
 
+   ///
+   /// This structure contains the error and the error gradient computed in a single forward and backward propagation.
+   ///
+
    struct FirstOrderError
    {
-       /// Default constructor.
+       /// Parameters number constructor.
 
        FirstOrderError(const size_t& parameters_number)
        {
@@ -104,6 +113,13 @@ public:
    {
        /// Default constructor.
 
+       SecondOrderErrorTerms()
+       {
+           loss = 0.0;
+       }
+
+       /// Parameters number constructor.
+
        SecondOrderErrorTerms(const size_t& parameters_number)
        {
            loss = 0.0;
@@ -121,6 +137,80 @@ public:
    };
 
 
+   ///
+   /// This structure contains the buffers used to propagate a batch of instances forward and backward through the multilayer perceptron.
+   /// Once it has been set for an architecture and a batch size, computing the error gradient of a batch does not allocate memory.
+   ///
+
+   struct BackPropagation
+   {
+       /// Default constructor.
+
+       BackPropagation()
+       {
+       }
+
+       virtual ~BackPropagation()
+       {
+       }
+
+       /// Allocates all the buffers for a given architecture and a maximum number of instances in a batch.
+       /// @param new_architecture Architecture of the multilayer perceptron.
+       /// @param instances_number Maximum number of instances in a batch.
+
+       void set(const Vector<size_t>& new_architecture, const size_t& instances_number)
+       {
+           architecture = new_architecture;
+
+           const size_t layers_number = architecture.empty() ? 0 : architecture.size()-1;
+
+           size_t parameters_number = 0;
+
+           forward_propagation.set(architecture, instances_number);
+
+           layers_delta.set(layers_number);
+
+           for(size_t i = 0; i < layers_number; i++)
+           {
+               layers_delta[i].set(instances_number, architecture[i+1]);
+
+               parameters_number += architecture[i+1]*(architecture[i]+1);
+           }
+
+           if(layers_number > 0) output_gradient.set(instances_number, architecture[layers_number]);
+
+           gradient.set(parameters_number, 0.0);
+       }
+
+       /// Architecture of the multilayer perceptron for which the buffers have been allocated.
+
+       Vector<size_t> architecture;
+
+       /// Combinations, activations and activation derivatives of all layers.
+
+       MultilayerPerceptron::FirstOrderForwardPropagation forward_propagation;
+
+       /// Derivatives of the error with respect to the outputs.
+
+       Matrix<double> output_gradient;
+
+       /// Derivatives of the error with respect to the combinations of each layer.
+
+       Vector< Matrix<double> > layers_delta;
+
+       /// Returns the outputs of the multilayer perceptron for the last batch propagated, which are the activations of the output layer.
+
+       const Matrix<double>& get_outputs() const
+       {
+           return forward_propagation.layers_activations[forward_propagation.layers_activations.size()-1];
+       }
+
+       /// Error gradient of the batch.
+
+       Vector<double> gradient;
+   };
+
+
    // METHODS
 
    // Get methods
@@ -170,6 +260,7 @@ public:
    }
 
    const double& get_regularization_weight() const;
+   const size_t& get_batch_size() const;
    const bool& get_display() const;
 
    bool has_neural_network() const;
@@ -201,29 +292,43 @@ public:
    double calculate_training_loss(const Vector<double>&) const;
    double calculate_training_loss(const Vector<double>&, const double&) const;
 
+   Vector<double> calculate_training_losses(const Vector<double>&, const Vector<double>&) const;
+
    // Loss gradient methods
 
    Vector<double> calculate_training_loss_gradient() const;
 
+   // First order loss methods
+
+   FirstOrderError calculate_training_first_order_loss() const;
+
    // ERROR METHODS
 
    virtual double calculate_training_error() const = 0;
    virtual double calculate_selection_error() const = 0;
    virtual double calculate_training_error(const Vector<double>&) const = 0;
+   virtual Vector<double> calculate_training_errors(const Vector< Vector<double> >&) const;
+   virtual double calculate_selection_error(const Vector<double>&) const;
+   virtual double combine_batch_errors(const Vector<double>&, const Vector<size_t>&) const;
    virtual double calculate_batch_error(const Vector<size_t>&) const = 0;
+   virtual double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const {return 0.0;}
 
    virtual double calculate_batch_error_cuda(const MultilayerPerceptron::Pointers&) const {return 0.0;}
 
    virtual Vector<double> calculate_training_error_gradient() const = 0;
 
    virtual Vector<double> calculate_batch_error_gradient(const Vector<size_t>&) const {return Vector<double>();}
+   virtual Vector<double> calculate_batch_error_gradient(const Matrix<double>&, const Matrix<double>&) const {return Vector<double>();}
 
    virtual Vector<double> calculate_batch_error_gradient_cuda(const MultilayerPerceptron::Pointers&) const {return Vector<double>();}
 
    virtual Vector<double> calculate_batch_error_terms(const Vector<size_t>&) const  {return Vector<double>();}
    virtual Matrix<double> calculate_batch_error_terms_Jacobian(const Vector<size_t>&) const  {return Matrix<double>();}
 
-   virtual FirstOrderError calculate_batch_first_order_error(const Vector<size_t>&) const {return FirstOrderError(0);}
+   virtual FirstOrderError calculate_training_first_order_error() const;
+
+   virtual FirstOrderError calculate_batch_first_order_error(const Vector<size_t>&) const;
+   virtual FirstOrderError calculate_batch_first_order_error(const Matrix<double>&, const Matrix<double>&) const;
 
    virtual SecondOrderErrorTerms calculate_terms_second_order_loss() const {return SecondOrderErrorTerms(0);}
 
@@ -268,6 +373,50 @@ public:
    Matrix<double> calculate_layer_error_terms_Jacobian(const Matrix<double>&, const Matrix<double>&) const;
    Matrix<double> calculate_error_terms_Jacobian(const Matrix<double>&, const Vector< Matrix<double> >&, const Vector< Matrix<double> >&) const;
 
+   void accumulate_second_order_terms(const Matrix<double>&, const Vector< Matrix<double> >&, const Vector< Matrix<double> >&,
+                                      const Vector<double>&, SecondOrderErrorTerms&) const;
+
+   // Back-propagation workspace methods
+
+   void set_back_propagations(const size_t&) const;
+
+   BackPropagation& get_back_propagation() const;
+
+   virtual void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&, Matrix<double>&) const;
+
+   void calculate_layers_delta(const Vector< Matrix<double> >&, const Matrix<double>&, Vector< Matrix<double> >&) const;
+
+   void calculate_error_gradient(const Matrix<double>&, const Vector< Matrix<double> >&, const Vector< Matrix<double> >&, Vector<double>&) const;
+
+   void calculate_back_propagation(const Matrix<double>&, const Matrix<double>&, BackPropagation&) const;
+
+   // Parallel reduction methods
+
+   void set_gradient_accumulators(const size_t&) const;
+
+   Vector<double>& get_gradient_accumulator() const;
+
+   void reduce_gradient_accumulators(Vector<double>&) const;
+
+   void set_second_order_accumulators(const size_t&) const;
+
+   SecondOrderErrorTerms& get_second_order_accumulator() const;
+
+   void reduce_second_order_accumulators(SecondOrderErrorTerms&) const;
+
+   static void calculate_tree_reduction(const Vector<double*>&, const size_t&);
+
+   // MPI reduction methods
+
+   double sum_MPI(const double&) const;
+   size_t sum_MPI(const size_t&) const;
+
+   void sum_MPI(Vector<double>&) const;
+   void sum_MPI(Matrix<double>&) const;
+   void sum_MPI(double*, const size_t&) const;
+
+   size_t maximum_MPI(const size_t&) const;
+
 protected:
 
    // MEMBERS
@@ -286,6 +435,18 @@ protected:
 
    size_t batch_size = 1000;
 
+   /// Back-propagation workspaces, one for each thread.
+
+   mutable Vector<BackPropagation> back_propagations;
+
+   /// Error gradient accumulated by each thread.
+
+   mutable Vector< Vector<double> > gradient_accumulators;
+
+   /// Loss, gradient and Hessian approximation accumulated by each thread.
+
+   mutable Vector<SecondOrderErrorTerms> second_order_accumulators;
+
    /// Display messages to screen. 
 
    bool display;  
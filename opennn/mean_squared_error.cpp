@@ -123,20 +123,23 @@ check();
 
     // Data set
 
-    const size_t training_instances_number = data_set_pointer->get_instances_pointer()->get_training_instances_number();
+    const size_t training_instances_number = sum_MPI(data_set_pointer->get_instances_pointer()->get_training_instances_number());
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     double training_error = 0.0;
 
+    Matrix<double> inputs_buffer;
+    Matrix<double> targets_buffer;
+
 //    #pragma omp parallel for reduction(+ : training_error)
 
     for(int i = 0; i < static_cast<int>(batches_number); i++)
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+        const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
         const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
@@ -145,7 +148,7 @@ check();
         training_error += batch_error;
     }
 
-    return training_error/static_cast<double>(training_instances_number);
+    return sum_MPI(training_error)/static_cast<double>(training_instances_number);
 }
 
 
@@ -163,29 +166,112 @@ check();
 
     // Data set
 
-    const size_t selection_instances_number = data_set_pointer->get_instances_pointer()->get_selection_instances_number();
+    const size_t selection_instances_number = sum_MPI(data_set_pointer->get_instances_pointer()->get_selection_instances_number());
 
-    const Vector< Vector<size_t> > selection_batches = data_set_pointer->get_instances_pointer()->get_selection_batches(batch_size);
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
 
-    const size_t batches_number = selection_batches.size();
+    const size_t batches_number = selection_batches.get_batches_number();
 
     double selection_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : selection_error)
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+        #pragma omp for reduction(+ : selection_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = selection_batches.get_inputs(i, inputs_buffer);
+            const Matrix<double>& targets = selection_batches.get_targets(i, targets_buffer);
+
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
+
+            selection_error += batch_error;
+        }
+    }
+
+    return sum_MPI(selection_error)/static_cast<double>(selection_instances_number);
+}
+
+
+/// Returns the mean squared error on the selection instances for a given parameters vector.
+/// The neural network is not modified, so this can be evaluated while the neural network is being trained.
+/// @param parameters Parameters vector of the neural network.
+
+double MeanSquaredError::calculate_selection_error(const Vector<double>& parameters) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Multilayer perceptron
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    // Data set
+
+    const size_t selection_instances_number = sum_MPI(data_set_pointer->get_instances_pointer()->get_selection_instances_number());
+
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
+
+    const size_t batches_number = selection_batches.get_batches_number();
+
+    double selection_error = 0.0;
+
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(selection_batches[i]);
-        const Matrix<double> targets = data_set_pointer->get_targets(selection_batches[i]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+        #pragma omp for reduction(+ : selection_error)
 
-        const double batch_error = outputs.calculate_sum_squared_error(targets);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = selection_batches.get_inputs(i, inputs_buffer);
+            const Matrix<double>& targets = selection_batches.get_targets(i, targets_buffer);
+
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
 
-        selection_error += batch_error;
+            selection_error += batch_error;
+        }
     }
 
-    return selection_error/static_cast<double>(selection_instances_number);
+    return sum_MPI(selection_error)/static_cast<double>(selection_instances_number);
+}
+
+
+/// Returns the mean squared error estimated from the errors of the batches of an epoch.
+/// Each batch error is a mean over its own instances, so they are weighted with the number of instances in each batch.
+/// @param batches_errors Error of each batch.
+/// @param batches_instances_numbers Number of instances in each batch.
+
+double MeanSquaredError::combine_batch_errors(const Vector<double>& batches_errors, const Vector<size_t>& batches_instances_numbers) const
+{
+    const size_t batches_number = batches_errors.size();
+
+    double training_error = 0.0;
+    size_t training_instances_number = 0;
+
+    for(size_t i = 0; i < batches_number; i++)
+    {
+        training_error += batches_errors[i]*static_cast<double>(batches_instances_numbers[i]);
+        training_instances_number += batches_instances_numbers[i];
+    }
+
+    if(training_instances_number == 0)
+    {
+        return 0.0;
+    }
+
+    return training_error/static_cast<double>(training_instances_number);
 }
 
 
@@ -203,29 +289,93 @@ check();
 
     // Data set
 
-    const size_t training_instances_number = data_set_pointer->get_instances_pointer()->get_training_instances_number();
+    const size_t training_instances_number = sum_MPI(data_set_pointer->get_instances_pointer()->get_training_instances_number());
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     double training_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : training_error)
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for reduction(+ : training_error)
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
+
+            training_error += batch_error;
+        }
+    }
+
+    return sum_MPI(training_error)/static_cast<double>(training_instances_number);
+}
+
+
+/// Returns the mean squared error on the training instances for each of a set of parameters vectors.
+/// Each batch is read once and evaluated with all the parameters vectors,
+/// which are then summed in batch order, so the results do not depend on the number of threads.
+/// @param parameters Parameters vectors of the neural network.
+
+Vector<double> MeanSquaredError::calculate_training_errors(const Vector< Vector<double> >& parameters) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Multilayer perceptron
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t parameters_vectors_number = parameters.size();
+
+    // Data set
+
+    const size_t training_instances_number = sum_MPI(data_set_pointer->get_instances_pointer()->get_training_instances_number());
+
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    Matrix<double> batches_errors(batches_number, parameters_vectors_number);
+
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+        #pragma omp for schedule(static)
 
-        const double batch_error = outputs.calculate_sum_squared_error(targets);
+        for(int i = 0; i < static_cast<int>(batches_number*parameters_vectors_number); i++)
+        {
+            const size_t batch = static_cast<size_t>(i)/parameters_vectors_number;
+            const size_t parameters_vector = static_cast<size_t>(i)%parameters_vectors_number;
 
-        training_error += batch_error;
+            const Matrix<double>& inputs = training_batches.get_inputs(batch, inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(batch, targets_buffer);
+
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters[parameters_vector]);
+
+            batches_errors(batch, parameters_vector) = outputs.calculate_sum_squared_error(targets);
+        }
     }
 
-    return training_error/static_cast<double>(training_instances_number);
+    Vector<double> training_errors = batches_errors.calculate_columns_sum();
+
+    sum_MPI(training_errors);
+
+    return training_errors/static_cast<double>(training_instances_number);
 }
 
 
@@ -239,7 +389,29 @@ check();
 
     // Data set
 
-    const size_t instances_number = batch_indices.size();
+    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
+    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+
+    return calculate_batch_error(inputs, targets);
+}
+
+
+/// Returns the mean squared error of the multilayer perceptron on a batch which has already been gathered.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+double MeanSquaredError::calculate_batch_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
+    const size_t instances_number = inputs.get_rows_number();
 
     // Neural network
 
@@ -247,18 +419,16 @@ check();
 
     // Loss index
 
-    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
-    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
-
-    const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
-
-    const double batch_error = outputs.calculate_sum_squared_error(targets);
+    double batch_error = 0.0;
 
-//    cout<< neural_network_pointer->get_multilayer_perceptron_pointer()->get_parameters();
-//    system("pause");
+    if(instances_number > 0)
+    {
+        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
-    return (batch_error/instances_number);
+        batch_error = outputs.calculate_sum_squared_error(targets);
+    }
 
+    return sum_MPI(batch_error)/static_cast<double>(sum_MPI(instances_number));
 }
 
 Vector<double> MeanSquaredError::calculate_training_error_gradient() const
@@ -273,46 +443,46 @@ check();
 
     const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
-    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
     const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
 
     // Data set
 
-    const size_t training_instances_number = data_set_pointer->get_instances().get_training_instances_number();
+    const size_t training_instances_number = sum_MPI(data_set_pointer->get_instances().get_training_instances_number());
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     // Loss index
 
-    Vector<double> training_error_gradient(parameters_number, 0.0);
+    Vector<double> training_error_gradient;
 
-    #pragma omp parallel for
+    set_back_propagations(batch_size);
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
-    {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+    set_gradient_accumulators(parameters_number);
 
-        const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-                = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> output_gradient
-                = calculate_output_gradient(first_order_forward_propagation.layers_activations[layers_number-1], targets);
+        #pragma omp for schedule(static)
 
-        const Vector< Matrix<double> > layers_delta
-                = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const Vector<double> batch_gradient
-                = calculate_error_gradient(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+            BackPropagation& back_propagation = get_back_propagation();
 
-        #pragma omp critical
+            calculate_back_propagation(inputs, targets, back_propagation);
 
-        training_error_gradient += batch_gradient;
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
     }
 
+    reduce_gradient_accumulators(training_error_gradient);
+
     return training_error_gradient/static_cast<double>(training_instances_number);
 }
 
@@ -327,30 +497,52 @@ check();
 
     // Data set
 
-    const size_t instances_number = batch_indices.size();
+    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
+    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+
+    return calculate_batch_error_gradient(inputs, targets);
+}
+
+
+/// Returns the mean squared error gradient of the multilayer perceptron on a batch which has already been gathered.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+Vector<double> MeanSquaredError::calculate_batch_error_gradient(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
 
     // Neural network
 
-    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+    const size_t parameters_number = neural_network_pointer->get_multilayer_perceptron_pointer()->get_parameters_number();
 
-    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
+    // Data set
+
+    const size_t instances_number = inputs.get_rows_number();
 
     // Loss index
 
-    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
-    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+    Vector<double> batch_error_gradient(parameters_number, 0.0);
 
-    const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-            = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+    if(instances_number > 0)
+    {
+        set_back_propagations(instances_number);
 
-    const Matrix<double> output_gradient = calculate_output_gradient(first_order_forward_propagation.layers_activations[layers_number-1], targets);
+        BackPropagation& back_propagation = get_back_propagation();
 
-    const Vector< Matrix<double> > layers_delta = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+        calculate_back_propagation(inputs, targets, back_propagation);
 
-    const Vector<double> batch_error_gradient = calculate_error_gradient(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+        batch_error_gradient = back_propagation.gradient;
+    }
 
-    return batch_error_gradient/static_cast<double>(instances_number);
+    sum_MPI(batch_error_gradient);
 
+    return batch_error_gradient/static_cast<double>(sum_MPI(instances_number));
 }
 
 
@@ -366,6 +558,33 @@ check();
 }
 
 
+/// Calculates the output gradient of a batch and writes it into a given matrix, which is resized only if its dimensions change.
+/// @param outputs Matrix of outputs of the neural network.
+/// @param targets Matrix of targets of the data set.
+/// @param output_gradient Matrix where the output gradient is written.
+
+void MeanSquaredError::calculate_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets, Matrix<double>& output_gradient) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    if(output_gradient.get_rows_number() != outputs.get_rows_number() || output_gradient.get_columns_number() != outputs.get_columns_number())
+    {
+        output_gradient.set(outputs.get_rows_number(), outputs.get_columns_number());
+    }
+
+    const size_t size = outputs.size();
+
+    for(size_t i = 0; i < size; i++)
+    {
+        output_gradient[i] = (outputs[i]-targets[i])*2.0;
+    }
+}
+
+
 /// Returns loss vector of the error terms function for the mean squared error.
 /// It uses the error back-propagation method.
 
@@ -423,53 +642,47 @@ check();
 
     // Data set
 
-    const size_t training_instances_number = data_set_pointer->get_instances_pointer()->get_training_instances_number();
+    const size_t training_instances_number = sum_MPI(data_set_pointer->get_instances_pointer()->get_training_instances_number());
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
-    SecondOrderErrorTerms terms_second_order_loss(parameters_number);
+    SecondOrderErrorTerms terms_second_order_loss;
 
-    #pragma omp parallel for
+    set_second_order_accumulators(parameters_number);
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-                = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+        #pragma omp for schedule(static)
 
-        const Vector<double> error_terms
-                = calculate_error_terms(first_order_forward_propagation.layers_activations[layers_number-1], targets);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        /*const */Matrix<double> output_gradient = (first_order_forward_propagation.layers_activations[layers_number-1] - targets)/*/error_terms*/;
-        output_gradient.divide_by_rows(error_terms);
+            const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
+                    = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
-        const Vector< Matrix<double> > layers_delta
-                = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+            const Vector<double> error_terms
+                    = calculate_error_terms(first_order_forward_propagation.layers_activations[layers_number-1], targets);
 
-        const Matrix<double> error_terms_Jacobian
-                = calculate_error_terms_Jacobian(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+            /*const */Matrix<double> output_gradient = (first_order_forward_propagation.layers_activations[layers_number-1] - targets)/*/error_terms*/;
+            output_gradient.divide_by_rows(error_terms);
 
-        const Matrix<double> error_terms_Jacobian_transpose = error_terms_Jacobian.calculate_transpose();
+            const Vector< Matrix<double> > layers_delta
+                    = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
 
-        const double loss = error_terms.dot(error_terms);
-
-        const Vector<double> gradient = error_terms_Jacobian_transpose.dot(error_terms);
-
-        Matrix<double> Hessian_approximation;// = error_terms_Jacobian.dot(error_terms_Jacobian);
-        Hessian_approximation.dot(error_terms_Jacobian_transpose, error_terms_Jacobian);
-
-        #pragma omp critical
-//        {
-            terms_second_order_loss.loss += loss;
-            terms_second_order_loss.gradient += gradient;
-            terms_second_order_loss.Hessian_approximation += Hessian_approximation;
-//         }
+            accumulate_second_order_terms(inputs, first_order_forward_propagation.layers_activations, layers_delta,
+                                          error_terms, get_second_order_accumulator());
+        }
     }
 
+    reduce_second_order_accumulators(terms_second_order_loss);
+
 //    const Matrix<double> regularization_Hessian = loss_index_pointer->calculate_regularization_Hessian();
 
     terms_second_order_loss.loss /= static_cast<double>(training_instances_number);
@@ -480,6 +693,146 @@ check();
 }
 
 
+/// Returns the mean squared error and its gradient on the training instances.
+/// Both are computed in a single forward and backward propagation of each batch.
+
+LossIndex::FirstOrderError MeanSquaredError::calculate_training_first_order_error() const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+    // Data set
+
+    const size_t training_instances_number = sum_MPI(data_set_pointer->get_instances().get_training_instances_number());
+
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    // Loss index
+
+    FirstOrderError first_order_error(0);
+
+    double training_error = 0.0;
+
+    set_back_propagations(batch_size);
+
+    set_gradient_accumulators(parameters_number);
+
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for schedule(static) reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            BackPropagation& back_propagation = get_back_propagation();
+
+            calculate_back_propagation(inputs, targets, back_propagation);
+
+            training_error += back_propagation.get_outputs().calculate_sum_squared_error(targets);
+
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
+    }
+
+    first_order_error.error = sum_MPI(training_error)/static_cast<double>(training_instances_number);
+
+    reduce_gradient_accumulators(first_order_error.gradient);
+
+    first_order_error.gradient /= static_cast<double>(training_instances_number);
+
+    return first_order_error;
+}
+
+
+/// Returns the mean squared error and its gradient on a batch of instances.
+/// @param batch_indices Indices of the instances in the batch.
+
+LossIndex::FirstOrderError MeanSquaredError::calculate_batch_first_order_error(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
+    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
+    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+
+    return calculate_batch_first_order_error(inputs, targets);
+}
+
+
+/// Returns the mean squared error and its gradient on a batch which has already been gathered.
+/// Both are computed in a single forward and backward propagation.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+LossIndex::FirstOrderError MeanSquaredError::calculate_batch_first_order_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const size_t parameters_number = neural_network_pointer->get_multilayer_perceptron_pointer()->get_parameters_number();
+
+    // Data set
+
+    const size_t instances_number = inputs.get_rows_number();
+
+    const size_t batch_instances_number = sum_MPI(instances_number);
+
+    // Loss index
+
+    FirstOrderError first_order_error(parameters_number);
+
+    double batch_error = 0.0;
+
+    if(instances_number > 0)
+    {
+        set_back_propagations(instances_number);
+
+        BackPropagation& back_propagation = get_back_propagation();
+
+        calculate_back_propagation(inputs, targets, back_propagation);
+
+        batch_error = back_propagation.get_outputs().calculate_sum_squared_error(targets);
+
+        first_order_error.gradient = back_propagation.gradient;
+    }
+
+    first_order_error.error = sum_MPI(batch_error)/static_cast<double>(batch_instances_number);
+
+    sum_MPI(first_order_error.gradient);
+
+    first_order_error.gradient /= static_cast<double>(batch_instances_number);
+
+    return first_order_error;
+}
+
+
 /// Returns a string with the name of the mean squared error loss type, "MEAN_SQUARED_ERROR".
 
 string MeanSquaredError::write_error_term_type() const
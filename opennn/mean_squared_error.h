@@ -84,16 +84,25 @@ public:
    double calculate_selection_error() const;
 
    double calculate_training_error(const Vector<double>&) const;
+   double calculate_selection_error(const Vector<double>&) const;
+
+   double combine_batch_errors(const Vector<double>&, const Vector<size_t>&) const;
+   Vector<double> calculate_training_errors(const Vector< Vector<double> >&) const;
 
    double calculate_batch_error(const Vector<size_t> &) const;
+   double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const;
 
    // Gradient methods
 
    Vector<double> calculate_training_error_gradient() const;
 
    Vector<double> calculate_batch_error_gradient(const Vector<size_t>&) const;
+   Vector<double> calculate_batch_error_gradient(const Matrix<double>&, const Matrix<double>&) const;
+
+   FirstOrderError calculate_training_first_order_error() const;
 
-   FirstOrderError calculate_batch_first_order_error(const Vector<size_t>&) const {return FirstOrderError(0);}
+   FirstOrderError calculate_batch_first_order_error(const Vector<size_t>&) const;
+   FirstOrderError calculate_batch_first_order_error(const Matrix<double>&, const Matrix<double>&) const;
 
    // Error terms methods
 
@@ -103,6 +112,7 @@ public:
    string write_error_term_type() const;
 
    Matrix<double> calculate_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&, Matrix<double>&) const;
 
    LossIndex::SecondOrderErrorTerms calculate_terms_second_order_loss() const;
 
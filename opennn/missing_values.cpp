@@ -73,6 +73,9 @@ MissingValues::MissingValues(const MissingValues& other_missing_values)
 
     items = other_missing_values.items;
 
+    mask_words_number = other_missing_values.mask_words_number;
+    missing_mask = other_missing_values.missing_mask;
+
     display = other_missing_values.display;
 }
 
@@ -99,8 +102,13 @@ MissingValues& MissingValues::operator= (const MissingValues& other_missing_valu
         instances_number = other_missing_values.instances_number;
         variables_number = other_missing_values.variables_number;
 
+        scrubbing_method = other_missing_values.scrubbing_method;
+
         items = other_missing_values.items;
 
+        mask_words_number = other_missing_values.mask_words_number;
+        missing_mask = other_missing_values.missing_mask;
+
         display = other_missing_values.display;
     }
 
@@ -154,20 +162,7 @@ size_t MissingValues::get_variables_number() const
 
 Vector<size_t> MissingValues::get_missing_values_numbers() const
 {
-    Vector<size_t> missing_values_numbers(variables_number, 0);
-
-    const size_t missing_values_number = get_missing_values_number();
-
-    size_t variable_index;
-
-    for(size_t i = 0; i < missing_values_number; i++)
-    {
-        variable_index = items[i].variable_index;
-
-        missing_values_numbers[variable_index]++;
-    }
-
-    return(missing_values_numbers);
+    return(count_variables_missing_indices());
 }
 
 
@@ -341,9 +336,9 @@ void MissingValues::set(const tinyxml2::XMLDocument& document)
 
 void MissingValues::set_instances_number(const size_t& new_instances_number)
 {
-    set_missing_values_number(0);
-
     instances_number = new_instances_number;
+
+    set_missing_values_number(0);
 }
 
 
@@ -351,9 +346,9 @@ void MissingValues::set_instances_number(const size_t& new_instances_number)
 
 void MissingValues::set_variables_number(const size_t& new_variables_number)
 {
-    set_missing_values_number(0);
-
     variables_number = new_variables_number;
+
+    set_missing_values_number(0);
 }
 
 
@@ -387,10 +382,16 @@ void MissingValues::set_display(const bool& new_display)
 void MissingValues::set_items(const Vector<Item>& new_items)
 {
     items = new_items;
+
+    update_mask();
 }
 
 
-/// Sets the indices
+/// Sets the instance and the variable of a missing value item.
+/// Each value can be referred to by one item only, so the value which the item referred to is no longer missing.
+/// @param index Index of the item.
+/// @param instance_index Instance with a missing value.
+/// @param variable_index Variable with a missing value.
 
 void MissingValues::set_item(const size_t& index, const size_t& instance_index, const size_t& variable_index)
 {
@@ -433,10 +434,33 @@ void MissingValues::set_item(const size_t& index, const size_t& instance_index,
         throw logic_error(buffer.str());
     }
 
+    if(is_missing_value(instance_index, variable_index) && !(items[index] == Item(instance_index, variable_index)))
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: MissingValues class.\n"
+               << "void set_item(const size_t&, const size_t&, const size_t&) method.\n"
+               << "Value of instance " << instance_index << " and variable " << variable_index << " is already missing.\n";
+
+        throw logic_error(buffer.str());
+    }
+
 #endif
 
+    const Item old_item = items[index];
+
     items[index].instance_index = instance_index;
     items[index].variable_index = variable_index;
+
+    if(old_item.instance_index < instances_number && old_item.variable_index < variables_number)
+    {
+        missing_mask[old_item.variable_index*mask_words_number + old_item.instance_index/64] &= ~(1ULL << (old_item.instance_index%64));
+    }
+
+    if(instance_index < instances_number && variable_index < variables_number)
+    {
+        missing_mask[variable_index*mask_words_number + instance_index/64] |= 1ULL << (instance_index%64);
+    }
 }
 
 
@@ -472,6 +496,20 @@ void MissingValues::append(const size_t& instance_index, const size_t& variable_
 
 #endif
 
+    if(instance_index < instances_number && variable_index < variables_number)
+    {
+        unsigned long long& word = missing_mask[variable_index*mask_words_number + instance_index/64];
+
+        const unsigned long long bit = 1ULL << (instance_index%64);
+
+        if((word & bit) != 0)
+        {
+            return;
+        }
+
+        word |= bit;
+    }
+
     Item item(instance_index, variable_index);
 
     items.push_back(item);
@@ -479,11 +517,22 @@ void MissingValues::append(const size_t& instance_index, const size_t& variable_
 
 
 /// Sets a new number of missing values in the data set.
+/// The items which are added do not refer to any value until they are set with set_item(),
+/// so they are not marked as missing values.
 /// @param new_missing_values_number Number of missing values.
 
 void MissingValues::set_missing_values_number(const size_t& new_missing_values_number)
 {
+    const size_t old_missing_values_number = items.size();
+
     items.set(new_missing_values_number);
+
+    for(size_t i = old_missing_values_number; i < new_missing_values_number; i++)
+    {
+        items[i] = Item(instances_number, variables_number);
+    }
+
+    update_mask();
 }
 
 
@@ -552,16 +601,14 @@ bool MissingValues::has_missing_values() const
 
 bool MissingValues::has_missing_values(const size_t& instance_index) const
 {
-    if(items.empty())
+    if(items.empty() || instance_index >= instances_number)
     {
         return(false);
     }
 
-    const size_t missing_values_number = get_missing_values_number();
-
-    for(size_t i = 0; i < missing_values_number; i++)
+    for(size_t j = 0; j < variables_number; j++)
     {
-        if(items[i].instance_index == instance_index)
+        if(get_mask_bit(instance_index, j))
         {
             return(true);
         }
@@ -578,21 +625,18 @@ bool MissingValues::has_missing_values(const size_t& instance_index) const
 
 bool MissingValues::has_missing_values(const size_t& instance_index, const Vector<size_t>& variables_indices) const
 {
-    const size_t missing_values_number = get_missing_values_number();
+    if(items.empty() || instance_index >= instances_number)
+    {
+        return(false);
+    }
 
-    const size_t variables_number = variables_indices.size();
+    const size_t variables_indices_size = variables_indices.size();
 
-    for(size_t i = 0; i < missing_values_number; i++)
+    for(size_t j = 0; j < variables_indices_size; j++)
     {
-        if(items[i].instance_index == instance_index)
+        if(variables_indices[j] < variables_number && get_mask_bit(instance_index, variables_indices[j]))
         {
-            for(size_t j = 0; j < variables_number; j++)
-            {
-                if(items[i].variable_index == variables_indices[j])
-                {
-                    return(true);
-                }
-            }
+            return(true);
         }
     }
 
@@ -606,22 +650,12 @@ bool MissingValues::has_missing_values(const size_t& instance_index, const Vecto
 
 bool MissingValues::is_missing_value(const size_t& instance_index, const size_t& variable_index) const
 {
-    if(items.empty())
+    if(instance_index >= instances_number || variable_index >= variables_number)
     {
         return(false);
     }
 
-    const size_t missing_values_number = get_missing_values_number();
-
-    for(size_t i = 0; i < missing_values_number; i++)
-    {
-        if(items[i].instance_index == instance_index && items[i].variable_index == variable_index)
-        {
-            return(true);
-        }
-    }
-
-    return(false);
+    return(get_mask_bit(instance_index, variable_index));
 }
 
 
@@ -629,52 +663,53 @@ bool MissingValues::is_missing_value(const size_t& instance_index, const size_t&
 
 Vector<size_t> MissingValues::get_missing_instances() const
 {
-    const size_t missing_values_number = get_missing_values_number();
-
-    Vector<double> missing_instances(instances_number, 0.0);
-
-    for(size_t i = 0; i < missing_values_number; i++)
+    if(variables_number == 0)
     {
-        missing_instances[items[i].instance_index] = 1.0;
+        return(Vector<size_t>());
     }
 
-    return(missing_instances.calculate_greater_than_indices(0.5));
+    const Vector<size_t> variables_indices(0, 1, variables_number-1);
+
+    return(get_missing_instances(variables_indices));
 }
 
 
+/// Returns a vector with the indices of the instances with a missing value in a given variable.
+/// The indices are sorted in ascending order.
+/// @param variable_index Index of variable.
+
 Vector<size_t> MissingValues::get_missing_instances(const size_t& variable_index) const
 {
-    const size_t missing_values_number = get_missing_values_number();
-
-    Vector<double> missing_instances(instances_number, 0.0);
-
-    for(size_t i = 0; i < missing_values_number; i++)
-    {
-        if(items[i].variable_index == variable_index)
-        {
-            missing_instances[items[i].instance_index] = 1.0;
-        }
-    }
-
-    return(missing_instances.calculate_greater_than_indices(0.5));
+    return(get_missing_indices(variable_index));
 }
 
 
-Vector<size_t> MissingValues::get_missing_instances(const Vector<size_t>& variable_indices) const
+/// Returns a vector with the indices of the instances with a missing value in any of the given variables.
+/// The indices are sorted in ascending order.
+/// @param variables_indices Indices of variables.
+
+Vector<size_t> MissingValues::get_missing_instances(const Vector<size_t>& variables_indices) const
 {
-    const size_t missing_values_number = get_missing_values_number();
+    const size_t variables_indices_size = variables_indices.size();
 
-    Vector<double> missing_instances(instances_number, 0.0);
+    Vector<unsigned long long> union_mask(mask_words_number, 0);
 
-    for(size_t i = 0; i < missing_values_number; i++)
+    for(size_t j = 0; j < variables_indices_size; j++)
     {
-        if(variable_indices.contains(items[i].variable_index))
+        if(variables_indices[j] >= variables_number)
         {
-            missing_instances[items[i].instance_index] = 1.0;
+            continue;
+        }
+
+        const unsigned long long* variable_mask = missing_mask.data() + variables_indices[j]*mask_words_number;
+
+        for(size_t k = 0; k < mask_words_number; k++)
+        {
+            union_mask[k] |= variable_mask[k];
         }
     }
 
-    return(missing_instances.calculate_greater_than_indices(0.5));
+    return(get_mask_indices(union_mask.data(), mask_words_number));
 }
 
 
@@ -686,39 +721,32 @@ size_t MissingValues::count_missing_instances() const
 }
 
 
+/// Returns the number of instances with a missing value in a given variable.
+/// @param variable_index Index of variable.
+
 size_t MissingValues::count_missing_instances(const size_t& variable_index) const
 {
-    const size_t missing_values_number = get_missing_values_number();
-
-    size_t count = 0;
-
-    for(size_t i = 0; i < missing_values_number; i++)
+    if(variable_index >= variables_number)
     {
-        if(items[i].variable_index == variable_index)
-        {
-            count++;
-        }
+        return(0);
     }
 
-    return(count);
+    return(count_mask_bits(missing_mask.data() + variable_index*mask_words_number, mask_words_number));
 }
 
 
+/// Returns the number of missing values in two given variables.
+/// @param variable_1 Index of the first variable.
+/// @param variable_2 Index of the second variable.
+
 size_t MissingValues::count_missing_instances(const size_t& variable_1, const size_t& variable_2) const
 {
-    const size_t missing_values_number = get_missing_values_number();
-
-    size_t count = 0;
-
-    for(size_t i = 0; i < missing_values_number; i++)
+    if(variable_1 == variable_2)
     {
-        if(items[i].variable_index == variable_1 || items[i].variable_index == variable_2)
-        {
-            count++;
-        }
+        return(count_missing_instances(variable_1));
     }
 
-    return(count);
+    return(count_missing_instances(variable_1) + count_missing_instances(variable_2));
 }
 
 
@@ -726,16 +754,7 @@ size_t MissingValues::count_missing_instances(const size_t& variable_1, const si
 
 Vector<size_t> MissingValues::get_missing_variables() const
 {
-    const size_t missing_values_number = get_missing_values_number();
-
-    Vector<double> missing_variables(variables_number, 0.0);
-
-    for(size_t i = 0; i < missing_values_number; i++)
-    {
-        missing_variables[items[i].variable_index] = 1.0;
-    }
-
-    return(missing_variables.calculate_greater_than_indices(0.5));
+    return(count_variables_missing_indices().calculate_greater_than_indices(0));
 }
 
 
@@ -824,17 +843,9 @@ Vector< Vector<size_t> > MissingValues::get_missing_indices() const
 {
     Vector< Vector<size_t> > missing_indices(variables_number);
 
-    const size_t missing_values_number = get_missing_values_number();
-
-    size_t variable_index;
-    size_t instance_index;
-
-    for(size_t i = 0; i < missing_values_number; i++)
+    for(size_t j = 0; j < variables_number; j++)
     {
-        variable_index = items[i].variable_index;
-        instance_index = items[i].instance_index;
-
-        missing_indices[variable_index].push_back(instance_index);
+        missing_indices[j] = get_missing_indices(j);
     }
 
     return(missing_indices);
@@ -862,45 +873,185 @@ Vector< Vector<size_t> > MissingValues::get_missing_indices(const Vector<size_t>
 
 Vector<size_t> MissingValues::get_missing_indices(const size_t& variable_index) const
 {
-    Vector<size_t> missing_indices(instances_number, 0);
+    if(variable_index >= variables_number)
+    {
+        return(Vector<size_t>());
+    }
 
-    const size_t missing_values_number = get_missing_values_number();
+    return(get_mask_indices(missing_mask.data() + variable_index*mask_words_number, mask_words_number));
+}
 
-    size_t current_variable_index;
-    size_t instance_index;
 
-    for(size_t i = 0; i < missing_values_number; i++)
+/// Returns the number of missing values of each variable, counted from the bits of the missing values mask.
+
+Vector<size_t> MissingValues::count_variables_missing_indices() const
+{
+    Vector<size_t> missing_indices_per_variable(variables_number);
+
+    for(size_t j = 0; j < variables_number; j++)
     {
-        current_variable_index = items[i].variable_index;
+        missing_indices_per_variable[j] = count_mask_bits(missing_mask.data() + j*mask_words_number, mask_words_number);
+    }
+
+    return(missing_indices_per_variable);
+}
 
-        if(current_variable_index == variable_index)
+
+/// Returns the number of 64-bit words in the missing values mask of each variable.
+
+size_t MissingValues::get_mask_words_number() const
+{
+    return(mask_words_number);
+}
+
+
+/// Returns the missing values mask of a variable.
+/// Bit i%64 of word i/64 is set when the value of instance i is missing.
+/// @param variable_index Index of variable.
+
+Vector<unsigned long long> MissingValues::get_missing_mask(const size_t& variable_index) const
+{
+    // Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+    if(variable_index >= variables_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: MissingValues class.\n"
+               << "Vector<unsigned long long> get_missing_mask(const size_t&) const method.\n"
+               << "Index of variable(" << variable_index << ") must be less than number of variables(" << variables_number << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const unsigned long long* variable_mask = missing_mask.data() + variable_index*mask_words_number;
+
+    return(Vector<unsigned long long>(variable_mask, variable_mask + mask_words_number));
+}
+
+
+/// Returns the missing values mask of a variable on a subset of instances.
+/// Bit i%64 of word i/64 is set when the value of the instance instances_indices[i] is missing,
+/// so that the mask is aligned with the column gathered at those instances.
+/// @param variable_index Index of variable.
+/// @param instances_indices Indices of the instances.
+
+Vector<unsigned long long> MissingValues::get_missing_mask(const size_t& variable_index, const Vector<size_t>& instances_indices) const
+{
+    // Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+    if(variable_index >= variables_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: MissingValues class.\n"
+               << "Vector<unsigned long long> get_missing_mask(const size_t&, const Vector<size_t>&) const method.\n"
+               << "Index of variable(" << variable_index << ") must be less than number of variables(" << variables_number << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const size_t instances_indices_size = instances_indices.size();
+
+    Vector<unsigned long long> instances_mask((instances_indices_size + 63)/64, 0);
+
+    if(count_missing_instances(variable_index) == 0)
+    {
+        return(instances_mask);
+    }
+
+    for(size_t i = 0; i < instances_indices_size; i++)
+    {
+        if(instances_indices[i] < instances_number && get_mask_bit(instances_indices[i], variable_index))
         {
-            instance_index = items[i].instance_index;
+            instances_mask[i/64] |= 1ULL << (i%64);
+        }
+    }
+
+    return(instances_mask);
+}
+
+
+/// Returns the number of set bits in an array of 64-bit words.
+/// @param words Pointer to the first word.
+/// @param words_number Number of words.
+
+size_t MissingValues::count_mask_bits(const unsigned long long* words, const size_t& words_number)
+{
+    size_t count = 0;
 
-            missing_indices[instance_index] = 1;
+    for(size_t k = 0; k < words_number; k++)
+    {
+        if(words[k] != 0)
+        {
+            count += bitset<64>(words[k]).count();
         }
     }
 
-    return(missing_indices.calculate_equal_to_indices(1));
+    return(count);
 }
 
 
-Vector<size_t> MissingValues::count_variables_missing_indices() const
+/// Sizes the missing values mask for the current numbers of instances and variables, with all the bits cleared.
+
+void MissingValues::set_mask()
 {
-    Vector<size_t> missing_indices_per_variable(variables_number, 0);
+    mask_words_number = (instances_number + 63)/64;
+
+    missing_mask.set(mask_words_number*variables_number, 0);
+}
 
-    const size_t missing_values_number = get_missing_values_number();
 
-    size_t variable_index;
+/// Rebuilds the missing values mask from the items.
+/// Items out of the range of instances and variables are not represented in the mask.
+
+void MissingValues::update_mask()
+{
+    set_mask();
+
+    const size_t missing_values_number = get_missing_values_number();
 
     for(size_t i = 0; i < missing_values_number; i++)
     {
-        variable_index = items[i].variable_index;
+        const size_t instance_index = items[i].instance_index;
+        const size_t variable_index = items[i].variable_index;
 
-        missing_indices_per_variable[variable_index]++;
+        if(instance_index < instances_number && variable_index < variables_number)
+        {
+            missing_mask[variable_index*mask_words_number + instance_index/64] |= 1ULL << (instance_index%64);
+        }
     }
+}
 
-    return(missing_indices_per_variable);
+
+/// Returns the positions of the set bits in an array of 64-bit words, in ascending order.
+/// @param words Pointer to the first word.
+/// @param words_number Number of words.
+
+Vector<size_t> MissingValues::get_mask_indices(const unsigned long long* words, const size_t& words_number)
+{
+    Vector<size_t> indices;
+    indices.reserve(count_mask_bits(words, words_number));
+
+    for(size_t k = 0; k < words_number; k++)
+    {
+        for(unsigned long long word = words[k]; word != 0; word &= word - 1)
+        {
+            const unsigned long long lowest_bit = word & (~word + 1);
+
+            indices.push_back(k*64 + bitset<64>(lowest_bit - 1).count());
+        }
+    }
+
+    return(indices);
 }
 
 
@@ -1325,6 +1476,8 @@ void MissingValues::from_XML(const tinyxml2::XMLDocument& document)
         items[i].variable_index = variables_indices.at(i) - 1;
     }
 
+    update_mask();
+
 /*
     unsigned index = 0;
 
@@ -25,6 +25,7 @@
 #include <stdexcept>
 #include <ctime>
 #include <exception>
+#include <bitset>
 
 // OpenNN includes
 
@@ -97,6 +98,8 @@ public:
 
        Item()
        {
+           instance_index = 0;
+           variable_index = 0;
        }
 
        /// Indices constructor.
@@ -211,6 +214,13 @@ public:
 
    Vector<size_t> count_variables_missing_indices() const;
 
+   size_t get_mask_words_number() const;
+
+   Vector<unsigned long long> get_missing_mask(const size_t&) const;
+   Vector<unsigned long long> get_missing_mask(const size_t&, const Vector<size_t>&) const;
+
+   static size_t count_mask_bits(const unsigned long long*, const size_t&);
+
    void convert_time_series(const size_t&);
    void convert_time_series(const Matrix<double>&);
    void convert_association();
@@ -229,6 +239,21 @@ public:
 
 private:
 
+   void set_mask();
+
+   void update_mask();
+
+   static Vector<size_t> get_mask_indices(const unsigned long long*, const size_t&);
+
+   /// Returns true if the bit of the given instance and variable is set in the missing values mask.
+   /// @param instance_index Index of instance.
+   /// @param variable_index Index of variable.
+
+   inline bool get_mask_bit(const size_t& instance_index, const size_t& variable_index) const
+   {
+       return(((missing_mask[variable_index*mask_words_number + instance_index/64] >> (instance_index%64)) & 1ULL) != 0);
+   }
+
    // MEMBERS
 
    /// Number of instances.
@@ -247,6 +272,16 @@ private:
 
    Vector<Item> items;
 
+   /// Number of 64-bit words of the missing values mask for each variable.
+
+   size_t mask_words_number;
+
+   /// Column-wise bitmask of the missing values.
+   /// Bit i%64 of word i/64 in the block of a variable is set when the value of instance i is missing.
+   /// It is kept in sync with the items, which remain the serialized form.
+
+   Vector<unsigned long long> missing_mask;
+
    /// Display messages to screen.
    
    bool display;
@@ -204,10 +204,6 @@ public:
 
 #ifdef __OPENNN_MPI__
     void set_MPI(TrainingStrategy*, const ModelSelection*);
-
-    void set_inputs_selection_MPI(const ModelSelection*);
-    void set_order_selection_MPI(const ModelSelection*);
-    void set_threshold_selection_MPI(const ModelSelection*);
 #endif
 
     void set_order_selection_method(const OrderSelectionMethod&);
@@ -2201,6 +2201,34 @@ MultilayerPerceptron::FirstOrderForwardPropagation MultilayerPerceptron::calcula
 }
 
 
+/// Calculates the combinations, activations and activation derivatives of all layers for a batch of inputs.
+/// The results are written into a forward propagation structure, whose matrices are reused when their dimensions match,
+/// so that no memory is allocated once the structure has been set for the batch size.
+/// @param inputs Inputs to the multilayer perceptron.
+/// @param first_order_forward_propagation Structure where the results are written.
+
+void MultilayerPerceptron::calculate_first_order_forward_propagation(const Matrix<double>& inputs,
+                                                                     FirstOrderForwardPropagation& first_order_forward_propagation) const
+{
+    const size_t layers_number = get_layers_number();
+
+    if(first_order_forward_propagation.layers_activations.size() != layers_number)
+    {
+        first_order_forward_propagation.set(get_architecture(), inputs.get_rows_number());
+    }
+
+    Vector< Matrix<double> >& layers_combinations = first_order_forward_propagation.layers_combinations;
+    Vector< Matrix<double> >& layers_activations = first_order_forward_propagation.layers_activations;
+    Vector< Matrix<double> >& layers_activation_derivatives = first_order_forward_propagation.layers_activation_derivatives;
+
+    for(size_t i = 0; i < layers_number; i++)
+    {
+        layers[i].calculate_first_order_outputs(i == 0 ? inputs : layers_activations[i-1],
+                                                layers_combinations[i], layers_activations[i], layers_activation_derivatives[i]);
+    }
+}
+
+
 /// Returns a string representation of the current multilayer perceptron object. 
 
 string MultilayerPerceptron::object_to_string() const
@@ -169,12 +169,39 @@ public:
    {
        /// Default constructor.
 
+       FirstOrderForwardPropagation()
+       {
+       }
+
+       /// Layers number constructor.
+
        FirstOrderForwardPropagation(const size_t layers_number)
        {
            layers_activations.set(layers_number);
            layers_activation_derivatives.set(layers_number);
        }
 
+       /// Allocates the combinations, activations and activation derivatives of all layers
+       /// for a batch with a given number of instances.
+       /// @param architecture Architecture of the multilayer perceptron.
+       /// @param instances_number Maximum number of instances in a batch.
+
+       void set(const Vector<size_t>& architecture, const size_t& instances_number)
+       {
+           const size_t layers_number = architecture.empty() ? 0 : architecture.size()-1;
+
+           layers_combinations.set(layers_number);
+           layers_activations.set(layers_number);
+           layers_activation_derivatives.set(layers_number);
+
+           for(size_t i = 0; i < layers_number; i++)
+           {
+               layers_combinations[i].set(instances_number, architecture[i+1]);
+               layers_activations[i].set(instances_number, architecture[i+1]);
+               layers_activation_derivatives[i].set(instances_number, architecture[i+1]);
+           }
+       }
+
        virtual ~FirstOrderForwardPropagation()
        {
        }
@@ -187,6 +214,7 @@ public:
            cout << layers_activation_derivatives << endl;
        }
 
+       Vector< Matrix<double> > layers_combinations;
        Vector< Matrix<double> > layers_activations;
        Vector< Matrix<double> > layers_activation_derivatives;
    };
@@ -498,6 +526,8 @@ public:
 
    FirstOrderForwardPropagation calculate_first_order_forward_propagation(const Matrix<double>&) const;
 
+   void calculate_first_order_forward_propagation(const Matrix<double>&, FirstOrderForwardPropagation&) const;
+
    // Output 
 
    Matrix<double> calculate_outputs(const Matrix<double>&) const;
@@ -839,133 +839,67 @@ void NeuralNetwork::set_default()
     display = true;
 }
 
-#ifdef __OPENNN_MPI__
+/// Sends the neural network of the first MPI process to all the processes.
+/// The architecture is broadcast as XML, and the parameters are broadcast in binary so that they are identical in all the processes.
+/// Without MPI, it copies the neural network.
+/// @param neural_network Original neural network, initialized by processor 0.
 
 void NeuralNetwork::set_MPI(const NeuralNetwork* neural_network)
 {
-
-    int size;
-    MPI_Comm_size(MPI_COMM_WORLD, &size);
+#ifdef __OPENNN_MPI__
 
     int rank;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-    int layers_number;
-    Vector<int> architecture;
+    Vector<char> neural_network_XML;
 
-    int parameters_number;
     Vector<double> parameters;
 
-    int inputs_number;
-    int outputs_number;
-
-    int* activation_functions;
-
     if(rank == 0)
     {
-        // Variables to send initialization
+        const tinyxml2::XMLDocument* document = neural_network->to_XML();
 
-        const MultilayerPerceptron* original_multilayer_perceptron_pointer = neural_network->get_multilayer_perceptron_pointer();
+        tinyxml2::XMLPrinter printer;
 
-        layers_number = (int)original_multilayer_perceptron_pointer->get_layers_number();
-        architecture = original_multilayer_perceptron_pointer->get_architecture_int();
+        document->Print(&printer);
 
-        parameters = original_multilayer_perceptron_pointer->get_parameters();
-        parameters_number = (int)parameters.size();
+        delete document;
 
-        const Vector<Perceptron::ActivationFunction> layers_activation_functions = original_multilayer_perceptron_pointer->get_layers_activation_function();
+        const string buffer(printer.CStr());
 
-        activation_functions = (int *)malloc(layers_number*sizeof(int));
+        neural_network_XML = Vector<char>(buffer.begin(), buffer.end());
 
-        for(int i = 0; i < layers_number; i++)
-        {
-            activation_functions[i] = (int)layers_activation_functions[i];
-        }
-
-        inputs_number = (int)original_multilayer_perceptron_pointer->get_inputs_number();
-        outputs_number = (int)original_multilayer_perceptron_pointer->get_outputs_number();
+        parameters = neural_network->get_parameters();
     }
 
-    // Send variables
+    neural_network_XML.set_MPI(MPI_CHAR);
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    parameters.set_MPI(MPI_DOUBLE);
 
-    if(rank > 0)
+    if(rank == 0 && neural_network == this)
     {
-        MPI_Request req[2];
-
-        MPI_Irecv(&layers_number, 1, MPI_INT, rank-1, 3, MPI_COMM_WORLD, &req[0]);
-        MPI_Irecv(&parameters_number, 1, MPI_INT, rank-1, 4, MPI_COMM_WORLD, &req[1]);
-
-        MPI_Waitall(2, req, MPI_STATUS_IGNORE);
-
-        architecture.set(layers_number+1);
-        parameters.set(parameters_number);
-
-        MPI_Irecv(architecture.data(),(int)layers_number+1, MPI_INT, rank-1, 9, MPI_COMM_WORLD, &req[0]);
-        MPI_Irecv(parameters.data(),(int)parameters_number, MPI_DOUBLE, rank-1, 10, MPI_COMM_WORLD, &req[1]);
-
-        MPI_Waitall(2, req, MPI_STATUS_IGNORE);
-
-        MPI_Request* req_activations = (MPI_Request*)malloc(layers_number*sizeof(MPI_Request));
-
-        activation_functions = (int *)malloc(layers_number*sizeof(int));
-
-        for(int i = 0; i < layers_number; i++)
-        {
-            MPI_Irecv(&activation_functions[i], 1, MPI_INT, rank-1, 11+i, MPI_COMM_WORLD, &req_activations[i]);
-        }
-
-        MPI_Waitall((int)layers_number, req_activations, MPI_STATUS_IGNORE);
-
-        free(req_activations);
+        return;
     }
 
-    if(rank < size-1)
-    {
-        MPI_Request req[4];
-
-        MPI_Isend(&layers_number, 1, MPI_INT, rank+1, 3, MPI_COMM_WORLD, &req[0]);
-        MPI_Isend(&parameters_number, 1, MPI_INT, rank+1, 4, MPI_COMM_WORLD, &req[1]);
-
-        MPI_Isend(architecture.data(),(int)layers_number+1, MPI_INT, rank+1, 9, MPI_COMM_WORLD, &req[2]);
-        MPI_Isend(parameters.data(),(int)parameters_number, MPI_DOUBLE, rank+1, 10, MPI_COMM_WORLD, &req[3]);
-
-        MPI_Waitall(4, req, MPI_STATUS_IGNORE);
+    const string buffer(neural_network_XML.begin(), neural_network_XML.end());
 
-        MPI_Request* req_activations = (MPI_Request*)malloc(layers_number*sizeof(MPI_Request));
-
-        for(int i = 0; i < layers_number; i++)
-        {
-            MPI_Isend(&activation_functions[i], 1, MPI_INT, rank+1, 11+i, MPI_COMM_WORLD, &req_activations[i]);
-        }
-
-        MPI_Waitall((int)layers_number, req_activations, MPI_STATUS_IGNORE);
+    tinyxml2::XMLDocument document;
 
-        free(req_activations);
-    }
+    document.Parse(buffer.c_str());
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    from_XML(document);
 
-    if(!has_multilayer_perceptron())
-    {
-        multilayer_perceptron_pointer = new MultilayerPerceptron(architecture);
-    }
-    else
-    {
-        multilayer_perceptron_pointer->set(architecture);
-    }
+    set_parameters(parameters);
 
-    multilayer_perceptron_pointer->set_parameters(parameters);
+#else
 
-    for(int i = 0; i < layers_number; i++)
+    if(neural_network != this)
     {
-        multilayer_perceptron_pointer->set_layer_activation_function(i,(Perceptron::ActivationFunction)activation_functions[i]);
+        set(*neural_network);
     }
 
-    free(activation_functions);
-}
 #endif
+}
 
 
 /// Sets a new multilayer perceptron within the neural network.
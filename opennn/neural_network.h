@@ -155,9 +155,7 @@ public:
 
    virtual void set_default();
 
-#ifdef __OPENNN_MPI__
    void set_MPI(const NeuralNetwork*);
-#endif
 
    void set_multilayer_perceptron_pointer(MultilayerPerceptron*);
    void set_inputs_trending_layer_pointer(InputsTrendingLayer*);
@@ -133,7 +133,24 @@ void NormalizedSquaredError::set_normalization_coefficient()
 
     const Vector<size_t> targets_indices = variables.get_targets_indices();
 
-    const Vector<double> training_targets_mean = data_set_pointer->calculate_training_targets_mean();
+    Vector<double> training_targets_mean = data_set_pointer->calculate_training_targets_mean();
+
+#ifdef __OPENNN_MPI__
+
+    // Mean of the training targets of all the processes
+
+    Vector<double> training_targets_sum(targets_indices.size(), 0.0);
+
+    if(training_instances_number > 0)
+    {
+        training_targets_sum = training_targets_mean*static_cast<double>(training_instances_number);
+    }
+
+    sum_MPI(training_targets_sum);
+
+    training_targets_mean = training_targets_sum/static_cast<double>(sum_MPI(training_instances_number));
+
+#endif
 
     // Normalized squared error stuff
 
@@ -154,7 +171,7 @@ void NormalizedSquaredError::set_normalization_coefficient()
        new_normalization_coefficient += targets.calculate_sum_squared_error(training_targets_mean);
     }
 
-    normalization_coefficient = new_normalization_coefficient;
+    normalization_coefficient = sum_MPI(new_normalization_coefficient);
 }
 
 
@@ -180,7 +197,24 @@ void NormalizedSquaredError::set_selection_normalization_coefficient()
 
     const Vector<size_t> targets_indices = data_set_pointer->get_variables_pointer()->get_targets_indices();
 
-    const Vector<double> selection_targets_mean = data_set_pointer->calculate_selection_targets_mean();
+    Vector<double> selection_targets_mean = data_set_pointer->calculate_selection_targets_mean();
+
+#ifdef __OPENNN_MPI__
+
+    // Mean of the selection targets of all the processes
+
+    Vector<double> selection_targets_sum(targets_indices.size(), 0.0);
+
+    if(selection_instances_number > 0)
+    {
+        selection_targets_sum = selection_targets_mean*static_cast<double>(selection_instances_number);
+    }
+
+    sum_MPI(selection_targets_sum);
+
+    selection_targets_mean = selection_targets_sum/static_cast<double>(sum_MPI(selection_instances_number));
+
+#endif
 
     // Normalized squared error stuff
 
@@ -201,7 +235,7 @@ void NormalizedSquaredError::set_selection_normalization_coefficient()
        new_selection_normalization_coefficient += targets.calculate_sum_squared_error(selection_targets_mean);
     }
 
-    selection_normalization_coefficient = new_selection_normalization_coefficient;
+    selection_normalization_coefficient = sum_MPI(new_selection_normalization_coefficient);
 }
 
 
@@ -256,27 +290,33 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     double training_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : training_error)
-
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+        #pragma omp for reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const double batch_error = outputs.calculate_sum_squared_error(targets);
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
-        training_error += batch_error;
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
+
+            training_error += batch_error;
+        }
     }
 
-    return training_error/normalization_coefficient;
+    return sum_MPI(training_error)/normalization_coefficient;
 }
 
 
@@ -294,27 +334,81 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > selection_batches = data_set_pointer->get_instances_pointer()->get_selection_batches(batch_size);
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
 
-    const size_t batches_number = selection_batches.size();
+    const size_t batches_number = selection_batches.get_batches_number();
 
     double selection_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : selection_error)
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for reduction(+ : selection_error)
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = selection_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = selection_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
+
+            selection_error += batch_error;
+        }
+    }
+
+    return sum_MPI(selection_error)/normalization_coefficient;
+}
+
+
+/// Returns the normalized squared error on the selection instances for a given parameters vector.
+/// The neural network is not modified, so this can be evaluated while the neural network is being trained.
+/// @param parameters Parameters vector of the neural network.
+
+double NormalizedSquaredError::calculate_selection_error(const Vector<double>& parameters) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Multilayer perceptron
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    // Data set
+
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
+
+    const size_t batches_number = selection_batches.get_batches_number();
+
+    double selection_error = 0.0;
+
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(selection_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(selection_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+        #pragma omp for reduction(+ : selection_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = selection_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = selection_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const double batch_error = outputs.calculate_sum_squared_error(targets);
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-        selection_error += batch_error;
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
+
+            selection_error += batch_error;
+        }
     }
 
-    return selection_error/normalization_coefficient;
+    return sum_MPI(selection_error)/normalization_coefficient;
 }
 
 
@@ -332,31 +426,42 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     double training_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : training_error)
-
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-        const double batch_error = outputs.calculate_sum_squared_error(targets);
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
 
-        training_error += batch_error;
+            training_error += batch_error;
+        }
     }
 
-    return training_error/normalization_coefficient;
+    return sum_MPI(training_error)/normalization_coefficient;
 }
 
 
-double NormalizedSquaredError::calculate_batch_error(const Vector<size_t>& batch_indices) const
+/// Returns the normalized squared error on the training instances for each of a set of parameters vectors.
+/// Each batch is read once and evaluated with all the parameters vectors,
+/// which are then summed in batch order, so the results do not depend on the number of threads.
+/// @param parameters Parameters vectors of the neural network.
+
+Vector<double> NormalizedSquaredError::calculate_training_errors(const Vector< Vector<double> >& parameters) const
 {
 #ifdef __OPENNN_DEBUG__
 
@@ -368,16 +473,89 @@ check();
 
     const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
+    const size_t parameters_vectors_number = parameters.size();
+
+    // Data set
+
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    Matrix<double> batches_errors(batches_number, parameters_vectors_number);
+
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for schedule(static)
+
+        for(int i = 0; i < static_cast<int>(batches_number*parameters_vectors_number); i++)
+        {
+            const size_t batch = static_cast<size_t>(i)/parameters_vectors_number;
+            const size_t parameters_vector = static_cast<size_t>(i)%parameters_vectors_number;
+
+            const Matrix<double>& inputs = training_batches.get_inputs(batch, inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(batch, targets_buffer);
+
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters[parameters_vector]);
+
+            batches_errors(batch, parameters_vector) = outputs.calculate_sum_squared_error(targets);
+        }
+    }
+
+    Vector<double> training_errors = batches_errors.calculate_columns_sum();
+
+    sum_MPI(training_errors);
+
+    return training_errors/normalization_coefficient;
+}
+
+
+double NormalizedSquaredError::calculate_batch_error(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
     // Data set
 
     const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
     const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
 
-    const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+    return calculate_batch_error(inputs, targets);
+}
+
 
-    const double batch_error = outputs.calculate_sum_squared_error(targets);
+/// Returns the normalized squared error of the multilayer perceptron on a batch which has already been gathered.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+double NormalizedSquaredError::calculate_batch_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
 
-    return batch_error / normalization_coefficient;
+    // Multilayer perceptron
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    double batch_error = 0.0;
+
+    if(inputs.get_rows_number() > 0)
+    {
+        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+
+        batch_error = outputs.calculate_sum_squared_error(targets);
+    }
+
+    return sum_MPI(batch_error) / normalization_coefficient;
 }
 
 
@@ -393,44 +571,44 @@ check();
 
     const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
-    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
     const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     // Loss index
 
-    Vector<double> training_error_gradient(parameters_number, 0.0);
+    Vector<double> training_error_gradient;
 
-    #pragma omp parallel for
+    set_back_propagations(batch_size);
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
-    {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+    set_gradient_accumulators(parameters_number);
 
-        const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-                = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> output_gradient
-                = calculate_output_gradient(first_order_forward_propagation.layers_activations[layers_number-1], targets);
+        #pragma omp for schedule(static)
 
-        const Vector< Matrix<double> > layers_delta
-                = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const Vector<double> batch_gradient
-                = calculate_error_gradient(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+            BackPropagation& back_propagation = get_back_propagation();
 
-        #pragma omp critical
+            calculate_back_propagation(inputs, targets, back_propagation);
 
-        training_error_gradient += batch_gradient;
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
     }
 
+    reduce_gradient_accumulators(training_error_gradient);
+
     return training_error_gradient/normalization_coefficient;
 }
 
@@ -545,6 +723,33 @@ check();
 }
 
 
+/// Calculates the output gradient of a batch and writes it into a given matrix, which is resized only if its dimensions change.
+/// @param outputs Matrix of outputs of the neural network.
+/// @param targets Matrix of targets of the data set.
+/// @param output_gradient Matrix where the output gradient is written.
+
+void NormalizedSquaredError::calculate_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets, Matrix<double>& output_gradient) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    if(output_gradient.get_rows_number() != outputs.get_rows_number() || output_gradient.get_columns_number() != outputs.get_columns_number())
+    {
+        output_gradient.set(outputs.get_rows_number(), outputs.get_columns_number());
+    }
+
+    const size_t size = outputs.size();
+
+    for(size_t i = 0; i < size; i++)
+    {
+        output_gradient[i] = (outputs[i]-targets[i])*2.0/normalization_coefficient;
+    }
+}
+
+
 /// Returns loss vector of the error terms function for the normalized squared error.
 /// It uses the error back-propagation method.
 
@@ -702,50 +907,44 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
-    SecondOrderErrorTerms terms_second_order_loss(parameters_number);
+    SecondOrderErrorTerms terms_second_order_loss;
 
-    #pragma omp parallel for
+    set_second_order_accumulators(parameters_number);
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
-
-        const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-                = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
-
-        const Vector<double> error_terms
-                = calculate_error_terms(first_order_forward_propagation.layers_activations[layers_number-1], targets);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> output_gradient = (first_order_forward_propagation.layers_activations[layers_number-1] - targets)/error_terms;
+        #pragma omp for schedule(static)
 
-        const Vector< Matrix<double> > layers_delta
-                = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const Matrix<double> error_terms_Jacobian
-                = calculate_error_terms_Jacobian(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+            const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
+                    = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
-        const Matrix<double> error_terms_Jacobian_transpose = error_terms_Jacobian.calculate_transpose();
+            const Vector<double> error_terms
+                    = calculate_error_terms(first_order_forward_propagation.layers_activations[layers_number-1], targets);
 
-        const double loss = error_terms.dot(error_terms);
+            const Matrix<double> output_gradient = (first_order_forward_propagation.layers_activations[layers_number-1] - targets)/error_terms;
 
-        const Vector<double> gradient = error_terms_Jacobian_transpose.dot(error_terms);
+            const Vector< Matrix<double> > layers_delta
+                    = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
 
-        Matrix<double> Hessian_approximation;
-        Hessian_approximation.dot(error_terms_Jacobian_transpose, error_terms_Jacobian);
-
-        #pragma omp critical
-//        {
-            terms_second_order_loss.loss += loss;
-            terms_second_order_loss.gradient += gradient;
-            terms_second_order_loss.Hessian_approximation += Hessian_approximation;
-//         }
+            accumulate_second_order_terms(inputs, first_order_forward_propagation.layers_activations, layers_delta,
+                                          error_terms, get_second_order_accumulator());
+        }
     }
 
+    reduce_second_order_accumulators(terms_second_order_loss);
+
 //    const Matrix<double> regularization_Hessian = loss_index_pointer->calculate_regularization_Hessian();
 
     terms_second_order_loss.loss /= normalization_coefficient;
@@ -756,6 +955,142 @@ check();
 }
 
 
+/// Returns the normalized squared error and its gradient on the training instances.
+/// Both are computed in a single forward and backward propagation of each batch.
+
+LossIndex::FirstOrderError NormalizedSquaredError::calculate_training_first_order_error() const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+    // Data set
+
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    // Loss index
+
+    FirstOrderError first_order_error(0);
+
+    double training_error = 0.0;
+
+    set_back_propagations(batch_size);
+
+    set_gradient_accumulators(parameters_number);
+
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for schedule(static) reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            BackPropagation& back_propagation = get_back_propagation();
+
+            calculate_back_propagation(inputs, targets, back_propagation);
+
+            training_error += back_propagation.get_outputs().calculate_sum_squared_error(targets);
+
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
+    }
+
+    first_order_error.error = sum_MPI(training_error)/normalization_coefficient;
+
+    reduce_gradient_accumulators(first_order_error.gradient);
+
+    first_order_error.gradient /= normalization_coefficient;
+
+    return first_order_error;
+}
+
+
+/// Returns the normalized squared error and its gradient on a batch of instances.
+/// @param batch_indices Indices of the instances in the batch.
+
+LossIndex::FirstOrderError NormalizedSquaredError::calculate_batch_first_order_error(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
+    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
+    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+
+    return calculate_batch_first_order_error(inputs, targets);
+}
+
+
+/// Returns the normalized squared error and its gradient on a batch which has already been gathered.
+/// Both are computed in a single forward and backward propagation.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+LossIndex::FirstOrderError NormalizedSquaredError::calculate_batch_first_order_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const size_t parameters_number = neural_network_pointer->get_multilayer_perceptron_pointer()->get_parameters_number();
+
+    // Data set
+
+    const size_t instances_number = inputs.get_rows_number();
+
+    // Loss index
+
+    FirstOrderError first_order_error(parameters_number);
+
+    double batch_error = 0.0;
+
+    if(instances_number > 0)
+    {
+        set_back_propagations(instances_number);
+
+        BackPropagation& back_propagation = get_back_propagation();
+
+        calculate_back_propagation(inputs, targets, back_propagation);
+
+        batch_error = back_propagation.get_outputs().calculate_sum_squared_error(targets);
+
+        first_order_error.gradient = back_propagation.gradient;
+    }
+
+    first_order_error.error = sum_MPI(batch_error)/normalization_coefficient;
+
+    sum_MPI(first_order_error.gradient);
+
+    first_order_error.gradient /= normalization_coefficient;
+
+    return first_order_error;
+}
+
+
 /// Returns a string with the name of the normalized squared error loss type, "NORMALIZED_SQUARED_ERROR".
 
 string NormalizedSquaredError::write_error_term_type() const
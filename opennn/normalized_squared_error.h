@@ -97,16 +97,25 @@ public:
    double calculate_selection_error() const;
 
    double calculate_training_error(const Vector<double>&) const;
+   double calculate_selection_error(const Vector<double>&) const;
+   Vector<double> calculate_training_errors(const Vector< Vector<double> >&) const;
 
    double calculate_batch_error(const Vector<size_t> &) const;
+   double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const;
 
    Vector<double> calculate_training_error_gradient() const;
 
+   FirstOrderError calculate_training_first_order_error() const;
+
+   FirstOrderError calculate_batch_first_order_error(const Vector<size_t>&) const;
+   FirstOrderError calculate_batch_first_order_error(const Matrix<double>&, const Matrix<double>&) const;
+
    double calculate_error(const Matrix<double>&, const Matrix<double>&) const;
 
    double calculate_error(const Vector<size_t>&, const Vector<double>&) const;
 
    Matrix<double> calculate_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&, Matrix<double>&) const;
 
    // Error terms methods
 
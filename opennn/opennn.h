@@ -16,9 +16,12 @@
 // Data set
 
 #include "data_set.h"
+#include "column_store.h"
+#include "batch_producer.h"
 #include "instances.h"
 #include "variables.h"
 #include "missing_values.h"
+#include "spatial_index.h"
 
 // Neural network
 
@@ -46,6 +49,7 @@
 #include "sum_squared_error.h"
 #include "weighted_squared_error.h"
 
+#include "adaptive_moment_estimation.h"
 #include "conjugate_gradient.h"
 #include "evolutionary_algorithm.h"
 #include "gradient_descent.h"
@@ -53,7 +57,10 @@
 #include "quasi_newton_method.h"
 #include "random_search.h"
 #include "training_algorithm.h"
+#include "history_sink.h"
+#include "training_checkpoint.h"
 #include "training_rate_algorithm.h"
+#include "single_precision_engine.h"
 
 // Model selection
 
@@ -92,7 +99,7 @@
 #include "vector.h"
 #include "tinyxml2.h"
 #include "correlation_analysis.h"
-//#include "k_nearest_neighbors.h"
+#include "k_nearest_neighbors.h"
 
 #endif
 
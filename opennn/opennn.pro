@@ -52,9 +52,14 @@ macx{
 HEADERS += \
     variables.h \
     stochastic_gradient_descent.h\
+    adaptive_moment_estimation.h \
+    single_precision_engine.h \
     instances.h \
     missing_values.h \
     data_set.h \
+    column_store.h \
+    spatial_index.h \
+    batch_producer.h \
     inputs.h \
     outputs.h \
     unscaling_layer.h \
@@ -76,6 +81,8 @@ HEADERS += \
     cross_entropy_error.h \
     training_strategy.h \
     training_algorithm.h \
+    history_sink.h \
+    training_checkpoint.h \
     training_rate_algorithm.h \
     random_search.h \
     quasi_newton_method.h \
@@ -119,6 +126,9 @@ SOURCES += \
     instances.cpp \
     missing_values.cpp \
     data_set.cpp \
+    column_store.cpp \
+    spatial_index.cpp \
+    batch_producer.cpp \
     inputs.cpp \
     outputs.cpp \
     unscaling_layer.cpp \
@@ -140,7 +150,11 @@ SOURCES += \
     cross_entropy_error.cpp \
     training_strategy.cpp \
     training_algorithm.cpp \
+    history_sink.cpp \
+    training_checkpoint.cpp \
     stochastic_gradient_descent.cpp\
+    adaptive_moment_estimation.cpp \
+    single_precision_engine.cpp \
     training_rate_algorithm.cpp \
     random_search.cpp \
     quasi_newton_method.cpp \
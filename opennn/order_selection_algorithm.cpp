@@ -253,6 +253,14 @@ void OrderSelectionAlgorithm::set_training_strategy_pointer(TrainingStrategy* ne
 }
 
 
+/// Returns the maximum number of threads used to perform the trials of each network architecture.
+
+const size_t& OrderSelectionAlgorithm::get_threads_number() const
+{
+    return(threads_number);
+}
+
+
 /// Sets the members of the order selection object to their default values.
 
 void OrderSelectionAlgorithm::set_default()
@@ -280,6 +288,12 @@ void OrderSelectionAlgorithm::set_default()
     maximum_order = 2*(inputs_number + outputs_number);
     trials_number = 1;
 
+#ifdef _OPENMP
+    threads_number = static_cast<size_t>(omp_get_max_threads());
+#else
+    threads_number = max(static_cast<size_t>(1), static_cast<size_t>(thread::hardware_concurrency()));
+#endif
+
     // order selection results
 
     reserve_parameters_data = true;
@@ -394,6 +408,30 @@ void OrderSelectionAlgorithm::set_trials_number(const size_t& new_trials_number)
 }
 
 
+/// Sets the maximum number of threads used to perform the trials of each network architecture.
+/// The trials are trained at the same time, and the threads which are left are shared out among them.
+/// @param new_threads_number Number of threads.
+
+void OrderSelectionAlgorithm::set_threads_number(const size_t& new_threads_number)
+{
+#ifdef __OPENNN_DEBUG__
+
+    if(new_threads_number == 0)
+    {
+        ostringstream buffer;
+        buffer << "OpenNN Exception: OrderSelectionAlgorithm class.\n"
+               << "void set_threads_number(const size_t&) method.\n"
+               << "Number of threads must be greater than 0.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    threads_number = new_threads_number;
+}
+
+
 /// Sets the reserve flag for the parameters data.
 /// @param new_reserve_parameters_data Flag value.
 
@@ -579,7 +617,34 @@ void OrderSelectionAlgorithm::set_tolerance(const double& new_tolerance)
 }
 
 
-/// Returns the minimum of the loss and selection loss in trials_number trainings
+/// Returns the index of the trial with the smallest selection error, or with the largest one if maximum is true.
+/// Ties are broken by the training loss and then by the lowest index, so that the choice does not depend on the order in which the trials finish.
+/// @param trials_losses Training loss and selection error of each trial in its rows.
+/// @param maximum True to select the trial with the largest errors, false to select the trial with the smallest ones.
+
+static size_t select_trial(const Matrix<double>& trials_losses, const bool& maximum)
+{
+    const double sign = maximum ? -1.0 : 1.0;
+
+    size_t selected_trial = 0;
+
+    for(size_t i = 1; i < trials_losses.get_rows_number(); i++)
+    {
+        const double selection_error_difference = sign*(trials_losses(i,1) - trials_losses(selected_trial,1));
+        const double loss_difference = sign*(trials_losses(i,0) - trials_losses(selected_trial,0));
+
+        if(selection_error_difference < 0.0 || (selection_error_difference == 0.0 && loss_difference < 0.0))
+        {
+            selected_trial = i;
+        }
+    }
+
+    return(selected_trial);
+}
+
+
+/// Returns the minimum of the loss and selection loss in trials_number trainings.
+/// The neural network is left with the parameters of the training with the smallest selection error.
 /// @param order_number Number of perceptrons in the hidden layer to be trained with.
 
 Vector<double> OrderSelectionAlgorithm::perform_minimum_model_evaluation(const size_t& order_number)
@@ -610,43 +675,20 @@ Vector<double> OrderSelectionAlgorithm::perform_minimum_model_evaluation(const s
 
 #endif
 
-    NeuralNetwork* neural_network = training_strategy_pointer->get_loss_index_pointer()->get_neural_network_pointer();
-
-    TrainingStrategy::Results training_strategy_results;
-
-    Vector<double> final(2);
-    final[0] = 10;
-    final[1] = 10;
-
-    Vector<double> current_loss(2);
-
-    Vector<double> final_parameters;
-
-    bool flag_loss = false;
-    bool flag_selection = false;
-
     for(size_t i = 0; i < order_history.size(); i++)
     {
         if(order_history[i] == order_number)
         {
-            final[0] = loss_history[i];
-            flag_loss = true;
-        }
-    }
+            Vector<double> final(2);
 
-    for(size_t i = 0; i < order_history.size(); i++)
-    {
-        if(order_history[i] == order_number)
-        {
+            final[0] = loss_history[i];
             final[1] = selection_error_history[i];
-            flag_selection = true;
+
+            return(final);
         }
     }
 
-    if(flag_loss && flag_selection)
-    {
-        return(final);
-    }
+    NeuralNetwork* neural_network = training_strategy_pointer->get_loss_index_pointer()->get_neural_network_pointer();
 
     MultilayerPerceptron* multilayer_perceptron = neural_network->get_multilayer_perceptron_pointer();
     const size_t last_hidden_layer = multilayer_perceptron->get_layers_number()-2;
@@ -655,16 +697,6 @@ Vector<double> OrderSelectionAlgorithm::perform_minimum_model_evaluation(const s
     if(order_number > perceptrons_number)
     {
         multilayer_perceptron->grow_layer_perceptron(last_hidden_layer,order_number-perceptrons_number);
-        neural_network->randomize_parameters_normal();
-#ifdef __OPENNN_MPI__
-
-        neural_network->set_MPI(neural_network);
-
-#endif
-        training_strategy_results = training_strategy_pointer->perform_training();
-
-        final_parameters.set(neural_network->get_parameters());
-        final = get_final_losses(training_strategy_results);
     }
     else
     {
@@ -672,72 +704,22 @@ Vector<double> OrderSelectionAlgorithm::perform_minimum_model_evaluation(const s
         {
             multilayer_perceptron->prune_layer_perceptron(last_hidden_layer,0);
         }
-
-        neural_network->randomize_parameters_normal();
-
-#ifdef __OPENNN_MPI__
-
-        neural_network->set_MPI(neural_network);
-
-#endif
-        training_strategy_results = training_strategy_pointer->perform_training();
-
-        final_parameters.set(neural_network->get_parameters());
-        final = get_final_losses(training_strategy_results);
     }
 
-    for(size_t i = 1; i < trials_number; i++)
-    {
-        if(display)
-        {
-            cout << "Trial number: " << i << endl;
-            if(i == 1)
-            {
-                cout << "Training loss: " << final[0] << endl;
-                cout << "Selection error: " << final[1] << endl;
-                cout << "Stopping condition: " << write_stopping_condition(training_strategy_results) << endl << endl;
-            }
-            else
-            {
-                cout << "Training loss: " << current_loss[0] << endl;
-                cout << "Selection error: " << current_loss[1] << endl;
-                cout << "Stopping condition: " << write_stopping_condition(training_strategy_results) << endl << endl;
-            }
-        }
-
-        neural_network->randomize_parameters_normal();
+    neural_network->randomize_parameters_normal();
 
-#ifdef __OPENNN_MPI__
+    Vector< Vector<double> > trials_parameters;
 
-        neural_network->set_MPI(neural_network);
+    const Matrix<double> trials_losses = perform_trials(trials_parameters);
 
-#endif
-        training_strategy_results = training_strategy_pointer->perform_training();
-
-        current_loss = get_final_losses(training_strategy_results);
+    const size_t selected_trial = select_trial(trials_losses, false);
 
-        if(!flag_loss && final[0] > current_loss[0])
-        {
-            final[0] = current_loss[0];
+    Vector<double> final(2);
 
-            final_parameters.set(neural_network->get_parameters());
-        }
+    final[0] = trials_losses.get_column(0).calculate_minimum();
+    final[1] = trials_losses.get_column(1).calculate_minimum();
 
-        if(!flag_selection && final[1] > current_loss[1])
-        {
-            final[1] = current_loss[1];
-
-            final_parameters.set(neural_network->get_parameters());
-        }
-    }
-
-    if(display)
-    {
-        cout << "Trial number: " << trials_number << endl;
-        cout << "Training loss: " << final[0] << endl;
-        cout << "Selection error: " << final[1] << endl;
-        cout << "Stopping condition: " << write_stopping_condition(training_strategy_results) << endl << endl;
-    }
+    neural_network->set_parameters(trials_parameters[selected_trial]);
 
     order_history.push_back(order_number);
 
@@ -745,13 +727,14 @@ Vector<double> OrderSelectionAlgorithm::perform_minimum_model_evaluation(const s
 
     selection_error_history.push_back(final[1]);
 
-    parameters_history.push_back(final_parameters);
+    parameters_history.push_back(trials_parameters[selected_trial]);
 
-    return final;
+    return(final);
 }
 
 
-/// Returns the maximum of the loss and selection loss in trials_number trainings
+/// Returns the maximum of the loss and selection loss in trials_number trainings.
+/// The neural network is left with the parameters of the training with the largest selection error.
 /// @param order_number Number of perceptrons in the hidden layer to be trained with.
 
 Vector<double> OrderSelectionAlgorithm::perform_maximum_model_evaluation(const size_t& order_number)
@@ -782,46 +765,20 @@ Vector<double> OrderSelectionAlgorithm::perform_maximum_model_evaluation(const s
 
 #endif
 
-    NeuralNetwork* neural_network = training_strategy_pointer->get_loss_index_pointer()->get_neural_network_pointer();
-
-    TrainingStrategy::Results training_strategy_results;
-
-    Vector<double> final(2);
-    final[0] = 0;
-    final[1] = 0;
-
-    Vector<double> current_loss(2);
-
-    Vector<double> final_parameters;
-
-    bool flag_loss = false;
-    bool flag_selection = false;
-
     for(size_t i = 0; i < order_history.size(); i++)
     {
         if(order_history[i] == order_number)
         {
-            final[0] = loss_history[i];
-            flag_loss = true;
-        }
-    }
-
-
+            Vector<double> final(2);
 
-    for(size_t i = 0; i < order_history.size(); i++)
-    {
-        if(order_history[i] == order_number)
-        {
+            final[0] = loss_history[i];
             final[1] = selection_error_history[i];
-            flag_selection = true;
+
+            return(final);
         }
     }
 
-
-    if(flag_loss && flag_selection)
-    {
-        return(final);
-    }
+    NeuralNetwork* neural_network = training_strategy_pointer->get_loss_index_pointer()->get_neural_network_pointer();
 
     MultilayerPerceptron* multilayer_perceptron = neural_network->get_multilayer_perceptron_pointer();
     const size_t last_hidden_layer = multilayer_perceptron->get_layers_number()-2;
@@ -830,11 +787,6 @@ Vector<double> OrderSelectionAlgorithm::perform_maximum_model_evaluation(const s
     if(order_number > perceptrons_number)
     {
         multilayer_perceptron->grow_layer_perceptron(last_hidden_layer,order_number-perceptrons_number);
-        neural_network->perturbate_parameters(0.001);
-        training_strategy_results = training_strategy_pointer->perform_training();
-
-        final_parameters.set(neural_network->get_parameters());
-        final = get_final_losses(training_strategy_results);
     }
     else
     {
@@ -844,66 +796,22 @@ Vector<double> OrderSelectionAlgorithm::perform_maximum_model_evaluation(const s
         {
             multilayer_perceptron->prune_layer_perceptron(last_hidden_layer,0);
         }
-
-        neural_network->perturbate_parameters(0.001);
-        training_strategy_results = training_strategy_pointer->perform_training();
-
-        final_parameters.set(neural_network->get_parameters());
-        final = get_final_losses(training_strategy_results);
     }
 
-    for(size_t i = 1; i < trials_number; i++)
-    {
-        if(display)
-        {
-            cout << "Trial number: " << i << endl;
-            if(i == 1)
-            {
-                cout << "Training loss: " << final[0] << endl;
-                cout << "Selection error: " << final[1] << endl;
-                cout << "Stopping condition: " << write_stopping_condition(training_strategy_results) << endl << endl;
-            }
-            else
-            {
-                cout << "Training loss: " << current_loss[0] << endl;
-                cout << "Selection error: " << current_loss[1] << endl;
-                cout << "Stopping condition: " << write_stopping_condition(training_strategy_results) << endl << endl;
-            }
-        }
-
-        neural_network->randomize_parameters_normal();
+    neural_network->perturbate_parameters(0.001);
 
-#ifdef __OPENNN_MPI__
+    Vector< Vector<double> > trials_parameters;
 
-        neural_network->set_MPI(neural_network);
+    const Matrix<double> trials_losses = perform_trials(trials_parameters);
 
-#endif
-        training_strategy_results = training_strategy_pointer->perform_training();
-
-        current_loss = get_final_losses(training_strategy_results);
+    const size_t selected_trial = select_trial(trials_losses, true);
 
-        if(!flag_loss && final[0] < current_loss[0])
-        {
-            final[0] = current_loss[0];
-
-            final_parameters.set(neural_network->get_parameters());
-        }
+    Vector<double> final(2);
 
-        if(!flag_selection && final[1] < current_loss[1])
-        {
-            final[1] = current_loss[1];
+    final[0] = trials_losses.get_column(0).calculate_maximum();
+    final[1] = trials_losses.get_column(1).calculate_maximum();
 
-            final_parameters.set(neural_network->get_parameters());
-        }
-    }
-
-    if(display)
-    {
-        cout << "Trial number: " << trials_number << endl;
-        cout << "Training loss: " << final[0] << endl;
-        cout << "Selection error: " << final[1] << endl;
-        cout << "Stopping condition: " << write_stopping_condition(training_strategy_results) << endl << endl;
-    }
+    neural_network->set_parameters(trials_parameters[selected_trial]);
 
     order_history.push_back(order_number);
 
@@ -911,13 +819,14 @@ Vector<double> OrderSelectionAlgorithm::perform_maximum_model_evaluation(const s
 
     selection_error_history.push_back(final[1]);
 
-    parameters_history.push_back(final_parameters);
+    parameters_history.push_back(trials_parameters[selected_trial]);
 
-    return final;
+    return(final);
 }
 
 
-/// Returns the mean of the loss and selection loss in trials_number trainings
+/// Returns the mean of the loss and selection loss in trials_number trainings.
+/// The neural network is left with the parameters of the training with the smallest selection error.
 /// @param order_number Number of perceptrons in the hidden layer to be trained with.
 
 Vector<double> OrderSelectionAlgorithm::perform_mean_model_evaluation(const size_t& order_number)
@@ -948,47 +857,20 @@ Vector<double> OrderSelectionAlgorithm::perform_mean_model_evaluation(const size
 
 #endif
 
-    NeuralNetwork* neural_network = training_strategy_pointer->get_loss_index_pointer()->get_neural_network_pointer();
-
-    TrainingStrategy::Results training_strategy_results;
-
-    Vector<double> mean_final(2);
-    mean_final[0] = 0;
-    mean_final[1] = 0;
-
-    Vector<double> current_loss(2);
-
-    Vector<double> final_parameters;
-
-    bool flag_loss = false;
-    bool flag_selection = false;
-
-
     for(size_t i = 0; i < order_history.size(); i++)
     {
         if(order_history[i] == order_number)
         {
-            mean_final[0] = loss_history[i];
-            flag_loss = true;
-        }
-    }
-
+            Vector<double> final(2);
 
+            final[0] = loss_history[i];
+            final[1] = selection_error_history[i];
 
-    for(size_t i = 0; i < order_history.size(); i++)
-    {
-        if(order_history[i] == order_number)
-        {
-            mean_final[1] = selection_error_history[i];
-            flag_selection = true;
+            return(final);
         }
     }
 
-
-    if(flag_loss && flag_selection)
-    {
-        return(mean_final);
-    }
+    NeuralNetwork* neural_network = training_strategy_pointer->get_loss_index_pointer()->get_neural_network_pointer();
 
     MultilayerPerceptron* multilayer_perceptron = neural_network->get_multilayer_perceptron_pointer();
     const size_t last_hidden_layer = multilayer_perceptron->get_layers_number()-2;
@@ -997,11 +879,6 @@ Vector<double> OrderSelectionAlgorithm::perform_mean_model_evaluation(const size
     if(order_number > perceptrons_number)
     {
         multilayer_perceptron->grow_layer_perceptron(last_hidden_layer,order_number-perceptrons_number);
-        neural_network->perturbate_parameters(0.001);
-        training_strategy_results = training_strategy_pointer->perform_training();
-
-        final_parameters.set(neural_network->get_parameters());
-        mean_final = get_final_losses(training_strategy_results);
     }
     else
     {
@@ -1009,72 +886,89 @@ Vector<double> OrderSelectionAlgorithm::perform_mean_model_evaluation(const size
         {
             multilayer_perceptron->prune_layer_perceptron(last_hidden_layer,0);
         }
+    }
 
-        neural_network->perturbate_parameters(0.001);
-        training_strategy_results = training_strategy_pointer->perform_training();
+    neural_network->perturbate_parameters(0.001);
 
-        final_parameters.set(neural_network->get_parameters());
-        mean_final = get_final_losses(training_strategy_results);
-    }
+    Vector< Vector<double> > trials_parameters;
+
+    const Matrix<double> trials_losses = perform_trials(trials_parameters);
+
+    const size_t selected_trial = select_trial(trials_losses, false);
+
+    Vector<double> final(2);
+
+    final[0] = trials_losses.get_column(0).calculate_mean();
+    final[1] = trials_losses.get_column(1).calculate_mean();
+
+    neural_network->set_parameters(trials_parameters[selected_trial]);
+
+    order_history.push_back(order_number);
+
+    loss_history.push_back(final[0]);
+
+    selection_error_history.push_back(final[1]);
+
+    parameters_history.push_back(trials_parameters[selected_trial]);
+
+    return(final);
+}
+
+
+/// Trains the neural network trials_number times and returns the final training loss and selection error of each training.
+/// The first training starts from the current parameters of the neural network, and the others from random parameters,
+/// which are drawn in the order of the trials.
+/// The trainings are performed at the same time on copies of the neural network, with up to threads_number threads.
+/// The parameters of the neural network are not modified.
+/// @param trials_parameters Parameters of the neural network at the end of each training.
+/// @return Matrix with the training loss and the selection error of each training in its rows.
+
+Matrix<double> OrderSelectionAlgorithm::perform_trials(Vector< Vector<double> >& trials_parameters)
+{
+    NeuralNetwork* neural_network = training_strategy_pointer->get_loss_index_pointer()->get_neural_network_pointer();
+
+    const Vector<double> parameters = neural_network->get_parameters();
+
+    Vector< Vector<double> > initial_parameters(trials_number);
+
+    initial_parameters[0] = parameters;
 
     for(size_t i = 1; i < trials_number; i++)
     {
-        if(display)
-        {
-            cout << "Trial number: " << i << endl;
-            if(i == 1)
-            {
-                cout << "Training loss: " << mean_final[0] << endl;
-                cout << "Selection error: " << mean_final[1] << endl;
-                cout << "Stopping condition: " << write_stopping_condition(training_strategy_results) << endl << endl;
-            }
-            else
-            {
-                cout << "Training loss: " << current_loss[0] << endl;
-                cout << "Selection error: " << current_loss[1] << endl;
-                cout << "Stopping condition: " << write_stopping_condition(training_strategy_results) << endl << endl;
-            }
-        }
-
         neural_network->randomize_parameters_normal();
 
-#ifdef __OPENNN_MPI__
+        initial_parameters[i] = neural_network->get_parameters();
+    }
 
-        neural_network->set_MPI(neural_network);
+    neural_network->set_parameters(parameters);
 
-#endif
-        training_strategy_results = training_strategy_pointer->perform_training();
+    const Vector<TrainingStrategy::Results*> trials_results
+            = training_strategy_pointer->perform_training_trials(initial_parameters, trials_parameters, threads_number);
 
-        current_loss = get_final_losses(training_strategy_results);
+    Matrix<double> trials_losses(trials_number, 2);
 
-        if(!flag_loss)
-        {
-            mean_final[0] += current_loss[0]/trials_number;
-        }
+    for(size_t i = 0; i < trials_number; i++)
+    {
+        const Vector<double> losses = get_final_losses(*trials_results[i]);
+
+        trials_losses(i,0) = losses[0];
+        trials_losses(i,1) = losses[1];
 
-        if(!flag_selection)
+        if(display)
         {
-            mean_final[1] += current_loss[1]/trials_number;
+            cout << "Trial number: " << i+1 << endl;
+            cout << "Training loss: " << losses[0] << endl;
+            cout << "Selection error: " << losses[1] << endl;
+            cout << "Stopping condition: " << write_stopping_condition(*trials_results[i]) << endl << endl;
         }
     }
 
-    if(display)
+    for(size_t i = 0; i < trials_number; i++)
     {
-        cout << "Trial number: " << trials_number << endl;
-        cout << "Training loss: " << mean_final[0] << endl;
-        cout << "Selection error: " << mean_final[1] << endl;
-        cout << "Stopping condition: " << write_stopping_condition(training_strategy_results) << endl << endl;
+        delete trials_results[i];
     }
 
-    order_history.push_back(order_number);
-
-    loss_history.push_back(mean_final[0]);
-
-    selection_error_history.push_back(mean_final[1]);
-
-    parameters_history.push_back(final_parameters);
-
-    return mean_final;
+    return(trials_losses);
 }
 
 
@@ -1110,6 +1004,18 @@ Vector<double> OrderSelectionAlgorithm::get_final_losses(const TrainingStrategy:
             losses[1] = results.Levenberg_Marquardt_algorithm_results_pointer->final_selection_error;
             return(losses);
         }
+        case TrainingStrategy::STOCHASTIC_GRADIENT_DESCENT:
+        {
+            losses[0] = results.stochastic_gradient_descent_results_pointer->final_loss;
+            losses[1] = results.stochastic_gradient_descent_results_pointer->final_selection_error;
+            return(losses);
+        }
+        case TrainingStrategy::ADAPTIVE_MOMENT_ESTIMATION:
+        {
+            losses[0] = results.adaptive_moment_estimation_results_pointer->final_loss;
+            losses[1] = results.adaptive_moment_estimation_results_pointer->final_selection_error;
+            return(losses);
+        }
 //        default:
 //        {
 //            ostringstream buffer;
@@ -1218,6 +1124,14 @@ string OrderSelectionAlgorithm::write_stopping_condition(const TrainingStrategy:
         {
             return results.Levenberg_Marquardt_algorithm_results_pointer->write_stopping_condition();
         }
+        case TrainingStrategy::STOCHASTIC_GRADIENT_DESCENT:
+        {
+            return results.stochastic_gradient_descent_results_pointer->write_stopping_condition();
+        }
+        case TrainingStrategy::ADAPTIVE_MOMENT_ESTIMATION:
+        {
+            return results.adaptive_moment_estimation_results_pointer->write_stopping_condition();
+        }
 //        default:
 //        {
 //            ostringstream buffer;
@@ -22,6 +22,7 @@
 #include <sstream>
 #include <cmath>
 #include <ctime>
+#include <thread>
 
 // OpenNN includes
 
@@ -153,6 +154,7 @@ public:
     const size_t& get_maximum_order() const;
     const size_t& get_minimum_order() const;
     const size_t& get_trials_number() const;
+    const size_t& get_threads_number() const;
 
     const bool& get_reserve_parameters_data() const;
     const bool& get_reserve_loss_data() const;
@@ -179,6 +181,7 @@ public:
     void set_maximum_order(const size_t&);
     void set_minimum_order(const size_t&);
     void set_trials_number(const size_t&);
+    void set_threads_number(const size_t&);
 
     void set_reserve_parameters_data(const bool&);
     void set_reserve_loss_data(const bool&);
@@ -222,6 +225,10 @@ public:
 
 protected:
 
+    // Trials methods
+
+    Matrix<double> perform_trials(Vector< Vector<double> >&);
+
     // MEMBERS
 
     /// Pointer to a training strategy object.
@@ -256,6 +263,10 @@ protected:
 
     size_t trials_number;
 
+    /// Maximum number of threads used to perform the trials of each neural network.
+
+    size_t threads_number;
+
     /// Method used for the calculation of the loss and the generalizaton loss.
 
     PerformanceCalculationMethod loss_calculation_method;
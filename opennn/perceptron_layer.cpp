@@ -988,77 +988,9 @@ Matrix<double> PerceptronLayer::calculate_outputs(const Matrix<double>& inputs)
 
     #endif
 
-    Matrix<double> outputs(inputs.calculate_linear_combinations(synaptic_weights, biases));
+    Matrix<double> outputs;
 
-    switch(activation_function)
-    {
-        case PerceptronLayer::Linear:
-        {
-             // do nothing
-        }
-        break;
-
-        case PerceptronLayer::HyperbolicTangent:
-        {
-             transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){return tanh(value);});
-        }
-        break;
-
-       case PerceptronLayer::Logistic:
-       {
-            transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){return 1.0 / (1.0 + exp(-value));});
-       }
-       break;
-
-       case PerceptronLayer::Threshold:
-       {
-            transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){return value < 0.0 ? 0.0 : 1.0;});
-       }
-       break;
-
-       case PerceptronLayer::SymmetricThreshold:
-       {
-            transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){return value < 0.0 ? -1.0 : 1.0;});
-       }
-       break;
-
-       case PerceptronLayer::RectifiedLinear:
-       {
-            transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){return value < 0.0 ? 0.0 : value;});
-       }
-       break;
-
-       case PerceptronLayer::ScaledExponentialLinear:
-       {
-            transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){return value < 0.0 ? 1.0507 * 1.67326 * (exp(value) - 1.0) :  1.0507 * value;});
-       }
-       break;
-
-       case PerceptronLayer::SoftPlus:
-       {
-            transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){return log(1 + exp(value));});
-       }
-       break;
-
-       case PerceptronLayer::SoftSign:
-       {
-            transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){return value < 0.0 ?  value/(1.0-value) : value/(1.0 + value);});
-       }
-       break;
-
-       case PerceptronLayer::ExponentialLinear:
-       {
-            transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){return value < 0.0 ?  1.0 * (exp(value)- 1.0) : value;});
-        }
-       break;
-
-       case PerceptronLayer::HardSigmoid:
-       {
-            transform(outputs.begin(), outputs.end(), outputs.begin(), [](const double &value){if(value < -2.5){return 0.0;}else if(value > 2.5){return 1.0;}else{return 0.2*value + 0.5;}});
-       }
-       break;
-
-    }
+    calculate_outputs(inputs, outputs);
 
     return outputs;
 }
@@ -1162,6 +1094,460 @@ Matrix<double> PerceptronLayer::calculate_outputs(const Matrix<double>& inputs,
 }
 
 
+/// Adds the biases to a matrix of synaptic products, and applies an activation function to the result, in place.
+/// Matrices are stored by columns, so that each column has a single bias and is contiguous in memory.
+/// The whole operation is done in one sweep over each column, which the compiler can vectorize.
+/// This method is a template so that it can be used both in double and in single precision.
+/// @param activation_function Activation function of the layer.
+/// @param biases Biases of the layer, one for each column.
+/// @param outputs Synaptic products on input, and activations on output.
+
+template<class T>
+void PerceptronLayer::calculate_activations(const ActivationFunction& activation_function, const Vector<T>& biases, Matrix<T>& outputs)
+{
+    const size_t instances_number = outputs.get_rows_number();
+    const size_t perceptrons_number = outputs.get_columns_number();
+
+    for(size_t j = 0; j < perceptrons_number; j++)
+    {
+        const T bias = biases[j];
+
+        T* output = outputs.data() + j*instances_number;
+
+        switch(activation_function)
+        {
+            case PerceptronLayer::Linear:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    output[i] += bias;
+                }
+            }
+            break;
+
+            case PerceptronLayer::HyperbolicTangent:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    output[i] = tanh(output[i] + bias);
+                }
+            }
+            break;
+
+            case PerceptronLayer::Logistic:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    output[i] = T(1.0)/(T(1.0) + exp(-output[i] - bias));
+                }
+            }
+            break;
+
+            case PerceptronLayer::Threshold:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    output[i] = output[i] + bias < T(0.0) ? T(0.0) : T(1.0);
+                }
+            }
+            break;
+
+            case PerceptronLayer::SymmetricThreshold:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    output[i] = output[i] + bias < T(0.0) ? -T(1.0) : T(1.0);
+                }
+            }
+            break;
+
+            case PerceptronLayer::RectifiedLinear:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    const T combination = output[i] + bias;
+
+                    output[i] = combination < T(0.0) ? T(0.0) : combination;
+                }
+            }
+            break;
+
+            case PerceptronLayer::ScaledExponentialLinear:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    const T combination = output[i] + bias;
+
+                    output[i] = combination < T(0.0) ? T(1.0507)*T(1.67326)*(exp(combination) - T(1.0)) : T(1.0507)*combination;
+                }
+            }
+            break;
+
+            case PerceptronLayer::SoftPlus:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    output[i] = log(T(1.0) + exp(output[i] + bias));
+                }
+            }
+            break;
+
+            case PerceptronLayer::SoftSign:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    const T combination = output[i] + bias;
+
+                    output[i] = combination < T(0.0) ? combination/(T(1.0) - combination) : combination/(T(1.0) + combination);
+                }
+            }
+            break;
+
+            case PerceptronLayer::HardSigmoid:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    const T combination = output[i] + bias;
+
+                    output[i] = combination < -T(2.5) ? T(0.0) : combination > T(2.5) ? T(1.0) : T(0.2)*combination + T(0.5);
+                }
+            }
+            break;
+
+            case PerceptronLayer::ExponentialLinear:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    const T combination = output[i] + bias;
+
+                    output[i] = combination < T(0.0) ? exp(combination) - T(1.0) : combination;
+                }
+            }
+            break;
+        }
+    }
+}
+
+
+/// Adds the biases to a matrix of synaptic products, and computes the activations and the activation derivatives of the result.
+/// The combinations, the activations and their derivatives are written in one sweep over each column,
+/// sharing the evaluation of the transcendental functions between them.
+/// The activations and derivatives matrices are only resized when their dimensions do not match.
+/// This method is a template so that it can be used both in double and in single precision.
+/// @param activation_function Activation function of the layer.
+/// @param biases Biases of the layer, one for each column.
+/// @param combinations Synaptic products on input, and combinations on output.
+/// @param activations Matrix where the activations are written.
+/// @param activations_derivatives Matrix where the activation derivatives are written.
+
+template<class T>
+void PerceptronLayer::calculate_first_order_activations(const ActivationFunction& activation_function,
+                                                        const Vector<T>& biases,
+                                                        Matrix<T>& combinations,
+                                                        Matrix<T>& activations,
+                                                        Matrix<T>& activations_derivatives)
+{
+    const size_t instances_number = combinations.get_rows_number();
+    const size_t perceptrons_number = combinations.get_columns_number();
+
+    if(activations.get_rows_number() != instances_number || activations.get_columns_number() != perceptrons_number)
+    {
+        activations.set(instances_number, perceptrons_number);
+    }
+
+    if(activations_derivatives.get_rows_number() != instances_number || activations_derivatives.get_columns_number() != perceptrons_number)
+    {
+        activations_derivatives.set(instances_number, perceptrons_number);
+    }
+
+    for(size_t j = 0; j < perceptrons_number; j++)
+    {
+        const T bias = biases[j];
+
+        T* combination = combinations.data() + j*instances_number;
+        T* activation = activations.data() + j*instances_number;
+        T* derivative = activations_derivatives.data() + j*instances_number;
+
+        switch(activation_function)
+        {
+            case PerceptronLayer::Linear:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+                    activation[i] = combination[i];
+                    derivative[i] = T(1.0);
+                }
+            }
+            break;
+
+            case PerceptronLayer::HyperbolicTangent:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+                    activation[i] = tanh(combination[i]);
+                    derivative[i] = T(1.0) - activation[i]*activation[i];
+                }
+            }
+            break;
+
+            case PerceptronLayer::Logistic:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+
+                    const T exponential = exp(-combination[i]);
+
+                    activation[i] = T(1.0)/(T(1.0) + exponential);
+                    derivative[i] = activation[i]*(T(1.0) - activation[i]);
+                }
+            }
+            break;
+
+            case PerceptronLayer::Threshold:
+            case PerceptronLayer::SymmetricThreshold:
+            {
+                const T lower_value = activation_function == PerceptronLayer::Threshold ? T(0.0) : -T(1.0);
+
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+
+                    if(combination[i] == T(0.0))
+                    {
+                        ostringstream buffer;
+
+                        buffer << "OpenNN Exception: PerceptronLayer class.\n"
+                               << "void calculate_first_order_activations(const ActivationFunction&, const Vector<T>&, Matrix<T>&, Matrix<T>&, Matrix<T>&) method.\n"
+                               << "Derivate does not exist for x equal to 0.\n";
+
+                        throw logic_error(buffer.str());
+                    }
+
+                    activation[i] = combination[i] < T(0.0) ? lower_value : T(1.0);
+                    derivative[i] = T(0.0);
+                }
+            }
+            break;
+
+            case PerceptronLayer::RectifiedLinear:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+
+                    const bool negative = combination[i] < T(0.0);
+
+                    activation[i] = negative ? T(0.0) : combination[i];
+                    derivative[i] = negative ? T(0.0) : T(1.0);
+                }
+            }
+            break;
+
+            case PerceptronLayer::ScaledExponentialLinear:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+
+                    if(combination[i] < T(0.0))
+                    {
+                        const T exponential = exp(combination[i]);
+
+                        activation[i] = T(1.0507)*T(1.67326)*(exponential - T(1.0));
+                        derivative[i] = T(1.0507)*T(1.67326)*exponential;
+                    }
+                    else
+                    {
+                        activation[i] = T(1.0507)*combination[i];
+                        derivative[i] = T(1.0507);
+                    }
+                }
+            }
+            break;
+
+            case PerceptronLayer::SoftPlus:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+
+                    const T exponential = exp(combination[i]);
+
+                    activation[i] = log(T(1.0) + exponential);
+                    derivative[i] = T(1.0)/(T(1.0) + T(1.0)/exponential);
+                }
+            }
+            break;
+
+            case PerceptronLayer::SoftSign:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+
+                    const T denominator = combination[i] < T(0.0) ? T(1.0) - combination[i] : T(1.0) + combination[i];
+
+                    activation[i] = combination[i]/denominator;
+                    derivative[i] = T(1.0)/(denominator*denominator);
+                }
+            }
+            break;
+
+            case PerceptronLayer::HardSigmoid:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+
+                    if(combination[i] < -T(2.5))
+                    {
+                        activation[i] = T(0.0);
+                        derivative[i] = T(0.0);
+                    }
+                    else if(combination[i] > T(2.5))
+                    {
+                        activation[i] = T(1.0);
+                        derivative[i] = T(0.0);
+                    }
+                    else
+                    {
+                        activation[i] = T(0.2)*combination[i] + T(0.5);
+                        derivative[i] = T(0.2);
+                    }
+                }
+            }
+            break;
+
+            case PerceptronLayer::ExponentialLinear:
+            {
+                for(size_t i = 0; i < instances_number; i++)
+                {
+                    combination[i] += bias;
+
+                    if(combination[i] < T(0.0))
+                    {
+                        const T exponential = exp(combination[i]);
+
+                        activation[i] = exponential - T(1.0);
+                        derivative[i] = exponential;
+                    }
+                    else
+                    {
+                        activation[i] = combination[i];
+                        derivative[i] = T(1.0);
+                    }
+                }
+            }
+            break;
+        }
+    }
+}
+
+
+template void PerceptronLayer::calculate_activations<double>(const ActivationFunction&, const Vector<double>&, Matrix<double>&);
+template void PerceptronLayer::calculate_activations<float>(const ActivationFunction&, const Vector<float>&, Matrix<float>&);
+
+template void PerceptronLayer::calculate_first_order_activations<double>(const ActivationFunction&, const Vector<double>&, Matrix<double>&, Matrix<double>&, Matrix<double>&);
+template void PerceptronLayer::calculate_first_order_activations<float>(const ActivationFunction&, const Vector<float>&, Matrix<float>&, Matrix<float>&, Matrix<float>&);
+
+
+/// Calculates the outputs of the layer for a batch of inputs, and writes them into a given matrix.
+/// The synaptic products are computed with a single matrix multiplication into the outputs matrix,
+/// and the biases and the activation function are then applied in one sweep, see calculate_activations(const ActivationFunction&, const Vector<T>&, Matrix<T>&).
+/// The outputs matrix is only resized when its dimensions do not match, so that its storage can be reused across batches.
+/// @param inputs Inputs to the layer. The number of columns must be equal to the number of layer inputs.
+/// @param outputs Matrix where the outputs are written.
+
+void PerceptronLayer::calculate_outputs(const Matrix<double>& inputs, Matrix<double>& outputs) const
+{
+    const size_t instances_number = inputs.get_rows_number();
+    const size_t inputs_number = get_inputs_number();
+    const size_t perceptrons_number = get_perceptrons_number();
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(inputs.get_columns_number() != inputs_number)
+    {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: PerceptronLayer class.\n"
+              << "void calculate_outputs(const Matrix<double>&, Matrix<double>&) const method.\n"
+              << "Number of columns of inputs matrix must be equal to number of inputs.\n";
+
+       throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    if(outputs.get_rows_number() != instances_number || outputs.get_columns_number() != perceptrons_number)
+    {
+        outputs.set(instances_number, perceptrons_number);
+    }
+
+    const Eigen::Map<Eigen::MatrixXd> inputs_eigen((double*)inputs.data(), instances_number, inputs_number);
+    const Eigen::Map<Eigen::MatrixXd> synaptic_weights_eigen((double*)synaptic_weights.data(), inputs_number, perceptrons_number);
+
+    Eigen::Map<Eigen::MatrixXd> outputs_eigen(outputs.data(), instances_number, perceptrons_number);
+
+    outputs_eigen.noalias() = inputs_eigen*synaptic_weights_eigen;
+
+    calculate_activations(activation_function, biases, outputs);
+}
+
+
+/// Calculates the combinations, the activations and the activation derivatives of the layer for a batch of inputs,
+/// and writes them into given matrices.
+/// The synaptic products are computed with a single matrix multiplication into the combinations matrix,
+/// and the biases, the activations and their derivatives are then computed in one sweep, see calculate_first_order_activations().
+/// The matrices are only resized when their dimensions do not match, so that their storage can be reused across batches.
+/// @param inputs Inputs to the layer. The number of columns must be equal to the number of layer inputs.
+/// @param combinations Matrix where the combinations are written.
+/// @param activations Matrix where the activations are written.
+/// @param activations_derivatives Matrix where the activation derivatives are written.
+
+void PerceptronLayer::calculate_first_order_outputs(const Matrix<double>& inputs,
+                                                    Matrix<double>& combinations,
+                                                    Matrix<double>& activations,
+                                                    Matrix<double>& activations_derivatives) const
+{
+    const size_t instances_number = inputs.get_rows_number();
+    const size_t inputs_number = get_inputs_number();
+    const size_t perceptrons_number = get_perceptrons_number();
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(inputs.get_columns_number() != inputs_number)
+    {
+       ostringstream buffer;
+
+       buffer << "OpenNN Exception: PerceptronLayer class.\n"
+              << "void calculate_first_order_outputs(const Matrix<double>&, Matrix<double>&, Matrix<double>&, Matrix<double>&) const method.\n"
+              << "Number of columns of inputs matrix must be equal to number of inputs.\n";
+
+       throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    if(combinations.get_rows_number() != instances_number || combinations.get_columns_number() != perceptrons_number)
+    {
+        combinations.set(instances_number, perceptrons_number);
+    }
+
+    const Eigen::Map<Eigen::MatrixXd> inputs_eigen((double*)inputs.data(), instances_number, inputs_number);
+    const Eigen::Map<Eigen::MatrixXd> synaptic_weights_eigen((double*)synaptic_weights.data(), inputs_number, perceptrons_number);
+
+    Eigen::Map<Eigen::MatrixXd> combinations_eigen(combinations.data(), instances_number, perceptrons_number);
+
+    combinations_eigen.noalias() = inputs_eigen*synaptic_weights_eigen;
+
+    calculate_first_order_activations(activation_function, biases, combinations, activations, activations_derivatives);
+}
+
+
 /// Returns a string with the expression of the inputs-outputs relationship of the layer.
 /// @param inputs_name Vector of strings with the name of the layer inputs. 
 /// @param outputs_name Vector of strings with the name of the layer outputs. 
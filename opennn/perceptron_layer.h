@@ -174,6 +174,12 @@ public:
    Matrix<double> calculate_activations(const Matrix<double>&) const;
    Matrix<double> calculate_activations_derivatives(const Matrix<double>&) const;
 
+   template<class T>
+   static void calculate_activations(const ActivationFunction&, const Vector<T>&, Matrix<T>&);
+
+   template<class T>
+   static void calculate_first_order_activations(const ActivationFunction&, const Vector<T>&, Matrix<T>&, Matrix<T>&, Matrix<T>&);
+
    // Perceptron layer outputs
 
    Matrix<double> calculate_outputs(const Matrix<double>&) const;
@@ -181,6 +187,10 @@ public:
 
    Matrix<double> calculate_outputs_combinations(const Matrix<double>&) const;
 
+   void calculate_outputs(const Matrix<double>&, Matrix<double>&) const;
+
+   void calculate_first_order_outputs(const Matrix<double>&, Matrix<double>&, Matrix<double>&, Matrix<double>&) const;
+
    // Expression methods
 
    string write_expression(const Vector<string>&, const Vector<string>&) const;
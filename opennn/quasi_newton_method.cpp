@@ -150,6 +150,11 @@ string QuasiNewtonMethod::write_inverse_Hessian_approximation_method() const
          return("BFGS");
 	  }
 
+      case LBFGS:
+      {
+         return("LBFGS");
+	  }
+
 //	  default:
 //      {
 //         ostringstream buffer;
@@ -172,6 +177,16 @@ string QuasiNewtonMethod::write_inverse_Hessian_approximation_method() const
 }
 
 
+// const size_t& get_limited_memory_size() const method
+
+/// Returns the number of pairs of parameters and gradient differences kept by the limited-memory BFGS method.
+
+const size_t& QuasiNewtonMethod::get_limited_memory_size() const
+{
+   return(limited_memory_size);
+}
+
+
 // const double& get_warning_parameters_norm() const method
 
 /// Returns the minimum value for the norm of the parameters vector at wich a warning message is written to the screen. 
@@ -462,6 +477,7 @@ new_inverse_Hessian_approximation_method)
 /// <ul>
 /// <li> "DFP"
 /// <li> "BFGS"
+/// <li> "LBFGS"
 /// </ul>
 /// @param new_inverse_Hessian_approximation_method_name Name of inverse Hessian approximation method.  
 
@@ -475,6 +491,10 @@ void QuasiNewtonMethod::set_inverse_Hessian_approximation_method(const string& n
    {
       inverse_Hessian_approximation_method = BFGS;
    }
+   else if(new_inverse_Hessian_approximation_method_name == "LBFGS")
+   {
+      inverse_Hessian_approximation_method = LBFGS;
+   }
    else
    {
       ostringstream buffer;
@@ -488,6 +508,35 @@ void QuasiNewtonMethod::set_inverse_Hessian_approximation_method(const string& n
 }
 
 
+// void set_limited_memory_size(const size_t&) method
+
+/// Sets the number of pairs of parameters and gradient differences kept by the limited-memory BFGS method.
+/// The memory needed by that method is proportional to this number times the number of parameters.
+/// @param new_limited_memory_size Number of pairs of differences. It must be greater than zero.
+
+void QuasiNewtonMethod::set_limited_memory_size(const size_t& new_limited_memory_size)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_limited_memory_size == 0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+             << "void set_limited_memory_size(const size_t&) method.\n"
+             << "Limited memory size must be greater than zero.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   limited_memory_size = new_limited_memory_size;
+}
+
+
 /// Makes the training history of all variables to reseved or not in memory.
 /// @param new_reserve_all_training_history True if the training history of all variables is to be reserved, 
 /// false otherwise.
@@ -524,6 +573,8 @@ void QuasiNewtonMethod::set_default()
 {
    inverse_Hessian_approximation_method = BFGS;
 
+   limited_memory_size = 10;
+
    training_rate_algorithm.set_default();
 
    // TRAINING PARAMETERS
@@ -1089,6 +1140,17 @@ const Matrix<double>& old_inverse_Hessian) const
       {
          return(calculate_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient, old_inverse_Hessian));
       }
+
+      case LBFGS:
+      {
+         ostringstream buffer;
+
+         buffer << "OpenNN Exception: QuasiNewtonMethod class.\n"
+                << "Vector<double> calculate_inverse_Hessian_approximation(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&, const Matrix<double>&) method.\n"
+                << "Limited-memory BFGS method does not form the inverse Hessian approximation.\n";
+
+         throw logic_error(buffer.str());
+      }
    }
 
    ostringstream buffer;
@@ -1157,6 +1219,17 @@ Vector<double> QuasiNewtonMethod::calculate_training_direction(const Vector<doub
 }
 
 
+/// Returns the limited-memory BFGS training direction, which has been previously normalized.
+/// It costs a number of operations proportional to the limited memory size times the number of parameters.
+/// @param gradient Gradient vector.
+/// @param limited_memory_inverse_Hessian Stored pairs of parameters and gradient differences.
+
+Vector<double> QuasiNewtonMethod::calculate_training_direction(const Vector<double>& gradient, const LimitedMemoryInverseHessian& limited_memory_inverse_Hessian) const
+{
+   return((limited_memory_inverse_Hessian.dot(gradient)*(-1.0)).calculate_normalized());
+}
+
+
 /// Returns the gradient descent training direction, which is the negative of the normalized gradient. 
 /// @param gradient Gradient vector.
 
@@ -1564,6 +1637,185 @@ double* old_inverse_Hessian_d, double* auxiliar_matrix_d) const
 
 #endif
 
+
+// void set(const size_t&, const size_t&) method
+
+/// Allocates the storage of the pairs of differences and removes the stored pairs.
+/// @param parameters_number Number of parameters of the neural network.
+/// @param memory_size Maximum number of pairs of differences to be stored.
+
+void QuasiNewtonMethod::LimitedMemoryInverseHessian::set(const size_t& parameters_number, const size_t& memory_size)
+{
+    parameters_differences.set(parameters_number, memory_size);
+    gradient_differences.set(parameters_number, memory_size);
+
+    rhos.set(memory_size);
+
+    reset();
+}
+
+
+// void reset() method
+
+/// Removes all the stored pairs of differences.
+/// The inverse Hessian approximation is then the identity matrix.
+
+void QuasiNewtonMethod::LimitedMemoryInverseHessian::reset()
+{
+    pairs_number = 0;
+    last_pair_index = 0;
+}
+
+
+// void update(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&) method
+
+/// Stores the differences of parameters and gradient between two points of the error function.
+/// When the storage is full, the oldest pair is overwritten.
+/// Pairs without positive curvature would make the approximation not positive definite, so they are discarded.
+/// @param old_parameters Another point of the error function.
+/// @param parameters Current point of the error function.
+/// @param old_gradient Gradient at the other point.
+/// @param gradient Gradient at the current point.
+
+void QuasiNewtonMethod::LimitedMemoryInverseHessian::update(const Vector<double>& old_parameters, const Vector<double>& parameters,
+                                                            const Vector<double>& old_gradient, const Vector<double>& gradient)
+{
+    const size_t parameters_number = parameters_differences.get_rows_number();
+    const size_t memory_size = parameters_differences.get_columns_number();
+
+    if(memory_size == 0)
+    {
+        return;
+    }
+
+    double parameters_dot_gradient = 0.0;
+
+    for(size_t i = 0; i < parameters_number; i++)
+    {
+        parameters_dot_gradient += (parameters[i] - old_parameters[i])*(gradient[i] - old_gradient[i]);
+    }
+
+    if(parameters_dot_gradient <= numeric_limits<double>::min())
+    {
+        return;
+    }
+
+    const size_t index = pairs_number == 0 ? 0 : (last_pair_index + 1)%memory_size;
+
+    double* parameters_difference = parameters_differences.data() + index*parameters_number;
+    double* gradient_difference = gradient_differences.data() + index*parameters_number;
+
+    for(size_t i = 0; i < parameters_number; i++)
+    {
+        parameters_difference[i] = parameters[i] - old_parameters[i];
+        gradient_difference[i] = gradient[i] - old_gradient[i];
+    }
+
+    rhos[index] = 1.0/parameters_dot_gradient;
+
+    last_pair_index = index;
+
+    if(pairs_number < memory_size)
+    {
+        pairs_number++;
+    }
+}
+
+
+// Vector<double> dot(const Vector<double>&) const method
+
+/// Returns the product of the limited-memory BFGS inverse Hessian approximation with a vector,
+/// computed with the two-loop recursion over the stored pairs.
+/// The initial approximation is the identity scaled with the most recent pair.
+/// @param vector Vector to be multiplied, usually the gradient.
+
+Vector<double> QuasiNewtonMethod::LimitedMemoryInverseHessian::dot(const Vector<double>& vector) const
+{
+    Vector<double> product(vector);
+
+    if(pairs_number == 0)
+    {
+        return(product);
+    }
+
+    const size_t parameters_number = parameters_differences.get_rows_number();
+    const size_t memory_size = parameters_differences.get_columns_number();
+
+    double* product_data = product.data();
+
+    Vector<double> alphas(pairs_number);
+
+    // From the newest to the oldest pair
+
+    for(size_t k = 0; k < pairs_number; k++)
+    {
+        const size_t index = (last_pair_index + memory_size - k)%memory_size;
+
+        const double* parameters_difference = parameters_differences.data() + index*parameters_number;
+        const double* gradient_difference = gradient_differences.data() + index*parameters_number;
+
+        double alpha = 0.0;
+
+        for(size_t i = 0; i < parameters_number; i++)
+        {
+            alpha += parameters_difference[i]*product_data[i];
+        }
+
+        alpha *= rhos[index];
+
+        for(size_t i = 0; i < parameters_number; i++)
+        {
+            product_data[i] -= alpha*gradient_difference[i];
+        }
+
+        alphas[k] = alpha;
+    }
+
+    // Initial approximation
+
+    const double* last_gradient_difference = gradient_differences.data() + last_pair_index*parameters_number;
+
+    double gradient_difference_squared_norm = 0.0;
+
+    for(size_t i = 0; i < parameters_number; i++)
+    {
+        gradient_difference_squared_norm += last_gradient_difference[i]*last_gradient_difference[i];
+    }
+
+    const double scaling = 1.0/(rhos[last_pair_index]*gradient_difference_squared_norm);
+
+    for(size_t i = 0; i < parameters_number; i++)
+    {
+        product_data[i] *= scaling;
+    }
+
+    // From the oldest to the newest pair
+
+    for(size_t k = pairs_number; k-- > 0;)
+    {
+        const size_t index = (last_pair_index + memory_size - k)%memory_size;
+
+        const double* parameters_difference = parameters_differences.data() + index*parameters_number;
+        const double* gradient_difference = gradient_differences.data() + index*parameters_number;
+
+        double beta = 0.0;
+
+        for(size_t i = 0; i < parameters_number; i++)
+        {
+            beta += gradient_difference[i]*product_data[i];
+        }
+
+        beta *= rhos[index];
+
+        for(size_t i = 0; i < parameters_number; i++)
+        {
+            product_data[i] += (alphas[k] - beta)*parameters_difference[i];
+        }
+    }
+
+    return(product);
+}
+
 // QuasiNewtonMethod* get_quasi_Newton_method_pointer() const method
 
 /// Returns the pointer to the quasi-Newton method object required by the corresponding results structure.
@@ -1861,6 +2113,9 @@ Matrix<string> QuasiNewtonMethod::QuasiNewtonMethodResults::write_final_results(
 
 /// Trains a neural network with an associated loss index according to the quasi-Newton method.
 /// Training occurs according to the training operators, training parameters and stopping criteria.
+/// If a checkpoint file is set, the parameters and the state of the method are saved to it every checkpoint period epochs,
+/// and the training can later resume from the last checkpoint, as if it had not been interrupted.
+/// The training history of the results only contains the epochs performed after resuming.
 
 QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training()
 {
@@ -1882,7 +2137,7 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
    // Data set
 
-   const size_t selection_instances_number = loss_index_pointer->get_data_set_pointer()->get_instances().get_selection_instances_number();
+   const size_t selection_instances_number = loss_index_pointer->sum_MPI(loss_index_pointer->get_data_set_pointer()->get_instances().get_selection_instances_number());
 
    // Neural network stuff
 
@@ -1907,9 +2162,20 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
    Vector<double> old_gradient(parameters_number);
    double gradient_norm;
 
-   Matrix<double> inverse_Hessian(parameters_number, parameters_number);
+   Matrix<double> inverse_Hessian;
    Matrix<double> old_inverse_Hessian;
 
+   LimitedMemoryInverseHessian limited_memory_inverse_Hessian;
+
+   if(inverse_Hessian_approximation_method == LBFGS)
+   {
+       limited_memory_inverse_Hessian.set(parameters_number, limited_memory_size);
+   }
+   else
+   {
+       inverse_Hessian.set(parameters_number, parameters_number);
+   }
+
    double selection_error = 0.0;
    double old_selection_error = 0.0;
 
@@ -2035,9 +2301,51 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
    time(&beginning_time);
    double elapsed_time;
 
+   // Checkpoint, from which the training resumes with the state it had at the end of an epoch
+
+   TrainingCheckpoint checkpoint;
+
+   size_t first_epoch = 0;
+
+   if(load_checkpoint(checkpoint))
+   {
+       first_epoch = checkpoint.get_epoch();
+
+       neural_network_pointer->set_parameters(checkpoint.get_vector("parameters"));
+
+       old_parameters = checkpoint.get_vector("old_parameters");
+       old_gradient = checkpoint.get_vector("old_gradient");
+       old_training_loss = checkpoint.get_scalar("old_training_loss");
+       old_selection_error = checkpoint.get_scalar("old_selection_error");
+       old_training_rate = checkpoint.get_scalar("old_training_rate");
+
+       directional_point = checkpoint.get_vector("directional_point");
+
+       if(inverse_Hessian_approximation_method == LBFGS)
+       {
+           limited_memory_inverse_Hessian.parameters_differences = checkpoint.get_matrix("parameters_differences");
+           limited_memory_inverse_Hessian.gradient_differences = checkpoint.get_matrix("gradient_differences");
+           limited_memory_inverse_Hessian.rhos = checkpoint.get_vector("rhos");
+           limited_memory_inverse_Hessian.pairs_number = checkpoint.get_integer("pairs_number");
+           limited_memory_inverse_Hessian.last_pair_index = checkpoint.get_integer("last_pair_index");
+       }
+       else
+       {
+           inverse_Hessian = checkpoint.get_matrix("inverse_Hessian");
+       }
+
+       minimum_selection_error_parameters = checkpoint.get_vector("minimum_selection_error_parameters");
+       minimum_selection_error = checkpoint.get_scalar("minimum_selection_error");
+       selection_failures = checkpoint.get_integer("selection_failures");
+
+       beginning_time -= static_cast<time_t>(checkpoint.get_scalar("elapsed_time"));
+
+       if(display) cout << "Resuming training from epoch " << first_epoch << " of " << checkpoint_file_name << ".\n";
+   }
+
    // Main loop 
 
-   for(size_t epoch = 0; epoch < maximum_epochs_number; epoch++)
+   for(size_t epoch = first_epoch; epoch < maximum_epochs_number; epoch++)
    {
        // Neural network
 
@@ -2052,9 +2360,11 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
        // Loss index stuff
 
+       const LossIndex::FirstOrderError first_order_loss = loss_index_pointer->calculate_training_first_order_loss();
+
        if(epoch == 0)
        {
-           training_loss = loss_index_pointer->calculate_training_loss();
+           training_loss = first_order_loss.error;
            training_loss_decrease = 0.0;
        }
        else
@@ -2082,7 +2392,7 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
            minimum_selection_error_parameters = neural_network_pointer->get_parameters();
        }
 
-       gradient = loss_index_pointer->calculate_training_loss_gradient();
+       gradient = first_order_loss.gradient;
 
        gradient_norm = gradient.calculate_L2_norm();
 
@@ -2095,7 +2405,18 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
        ||(old_parameters - parameters).calculate_absolute_value() < numeric_limits<double>::min()
        ||(old_gradient - gradient).calculate_absolute_value() < numeric_limits<double>::min())
        {
-           inverse_Hessian.initialize_identity();
+           if(inverse_Hessian_approximation_method == LBFGS)
+           {
+               limited_memory_inverse_Hessian.reset();
+           }
+           else
+           {
+               inverse_Hessian.initialize_identity();
+           }
+       }
+       else if(inverse_Hessian_approximation_method == LBFGS)
+       {
+           limited_memory_inverse_Hessian.update(old_parameters, parameters, old_gradient, gradient);
        }
        else
        {
@@ -2144,6 +2465,9 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
                  inverse_Hessian.update_BFGS_inverse_Hessian(old_parameters, parameters, old_gradient, gradient);
               }
               break;
+
+              case LBFGS:
+              break;
            }
 
            old_parameters.set();
@@ -2154,7 +2478,14 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
        // Training algorithm
 
-       training_direction = calculate_training_direction(gradient, inverse_Hessian);
+       if(inverse_Hessian_approximation_method == LBFGS)
+       {
+           training_direction = calculate_training_direction(gradient, limited_memory_inverse_Hessian);
+       }
+       else
+       {
+           training_direction = calculate_training_direction(gradient, inverse_Hessian);
+       }
 
        // Calculate loss training slope
 
@@ -2203,25 +2534,33 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
        // Training history
 
-       if(reserve_parameters_history) results_pointer->parameters_history[epoch] = parameters;
+       if(reserve_parameters_history) results_pointer->parameters_history[epoch - first_epoch] = parameters;
+
+       if(parameters_history_sink) parameters_history_sink->record(epoch, parameters);
 
-       if(reserve_parameters_norm_history) results_pointer->parameters_norm_history[epoch] = parameters_norm;
+       if(reserve_parameters_norm_history) results_pointer->parameters_norm_history[epoch - first_epoch] = parameters_norm;
 
-       if(reserve_loss_history) results_pointer->loss_history[epoch] = training_loss;
+       if(reserve_loss_history) results_pointer->loss_history[epoch - first_epoch] = training_loss;
 
-       if(reserve_selection_error_history) results_pointer->selection_error_history[epoch] = selection_error;
+       if(reserve_selection_error_history) results_pointer->selection_error_history[epoch - first_epoch] = selection_error;
 
-       if(reserve_gradient_history) results_pointer->gradient_history[epoch] = gradient;
+       if(reserve_gradient_history) results_pointer->gradient_history[epoch - first_epoch] = gradient;
 
-       if(reserve_gradient_norm_history) results_pointer->gradient_norm_history[epoch] = gradient_norm;
+       if(gradient_history_sink) gradient_history_sink->record(epoch, gradient);
 
-       if(reserve_inverse_Hessian_history) results_pointer->inverse_Hessian_history[epoch] = inverse_Hessian;
+       if(reserve_gradient_norm_history) results_pointer->gradient_norm_history[epoch - first_epoch] = gradient_norm;
 
-       if(reserve_training_direction_history) results_pointer->training_direction_history[epoch] = training_direction;
+       if(reserve_inverse_Hessian_history && inverse_Hessian_approximation_method != LBFGS) results_pointer->inverse_Hessian_history[epoch - first_epoch] = inverse_Hessian;
 
-       if(reserve_training_rate_history) results_pointer->training_rate_history[epoch] = training_rate;
+       if(Hessian_approximation_history_sink && inverse_Hessian_approximation_method != LBFGS) Hessian_approximation_history_sink->record(epoch, inverse_Hessian);
 
-       if(reserve_elapsed_time_history) results_pointer->elapsed_time_history[epoch] = elapsed_time;
+       if(reserve_training_direction_history) results_pointer->training_direction_history[epoch - first_epoch] = training_direction;
+
+       if(training_direction_history_sink) training_direction_history_sink->record(epoch, training_direction);
+
+       if(reserve_training_rate_history) results_pointer->training_rate_history[epoch - first_epoch] = training_rate;
+
+       if(reserve_elapsed_time_history) results_pointer->elapsed_time_history[epoch - first_epoch] = elapsed_time;
 
        // Stopping Criteria
 
@@ -2328,7 +2667,7 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
            results_pointer->epochs_number = epoch;
 
-           results_pointer->resize_training_history(epoch+1);
+           results_pointer->resize_training_history(1 + epoch - first_epoch);
 
            if(display)
            {
@@ -2384,9 +2723,52 @@ QuasiNewtonMethod::QuasiNewtonMethodResults* QuasiNewtonMethod::perform_training
 
        neural_network_pointer->set_parameters(parameters);
 
+       // Checkpoint
+
+       if(!stop_training && is_checkpoint_epoch(epoch))
+       {
+           checkpoint.set();
+
+           checkpoint.set_training_algorithm_type(write_training_algorithm_type());
+           checkpoint.set_epoch(epoch+1);
+
+           checkpoint.set_vector("parameters", parameters);
+
+           checkpoint.set_vector("old_parameters", old_parameters);
+           checkpoint.set_vector("old_gradient", old_gradient);
+           checkpoint.set_scalar("old_training_loss", old_training_loss);
+           checkpoint.set_scalar("old_selection_error", old_selection_error);
+           checkpoint.set_scalar("old_training_rate", old_training_rate);
+
+           checkpoint.set_vector("directional_point", directional_point);
+
+           if(inverse_Hessian_approximation_method == LBFGS)
+           {
+               checkpoint.set_matrix("parameters_differences", limited_memory_inverse_Hessian.parameters_differences);
+               checkpoint.set_matrix("gradient_differences", limited_memory_inverse_Hessian.gradient_differences);
+               checkpoint.set_vector("rhos", limited_memory_inverse_Hessian.rhos);
+               checkpoint.set_integer("pairs_number", limited_memory_inverse_Hessian.pairs_number);
+               checkpoint.set_integer("last_pair_index", limited_memory_inverse_Hessian.last_pair_index);
+           }
+           else
+           {
+               checkpoint.set_matrix("inverse_Hessian", inverse_Hessian);
+           }
+
+           checkpoint.set_vector("minimum_selection_error_parameters", minimum_selection_error_parameters);
+           checkpoint.set_scalar("minimum_selection_error", minimum_selection_error);
+           checkpoint.set_integer("selection_failures", selection_failures);
+
+           checkpoint.set_scalar("elapsed_time", elapsed_time);
+
+           save_checkpoint(checkpoint);
+       }
+
        if(stop_training) break;
     }
 
+   wait_checkpoint();
+
    if(return_minimum_selection_error_neural_network)
    {
        parameters = minimum_selection_error_parameters;
@@ -2481,6 +2863,18 @@ tinyxml2::XMLDocument* QuasiNewtonMethod::to_XML() const
        element->LinkEndChild(text);
    }
 
+   // Limited memory size
+   {
+       element = document->NewElement("LimitedMemorySize");
+       root_element->LinkEndChild(element);
+
+       buffer.str("");
+       buffer << limited_memory_size;
+
+       text = document->NewText(buffer.str().c_str());
+       element->LinkEndChild(text);
+   }
+
 
    // Training rate algorithm
    {
@@ -2874,6 +3268,17 @@ void QuasiNewtonMethod::write_XML(tinyxml2::XMLPrinter& file_stream) const
 
     file_stream.CloseElement();
 
+    // Limited memory size
+
+    file_stream.OpenElement("LimitedMemorySize");
+
+    buffer.str("");
+    buffer << limited_memory_size;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
     // Training rate algorithm
 
     training_rate_algorithm.write_XML(file_stream);
@@ -3057,6 +3462,18 @@ Matrix<string> QuasiNewtonMethod::to_string_matrix() const
 
     values.push_back(inverse_Hessian_approximation_method_string);
 
+    // Limited memory size
+
+    if(inverse_Hessian_approximation_method == LBFGS)
+    {
+        labels.push_back("Limited memory size");
+
+        buffer.str("");
+        buffer << limited_memory_size;
+
+        values.push_back(buffer.str());
+    }
+
    // Training rate method
 
    labels.push_back("Training rate method");
@@ -3297,6 +3714,25 @@ void QuasiNewtonMethod::from_XML(const tinyxml2::XMLDocument& document)
        }
    }
 
+   // Limited memory size
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("LimitedMemorySize");
+
+       if(element)
+       {
+          const size_t new_limited_memory_size = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_limited_memory_size(new_limited_memory_size);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
 
    // Training rate algorithm
    {
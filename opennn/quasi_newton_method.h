@@ -56,7 +56,7 @@ public:
 
    /// Enumeration of the available training operators for obtaining the approximation to the inverse Hessian.
 
-   enum InverseHessianApproximationMethod{DFP, BFGS};
+   enum InverseHessianApproximationMethod{DFP, BFGS, LBFGS};
 
 
    // DEFAULT CONSTRUCTOR
@@ -78,6 +78,51 @@ public:
 
    // STRUCTURES
 
+   ///
+   /// This structure contains the last pairs of parameters and gradient differences used by the limited-memory BFGS method.
+   /// The product of the inverse Hessian approximation with a vector is obtained from them by the two-loop recursion,
+   /// so the inverse Hessian matrix is never formed.
+   ///
+
+   struct LimitedMemoryInverseHessian
+   {
+       /// Sets the storage for a number of parameters and a number of difference pairs, and clears the stored pairs.
+
+       void set(const size_t&, const size_t&);
+
+       /// Removes all the stored pairs, so that the approximation becomes the identity.
+
+       void reset();
+
+       /// Stores the pair of differences between two points, replacing the oldest pair if the storage is full.
+
+       void update(const Vector<double>&, const Vector<double>&, const Vector<double>&, const Vector<double>&);
+
+       /// Returns the product of the inverse Hessian approximation with a vector.
+
+       Vector<double> dot(const Vector<double>&) const;
+
+       /// Parameters differences, one per column.
+
+       Matrix<double> parameters_differences;
+
+       /// Gradient differences, one per column.
+
+       Matrix<double> gradient_differences;
+
+       /// Inverses of the dot products between the parameters and the gradient differences.
+
+       Vector<double> rhos;
+
+       /// Number of stored pairs.
+
+       size_t pairs_number = 0;
+
+       /// Column of the most recent pair.
+
+       size_t last_pair_index = 0;
+   };
+
    ///
    /// This structure contains the training results for the quasi-Newton method. 
    ///
@@ -222,6 +267,8 @@ public:
    const InverseHessianApproximationMethod& get_inverse_Hessian_approximation_method() const;
    string write_inverse_Hessian_approximation_method() const;
 
+   const size_t& get_limited_memory_size() const;
+
    // Training parameters
 
    const double& get_warning_parameters_norm() const;
@@ -271,6 +318,8 @@ public:
    void set_inverse_Hessian_approximation_method(const InverseHessianApproximationMethod&);
    void set_inverse_Hessian_approximation_method(const string&);
 
+   void set_limited_memory_size(const size_t&);
+
    void set_display(const bool&);
 
    void set_default();
@@ -339,6 +388,7 @@ public:
 #endif
 
    Vector<double> calculate_training_direction(const Vector<double>&, const Matrix<double>&) const;
+   Vector<double> calculate_training_direction(const Vector<double>&, const LimitedMemoryInverseHessian&) const;
 
    QuasiNewtonMethodResults* perform_training();
    void perform_training_void();
@@ -373,6 +423,10 @@ private:
 
    InverseHessianApproximationMethod inverse_Hessian_approximation_method;
 
+   /// Number of pairs of parameters and gradient differences kept by the limited-memory BFGS method.
+
+   size_t limited_memory_size;
+
 
    /// Value for the parameters norm at which a warning message is written to the screen. 
 
@@ -461,6 +515,7 @@ private:
    bool reserve_gradient_norm_history;
 
    /// True if the inverse Hessian history vector of matrices is to be reserved, false otherwise.
+   /// The limited-memory BFGS method does not form the inverse Hessian, so this history is left empty with it.
 
    bool reserve_inverse_Hessian_history;
 
@@ -1011,6 +1011,11 @@ RandomSearch::RandomSearchResults* RandomSearch::perform_training()
          results_pointer->parameters_history[iteration] = parameters;
       }
 
+      if(parameters_history_sink)
+      {
+         parameters_history_sink->record(iteration, parameters);
+      }
+
       if(reserve_parameters_norm_history)
       {
          results_pointer->parameters_norm_history[iteration] = parameters_norm;
@@ -1035,6 +1040,11 @@ RandomSearch::RandomSearchResults* RandomSearch::perform_training()
          results_pointer->training_direction_history[iteration] = training_direction;
       }
 
+      if(training_direction_history_sink)
+      {
+         training_direction_history_sink->record(iteration, training_direction);
+      }
+
       if(reserve_training_rate_history)
       {
          results_pointer->training_rate_history[iteration] = training_rate;
@@ -0,0 +1,972 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   S I N G L E   P R E C I S I O N   E N G I N E   C L A S S                                                  */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "single_precision_engine.h"
+
+namespace OpenNN
+{
+
+/// Default constructor.
+/// It creates a single precision engine not associated to any neural network or data set.
+
+SinglePrecisionEngine::SinglePrecisionEngine()
+{
+}
+
+
+/// Neural network and data set constructor.
+/// It creates a single precision engine for a neural network and a data set,
+/// and copies the parameters, the scaling and the training data in float.
+/// @param new_neural_network_pointer Pointer to a neural network object.
+/// @param new_data_set_pointer Pointer to a data set object. It might be null if the engine is only used for inference.
+
+SinglePrecisionEngine::SinglePrecisionEngine(NeuralNetwork* new_neural_network_pointer, DataSet* new_data_set_pointer)
+{
+    set(new_neural_network_pointer, new_data_set_pointer);
+}
+
+
+/// Destructor.
+
+SinglePrecisionEngine::~SinglePrecisionEngine()
+{
+}
+
+
+/// Returns a pointer to the neural network which is run in single precision.
+
+NeuralNetwork* SinglePrecisionEngine::get_neural_network_pointer() const
+{
+    return neural_network_pointer;
+}
+
+
+/// Returns a pointer to the data set used for training.
+
+DataSet* SinglePrecisionEngine::get_data_set_pointer() const
+{
+    return data_set_pointer;
+}
+
+
+/// Returns the method used for updating the parameters.
+
+const SinglePrecisionEngine::OptimizationMethod& SinglePrecisionEngine::get_optimization_method() const
+{
+    return optimization_method;
+}
+
+
+/// Returns a string with the name of the method used for updating the parameters.
+
+string SinglePrecisionEngine::write_optimization_method() const
+{
+    switch(optimization_method)
+    {
+        case StochasticGradientDescent:
+        {
+            return "STOCHASTIC_GRADIENT_DESCENT";
+        }
+
+        case Adam:
+        {
+            return "ADAM";
+        }
+    }
+
+    return string();
+}
+
+
+/// Returns true if the updates are accumulated in double master parameters, and false if they are applied to the float parameters.
+
+const bool& SinglePrecisionEngine::get_double_master_parameters() const
+{
+    return double_master_parameters;
+}
+
+
+/// Returns the learning rate.
+
+const double& SinglePrecisionEngine::get_learning_rate() const
+{
+    return learning_rate;
+}
+
+
+/// Returns the momentum of stochastic gradient descent, which is also the first moment decay rate of Adam.
+
+const double& SinglePrecisionEngine::get_momentum() const
+{
+    return momentum;
+}
+
+
+/// Returns the number of instances in each training batch.
+
+const size_t& SinglePrecisionEngine::get_batch_size() const
+{
+    return batch_size;
+}
+
+
+/// Returns the number of passes over the training instances.
+
+const size_t& SinglePrecisionEngine::get_epochs_number() const
+{
+    return epochs_number;
+}
+
+
+/// Returns the float parameters of the multilayer perceptron.
+
+const Vector<float>& SinglePrecisionEngine::get_parameters() const
+{
+    return parameters;
+}
+
+
+/// Sets the neural network and the data set of this engine,
+/// and copies the parameters, the scaling and the training data in float.
+/// @param new_neural_network_pointer Pointer to a neural network object.
+/// @param new_data_set_pointer Pointer to a data set object. It might be null if the engine is only used for inference.
+
+void SinglePrecisionEngine::set(NeuralNetwork* new_neural_network_pointer, DataSet* new_data_set_pointer)
+{
+    neural_network_pointer = new_neural_network_pointer;
+    data_set_pointer = new_data_set_pointer;
+
+    update_parameters();
+    update_scaling();
+
+    if(data_set_pointer)
+    {
+        update_data();
+    }
+}
+
+
+/// Sets a new method for updating the parameters.
+/// @param new_optimization_method Optimization method.
+
+void SinglePrecisionEngine::set_optimization_method(const OptimizationMethod& new_optimization_method)
+{
+    optimization_method = new_optimization_method;
+}
+
+
+/// Sets a new method for updating the parameters from a string.
+/// @param new_optimization_method Name of the optimization method ("STOCHASTIC_GRADIENT_DESCENT" or "ADAM").
+
+void SinglePrecisionEngine::set_optimization_method(const string& new_optimization_method)
+{
+    if(new_optimization_method == "STOCHASTIC_GRADIENT_DESCENT")
+    {
+        optimization_method = StochasticGradientDescent;
+    }
+    else if(new_optimization_method == "ADAM")
+    {
+        optimization_method = Adam;
+    }
+    else
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SinglePrecisionEngine class.\n"
+               << "void set_optimization_method(const string&) method.\n"
+               << "Unknown optimization method: " << new_optimization_method << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+
+/// Sets whether the updates are accumulated in double master parameters.
+/// @param new_double_master_parameters True to keep master parameters in double, false to update the float parameters directly.
+
+void SinglePrecisionEngine::set_double_master_parameters(const bool& new_double_master_parameters)
+{
+    double_master_parameters = new_double_master_parameters;
+}
+
+
+/// Sets a new learning rate.
+/// @param new_learning_rate Learning rate. It must be greater than zero.
+
+void SinglePrecisionEngine::set_learning_rate(const double& new_learning_rate)
+{
+    #ifdef __OPENNN_DEBUG__
+
+    if(new_learning_rate <= 0.0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SinglePrecisionEngine class.\n"
+               << "void set_learning_rate(const double&) method.\n"
+               << "Learning rate must be greater than zero.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    learning_rate = new_learning_rate;
+}
+
+
+/// Sets a new momentum, which is also the first moment decay rate of Adam.
+/// @param new_momentum Momentum. It must be in the interval [0, 1).
+
+void SinglePrecisionEngine::set_momentum(const double& new_momentum)
+{
+    #ifdef __OPENNN_DEBUG__
+
+    if(new_momentum < 0.0 || new_momentum >= 1.0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SinglePrecisionEngine class.\n"
+               << "void set_momentum(const double&) method.\n"
+               << "Momentum must be in the interval [0, 1).\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    momentum = new_momentum;
+}
+
+
+/// Sets a new number of instances in each training batch.
+/// @param new_batch_size Batch size. It must be greater than zero.
+
+void SinglePrecisionEngine::set_batch_size(const size_t& new_batch_size)
+{
+    #ifdef __OPENNN_DEBUG__
+
+    if(new_batch_size == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SinglePrecisionEngine class.\n"
+               << "void set_batch_size(const size_t&) method.\n"
+               << "Batch size must be greater than zero.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    batch_size = new_batch_size;
+}
+
+
+/// Sets a new number of passes over the training instances.
+/// @param new_epochs_number Number of epochs.
+
+void SinglePrecisionEngine::set_epochs_number(const size_t& new_epochs_number)
+{
+    epochs_number = new_epochs_number;
+}
+
+
+/// Seeds the random number generator used for shuffling the training instances.
+/// @param new_seed Seed of the random number generator.
+
+void SinglePrecisionEngine::set_seed(const unsigned& new_seed)
+{
+    generator.seed(new_seed);
+}
+
+
+/// Sets new float parameters for the multilayer perceptron.
+/// The parameters of the neural network are not modified until write_parameters() is called.
+/// @param new_parameters Parameters, with the same layout as MultilayerPerceptron::get_parameters().
+
+void SinglePrecisionEngine::set_parameters(const Vector<float>& new_parameters)
+{
+    #ifdef __OPENNN_DEBUG__
+
+    if(new_parameters.size() != parameters.size())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SinglePrecisionEngine class.\n"
+               << "void set_parameters(const Vector<float>&) method.\n"
+               << "Size of parameters (" << new_parameters.size() << ") must be equal to number of parameters (" << parameters.size() << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    parameters = new_parameters;
+}
+
+
+/// Copies the architecture, the activation functions and the parameters of the multilayer perceptron in float.
+
+void SinglePrecisionEngine::update_parameters()
+{
+    if(!neural_network_pointer || !neural_network_pointer->has_multilayer_perceptron())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SinglePrecisionEngine class.\n"
+               << "void update_parameters() method.\n"
+               << "Neural network must have a multilayer perceptron.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    architecture = multilayer_perceptron_pointer->get_architecture();
+
+    layers_activation_function = multilayer_perceptron_pointer->get_layers_activation_function();
+
+    const Vector<double> new_parameters = multilayer_perceptron_pointer->get_parameters();
+
+    parameters.set(new_parameters.size());
+
+    transform(new_parameters.begin(), new_parameters.end(), parameters.begin(), [](const double& value){return static_cast<float>(value);});
+}
+
+
+/// Converts the scaling and unscaling layers of the neural network into per variable affine transformations in float.
+/// The principal components, probabilistic and bounding layers are not supported in single precision.
+
+void SinglePrecisionEngine::update_scaling()
+{
+    if(neural_network_pointer->has_principal_components_layer()
+    || neural_network_pointer->has_probabilistic_layer()
+    || neural_network_pointer->has_bounding_layer())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SinglePrecisionEngine class.\n"
+               << "void update_scaling() method.\n"
+               << "Principal components, probabilistic and bounding layers are not supported in single precision.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    const size_t inputs_number = architecture[0];
+    const size_t outputs_number = architecture[architecture.size()-1];
+
+    // Scaling layer
+
+    scaling_slopes.set(inputs_number, 1.0f);
+    scaling_intercepts.set(inputs_number, 0.0f);
+
+    if(neural_network_pointer->has_scaling_layer())
+    {
+        const ScalingLayer* scaling_layer_pointer = neural_network_pointer->get_scaling_layer_pointer();
+
+        const Vector< Statistics<double> > statistics = scaling_layer_pointer->get_statistics();
+        const Vector<ScalingLayer::ScalingMethod> scaling_methods = scaling_layer_pointer->get_scaling_methods();
+
+        for(size_t i = 0; i < inputs_number; i++)
+        {
+            const double range = statistics[i].maximum - statistics[i].minimum;
+
+            if(scaling_methods[i] == ScalingLayer::MinimumMaximum && range >= numeric_limits<double>::min())
+            {
+                scaling_slopes[i] = static_cast<float>(2.0/range);
+                scaling_intercepts[i] = static_cast<float>(-2.0*statistics[i].minimum/range - 1.0);
+            }
+            else if(scaling_methods[i] == ScalingLayer::MeanStandardDeviation && statistics[i].standard_deviation >= numeric_limits<double>::min())
+            {
+                scaling_slopes[i] = static_cast<float>(1.0/statistics[i].standard_deviation);
+                scaling_intercepts[i] = static_cast<float>(-statistics[i].mean/statistics[i].standard_deviation);
+            }
+            else if(scaling_methods[i] == ScalingLayer::StandardDeviation && statistics[i].standard_deviation >= numeric_limits<double>::min())
+            {
+                scaling_slopes[i] = static_cast<float>(1.0/statistics[i].standard_deviation);
+            }
+        }
+    }
+
+    // Unscaling layer
+
+    unscaling_slopes.set(outputs_number, 1.0f);
+    unscaling_intercepts.set(outputs_number, 0.0f);
+
+    logarithmic_unscaling = false;
+
+    if(neural_network_pointer->has_unscaling_layer())
+    {
+        const UnscalingLayer* unscaling_layer_pointer = neural_network_pointer->get_unscaling_layer_pointer();
+
+        const Vector< Statistics<double> > statistics = unscaling_layer_pointer->get_statistics();
+        const UnscalingLayer::UnscalingMethod unscaling_method = unscaling_layer_pointer->get_unscaling_method();
+
+        logarithmic_unscaling = (unscaling_method == UnscalingLayer::Logarithmic);
+
+        for(size_t i = 0; i < outputs_number; i++)
+        {
+            const double range = statistics[i].maximum - statistics[i].minimum;
+
+            switch(unscaling_method)
+            {
+                case UnscalingLayer::MinimumMaximum:
+                {
+                    unscaling_slopes[i] = range < numeric_limits<double>::min() ? 0.0f : static_cast<float>(0.5*range);
+                    unscaling_intercepts[i] = range < numeric_limits<double>::min() ? 0.0f : static_cast<float>(0.5*range + statistics[i].minimum);
+                }
+                break;
+
+                case UnscalingLayer::MeanStandardDeviation:
+                {
+                    const bool constant = statistics[i].standard_deviation < numeric_limits<double>::min();
+
+                    unscaling_slopes[i] = constant ? 0.0f : static_cast<float>(statistics[i].standard_deviation);
+                    unscaling_intercepts[i] = constant ? 0.0f : static_cast<float>(statistics[i].mean);
+                }
+                break;
+
+                case UnscalingLayer::Logarithmic:
+                {
+                    unscaling_slopes[i] = range < numeric_limits<double>::min() ? 0.0f : static_cast<float>(0.5*range);
+                    unscaling_intercepts[i] = range < numeric_limits<double>::min() ? 0.0f : static_cast<float>(statistics[i].minimum);
+                }
+                break;
+
+                case UnscalingLayer::NoUnscaling:
+                {
+                    // Do nothing
+                }
+                break;
+            }
+        }
+    }
+}
+
+
+/// Copies the inputs and targets of the training instances of the data set in float.
+
+void SinglePrecisionEngine::update_data()
+{
+    const Matrix<double>& data = data_set_pointer->get_data();
+
+    const Vector<size_t> training_indices = data_set_pointer->get_instances().get_training_indices();
+
+    const Vector<size_t> inputs_indices = data_set_pointer->get_variables().get_inputs_indices();
+    const Vector<size_t> targets_indices = data_set_pointer->get_variables().get_targets_indices();
+
+    const size_t training_instances_number = training_indices.size();
+
+    training_inputs.set(training_instances_number, inputs_indices.size());
+    training_targets.set(training_instances_number, targets_indices.size());
+
+    for(size_t j = 0; j < inputs_indices.size(); j++)
+    {
+        for(size_t i = 0; i < training_instances_number; i++)
+        {
+            training_inputs(i,j) = static_cast<float>(data(training_indices[i], inputs_indices[j]));
+        }
+    }
+
+    for(size_t j = 0; j < targets_indices.size(); j++)
+    {
+        for(size_t i = 0; i < training_instances_number; i++)
+        {
+            training_targets(i,j) = static_cast<float>(data(training_indices[i], targets_indices[j]));
+        }
+    }
+}
+
+
+/// Writes the float parameters back into the multilayer perceptron of the neural network.
+
+void SinglePrecisionEngine::write_parameters() const
+{
+    Vector<double> new_parameters(parameters.size());
+
+    transform(parameters.begin(), parameters.end(), new_parameters.begin(), [](const float& value){return static_cast<double>(value);});
+
+    neural_network_pointer->get_multilayer_perceptron_pointer()->set_parameters(new_parameters);
+}
+
+
+/// Calculates the outputs of the multilayer perceptron in float for a batch of inputs, which are not scaled.
+/// @param inputs Matrix of inputs, with one row for each instance.
+
+Matrix<float> SinglePrecisionEngine::calculate_multilayer_perceptron_outputs(const Matrix<float>& inputs) const
+{
+    const size_t instances_number = inputs.get_rows_number();
+    const size_t layers_number = architecture.size()-1;
+
+    #ifdef __OPENNN_DEBUG__
+
+    if(inputs.get_columns_number() != architecture[0])
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SinglePrecisionEngine class.\n"
+               << "Matrix<float> calculate_multilayer_perceptron_outputs(const Matrix<float>&) const method.\n"
+               << "Number of columns of inputs must be equal to number of inputs.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    #endif
+
+    Matrix<float> outputs(inputs);
+
+    Vector<float> biases;
+
+    size_t index = 0;
+
+    for(size_t i = 0; i < layers_number; i++)
+    {
+        const size_t layer_inputs_number = architecture[i];
+        const size_t perceptrons_number = architecture[i+1];
+
+        const Eigen::Map<Eigen::MatrixXf> inputs_eigen(outputs.data(), instances_number, layer_inputs_number);
+        const Eigen::Map<Eigen::MatrixXf> synaptic_weights_eigen((float*)parameters.data() + index, layer_inputs_number, perceptrons_number);
+
+        Matrix<float> layer_outputs(instances_number, perceptrons_number);
+
+        Eigen::Map<Eigen::MatrixXf> layer_outputs_eigen(layer_outputs.data(), instances_number, perceptrons_number);
+
+        layer_outputs_eigen.noalias() = inputs_eigen*synaptic_weights_eigen;
+
+        index += layer_inputs_number*perceptrons_number;
+
+        biases.assign(parameters.begin() + static_cast<long>(index), parameters.begin() + static_cast<long>(index + perceptrons_number));
+
+        index += perceptrons_number;
+
+        PerceptronLayer::calculate_activations(layers_activation_function[i], biases, layer_outputs);
+
+        outputs = layer_outputs;
+    }
+
+    return outputs;
+}
+
+
+/// Calculates the outputs of the neural network in float for a batch of inputs.
+/// The inputs are scaled, propagated through the multilayer perceptron, and the outputs are unscaled.
+/// @param inputs Matrix of inputs, with one row for each instance.
+
+Matrix<float> SinglePrecisionEngine::calculate_outputs(const Matrix<float>& inputs) const
+{
+    const size_t instances_number = inputs.get_rows_number();
+    const size_t inputs_number = inputs.get_columns_number();
+
+    Matrix<float> scaled_inputs(instances_number, inputs_number);
+
+    for(size_t j = 0; j < inputs_number; j++)
+    {
+        for(size_t i = 0; i < instances_number; i++)
+        {
+            scaled_inputs(i,j) = scaling_slopes[j]*inputs(i,j) + scaling_intercepts[j];
+        }
+    }
+
+    Matrix<float> outputs = calculate_multilayer_perceptron_outputs(scaled_inputs);
+
+    const size_t outputs_number = outputs.get_columns_number();
+
+    for(size_t j = 0; j < outputs_number; j++)
+    {
+        for(size_t i = 0; i < instances_number; i++)
+        {
+            const float output = logarithmic_unscaling ? exp(outputs(i,j) - 1.0f) : outputs(i,j);
+
+            outputs(i,j) = unscaling_slopes[j]*output + unscaling_intercepts[j];
+        }
+    }
+
+    return outputs;
+}
+
+
+/// Returns the mean squared error of the multilayer perceptron in float for a batch of inputs and targets.
+/// @param inputs Matrix of inputs, with one row for each instance.
+/// @param targets Matrix of targets, with one row for each instance.
+
+float SinglePrecisionEngine::calculate_error(const Matrix<float>& inputs, const Matrix<float>& targets) const
+{
+    const Matrix<float> outputs = calculate_multilayer_perceptron_outputs(inputs);
+
+    const size_t instances_number = outputs.get_rows_number();
+
+    if(instances_number == 0) return 0.0f;
+
+    double sum_squared_error = 0.0;
+
+    for(size_t i = 0; i < outputs.size(); i++)
+    {
+        const double error = static_cast<double>(outputs[i] - targets[i]);
+
+        sum_squared_error += error*error;
+    }
+
+    return static_cast<float>(sum_squared_error/static_cast<double>(instances_number));
+}
+
+
+/// Returns the mean squared error of the multilayer perceptron in float on the training instances.
+
+float SinglePrecisionEngine::calculate_training_error() const
+{
+    return calculate_error(training_inputs, training_targets);
+}
+
+
+/// Propagates a batch forward and backward through the multilayer perceptron in float,
+/// and calculates the gradient of the mean squared error with respect to the parameters.
+/// The buffers of this object are reused between batches.
+/// @param inputs Matrix of inputs of the batch.
+/// @param targets Matrix of targets of the batch.
+/// @param gradient Vector where the gradient is written.
+/// @return Mean squared error of the batch.
+
+float SinglePrecisionEngine::calculate_batch_error_gradient(const Matrix<float>& inputs, const Matrix<float>& targets, Vector<float>& gradient)
+{
+    const size_t instances_number = inputs.get_rows_number();
+    const size_t layers_number = architecture.size()-1;
+
+    if(layers_combinations.size() != layers_number)
+    {
+        layers_combinations.set(layers_number);
+        layers_activations.set(layers_number);
+        layers_activation_derivatives.set(layers_number);
+        layers_delta.set(layers_number);
+        layers_biases.set(layers_number);
+    }
+
+    if(gradient.size() != parameters.size())
+    {
+        gradient.set(parameters.size());
+    }
+
+    Vector<size_t> layers_parameters_index(layers_number);
+
+    // Forward propagation
+
+    size_t index = 0;
+
+    for(size_t i = 0; i < layers_number; i++)
+    {
+        const size_t layer_inputs_number = architecture[i];
+        const size_t perceptrons_number = architecture[i+1];
+
+        const Matrix<float>& layer_inputs = i == 0 ? inputs : layers_activations[i-1];
+
+        Matrix<float>& combinations = layers_combinations[i];
+
+        if(combinations.get_rows_number() != instances_number || combinations.get_columns_number() != perceptrons_number)
+        {
+            combinations.set(instances_number, perceptrons_number);
+        }
+
+        layers_parameters_index[i] = index;
+
+        const Eigen::Map<Eigen::MatrixXf> inputs_eigen((float*)layer_inputs.data(), instances_number, layer_inputs_number);
+        const Eigen::Map<Eigen::MatrixXf> synaptic_weights_eigen(parameters.data() + index, layer_inputs_number, perceptrons_number);
+
+        Eigen::Map<Eigen::MatrixXf> combinations_eigen(combinations.data(), instances_number, perceptrons_number);
+
+        combinations_eigen.noalias() = inputs_eigen*synaptic_weights_eigen;
+
+        index += layer_inputs_number*perceptrons_number;
+
+        Vector<float>& biases = layers_biases[i];
+
+        biases.assign(parameters.begin() + static_cast<long>(index), parameters.begin() + static_cast<long>(index + perceptrons_number));
+
+        index += perceptrons_number;
+
+        PerceptronLayer::calculate_first_order_activations(layers_activation_function[i], biases,
+                                                           combinations, layers_activations[i], layers_activation_derivatives[i]);
+    }
+
+    // Output gradient of the mean squared error
+
+    const Matrix<float>& outputs = layers_activations[layers_number-1];
+
+    Matrix<float>& output_delta = layers_delta[layers_number-1];
+
+    if(output_delta.get_rows_number() != instances_number || output_delta.get_columns_number() != outputs.get_columns_number())
+    {
+        output_delta.set(instances_number, outputs.get_columns_number());
+    }
+
+    const float coefficient = 2.0f/static_cast<float>(instances_number);
+
+    double sum_squared_error = 0.0;
+
+    for(size_t i = 0; i < outputs.size(); i++)
+    {
+        const float error = outputs[i] - targets[i];
+
+        sum_squared_error += static_cast<double>(error)*static_cast<double>(error);
+
+        output_delta[i] = coefficient*error*layers_activation_derivatives[layers_number-1][i];
+    }
+
+    // Back propagation
+
+    for(size_t i = layers_number-1; i > 0; i--)
+    {
+        const size_t perceptrons_number = architecture[i];
+        const size_t next_perceptrons_number = architecture[i+1];
+
+        Matrix<float>& layer_delta = layers_delta[i-1];
+
+        if(layer_delta.get_rows_number() != instances_number || layer_delta.get_columns_number() != perceptrons_number)
+        {
+            layer_delta.set(instances_number, perceptrons_number);
+        }
+
+        const Eigen::Map<Eigen::MatrixXf> next_layer_delta_eigen(layers_delta[i].data(), instances_number, next_perceptrons_number);
+        const Eigen::Map<Eigen::MatrixXf> synaptic_weights_eigen(parameters.data() + layers_parameters_index[i], perceptrons_number, next_perceptrons_number);
+        const Eigen::Map<Eigen::MatrixXf> activation_derivatives_eigen(layers_activation_derivatives[i-1].data(), instances_number, perceptrons_number);
+
+        Eigen::Map<Eigen::MatrixXf> layer_delta_eigen(layer_delta.data(), instances_number, perceptrons_number);
+
+        layer_delta_eigen.noalias() = next_layer_delta_eigen*synaptic_weights_eigen.transpose();
+
+        layer_delta_eigen.array() *= activation_derivatives_eigen.array();
+    }
+
+    // Gradient
+
+    for(size_t i = 0; i < layers_number; i++)
+    {
+        const size_t layer_inputs_number = architecture[i];
+        const size_t perceptrons_number = architecture[i+1];
+
+        const Matrix<float>& layer_inputs = i == 0 ? inputs : layers_activations[i-1];
+
+        const Eigen::Map<Eigen::MatrixXf> inputs_eigen((float*)layer_inputs.data(), instances_number, layer_inputs_number);
+        const Eigen::Map<Eigen::MatrixXf> layer_delta_eigen(layers_delta[i].data(), instances_number, perceptrons_number);
+
+        Eigen::Map<Eigen::MatrixXf> synaptic_weights_gradient_eigen(gradient.data() + layers_parameters_index[i], layer_inputs_number, perceptrons_number);
+        Eigen::Map<Eigen::VectorXf> biases_gradient_eigen(gradient.data() + layers_parameters_index[i] + layer_inputs_number*perceptrons_number, perceptrons_number);
+
+        synaptic_weights_gradient_eigen.noalias() = inputs_eigen.transpose()*layer_delta_eigen;
+
+        biases_gradient_eigen.noalias() = layer_delta_eigen.colwise().sum().transpose();
+    }
+
+    return static_cast<float>(sum_squared_error/static_cast<double>(instances_number));
+}
+
+
+/// Applies one update of the optimization method to a set of parameters.
+/// @param updated_parameters Parameters to be updated, either the double master parameters or the float parameters.
+/// @param first_moment Velocity for stochastic gradient descent, or first moment estimate for Adam.
+/// @param second_moment Second moment estimate for Adam.
+/// @param gradient Gradient of the batch, in float.
+/// @param iteration Number of the update, starting at one.
+
+template<class T>
+void SinglePrecisionEngine::apply_optimization_step(Vector<T>& updated_parameters,
+                                                      Vector<T>& first_moment,
+                                                      Vector<T>& second_moment,
+                                                      const Vector<float>& gradient,
+                                                      const size_t& iteration)
+{
+    const size_t parameters_number = updated_parameters.size();
+
+    const T rate = static_cast<T>(learning_rate);
+    const T beta_1 = static_cast<T>(momentum);
+
+    switch(optimization_method)
+    {
+        case StochasticGradientDescent:
+        {
+            for(size_t i = 0; i < parameters_number; i++)
+            {
+                first_moment[i] = beta_1*first_moment[i] - rate*static_cast<T>(gradient[i]);
+
+                updated_parameters[i] += first_moment[i];
+            }
+        }
+        break;
+
+        case Adam:
+        {
+            const T beta_2 = static_cast<T>(0.999);
+            const T epsilon = static_cast<T>(1.0e-7);
+
+            const T first_correction = static_cast<T>(1.0 - pow(momentum, static_cast<double>(iteration)));
+            const T second_correction = static_cast<T>(1.0 - pow(0.999, static_cast<double>(iteration)));
+
+            for(size_t i = 0; i < parameters_number; i++)
+            {
+                const T parameter_gradient = static_cast<T>(gradient[i]);
+
+                first_moment[i] = beta_1*first_moment[i] + (T(1) - beta_1)*parameter_gradient;
+                second_moment[i] = beta_2*second_moment[i] + (T(1) - beta_2)*parameter_gradient*parameter_gradient;
+
+                updated_parameters[i] -= rate*(first_moment[i]/first_correction)/(sqrt(second_moment[i]/second_correction) + epsilon);
+            }
+        }
+        break;
+    }
+}
+
+
+/// Trains the multilayer perceptron in float with mini-batches of shuffled training instances.
+/// The parameters, the scaling and the training data are first copied from the neural network and the data set,
+/// and the trained parameters are written back into the neural network at the end.
+/// Each epoch goes through all the training instances, so the last batch is smaller when their number is not a multiple of the batch size.
+/// @return Mean squared error on the training instances after training.
+
+double SinglePrecisionEngine::perform_training()
+{
+    update_parameters();
+    update_data();
+
+    const size_t training_instances_number = training_inputs.get_rows_number();
+
+    if(training_instances_number == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SinglePrecisionEngine class.\n"
+               << "double perform_training() method.\n"
+               << "Number of training instances is zero.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    const size_t parameters_number = parameters.size();
+
+    const size_t instances_per_batch = min(batch_size, training_instances_number);
+
+    const size_t batches_number = (training_instances_number + instances_per_batch - 1)/instances_per_batch;
+
+    Vector<size_t> indices(0, 1, training_instances_number-1);
+
+    Vector<float> gradient(parameters_number);
+
+    Vector<double> master_parameters;
+    Vector<double> master_first_moment;
+    Vector<double> master_second_moment;
+
+    Vector<float> first_moment;
+    Vector<float> second_moment;
+
+    if(double_master_parameters)
+    {
+        master_parameters.set(parameters_number);
+
+        transform(parameters.begin(), parameters.end(), master_parameters.begin(), [](const float& value){return static_cast<double>(value);});
+
+        master_first_moment.set(parameters_number, 0.0);
+        master_second_moment.set(parameters_number, 0.0);
+    }
+    else
+    {
+        first_moment.set(parameters_number, 0.0f);
+        second_moment.set(parameters_number, 0.0f);
+    }
+
+    size_t iteration = 0;
+
+    for(size_t epoch = 0; epoch < epochs_number; epoch++)
+    {
+        shuffle(indices.begin(), indices.end(), generator);
+
+        for(size_t batch = 0; batch < batches_number; batch++)
+        {
+            const size_t first = batch*instances_per_batch;
+
+            // The last batch takes the remaining instances
+
+            gather_batch(indices, first, min(instances_per_batch, training_instances_number - first));
+
+            calculate_batch_error_gradient(batch_inputs, batch_targets, gradient);
+
+            iteration++;
+
+            if(double_master_parameters)
+            {
+                apply_optimization_step(master_parameters, master_first_moment, master_second_moment, gradient, iteration);
+
+                transform(master_parameters.begin(), master_parameters.end(), parameters.begin(), [](const double& value){return static_cast<float>(value);});
+            }
+            else
+            {
+                apply_optimization_step(parameters, first_moment, second_moment, gradient, iteration);
+            }
+        }
+    }
+
+    write_parameters();
+
+    return static_cast<double>(calculate_training_error());
+}
+
+
+/// Copies the training inputs and targets of a range of shuffled instances into the batch buffers.
+/// @param indices Shuffled indices of the training instances.
+/// @param first Position of the first instance of the batch in the indices vector.
+/// @param instances_number Number of instances in the batch.
+
+void SinglePrecisionEngine::gather_batch(const Vector<size_t>& indices, const size_t& first, const size_t& instances_number)
+{
+    const size_t inputs_number = training_inputs.get_columns_number();
+    const size_t targets_number = training_targets.get_columns_number();
+
+    if(batch_inputs.get_rows_number() != instances_number || batch_inputs.get_columns_number() != inputs_number)
+    {
+        batch_inputs.set(instances_number, inputs_number);
+        batch_targets.set(instances_number, targets_number);
+    }
+
+    for(size_t j = 0; j < inputs_number; j++)
+    {
+        for(size_t i = 0; i < instances_number; i++)
+        {
+            batch_inputs(i,j) = training_inputs(indices[first+i], j);
+        }
+    }
+
+    for(size_t j = 0; j < targets_number; j++)
+    {
+        for(size_t i = 0; i < instances_number; i++)
+        {
+            batch_targets(i,j) = training_targets(indices[first+i], j);
+        }
+    }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
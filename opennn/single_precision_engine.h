@@ -0,0 +1,241 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   S I N G L E   P R E C I S I O N   E N G I N E   C L A S S   H E A D E R                                    */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __SINGLEPRECISIONENGINE_H__
+#define __SINGLEPRECISIONENGINE_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <cmath>
+#include <ctime>
+#include <random>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+
+#include "data_set.h"
+#include "neural_network.h"
+
+namespace OpenNN
+{
+
+///
+/// This class runs a neural network in single precision.
+/// It keeps a float copy of the parameters of the multilayer perceptron, of the scaling and unscaling layers,
+/// and of the training data, so that inference (scaling, multilayer perceptron and unscaling) and
+/// mini-batch training with the mean squared error are computed in float.
+/// The master parameters used for the updates can optionally be kept in double.
+///
+
+class SinglePrecisionEngine
+{
+
+public:
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit SinglePrecisionEngine();
+
+    // NEURAL NETWORK AND DATA SET CONSTRUCTOR
+
+    explicit SinglePrecisionEngine(NeuralNetwork*, DataSet*);
+
+    // DESTRUCTOR
+
+    virtual ~SinglePrecisionEngine();
+
+    // ENUMERATIONS
+
+    /// Enumeration of the available methods for updating the parameters.
+
+    enum OptimizationMethod{StochasticGradientDescent, Adam};
+
+    // Get methods
+
+    NeuralNetwork* get_neural_network_pointer() const;
+    DataSet* get_data_set_pointer() const;
+
+    const OptimizationMethod& get_optimization_method() const;
+    string write_optimization_method() const;
+
+    const bool& get_double_master_parameters() const;
+
+    const double& get_learning_rate() const;
+    const double& get_momentum() const;
+
+    const size_t& get_batch_size() const;
+    const size_t& get_epochs_number() const;
+
+    const Vector<float>& get_parameters() const;
+
+    // Set methods
+
+    void set(NeuralNetwork*, DataSet*);
+
+    void set_optimization_method(const OptimizationMethod&);
+    void set_optimization_method(const string&);
+
+    void set_double_master_parameters(const bool&);
+
+    void set_learning_rate(const double&);
+    void set_momentum(const double&);
+
+    void set_batch_size(const size_t&);
+    void set_epochs_number(const size_t&);
+
+    void set_seed(const unsigned&);
+
+    void set_parameters(const Vector<float>&);
+
+    // Synchronization methods
+
+    void update_parameters();
+    void update_scaling();
+    void update_data();
+
+    void write_parameters() const;
+
+    // Operation methods
+
+    Matrix<float> calculate_multilayer_perceptron_outputs(const Matrix<float>&) const;
+
+    Matrix<float> calculate_outputs(const Matrix<float>&) const;
+
+    float calculate_error(const Matrix<float>&, const Matrix<float>&) const;
+
+    float calculate_training_error() const;
+
+    float calculate_batch_error_gradient(const Matrix<float>&, const Matrix<float>&, Vector<float>&);
+
+    // Training methods
+
+    double perform_training();
+
+private:
+
+    template<class T>
+    void apply_optimization_step(Vector<T>&, Vector<T>&, Vector<T>&, const Vector<float>&, const size_t&);
+
+    void gather_batch(const Vector<size_t>&, const size_t&, const size_t&);
+
+    // MEMBERS
+
+    /// Pointer to the neural network which is run in single precision.
+
+    NeuralNetwork* neural_network_pointer = nullptr;
+
+    /// Pointer to the data set used for training.
+
+    DataSet* data_set_pointer = nullptr;
+
+    /// Architecture of the multilayer perceptron.
+
+    Vector<size_t> architecture;
+
+    /// Activation function of each layer of the multilayer perceptron.
+
+    Vector<PerceptronLayer::ActivationFunction> layers_activation_function;
+
+    /// Parameters of the multilayer perceptron in float, with the same layout as MultilayerPerceptron::get_parameters().
+
+    Vector<float> parameters;
+
+    /// Slopes and intercepts of the affine transformation of the scaling layer.
+
+    Vector<float> scaling_slopes;
+    Vector<float> scaling_intercepts;
+
+    /// Slopes and intercepts of the affine transformation of the unscaling layer.
+
+    Vector<float> unscaling_slopes;
+    Vector<float> unscaling_intercepts;
+
+    /// True if the unscaling layer uses the logarithmic method.
+
+    bool logarithmic_unscaling = false;
+
+    /// Training inputs and targets in float.
+
+    Matrix<float> training_inputs;
+    Matrix<float> training_targets;
+
+    /// Method used for updating the parameters.
+
+    OptimizationMethod optimization_method = StochasticGradientDescent;
+
+    /// True if the updates are accumulated in double master parameters.
+
+    bool double_master_parameters = true;
+
+    /// Learning rate.
+
+    double learning_rate = 0.01;
+
+    /// Momentum for stochastic gradient descent, or first moment decay for Adam.
+
+    double momentum = 0.9;
+
+    /// Number of instances in each batch.
+
+    size_t batch_size = 1000;
+
+    /// Number of passes over the training instances.
+
+    size_t epochs_number = 100;
+
+    /// Random number generator used for shuffling the training instances.
+
+    mt19937 generator;
+
+    // Buffers
+
+    Matrix<float> batch_inputs;
+    Matrix<float> batch_targets;
+
+    Vector< Matrix<float> > layers_combinations;
+    Vector< Matrix<float> > layers_activations;
+    Vector< Matrix<float> > layers_activation_derivatives;
+    Vector< Matrix<float> > layers_delta;
+
+    Vector< Vector<float> > layers_biases;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,873 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   S P A T I A L   I N D E X   C L A S S                                                                      */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "spatial_index.h"
+
+namespace OpenNN
+{
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates an empty spatial index.
+
+SpatialIndex::SpatialIndex()
+{
+    set();
+}
+
+
+// POINTS CONSTRUCTOR
+
+/// Points constructor.
+/// It builds the index of the rows of a matrix, with unit weights.
+/// @param new_points Matrix whose rows are the points to be indexed.
+/// @param new_distance_method Distance between points.
+
+SpatialIndex::SpatialIndex(const Matrix<double>& new_points, const DistanceMethod& new_distance_method)
+{
+    leaf_size = 16;
+
+    search_method = Automatic;
+
+    set(new_points, new_distance_method);
+}
+
+
+// WEIGHTED POINTS CONSTRUCTOR
+
+/// Weighted points constructor.
+/// It builds the index of the rows of a matrix, with a weight for each column in the distance.
+/// @param new_points Matrix whose rows are the points to be indexed.
+/// @param new_weights Weight of each column.
+/// @param new_distance_method Distance between points.
+
+SpatialIndex::SpatialIndex(const Matrix<double>& new_points, const Vector<double>& new_weights, const DistanceMethod& new_distance_method)
+{
+    leaf_size = 16;
+
+    search_method = Automatic;
+
+    set(new_points, new_weights, new_distance_method);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+SpatialIndex::~SpatialIndex()
+{
+}
+
+
+// METHODS
+
+/// Returns the number of indexed points.
+
+size_t SpatialIndex::get_points_number() const
+{
+    return(points_number);
+}
+
+
+/// Returns the number of coordinates of the indexed points.
+
+size_t SpatialIndex::get_dimensions_number() const
+{
+    return(dimensions_number);
+}
+
+
+/// Returns the weight of each dimension in the distance.
+
+const Vector<double>& SpatialIndex::get_weights() const
+{
+    return(weights);
+}
+
+
+/// Returns the distance between points used by this index.
+
+const SpatialIndex::DistanceMethod& SpatialIndex::get_distance_method() const
+{
+    return(distance_method);
+}
+
+
+/// Returns the maximum number of points in a leaf of the tree.
+
+const size_t& SpatialIndex::get_leaf_size() const
+{
+    return(leaf_size);
+}
+
+
+/// Returns the method for searching the neighbors of a batch of queries.
+
+const SpatialIndex::SearchMethod& SpatialIndex::get_search_method() const
+{
+    return(search_method);
+}
+
+
+/// Returns true if the queries compare the query point with every indexed point,
+/// which happens when some weight is negative.
+
+bool SpatialIndex::is_exhaustive() const
+{
+    return(exhaustive);
+}
+
+
+/// Returns true if a batch of queries is compared with all the points in blocks instead of searching the tree.
+/// The automatic method does so for more than one Euclidean query when the tree would prune few points,
+/// that is, with negative weights or with at least 16 dimensions.
+/// @param queries_number Number of queries in the batch.
+
+bool SpatialIndex::is_brute_force(const size_t& queries_number) const
+{
+    if(search_method == Tree)
+    {
+        return(false);
+    }
+    else if(search_method == BruteForce)
+    {
+        return(true);
+    }
+
+    return(queries_number > 1 && distance_method == Euclidean && (exhaustive || dimensions_number >= 16));
+}
+
+
+/// Sets an empty spatial index.
+
+void SpatialIndex::set()
+{
+    points_number = 0;
+    dimensions_number = 0;
+
+    points.set();
+    points_indices.set();
+    weights.set();
+
+    distance_method = Euclidean;
+
+    leaf_size = 16;
+
+    search_method = Automatic;
+
+    exhaustive = false;
+
+    nodes.clear();
+}
+
+
+/// Builds the index of the rows of a matrix, with unit weights.
+/// @param new_points Matrix whose rows are the points to be indexed.
+/// @param new_distance_method Distance between points.
+
+void SpatialIndex::set(const Matrix<double>& new_points, const DistanceMethod& new_distance_method)
+{
+    set(new_points, Vector<double>(new_points.get_columns_number(), 1.0), new_distance_method);
+}
+
+
+/// Builds the index of the rows of a matrix, with a weight for each column in the distance.
+/// The Euclidean distance is the square root of the weighted sum of squared differences,
+/// and the Manhattan distance is the weighted sum of absolute differences.
+/// @param new_points Matrix whose rows are the points to be indexed.
+/// @param new_weights Weight of each column.
+/// @param new_distance_method Distance between points.
+
+void SpatialIndex::set(const Matrix<double>& new_points, const Vector<double>& new_weights, const DistanceMethod& new_distance_method)
+{
+    // Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+    if(new_weights.size() != new_points.get_columns_number())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SpatialIndex class.\n"
+               << "void set(const Matrix<double>&, const Vector<double>&, const DistanceMethod&) method.\n"
+               << "Size of weights(" << new_weights.size() << ") must be equal to number of columns(" << new_points.get_columns_number() << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    points_number = new_points.get_rows_number();
+    dimensions_number = new_points.get_columns_number();
+
+    weights = new_weights;
+
+    distance_method = new_distance_method;
+
+    exhaustive = false;
+
+    for(size_t j = 0; j < dimensions_number; j++)
+    {
+        if(weights[j] < 0.0)
+        {
+            exhaustive = true;
+        }
+    }
+
+    // The points are reordered while the tree is built, and then stored by rows in that order
+
+    points_indices.set(points_number);
+    points_indices.initialize_sequential();
+
+    nodes.clear();
+
+    if(points_number != 0)
+    {
+        build_node(points_indices, new_points, 0, points_number);
+    }
+
+    points.set(points_number*dimensions_number);
+
+    for(size_t i = 0; i < points_number; i++)
+    {
+        for(size_t j = 0; j < dimensions_number; j++)
+        {
+            points[i*dimensions_number + j] = new_points(points_indices[i], j);
+        }
+    }
+}
+
+
+/// Sets the maximum number of points in a leaf of the tree, and rebuilds the tree.
+/// Small leaves prune more points, while large leaves make fewer recursive calls.
+/// @param new_leaf_size Maximum number of points in a leaf. It must be greater than zero.
+
+void SpatialIndex::set_leaf_size(const size_t& new_leaf_size)
+{
+    // Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+    if(new_leaf_size == 0)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SpatialIndex class.\n"
+               << "void set_leaf_size(const size_t&) method.\n"
+               << "Leaf size must be greater than zero.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    leaf_size = new_leaf_size;
+
+    build();
+}
+
+
+/// Sets the method for searching the neighbors of a batch of queries.
+/// The tree and the brute force methods return the same neighbors, except for rounding differences in the distances.
+/// @param new_search_method Search method.
+
+void SpatialIndex::set_search_method(const SearchMethod& new_search_method)
+{
+    search_method = new_search_method;
+}
+
+
+/// Returns the k nearest indexed points to a single query point.
+/// The result has a single row. If k is greater than the number of points, all of them are returned.
+/// @param query Coordinates of the query point.
+/// @param k Number of neighbors.
+
+SpatialIndex::Neighbors SpatialIndex::calculate_k_nearest_neighbors(const Vector<double>& query, const size_t& k) const
+{
+    // Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+    if(query.size() != dimensions_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SpatialIndex class.\n"
+               << "Neighbors calculate_k_nearest_neighbors(const Vector<double>&, const size_t&) const method.\n"
+               << "Size of query(" << query.size() << ") must be equal to number of dimensions(" << dimensions_number << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const size_t neighbors_number = min(k, points_number);
+
+    Neighbors neighbors;
+
+    neighbors.distances.set(1, neighbors_number);
+    neighbors.indices.set(1, neighbors_number);
+
+    vector< pair<double, size_t> > heap;
+
+    search(query.data(), neighbors_number, points_number, heap);
+
+    set_neighbors(heap, 0, neighbors);
+
+    return(neighbors);
+}
+
+
+/// Returns the k nearest indexed points to each row of a matrix of query points.
+/// The queries are independent, and they are distributed among the available threads.
+/// @param queries Matrix whose rows are the query points.
+/// @param k Number of neighbors.
+
+SpatialIndex::Neighbors SpatialIndex::calculate_k_nearest_neighbors(const Matrix<double>& queries, const size_t& k) const
+{
+    // Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+    if(queries.get_columns_number() != dimensions_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SpatialIndex class.\n"
+               << "Neighbors calculate_k_nearest_neighbors(const Matrix<double>&, const size_t&) const method.\n"
+               << "Number of columns(" << queries.get_columns_number() << ") must be equal to number of dimensions(" << dimensions_number << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const size_t queries_number = queries.get_rows_number();
+
+    if(is_brute_force(queries_number))
+    {
+        return(calculate_k_nearest_neighbors_brute_force(queries, k));
+    }
+
+    const size_t neighbors_number = min(k, points_number);
+
+    Neighbors neighbors;
+
+    neighbors.distances.set(queries_number, neighbors_number);
+    neighbors.indices.set(queries_number, neighbors_number);
+
+    #pragma omp parallel for schedule(dynamic, 16)
+
+    for(int i = 0; i < static_cast<int>(queries_number); i++)
+    {
+        const size_t query_index = static_cast<size_t>(i);
+
+        vector<double> query(dimensions_number);
+
+        for(size_t j = 0; j < dimensions_number; j++)
+        {
+            query[j] = queries(query_index, j);
+        }
+
+        vector< pair<double, size_t> > heap;
+
+        search(query.data(), neighbors_number, points_number, heap);
+
+        set_neighbors(heap, query_index, neighbors);
+    }
+
+    return(neighbors);
+}
+
+
+/// Returns the k nearest neighbors of every indexed point, excluding the point itself.
+/// Row i of the result corresponds to row i of the indexed points.
+/// @param k Number of neighbors.
+
+SpatialIndex::Neighbors SpatialIndex::calculate_k_nearest_neighbors(const size_t& k) const
+{
+    const size_t neighbors_number = points_number == 0 ? 0 : min(k, points_number-1);
+
+    Neighbors neighbors;
+
+    neighbors.distances.set(points_number, neighbors_number);
+    neighbors.indices.set(points_number, neighbors_number);
+
+    if(is_brute_force(points_number))
+    {
+        Matrix<double> original_points(points_number, dimensions_number);
+
+        for(size_t i = 0; i < points_number; i++)
+        {
+            for(size_t j = 0; j < dimensions_number; j++)
+            {
+                original_points(points_indices[i], j) = points[i*dimensions_number + j];
+            }
+        }
+
+        search_brute_force(original_points, neighbors_number, true, neighbors);
+
+        return(neighbors);
+    }
+
+    #pragma omp parallel for schedule(dynamic, 16)
+
+    for(int i = 0; i < static_cast<int>(points_number); i++)
+    {
+        const size_t position = static_cast<size_t>(i);
+
+        vector< pair<double, size_t> > heap;
+
+        search(points.data() + position*dimensions_number, neighbors_number, points_indices[position], heap);
+
+        set_neighbors(heap, points_indices[position], neighbors);
+    }
+
+    return(neighbors);
+}
+
+
+/// Returns the k nearest indexed points to each row of a matrix of query points, comparing each query with all the points.
+/// It does not use the tree, and it is faster than the tree search when the points have many dimensions.
+/// @param queries Matrix whose rows are the query points.
+/// @param k Number of neighbors.
+
+SpatialIndex::Neighbors SpatialIndex::calculate_k_nearest_neighbors_brute_force(const Matrix<double>& queries, const size_t& k) const
+{
+    // Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+    if(queries.get_columns_number() != dimensions_number)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: SpatialIndex class.\n"
+               << "Neighbors calculate_k_nearest_neighbors_brute_force(const Matrix<double>&, const size_t&) const method.\n"
+               << "Number of columns(" << queries.get_columns_number() << ") must be equal to number of dimensions(" << dimensions_number << ").\n";
+
+        throw logic_error(buffer.str());
+    }
+
+#endif
+
+    const size_t queries_number = queries.get_rows_number();
+
+    const size_t neighbors_number = min(k, points_number);
+
+    Neighbors neighbors;
+
+    neighbors.distances.set(queries_number, neighbors_number);
+    neighbors.indices.set(queries_number, neighbors_number);
+
+    search_brute_force(queries, neighbors_number, false, neighbors);
+
+    return(neighbors);
+}
+
+
+/// Rebuilds the tree on the points already stored in this index.
+
+void SpatialIndex::build()
+{
+    if(points_number == 0)
+    {
+        return;
+    }
+
+    Matrix<double> original_points(points_number, dimensions_number);
+
+    for(size_t i = 0; i < points_number; i++)
+    {
+        for(size_t j = 0; j < dimensions_number; j++)
+        {
+            original_points(points_indices[i], j) = points[i*dimensions_number + j];
+        }
+    }
+
+    set(original_points, weights, distance_method);
+}
+
+
+/// Builds the node of a range of points, and recursively its children.
+/// The dimension with the largest weighted spread is split at its median,
+/// so that both children have about the same number of points.
+/// Returns the index of the new node.
+/// @param order Rows of the points, reordered in place.
+/// @param original_points Matrix whose rows are the points.
+/// @param begin Position of the first point of the node in the order.
+/// @param end Position past the last point of the node in the order.
+
+size_t SpatialIndex::build_node(Vector<size_t>& order, const Matrix<double>& original_points, const size_t& begin, const size_t& end)
+{
+    const size_t node_index = nodes.size();
+
+    nodes.push_back(Node());
+
+    nodes[node_index].begin = begin;
+    nodes[node_index].end = end;
+
+    if(exhaustive || end - begin <= leaf_size)
+    {
+        return(node_index);
+    }
+
+    size_t split_dimension = 0;
+    double maximum_spread = 0.0;
+
+    for(size_t j = 0; j < dimensions_number; j++)
+    {
+        double minimum = numeric_limits<double>::max();
+        double maximum = -numeric_limits<double>::max();
+
+        for(size_t i = begin; i < end; i++)
+        {
+            const double value = original_points(order[i], j);
+
+            minimum = min(minimum, value);
+            maximum = max(maximum, value);
+        }
+
+        const double spread = weights[j]*(maximum - minimum);
+
+        if(spread > maximum_spread)
+        {
+            maximum_spread = spread;
+            split_dimension = j;
+        }
+    }
+
+    if(maximum_spread <= 0.0)
+    {
+        return(node_index);
+    }
+
+    const size_t middle = begin + (end - begin)/2;
+
+    nth_element(order.begin() + static_cast<long>(begin), order.begin() + static_cast<long>(middle), order.begin() + static_cast<long>(end),
+                [&](const size_t& first, const size_t& second)
+                {
+                    return(original_points(first, split_dimension) < original_points(second, split_dimension));
+                });
+
+    const double split_value = original_points(order[middle], split_dimension);
+
+    const size_t left = build_node(order, original_points, begin, middle);
+    const size_t right = build_node(order, original_points, middle, end);
+
+    nodes[node_index].split_dimension = split_dimension;
+    nodes[node_index].split_value = split_value;
+    nodes[node_index].left = left;
+    nodes[node_index].right = right;
+
+    return(node_index);
+}
+
+
+/// Returns the distance between two points without the final square root of the Euclidean distance,
+/// which preserves the order of the distances.
+/// @param first Coordinates of the first point.
+/// @param second Coordinates of the second point.
+
+double SpatialIndex::calculate_reduced_distance(const double* first, const double* second) const
+{
+    double distance = 0.0;
+
+    if(distance_method == Euclidean)
+    {
+        for(size_t j = 0; j < dimensions_number; j++)
+        {
+            const double difference = first[j] - second[j];
+
+            distance += weights[j]*difference*difference;
+        }
+    }
+    else
+    {
+        for(size_t j = 0; j < dimensions_number; j++)
+        {
+            distance += weights[j]*fabs(first[j] - second[j]);
+        }
+    }
+
+    return(distance);
+}
+
+
+/// Searches the neighbors of a query point in a node and its children.
+/// The heap keeps the best candidates found so far, with the worst one on top.
+/// The lower bound of the distance to the node is the sum of its offsets in each dimension,
+/// and the far child is visited only if its own bound can improve the candidates.
+/// @param node_index Index of the node.
+/// @param query Coordinates of the query point.
+/// @param k Number of neighbors.
+/// @param excluded_index Row of a point which is not a candidate.
+/// @param node_distance Lower bound of the reduced distance from the query point to the points of the node.
+/// @param offsets Contribution of each dimension to that lower bound.
+/// @param heap Best candidates, as pairs of reduced distance and row.
+
+void SpatialIndex::search_node(const size_t& node_index,
+                               const double* query,
+                               const size_t& k,
+                               const size_t& excluded_index,
+                               const double& node_distance,
+                               Vector<double>& offsets,
+                               vector< pair<double, size_t> >& heap) const
+{
+    const Node& node = nodes[node_index];
+
+    if(node.left == 0)
+    {
+        for(size_t i = node.begin; i < node.end; i++)
+        {
+            if(points_indices[i] == excluded_index)
+            {
+                continue;
+            }
+
+            const pair<double, size_t> candidate(calculate_reduced_distance(query, points.data() + i*dimensions_number), points_indices[i]);
+
+            insert_candidate(candidate, k, heap);
+        }
+
+        return;
+    }
+
+    const double difference = query[node.split_dimension] - node.split_value;
+
+    const size_t near_child = difference < 0.0 ? node.left : node.right;
+    const size_t far_child = difference < 0.0 ? node.right : node.left;
+
+    search_node(near_child, query, k, excluded_index, node_distance, offsets, heap);
+
+    const double old_offset = offsets[node.split_dimension];
+
+    const double new_offset = distance_method == Euclidean
+            ? weights[node.split_dimension]*difference*difference
+            : weights[node.split_dimension]*fabs(difference);
+
+    const double far_distance = node_distance - old_offset + new_offset;
+
+    if(heap.size() < k || far_distance <= heap.front().first)
+    {
+        offsets[node.split_dimension] = new_offset;
+
+        search_node(far_child, query, k, excluded_index, far_distance, offsets, heap);
+
+        offsets[node.split_dimension] = old_offset;
+    }
+}
+
+
+/// Searches the k nearest indexed points to a query point.
+/// Ties in the distance are broken by the row of the points, so that the result does not depend on the tree.
+/// @param query Coordinates of the query point.
+/// @param k Number of neighbors.
+/// @param excluded_index Row of a point which is not a candidate, or the number of points to exclude none.
+/// @param heap Neighbors found, as pairs of reduced distance and row.
+
+void SpatialIndex::search(const double* query, const size_t& k, const size_t& excluded_index, vector< pair<double, size_t> >& heap) const
+{
+    heap.clear();
+
+    if(k == 0 || nodes.empty())
+    {
+        return;
+    }
+
+    heap.reserve(k);
+
+    Vector<double> offsets(dimensions_number, 0.0);
+
+    search_node(0, query, k, excluded_index, 0.0, offsets, heap);
+}
+
+
+/// Searches the k nearest indexed points to each query point by comparing it with all the points.
+/// The queries are processed in blocks, which are distributed among the available threads,
+/// and each block is compared with blocks of points.
+/// The weighted Euclidean distances of a block come from a matrix product, as the weighted squared norms
+/// of the queries and of the points minus twice their weighted inner products.
+/// @param queries Matrix whose rows are the query points.
+/// @param k Number of neighbors. It must not be greater than the number of candidates of each query.
+/// @param excluding_queries True if the queries are the indexed points, and each one is not a candidate of itself.
+/// @param neighbors Neighbors structure, with a row for each query and k columns.
+
+void SpatialIndex::search_brute_force(const Matrix<double>& queries, const size_t& k, const bool& excluding_queries, Neighbors& neighbors) const
+{
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMajorMatrix;
+
+    const size_t queries_number = queries.get_rows_number();
+
+    if(k == 0 || queries_number == 0)
+    {
+        return;
+    }
+
+    const size_t queries_block_size = 64;
+    const size_t points_block_size = 1024;
+
+    const size_t blocks_number = (queries_number + queries_block_size - 1)/queries_block_size;
+
+    const Eigen::Index dimensions = static_cast<Eigen::Index>(dimensions_number);
+
+    const Eigen::Map<const Eigen::MatrixXd> queries_eigen(queries.data(), static_cast<Eigen::Index>(queries_number), dimensions);
+    const Eigen::Map<const RowMajorMatrix> points_eigen(points.data(), static_cast<Eigen::Index>(points_number), dimensions);
+    const Eigen::Map<const Eigen::VectorXd> weights_eigen(weights.data(), dimensions);
+
+    Eigen::VectorXd points_norms;
+
+    if(distance_method == Euclidean)
+    {
+        points_norms = points_eigen.cwiseAbs2()*weights_eigen;
+    }
+
+    #pragma omp parallel for schedule(dynamic)
+
+    for(int block = 0; block < static_cast<int>(blocks_number); block++)
+    {
+        const size_t first_query = static_cast<size_t>(block)*queries_block_size;
+        const size_t block_queries_number = min(queries_block_size, queries_number - first_query);
+
+        const RowMajorMatrix block_queries = queries_eigen.middleRows(static_cast<Eigen::Index>(first_query), static_cast<Eigen::Index>(block_queries_number));
+
+        RowMajorMatrix weighted_queries;
+        Eigen::VectorXd queries_norms;
+
+        if(distance_method == Euclidean)
+        {
+            weighted_queries = block_queries*weights_eigen.asDiagonal();
+            queries_norms = block_queries.cwiseProduct(weighted_queries).rowwise().sum();
+        }
+
+        vector< vector< pair<double, size_t> > > heaps(block_queries_number);
+
+        for(size_t i = 0; i < block_queries_number; i++)
+        {
+            heaps[i].reserve(k);
+        }
+
+        Eigen::MatrixXd products;
+
+        for(size_t first_point = 0; first_point < points_number; first_point += points_block_size)
+        {
+            const size_t block_points_number = min(points_block_size, points_number - first_point);
+
+            if(distance_method == Euclidean)
+            {
+                products.noalias() = weighted_queries*points_eigen.middleRows(static_cast<Eigen::Index>(first_point), static_cast<Eigen::Index>(block_points_number)).transpose();
+            }
+
+            for(size_t i = 0; i < block_queries_number; i++)
+            {
+                const size_t query_index = first_query + i;
+
+                for(size_t j = 0; j < block_points_number; j++)
+                {
+                    const size_t position = first_point + j;
+
+                    if(excluding_queries && points_indices[position] == query_index)
+                    {
+                        continue;
+                    }
+
+                    double distance;
+
+                    if(distance_method == Euclidean)
+                    {
+                        distance = queries_norms(static_cast<Eigen::Index>(i)) + points_norms(static_cast<Eigen::Index>(position))
+                                 - 2.0*products(static_cast<Eigen::Index>(i), static_cast<Eigen::Index>(j));
+
+                        if(!exhaustive && distance < 0.0)
+                        {
+                            distance = 0.0;
+                        }
+                    }
+                    else
+                    {
+                        distance = calculate_reduced_distance(block_queries.data() + i*dimensions_number, points.data() + position*dimensions_number);
+                    }
+
+                    insert_candidate(pair<double, size_t>(distance, points_indices[position]), k, heaps[i]);
+                }
+            }
+        }
+
+        for(size_t i = 0; i < block_queries_number; i++)
+        {
+            set_neighbors(heaps[i], first_query + i, neighbors);
+        }
+    }
+}
+
+
+/// Inserts a candidate in a heap of the best k candidates, with the worst one on top,
+/// if the heap is not full or the candidate is better than the worst one.
+/// @param candidate Pair of reduced distance and row of a point.
+/// @param k Number of neighbors.
+/// @param heap Best candidates.
+
+void SpatialIndex::insert_candidate(const pair<double, size_t>& candidate, const size_t& k, vector< pair<double, size_t> >& heap)
+{
+    if(heap.size() < k)
+    {
+        heap.push_back(candidate);
+        push_heap(heap.begin(), heap.end());
+    }
+    else if(candidate < heap.front())
+    {
+        pop_heap(heap.begin(), heap.end());
+        heap.back() = candidate;
+        push_heap(heap.begin(), heap.end());
+    }
+}
+
+
+/// Writes the neighbors found for a query point in a row of a neighbors structure, sorted by ascending distance.
+/// @param heap Neighbors found, as pairs of reduced distance and row.
+/// @param row Row of the neighbors structure.
+/// @param neighbors Neighbors structure.
+
+void SpatialIndex::set_neighbors(vector< pair<double, size_t> >& heap, const size_t& row, Neighbors& neighbors) const
+{
+    sort_heap(heap.begin(), heap.end());
+
+    for(size_t j = 0; j < heap.size(); j++)
+    {
+        neighbors.distances(row, j) = distance_method == Euclidean ? sqrt(heap[j].first) : heap[j].first;
+        neighbors.indices(row, j) = heap[j].second;
+    }
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
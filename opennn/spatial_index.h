@@ -0,0 +1,244 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   S P A T I A L   I N D E X   C L A S S   H E A D E R                                                        */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __SPATIALINDEX_H__
+#define __SPATIALINDEX_H__
+
+// System includes
+
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <limits>
+#include <stdexcept>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+
+namespace OpenNN
+{
+
+///
+/// This class answers k-nearest neighbors queries on a fixed set of points with a k-d tree.
+/// The tree is built once, and the distances are the weighted Euclidean or Manhattan distances
+/// used by the k-nearest neighbors model, with one weight per dimension.
+/// Batches of queries are processed in parallel. In many dimensions, where the tree prunes few points,
+/// they can also be compared with all the points in blocks, using matrix products for the Euclidean distance.
+///
+
+class SpatialIndex
+{
+
+public:
+
+    // ENUMERATIONS
+
+    /// Enumeration of available distances between points.
+
+    enum DistanceMethod{Euclidean, Manhattan};
+
+    /// Enumeration of available methods for searching the neighbors of a batch of queries.
+
+    enum SearchMethod{Automatic, Tree, BruteForce};
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit SpatialIndex();
+
+    // POINTS CONSTRUCTOR
+
+    explicit SpatialIndex(const Matrix<double>&, const DistanceMethod& = Euclidean);
+
+    // WEIGHTED POINTS CONSTRUCTOR
+
+    explicit SpatialIndex(const Matrix<double>&, const Vector<double>&, const DistanceMethod& = Euclidean);
+
+    // DESTRUCTOR
+
+    virtual ~SpatialIndex();
+
+    // STRUCTURES
+
+    ///
+    /// This structure contains the nearest neighbors of a set of query points.
+    /// Each row corresponds to a query point, and its neighbors are sorted by ascending distance.
+    ///
+
+    struct Neighbors
+    {
+        /// Distances from the query points to their neighbors.
+
+        Matrix<double> distances;
+
+        /// Indices of the neighbors, as rows of the indexed points.
+
+        Matrix<size_t> indices;
+    };
+
+    // METHODS
+
+    // Get methods
+
+    size_t get_points_number() const;
+    size_t get_dimensions_number() const;
+
+    const Vector<double>& get_weights() const;
+
+    const DistanceMethod& get_distance_method() const;
+
+    const size_t& get_leaf_size() const;
+
+    const SearchMethod& get_search_method() const;
+
+    bool is_exhaustive() const;
+    bool is_brute_force(const size_t&) const;
+
+    // Set methods
+
+    void set();
+    void set(const Matrix<double>&, const DistanceMethod& = Euclidean);
+    void set(const Matrix<double>&, const Vector<double>&, const DistanceMethod& = Euclidean);
+
+    void set_leaf_size(const size_t&);
+
+    void set_search_method(const SearchMethod&);
+
+    // Query methods
+
+    Neighbors calculate_k_nearest_neighbors(const Vector<double>&, const size_t&) const;
+    Neighbors calculate_k_nearest_neighbors(const Matrix<double>&, const size_t&) const;
+    Neighbors calculate_k_nearest_neighbors(const size_t&) const;
+
+    Neighbors calculate_k_nearest_neighbors_brute_force(const Matrix<double>&, const size_t&) const;
+
+private:
+
+    ///
+    /// Node of the k-d tree, which holds a contiguous range of the reordered points.
+    /// Leaves have no children, and the points of an inner node are split at a value of one dimension.
+    ///
+
+    struct Node
+    {
+        /// Position of the first point of the node.
+
+        size_t begin = 0;
+
+        /// Position past the last point of the node.
+
+        size_t end = 0;
+
+        /// Dimension in which the points are split.
+
+        size_t split_dimension = 0;
+
+        /// Coordinate at which the points are split.
+        /// The points of the left child are not greater than it, and those of the right child are not less.
+
+        double split_value = 0.0;
+
+        /// Index of the left child, or zero for a leaf.
+
+        size_t left = 0;
+
+        /// Index of the right child, or zero for a leaf.
+
+        size_t right = 0;
+    };
+
+    void build();
+
+    size_t build_node(Vector<size_t>&, const Matrix<double>&, const size_t&, const size_t&);
+
+    double calculate_reduced_distance(const double*, const double*) const;
+
+    void search_node(const size_t&, const double*, const size_t&, const size_t&, const double&, Vector<double>&, vector< pair<double, size_t> >&) const;
+
+    void search(const double*, const size_t&, const size_t&, vector< pair<double, size_t> >&) const;
+
+    void search_brute_force(const Matrix<double>&, const size_t&, const bool&, Neighbors&) const;
+
+    static void insert_candidate(const pair<double, size_t>&, const size_t&, vector< pair<double, size_t> >&);
+
+    void set_neighbors(vector< pair<double, size_t> >&, const size_t&, Neighbors&) const;
+
+    // MEMBERS
+
+    /// Number of indexed points.
+
+    size_t points_number;
+
+    /// Number of coordinates of each point.
+
+    size_t dimensions_number;
+
+    /// Coordinates of the points, stored by rows in the order of the tree leaves.
+
+    Vector<double> points;
+
+    /// Row of the original points matrix of each stored point.
+
+    Vector<size_t> points_indices;
+
+    /// Weight of each dimension in the distance.
+
+    Vector<double> weights;
+
+    /// Distance between points.
+
+    DistanceMethod distance_method;
+
+    /// Maximum number of points in a leaf.
+
+    size_t leaf_size;
+
+    /// Method for searching the neighbors of a batch of queries.
+
+    SearchMethod search_method;
+
+    /// True if the distance has negative weights, which invalidate the pruning bounds.
+    /// In that case the tree is a single leaf, and the queries are exhaustive.
+
+    bool exhaustive;
+
+    /// Nodes of the tree. The first one is the root.
+
+    vector<Node> nodes;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -196,6 +196,54 @@ const bool& StochasticGradientDescent::get_apply_early_stopping() const
 }
 
 
+/// Returns true if the training instances are shuffled at the beginning of each epoch, false otherwise.
+
+const bool& StochasticGradientDescent::get_shuffle() const
+{
+    return(shuffle);
+}
+
+
+/// Returns the number of consecutive training instances which are shuffled together.
+
+const size_t& StochasticGradientDescent::get_shuffle_block_size() const
+{
+    return(shuffle_block_size);
+}
+
+
+/// Returns the number of batches gathered on a background thread ahead of the batch being trained.
+
+const size_t& StochasticGradientDescent::get_prefetched_batches_number() const
+{
+    return(prefetched_batches_number);
+}
+
+
+/// Returns the seed of the random number generator used for shuffling the training instances.
+
+const unsigned& StochasticGradientDescent::get_shuffle_seed() const
+{
+    return(shuffle_seed);
+}
+
+
+/// Returns true if the selection error is calculated on a background thread while the next epoch is trained, and false otherwise.
+
+const bool& StochasticGradientDescent::get_asynchronous_selection_error() const
+{
+    return(asynchronous_selection_error);
+}
+
+
+/// Returns true if the training error of each epoch is estimated from the errors of its batches, and false otherwise.
+
+const bool& StochasticGradientDescent::get_reuse_batch_errors() const
+{
+    return(reuse_batch_errors);
+}
+
+
 /// Returns true if the parameters history matrix is to be reserved, and false otherwise.
 
 const bool& StochasticGradientDescent::get_reserve_parameters_history() const
@@ -294,6 +342,18 @@ void StochasticGradientDescent::set_default()
    initial_decay = 0.0;
    momentum = 0.0;
 
+   // BATCHES
+
+   shuffle = false;
+   shuffle_block_size = 1;
+   prefetched_batches_number = 2;
+   shuffle_seed = 0;
+
+   // EPOCH EVALUATION
+
+   asynchronous_selection_error = false;
+   reuse_batch_errors = false;
+
    // STOPPING CRITERIA
 
    minimum_parameters_increment_norm = 0.0;
@@ -736,6 +796,67 @@ void StochasticGradientDescent::set_apply_early_stopping(const bool& new_apply_e
 }
 
 
+/// Sets whether the training instances are shuffled at the beginning of each epoch.
+/// @param new_shuffle True for shuffling the training instances, false for keeping their order.
+
+void StochasticGradientDescent::set_shuffle(const bool& new_shuffle)
+{
+    shuffle = new_shuffle;
+}
+
+
+/// Sets the number of consecutive training instances which are shuffled together.
+/// Blocks larger than one improve the memory locality of the batches.
+/// @param new_shuffle_block_size Number of instances in each shuffling block.
+
+void StochasticGradientDescent::set_shuffle_block_size(const size_t& new_shuffle_block_size)
+{
+    shuffle_block_size = new_shuffle_block_size;
+}
+
+
+/// Sets the number of batches gathered on a background thread ahead of the batch being trained.
+/// @param new_prefetched_batches_number Number of prefetched batches. Zero gathers each batch in the training loop.
+
+void StochasticGradientDescent::set_prefetched_batches_number(const size_t& new_prefetched_batches_number)
+{
+    prefetched_batches_number = new_prefetched_batches_number;
+}
+
+
+/// Sets the seed of the random number generator used for shuffling the training instances.
+/// @param new_shuffle_seed Seed of the random number generator.
+
+void StochasticGradientDescent::set_shuffle_seed(const unsigned& new_shuffle_seed)
+{
+    shuffle_seed = new_shuffle_seed;
+}
+
+
+/// Sets whether the selection error of each epoch is calculated on a background thread while the next epoch is trained.
+/// In that case, the selection failures and the minimum selection error are updated one epoch late,
+/// and the training can run one epoch past the point where it would otherwise stop.
+/// The error term must implement calculate_selection_error(const Vector<double>&).
+/// With MPI the selection error is always calculated synchronously, since its reduction cannot overlap those of the training.
+/// @param new_asynchronous_selection_error True for calculating the selection error asynchronously, false otherwise.
+
+void StochasticGradientDescent::set_asynchronous_selection_error(const bool& new_asynchronous_selection_error)
+{
+    asynchronous_selection_error = new_asynchronous_selection_error;
+}
+
+
+/// Sets whether the training error of each epoch is estimated from the errors of its batches,
+/// instead of being calculated again over all the training instances.
+/// The estimate mixes the parameters at each batch of the epoch.
+/// @param new_reuse_batch_errors True for estimating the training error from the batches, false otherwise.
+
+void StochasticGradientDescent::set_reuse_batch_errors(const bool& new_reuse_batch_errors)
+{
+    reuse_batch_errors = new_reuse_batch_errors;
+}
+
+
 /// Makes the parameters history vector of vectors to be reseved or not in memory.
 /// @param new_reserve_parameters_history True if the parameters history vector of vectors is to be reserved, false otherwise.
 
@@ -1123,6 +1244,9 @@ void StochasticGradientDescent::StochasticGradientDescentResults::resize_trainin
 /// according to the gradient descent method.
 /// Training occurs according to the training parameters and stopping criteria.
 /// It returns a results structure with the history and the final values of the reserved variables.
+/// If a checkpoint file is set, the parameters and the state of the method are saved to it every checkpoint period epochs,
+/// and the training can later resume from the last checkpoint, as if it had not been interrupted.
+/// The training history of the results only contains the epochs performed after resuming.
 
 StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientDescent::perform_training()
 {
@@ -1146,7 +1270,33 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t selection_instances_number = instances.get_selection_instances_number();
+   const size_t selection_instances_number = loss_index_pointer->sum_MPI(instances.get_selection_instances_number());
+
+   // The selection error ends with an MPI reduction, which must not run on a background thread
+   // at the same time as those of the training, so with MPI it is always calculated synchronously.
+
+#ifdef __OPENNN_MPI__
+   const bool background_selection_error = false;
+#else
+   const bool background_selection_error = asynchronous_selection_error && selection_instances_number > 0;
+#endif
+
+   // The selection batches are gathered here, so that the background thread only reads them
+
+   if(background_selection_error)
+   {
+       data_set_pointer->get_selection_batches(loss_index_pointer->get_batch_size());
+   }
+
+   BatchProducer batch_producer(data_set_pointer);
+
+   batch_producer.set_batch_size(training_batch_size);
+   batch_producer.set_shuffle(shuffle);
+   batch_producer.set_shuffle_block_size(shuffle_block_size);
+   batch_producer.set_prefetched_batches_number(prefetched_batches_number);
+   batch_producer.set_seed(shuffle_seed);
+
+   BatchProducer::Batch batch;
 
    // Neural network stuff
 
@@ -1170,6 +1320,7 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
    double old_selection_error = 0.0;
 
    Vector<double> loss(instances.get_training_batches(training_batch_size).size());
+   Vector<size_t> batches_instances_numbers;
 
    Vector<double> gradient(parameters_number);
    double gradient_norm = 0.0;
@@ -1185,6 +1336,14 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
    Vector<double> minimum_selection_error_parameters(parameters_number);
    double minimum_selection_error = numeric_limits<double>::max();
 
+   // Parameters whose selection error is being calculated in the background, and that of the last selection error
+
+   future<double> selection_error_future;
+   Vector<double> evaluated_parameters;
+   size_t evaluated_epoch = 0;
+
+   Vector<double> selection_parameters;
+
    bool stop_training = false;
 
    time_t beginning_time, current_time;
@@ -1198,14 +1357,64 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
    size_t current_iteration = 0;
    size_t learning_rate_iteration = 1;
 
+   // Checkpoint, from which the training resumes with the state it had at the end of an epoch
+
+   TrainingCheckpoint checkpoint;
+
+   size_t first_epoch = 0;
+
+   if(load_checkpoint(checkpoint))
+   {
+       first_epoch = checkpoint.get_epoch();
+
+       neural_network_pointer->set_parameters(checkpoint.get_vector("parameters"));
+
+       last_increment = checkpoint.get_vector("last_increment");
+       learning_rate_iteration = checkpoint.get_integer("learning_rate_iteration");
+       current_iteration = checkpoint.get_integer("current_iteration");
+
+       old_training_error = checkpoint.get_scalar("old_training_error");
+       old_selection_error = checkpoint.get_scalar("old_selection_error");
+
+       minimum_selection_error_parameters = checkpoint.get_vector("minimum_selection_error_parameters");
+       minimum_selection_error = checkpoint.get_scalar("minimum_selection_error");
+       selection_failures = checkpoint.get_integer("selection_failures");
+
+       batch_producer.set_generator_state(checkpoint.get_text("generator_state"));
+
+       // The selection error which was being calculated in the background is calculated again
+
+       if(checkpoint.has_vector("evaluated_parameters") && background_selection_error)
+       {
+           evaluated_parameters = checkpoint.get_vector("evaluated_parameters");
+           evaluated_epoch = checkpoint.get_integer("evaluated_epoch");
+
+           const LossIndex* selection_loss_index_pointer = loss_index_pointer;
+           const Vector<double> pending_parameters = evaluated_parameters;
+
+           selection_error_future = async(launch::async, [selection_loss_index_pointer, pending_parameters]()
+           {
+               return selection_loss_index_pointer->calculate_selection_error(pending_parameters);
+           });
+       }
+
+       beginning_time -= static_cast<time_t>(checkpoint.get_scalar("elapsed_time"));
+
+       if(display) cout << "Resuming training from epoch " << first_epoch << " of " << checkpoint_file_name << ".\n";
+   }
 
    // Main loop
 
-   for(size_t epoch = 0; epoch < epochs_number; epoch++)
+   for(size_t epoch = first_epoch; epoch < epochs_number; epoch++)
    {       
-       const Vector< Vector<size_t> > training_batches = instances.get_training_batches(training_batch_size);
+       batch_producer.start_epoch();
 
-       const size_t batches_number = training_batches.size();
+       // With MPI, all the processes run the number of iterations of the process with most batches
+
+       const size_t batches_number = loss_index_pointer->maximum_MPI(batch_producer.get_batches_number());
+
+       loss.set(batches_number, 0.0);
+       batches_instances_numbers.set(batches_number, 0);
 
        parameters = neural_network_pointer->get_parameters();
 
@@ -1215,13 +1424,19 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
 
        for(size_t iteration = 0; iteration < batches_number; iteration++)
        {           
-           //Loss
+            if(!batch_producer.get_next_batch(batch))
+            {
+                batch = BatchProducer::Batch();
+            }
 
-            loss[iteration] = loss_index_pointer->calculate_batch_error(training_batches[iteration]);
+           // Loss and gradient, from a single forward and backward propagation of the batch
 
-           // Gradient
+            const LossIndex::FirstOrderError first_order_error = loss_index_pointer->calculate_batch_first_order_error(batch.inputs, batch.targets);
 
-            gradient = loss_index_pointer->calculate_batch_error_gradient(training_batches[iteration]);
+            loss[iteration] = first_order_error.error;
+            batches_instances_numbers[iteration] = batch.inputs.get_rows_number();
+
+            gradient = first_order_error.gradient;
 
             gradient_norm = gradient.calculate_L2_norm();
 
@@ -1253,23 +1468,65 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
 
        tensorflow_error = loss.calculate_sum()/batches_number;
 
-       training_error = loss_index_pointer->calculate_training_error();
+       if(reuse_batch_errors)
+       {
+           training_error = loss_index_pointer->combine_batch_errors(loss, batches_instances_numbers);
+       }
+       else
+       {
+           training_error = loss_index_pointer->calculate_training_error();
+       }
 
-       if(selection_instances_number > 0) selection_error = loss_index_pointer->calculate_selection_error();
+       // Selection error. When it is calculated asynchronously, the one available here belongs to the previous epoch
 
-       if(epoch == 0)
+       size_t selection_epoch = epoch;
+       bool selection_error_available = true;
+
+       if(background_selection_error)
        {
-          minimum_selection_error = selection_error;
-          minimum_selection_error_parameters = neural_network_pointer->get_parameters();
+           selection_error_available = selection_error_future.valid();
+
+           if(selection_error_available)
+           {
+               selection_error = selection_error_future.get();
+               selection_parameters.swap(evaluated_parameters);
+               selection_epoch = evaluated_epoch;
+           }
+
+           evaluated_parameters = neural_network_pointer->get_parameters();
+           evaluated_epoch = epoch;
+
+           const LossIndex* selection_loss_index_pointer = loss_index_pointer;
+           const Vector<double> pending_parameters = evaluated_parameters;
+
+           selection_error_future = async(launch::async, [selection_loss_index_pointer, pending_parameters]()
+           {
+               return selection_loss_index_pointer->calculate_selection_error(pending_parameters);
+           });
        }
-       else if(epoch != 0 && selection_error > old_selection_error)
+       else
        {
-          selection_failures++;
+           if(selection_instances_number > 0) selection_error = loss_index_pointer->calculate_selection_error();
+
+           selection_parameters = neural_network_pointer->get_parameters();
        }
-       else if(selection_error <= minimum_selection_error)
+
+       if(selection_error_available)
        {
-          minimum_selection_error = selection_error;
-          minimum_selection_error_parameters = neural_network_pointer->get_parameters();
+           if(selection_epoch == 0)
+           {
+              minimum_selection_error = selection_error;
+              minimum_selection_error_parameters = selection_parameters;
+           }
+           else if(selection_error > old_selection_error)
+           {
+              selection_failures++;
+           }
+           else if(selection_error <= minimum_selection_error)
+           {
+              minimum_selection_error = selection_error;
+              minimum_selection_error_parameters = selection_parameters;
+           }
        }
 
        // Elapsed time
@@ -1279,21 +1536,25 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
 
        // Training history neural network
 
-       if(reserve_parameters_history) results_pointer->parameters_history[epoch] = parameters;
+       if(reserve_parameters_history) results_pointer->parameters_history[epoch - first_epoch] = parameters;
 
-       if(reserve_parameters_norm_history) results_pointer->parameters_norm_history[epoch] = parameters_norm;
+       if(parameters_history_sink) parameters_history_sink->record(epoch, neural_network_pointer->get_parameters());
+
+       if(gradient_history_sink) gradient_history_sink->record(epoch, gradient);
+
+       if(reserve_parameters_norm_history) results_pointer->parameters_norm_history[epoch - first_epoch] = parameters_norm;
 
        // Training history loss index
 
-       if(reserve_loss_history) results_pointer->loss_history[epoch] = training_error;
+       if(reserve_loss_history) results_pointer->loss_history[epoch - first_epoch] = training_error;
 
-       if(reserve_gradient_norm_history) results_pointer->gradient_norm_history[epoch] = gradient_norm;
+       if(reserve_gradient_norm_history) results_pointer->gradient_norm_history[epoch - first_epoch] = gradient_norm;
 
-       if(reserve_selection_error_history) results_pointer->selection_error_history[epoch] = selection_error;
+       if(reserve_selection_error_history && selection_error_available && selection_epoch >= first_epoch) results_pointer->selection_error_history[selection_epoch - first_epoch] = selection_error;
 
        // Training history training algorithm
 
-       if(reserve_elapsed_time_history) results_pointer->elapsed_time_history[epoch] = elapsed_time;
+       if(reserve_elapsed_time_history) results_pointer->elapsed_time_history[epoch - first_epoch] = elapsed_time;
 
        // Stopping Criteria
 
@@ -1354,7 +1615,7 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
                         << "Selection error: " << selection_error << endl;
            }
 
-           results_pointer->resize_training_history(1+epoch);
+           results_pointer->resize_training_history(1 + epoch - first_epoch);
 
            results_pointer->final_parameters = parameters;
 
@@ -1395,9 +1656,64 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
 
           current_iteration++;
 
+       // Checkpoint
+
+       if(!stop_training && is_checkpoint_epoch(epoch))
+       {
+           checkpoint.set();
+
+           checkpoint.set_training_algorithm_type(write_training_algorithm_type());
+           checkpoint.set_epoch(epoch+1);
+
+           checkpoint.set_vector("parameters", neural_network_pointer->get_parameters());
+
+           checkpoint.set_vector("last_increment", last_increment);
+           checkpoint.set_integer("learning_rate_iteration", learning_rate_iteration);
+           checkpoint.set_integer("current_iteration", current_iteration);
+
+           checkpoint.set_scalar("old_training_error", old_training_error);
+           checkpoint.set_scalar("old_selection_error", old_selection_error);
+
+           checkpoint.set_vector("minimum_selection_error_parameters", minimum_selection_error_parameters);
+           checkpoint.set_scalar("minimum_selection_error", minimum_selection_error);
+           checkpoint.set_integer("selection_failures", selection_failures);
+
+           checkpoint.set_text("generator_state", batch_producer.write_generator_state());
+
+           if(selection_error_future.valid())
+           {
+               checkpoint.set_vector("evaluated_parameters", evaluated_parameters);
+               checkpoint.set_integer("evaluated_epoch", evaluated_epoch);
+           }
+
+           checkpoint.set_scalar("elapsed_time", elapsed_time);
+
+           save_checkpoint(checkpoint);
+       }
+
        if(stop_training) break;
    }
 
+   wait_checkpoint();
+
+   // Selection error of the last epoch, when it is calculated asynchronously
+
+   if(selection_error_future.valid())
+   {
+       selection_error = selection_error_future.get();
+
+       if(reserve_selection_error_history && evaluated_epoch >= first_epoch && evaluated_epoch - first_epoch < results_pointer->selection_error_history.size())
+       {
+           results_pointer->selection_error_history[evaluated_epoch - first_epoch] = selection_error;
+       }
+
+       if(evaluated_epoch == 0 || selection_error <= minimum_selection_error)
+       {
+           minimum_selection_error = selection_error;
+           minimum_selection_error_parameters = evaluated_parameters;
+       }
+   }
+
    if(return_minimum_selection_error_neural_network)
    {
        parameters = minimum_selection_error_parameters;
@@ -1444,7 +1760,7 @@ StochasticGradientDescent::StochasticGradientDescentResults* StochasticGradientD
 
    const Instances& instances = data_set_pointer->get_instances();
 
-   const size_t selection_instances_number = instances.get_selection_instances_number();
+   const size_t selection_instances_number = loss_index_pointer->sum_MPI(instances.get_selection_instances_number());
 
    // Neural network stuff
 
@@ -2069,6 +2385,72 @@ tinyxml2::XMLDocument* StochasticGradientDescent::to_XML() const
    text = document->NewText(buffer.str().c_str());
    element->LinkEndChild(text);
 
+   // Shuffle
+
+   element = document->NewElement("Shuffle");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << shuffle;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Shuffle block size
+
+   element = document->NewElement("ShuffleBlockSize");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << shuffle_block_size;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Prefetched batches number
+
+   element = document->NewElement("PrefetchedBatchesNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << prefetched_batches_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Shuffle seed
+
+   element = document->NewElement("ShuffleSeed");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << shuffle_seed;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Asynchronous selection error
+
+   element = document->NewElement("AsynchronousSelectionError");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << asynchronous_selection_error;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
+   // Reuse batch errors
+
+   element = document->NewElement("ReuseBatchErrors");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << reuse_batch_errors;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+
    // Reserve parameters norm history
 
    element = document->NewElement("ReserveParametersNormHistory");
@@ -2334,6 +2716,72 @@ void StochasticGradientDescent::write_XML(tinyxml2::XMLPrinter& file_stream) con
 
     file_stream.CloseElement();
 
+    // Shuffle
+
+    file_stream.OpenElement("Shuffle");
+
+    buffer.str("");
+    buffer << shuffle;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Shuffle block size
+
+    file_stream.OpenElement("ShuffleBlockSize");
+
+    buffer.str("");
+    buffer << shuffle_block_size;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Prefetched batches number
+
+    file_stream.OpenElement("PrefetchedBatchesNumber");
+
+    buffer.str("");
+    buffer << prefetched_batches_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Shuffle seed
+
+    file_stream.OpenElement("ShuffleSeed");
+
+    buffer.str("");
+    buffer << shuffle_seed;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Asynchronous selection error
+
+    file_stream.OpenElement("AsynchronousSelectionError");
+
+    buffer.str("");
+    buffer << asynchronous_selection_error;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
+    // Reuse batch errors
+
+    file_stream.OpenElement("ReuseBatchErrors");
+
+    buffer.str("");
+    buffer << reuse_batch_errors;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
+
     // Reserve parameters norm history
 
     file_stream.OpenElement("ReserveParametersNormHistory");
@@ -2678,6 +3126,120 @@ void StochasticGradientDescent::from_XML(const tinyxml2::XMLDocument& document)
        }
    }
 
+   // Shuffle
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("Shuffle");
+
+       if(element)
+       {
+          const bool new_shuffle = element->GetText() != string("0");
+
+          try
+          {
+             set_shuffle(new_shuffle);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Shuffle block size
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ShuffleBlockSize");
+
+       if(element)
+       {
+          const size_t new_shuffle_block_size = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_shuffle_block_size(new_shuffle_block_size);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Prefetched batches number
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("PrefetchedBatchesNumber");
+
+       if(element)
+       {
+          const size_t new_prefetched_batches_number = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_prefetched_batches_number(new_prefetched_batches_number);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Shuffle seed
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ShuffleSeed");
+
+       if(element)
+       {
+          const unsigned new_shuffle_seed = static_cast<unsigned>(atoi(element->GetText()));
+
+          try
+          {
+             set_shuffle_seed(new_shuffle_seed);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Asynchronous selection error
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("AsynchronousSelectionError");
+
+       if(element)
+       {
+          const bool new_asynchronous_selection_error = element->GetText() != string("0");
+
+          try
+          {
+             set_asynchronous_selection_error(new_asynchronous_selection_error);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
+   // Reuse batch errors
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReuseBatchErrors");
+
+       if(element)
+       {
+          const bool new_reuse_batch_errors = element->GetText() != string("0");
+
+          try
+          {
+             set_reuse_batch_errors(new_reuse_batch_errors);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
    // Reserve parameters history 
    {
        const tinyxml2::XMLElement* element = root_element->FirstChildElement("ReserveParametersHistory");
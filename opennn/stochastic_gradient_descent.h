@@ -24,6 +24,7 @@
 #include <limits>
 #include <cmath>
 #include <ctime>
+#include <future>
 
 // OpenNN includes
 
@@ -31,6 +32,7 @@
 
 #include "training_algorithm.h"
 #include "training_rate_algorithm.h"
+#include "batch_producer.h"
 
 
 namespace OpenNN
@@ -211,6 +213,18 @@ public:
    const bool& get_return_minimum_selection_error_neural_network() const;
    const bool& get_apply_early_stopping() const;
 
+   // Batches
+
+   const bool& get_shuffle() const;
+   const size_t& get_shuffle_block_size() const;
+   const size_t& get_prefetched_batches_number() const;
+   const unsigned& get_shuffle_seed() const;
+
+   // Epoch evaluation
+
+   const bool& get_asynchronous_selection_error() const;
+   const bool& get_reuse_batch_errors() const;
+
    // Reserve training history
 
    const bool& get_reserve_parameters_history() const;
@@ -262,6 +276,18 @@ public:
    void set_return_minimum_selection_error_neural_network(const bool&);
    void set_apply_early_stopping(const bool&);
 
+   // Batches
+
+   void set_shuffle(const bool&);
+   void set_shuffle_block_size(const size_t&);
+   void set_prefetched_batches_number(const size_t&);
+   void set_shuffle_seed(const unsigned&);
+
+   // Epoch evaluation
+
+   void set_asynchronous_selection_error(const bool&);
+   void set_reuse_batch_errors(const bool&);
+
    // Reserve training history
 
    void set_reserve_parameters_history(const bool&);
@@ -308,6 +334,37 @@ private:
    double initial_decay;
    double momentum;
 
+   // BATCHES
+
+   /// True if the training instances are shuffled at the beginning of each epoch, false otherwise.
+
+   bool shuffle;
+
+   /// Number of consecutive training instances which are shuffled together.
+
+   size_t shuffle_block_size;
+
+   /// Number of batches gathered on a background thread ahead of the batch being trained.
+
+   size_t prefetched_batches_number;
+
+   /// Seed of the random number generator used for shuffling the training instances.
+
+   unsigned shuffle_seed;
+
+   // EPOCH EVALUATION
+
+   /// True if the selection error of each epoch is calculated on a background thread while the next epoch is trained, false otherwise.
+   /// The selection error of an epoch is then known at the end of the following one,
+   /// so that early stopping and the minimum selection error neural network lag one epoch behind.
+
+   bool asynchronous_selection_error;
+
+   /// True if the training error of each epoch is estimated from the errors of its batches,
+   /// false if it is calculated again over all the training instances.
+
+   bool reuse_batch_errors;
+
    // TRAINING PARAMETERS
 
    /// Value for the parameters norm at which a warning message is written to the screen. 
@@ -109,27 +109,33 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     double training_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : training_error)
-
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+        #pragma omp for reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const double batch_error = outputs.calculate_sum_squared_error(targets);
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
-        training_error += batch_error;
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
+
+            training_error += batch_error;
+        }
     }
 
-    return training_error;
+    return sum_MPI(training_error);
 }
 
 double SumSquaredError::calculate_selection_error() const
@@ -146,27 +152,81 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > selection_batches = data_set_pointer->get_instances_pointer()->get_selection_batches(batch_size);
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
 
-    const size_t batches_number = selection_batches.size();
+    const size_t batches_number = selection_batches.get_batches_number();
 
     double selection_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : selection_error)
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for reduction(+ : selection_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = selection_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = selection_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
+
+            selection_error += batch_error;
+        }
+    }
+
+    return sum_MPI(selection_error);
+}
+
+
+/// Returns the sum squared error on the selection instances for a given parameters vector.
+/// The neural network is not modified, so this can be evaluated while the neural network is being trained.
+/// @param parameters Parameters vector of the neural network.
+
+double SumSquaredError::calculate_selection_error(const Vector<double>& parameters) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Multilayer perceptron
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    // Data set
+
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
+
+    const size_t batches_number = selection_batches.get_batches_number();
+
+    double selection_error = 0.0;
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(selection_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(selection_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+        #pragma omp for reduction(+ : selection_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = selection_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = selection_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-        const double batch_error = outputs.calculate_sum_squared_error(targets);
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
 
-        selection_error += batch_error;
+            selection_error += batch_error;
+        }
     }
 
-    return selection_error;
+    return sum_MPI(selection_error);
 }
 
 
@@ -184,27 +244,89 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     double training_error = 0.0;
 
-    #pragma omp parallel for reduction(+ : training_error)
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+
+            const double batch_error = outputs.calculate_sum_squared_error(targets);
+
+            training_error += batch_error;
+        }
+    }
+
+    return sum_MPI(training_error);
+}
+
+
+/// Returns the sum squared error on the training instances for each of a set of parameters vectors.
+/// Each batch is read once and evaluated with all the parameters vectors,
+/// which are then summed in batch order, so the results do not depend on the number of threads.
+/// @param parameters Parameters vectors of the neural network.
+
+Vector<double> SumSquaredError::calculate_training_errors(const Vector< Vector<double> >& parameters) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Multilayer perceptron
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t parameters_vectors_number = parameters.size();
+
+    // Data set
+
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    Matrix<double> batches_errors(batches_number, parameters_vectors_number);
+
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for schedule(static)
 
-        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+        for(int i = 0; i < static_cast<int>(batches_number*parameters_vectors_number); i++)
+        {
+            const size_t batch = static_cast<size_t>(i)/parameters_vectors_number;
+            const size_t parameters_vector = static_cast<size_t>(i)%parameters_vectors_number;
+
+            const Matrix<double>& inputs = training_batches.get_inputs(batch, inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(batch, targets_buffer);
 
-        const double batch_error = outputs.calculate_sum_squared_error(targets);
+            const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters[parameters_vector]);
 
-        training_error += batch_error;
+            batches_errors(batch, parameters_vector) = outputs.calculate_sum_squared_error(targets);
+        }
     }
 
-    return training_error;
+    Vector<double> training_errors = batches_errors.calculate_columns_sum();
+
+    sum_MPI(training_errors);
+
+    return training_errors;
 }
 
 
@@ -220,49 +342,74 @@ check();
 
     const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
-    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
     const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     // Loss index
 
-    Vector<double> training_error_gradient(parameters_number, 0.0);
+    Vector<double> training_error_gradient;
 
-    #pragma omp parallel for
+    set_back_propagations(batch_size);
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
-    {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+    set_gradient_accumulators(parameters_number);
 
-        const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-                = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> output_gradient
-                = calculate_output_gradient(first_order_forward_propagation.layers_activations[layers_number-1], targets);
+        #pragma omp for schedule(static)
 
-        const Vector< Matrix<double> > layers_delta
-                = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const Vector<double> batch_gradient
-                = calculate_error_gradient(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+            BackPropagation& back_propagation = get_back_propagation();
 
-        #pragma omp critical
+            calculate_back_propagation(inputs, targets, back_propagation);
 
-        training_error_gradient += batch_gradient;
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
     }
 
+    reduce_gradient_accumulators(training_error_gradient);
+
     return training_error_gradient;
 }
 
 
-Vector<double> SumSquaredError::calculate_batch_error_gradient(const Vector<size_t>& batch_indices) const
+/// Returns the sum squared error of the multilayer perceptron on a batch of instances.
+/// @param batch_indices Indices of the instances in the batch.
+
+double SumSquaredError::calculate_batch_error(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
+    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
+    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+
+    return calculate_batch_error(inputs, targets);
+}
+
+
+/// Returns the sum squared error of the multilayer perceptron on a batch which has already been gathered.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+double SumSquaredError::calculate_batch_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
 {
 #ifdef __OPENNN_DEBUG__
 
@@ -274,21 +421,71 @@ check();
 
     const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
-    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
     // Loss index
 
+    double batch_error = 0.0;
+
+    if(inputs.get_rows_number() > 0)
+    {
+        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+
+        batch_error = outputs.calculate_sum_squared_error(targets);
+    }
+
+    return sum_MPI(batch_error);
+}
+
+
+Vector<double> SumSquaredError::calculate_batch_error_gradient(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
     const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
     const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
 
-    const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-            = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+    return calculate_batch_error_gradient(inputs, targets);
+}
+
+
+/// Returns the sum squared error gradient of the multilayer perceptron on a batch which has already been gathered.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+Vector<double> SumSquaredError::calculate_batch_error_gradient(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
 
-    const Matrix<double> output_gradient = calculate_output_gradient(first_order_forward_propagation.layers_activations[layers_number-1], targets);
+    const size_t parameters_number = neural_network_pointer->get_multilayer_perceptron_pointer()->get_parameters_number();
 
-    const Vector< Matrix<double> > layers_delta = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+    // Loss index
+
+    Vector<double> batch_error_gradient(parameters_number, 0.0);
+
+    if(inputs.get_rows_number() > 0)
+    {
+        set_back_propagations(inputs.get_rows_number());
+
+        BackPropagation& back_propagation = get_back_propagation();
+
+        calculate_back_propagation(inputs, targets, back_propagation);
+
+        batch_error_gradient = back_propagation.gradient;
+    }
 
-    const Vector<double> batch_error_gradient = calculate_error_gradient(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+    sum_MPI(batch_error_gradient);
 
     return batch_error_gradient;
 }
@@ -365,6 +562,33 @@ check();
 }
 
 
+/// Calculates the output gradient of a batch and writes it into a given matrix, which is resized only if its dimensions change.
+/// @param outputs Matrix of outputs of the neural network.
+/// @param targets Matrix of targets of the data set.
+/// @param output_gradient Matrix where the output gradient is written.
+
+void SumSquaredError::calculate_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets, Matrix<double>& output_gradient) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    if(output_gradient.get_rows_number() != outputs.get_rows_number() || output_gradient.get_columns_number() != outputs.get_columns_number())
+    {
+        output_gradient.set(outputs.get_rows_number(), outputs.get_columns_number());
+    }
+
+    const size_t size = outputs.size();
+
+    for(size_t i = 0; i < size; i++)
+    {
+        output_gradient[i] = (outputs[i]-targets[i])*2.0;
+    }
+}
+
+
 
 /// Calculates the squared error terms for each instance, and returns it in a vector of size the number training instances. 
 
@@ -490,50 +714,44 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
-    SecondOrderErrorTerms terms_second_order_loss(parameters_number);
+    SecondOrderErrorTerms terms_second_order_loss;
 
-    #pragma omp parallel for
+    set_second_order_accumulators(parameters_number);
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
-
-        const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-                = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
-
-        const Vector<double> error_terms
-                = calculate_error_terms(first_order_forward_propagation.layers_activations[layers_number-1], targets);
-
-        const Matrix<double> output_gradient = (first_order_forward_propagation.layers_activations[layers_number-1] - targets)/error_terms;
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Vector< Matrix<double> > layers_delta
-                = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+        #pragma omp for schedule(static)
 
-        const Matrix<double> error_terms_Jacobian
-                = calculate_error_terms_Jacobian(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const Matrix<double> error_terms_Jacobian_transpose = error_terms_Jacobian.calculate_transpose();
+            const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
+                    = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
-        const double loss = error_terms.dot(error_terms);
+            const Vector<double> error_terms
+                    = calculate_error_terms(first_order_forward_propagation.layers_activations[layers_number-1], targets);
 
-        const Vector<double> gradient = error_terms_Jacobian_transpose.dot(error_terms);
+            const Matrix<double> output_gradient = (first_order_forward_propagation.layers_activations[layers_number-1] - targets)/error_terms;
 
-        Matrix<double> Hessian_approximation;
-        Hessian_approximation.dot(error_terms_Jacobian_transpose, error_terms_Jacobian);
+            const Vector< Matrix<double> > layers_delta
+                    = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
 
-        #pragma omp critical
-        {
-            terms_second_order_loss.loss += loss;
-            terms_second_order_loss.gradient += gradient;
-            terms_second_order_loss.Hessian_approximation += Hessian_approximation;
-         }
+            accumulate_second_order_terms(inputs, first_order_forward_propagation.layers_activations, layers_delta,
+                                          error_terms, get_second_order_accumulator());
+        }
     }
 
+    reduce_second_order_accumulators(terms_second_order_loss);
+
 //    const Matrix<double> regularization_Hessian = loss_index_pointer->calculate_regularization_Hessian();
 
     terms_second_order_loss.gradient *= 2.0;
@@ -543,6 +761,138 @@ check();
 }
 
 
+/// Returns the sum squared error and its gradient on the training instances.
+/// Both are computed in a single forward and backward propagation of each batch.
+
+LossIndex::FirstOrderError SumSquaredError::calculate_training_first_order_error() const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+    // Data set
+
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    // Loss index
+
+    FirstOrderError first_order_error(0);
+
+    double training_error = 0.0;
+
+    set_back_propagations(batch_size);
+
+    set_gradient_accumulators(parameters_number);
+
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for schedule(static) reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            BackPropagation& back_propagation = get_back_propagation();
+
+            calculate_back_propagation(inputs, targets, back_propagation);
+
+            training_error += back_propagation.get_outputs().calculate_sum_squared_error(targets);
+
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
+    }
+
+    first_order_error.error = sum_MPI(training_error);
+
+    reduce_gradient_accumulators(first_order_error.gradient);
+
+    return first_order_error;
+}
+
+
+/// Returns the sum squared error and its gradient on a batch of instances.
+/// @param batch_indices Indices of the instances in the batch.
+
+LossIndex::FirstOrderError SumSquaredError::calculate_batch_first_order_error(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
+    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
+    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+
+    return calculate_batch_first_order_error(inputs, targets);
+}
+
+
+/// Returns the sum squared error and its gradient on a batch which has already been gathered.
+/// Both are computed in a single forward and backward propagation.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+LossIndex::FirstOrderError SumSquaredError::calculate_batch_first_order_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const size_t parameters_number = neural_network_pointer->get_multilayer_perceptron_pointer()->get_parameters_number();
+
+    // Data set
+
+    const size_t instances_number = inputs.get_rows_number();
+
+    // Loss index
+
+    FirstOrderError first_order_error(parameters_number);
+
+    double batch_error = 0.0;
+
+    if(instances_number > 0)
+    {
+        set_back_propagations(instances_number);
+
+        BackPropagation& back_propagation = get_back_propagation();
+
+        calculate_back_propagation(inputs, targets, back_propagation);
+
+        batch_error = back_propagation.get_outputs().calculate_sum_squared_error(targets);
+
+        first_order_error.gradient = back_propagation.gradient;
+    }
+
+    first_order_error.error = sum_MPI(batch_error);
+
+    sum_MPI(first_order_error.gradient);
+
+    return first_order_error;
+}
+
+
 // string write_error_term_type() const method
 
 /// Returns a string with the name of the sum squared error loss type, "SUM_SQUARED_ERROR".
@@ -81,12 +81,21 @@ public:
    double calculate_selection_error() const;
 
    double calculate_training_error(const Vector<double>&) const;
+   double calculate_selection_error(const Vector<double>&) const;
+   Vector<double> calculate_training_errors(const Vector< Vector<double> >&) const;
 
    Vector<double> calculate_training_error_gradient() const;
 
-   double calculate_batch_error(const Vector<size_t>&) const {return 0.0;}
+   double calculate_batch_error(const Vector<size_t>&) const;
+   double calculate_batch_error(const Matrix<double>&, const Matrix<double>&) const;
 
    Vector<double> calculate_batch_error_gradient(const Vector<size_t>&) const;
+   Vector<double> calculate_batch_error_gradient(const Matrix<double>&, const Matrix<double>&) const;
+
+   FirstOrderError calculate_training_first_order_error() const;
+
+   FirstOrderError calculate_batch_first_order_error(const Vector<size_t>&) const;
+   FirstOrderError calculate_batch_first_order_error(const Matrix<double>&, const Matrix<double>&) const;
 
    double calculate_error(const Matrix<double>&, const Matrix<double>&) const;
 
@@ -109,6 +118,7 @@ public:
    void write_XML(tinyxml2::XMLPrinter&) const;
 
    Matrix<double> calculate_output_gradient(const Matrix<double>&, const Matrix<double>&) const;
+   void calculate_output_gradient(const Matrix<double>&, const Matrix<double>&, Matrix<double>&) const;
 
    LossIndex::SecondOrderErrorTerms calculate_terms_second_order_loss() const;
 
@@ -190,6 +190,70 @@ const string& TrainingAlgorithm::get_neural_network_file_name() const
 }
 
 
+/// Returns the number of training instances in each batch of the batch training algorithms.
+
+const size_t& TrainingAlgorithm::get_training_batch_size() const
+{
+   return(training_batch_size);
+}
+
+
+/// Returns the sink which receives the parameters at each epoch, or nullptr if there is none.
+
+HistorySink* TrainingAlgorithm::get_parameters_history_sink() const
+{
+   return(parameters_history_sink);
+}
+
+
+/// Returns the sink which receives the gradient at each epoch, or nullptr if there is none.
+
+HistorySink* TrainingAlgorithm::get_gradient_history_sink() const
+{
+   return(gradient_history_sink);
+}
+
+
+/// Returns the sink which receives the training direction at each epoch, or nullptr if there is none.
+
+HistorySink* TrainingAlgorithm::get_training_direction_history_sink() const
+{
+   return(training_direction_history_sink);
+}
+
+
+/// Returns the sink which receives the Hessian approximation at each epoch, or nullptr if there is none.
+
+HistorySink* TrainingAlgorithm::get_Hessian_approximation_history_sink() const
+{
+   return(Hessian_approximation_history_sink);
+}
+
+
+/// Returns the name of the file where the checkpoints are saved, or an empty string if no checkpoint is saved.
+
+const string& TrainingAlgorithm::get_checkpoint_file_name() const
+{
+   return(checkpoint_file_name);
+}
+
+
+/// Returns the number of epochs between two checkpoints.
+
+const size_t& TrainingAlgorithm::get_checkpoint_period() const
+{
+   return(checkpoint_period);
+}
+
+
+/// Returns true if the training continues from the checkpoint file when it exists, and false otherwise.
+
+const bool& TrainingAlgorithm::get_resume_from_checkpoint() const
+{
+   return(resume_from_checkpoint);
+}
+
+
 // void set() method
 
 /// Sets the loss index pointer to nullptr.
@@ -320,6 +384,192 @@ void TrainingAlgorithm::set_neural_network_file_name(const string& new_neural_ne
 }
 
 
+/// Sets a sink which receives the parameters at each epoch, independently of the parameters history of the training results.
+/// The sink is not owned by the training algorithm, and it must exist while the training is performed.
+/// @param new_parameters_history_sink Pointer to a history sink, or nullptr for none.
+
+void TrainingAlgorithm::set_parameters_history_sink(HistorySink* new_parameters_history_sink)
+{
+   parameters_history_sink = new_parameters_history_sink;
+}
+
+
+/// Sets a sink which receives the gradient at each epoch, independently of the gradient history of the training results.
+/// The sink is not owned by the training algorithm, and it must exist while the training is performed.
+/// @param new_gradient_history_sink Pointer to a history sink, or nullptr for none.
+
+void TrainingAlgorithm::set_gradient_history_sink(HistorySink* new_gradient_history_sink)
+{
+   gradient_history_sink = new_gradient_history_sink;
+}
+
+
+/// Sets a sink which receives the training direction at each epoch, independently of the training direction history of the training results.
+/// The sink is not owned by the training algorithm, and it must exist while the training is performed.
+/// @param new_training_direction_history_sink Pointer to a history sink, or nullptr for none.
+
+void TrainingAlgorithm::set_training_direction_history_sink(HistorySink* new_training_direction_history_sink)
+{
+   training_direction_history_sink = new_training_direction_history_sink;
+}
+
+
+/// Sets a sink which receives the Hessian approximation at each epoch of the Levenberg-Marquardt algorithm,
+/// or the inverse Hessian approximation of the quasi-Newton method.
+/// Each record holds the matrix in column-major order.
+/// The sink is not owned by the training algorithm, and it must exist while the training is performed.
+/// @param new_Hessian_approximation_history_sink Pointer to a history sink, or nullptr for none.
+
+void TrainingAlgorithm::set_Hessian_approximation_history_sink(HistorySink* new_Hessian_approximation_history_sink)
+{
+   Hessian_approximation_history_sink = new_Hessian_approximation_history_sink;
+}
+
+
+/// Sets the file where the training algorithms which support it, the quasi-Newton method and stochastic gradient descent,
+/// save a checkpoint with the parameters and their own state every few epochs.
+/// @param new_checkpoint_file_name Name of the checkpoint file, or an empty string for no checkpoints.
+
+void TrainingAlgorithm::set_checkpoint_file_name(const string& new_checkpoint_file_name)
+{
+   checkpoint_file_name = new_checkpoint_file_name;
+}
+
+
+/// Sets the number of epochs between two checkpoints.
+/// @param new_checkpoint_period Number of epochs. It must be greater than zero.
+
+void TrainingAlgorithm::set_checkpoint_period(const size_t& new_checkpoint_period)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__
+
+   if(new_checkpoint_period == 0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "void set_checkpoint_period(const size_t&) method.\n"
+             << "Checkpoint period must be greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   checkpoint_period = new_checkpoint_period;
+}
+
+
+/// Sets whether the training continues from the checkpoint file.
+/// If it is true and the checkpoint file exists, the parameters and the state of the training algorithm are restored from it,
+/// and the training continues from the epoch following the checkpoint, exactly as if it had not been interrupted.
+/// If the checkpoint file does not exist, the training starts from the first epoch.
+/// @param new_resume_from_checkpoint True to resume from the checkpoint file, false otherwise.
+
+void TrainingAlgorithm::set_resume_from_checkpoint(const bool& new_resume_from_checkpoint)
+{
+   resume_from_checkpoint = new_resume_from_checkpoint;
+}
+
+
+/// Returns true if a checkpoint must be saved after a given epoch, and false otherwise.
+/// @param epoch Epoch which has just been performed.
+
+bool TrainingAlgorithm::is_checkpoint_epoch(const size_t& epoch) const
+{
+   return(!checkpoint_file_name.empty() && (epoch+1)%checkpoint_period == 0);
+}
+
+
+/// Saves a checkpoint to the checkpoint file in a background thread, so that the training continues while it is written.
+/// It first waits for the previous checkpoint, if it is still being saved.
+/// With MPI, all the processes hold the same checkpoint, and only the first one writes it.
+/// @param checkpoint Checkpoint to be saved. It is copied, so it can be modified as soon as this method returns.
+
+void TrainingAlgorithm::save_checkpoint(const TrainingCheckpoint& checkpoint)
+{
+   wait_checkpoint();
+
+#ifdef __OPENNN_MPI__
+
+   int rank;
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+   if(rank != 0)
+   {
+      return;
+   }
+
+#endif
+
+   const string file_name = checkpoint_file_name;
+
+   checkpoint_saving = async(launch::async, [checkpoint, file_name]()
+   {
+       checkpoint.save(file_name);
+   }).share();
+}
+
+
+/// Waits for the checkpoint being saved in the background, if any.
+/// It throws the exception raised while saving it, if any.
+
+void TrainingAlgorithm::wait_checkpoint()
+{
+   if(!checkpoint_saving.valid())
+   {
+      return;
+   }
+
+   const shared_future<void> saving = checkpoint_saving;
+
+   checkpoint_saving = shared_future<void>();
+
+   saving.get();
+}
+
+
+/// Loads the checkpoint file, if the training must resume from it and it exists.
+/// It checks that the checkpoint was saved by the same type of training algorithm, and for a neural network with the same number of parameters.
+/// @param checkpoint Checkpoint where the file is loaded.
+/// @return True if the checkpoint has been loaded, and false if the training must start from the first epoch.
+
+bool TrainingAlgorithm::load_checkpoint(TrainingCheckpoint& checkpoint) const
+{
+   if(!resume_from_checkpoint || checkpoint_file_name.empty())
+   {
+      return(false);
+   }
+
+   if(!ifstream(checkpoint_file_name.c_str()).good())
+   {
+      return(false);
+   }
+
+   checkpoint.load(checkpoint_file_name);
+
+   const size_t parameters_number = loss_index_pointer->get_neural_network_pointer()->get_parameters_number();
+
+   if(checkpoint.get_training_algorithm_type() != write_training_algorithm_type()
+   || checkpoint.get_vector("parameters").size() != parameters_number)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingAlgorithm class.\n"
+             << "bool load_checkpoint(TrainingCheckpoint&) const method.\n"
+             << "Checkpoint file " << checkpoint_file_name << " was saved by " << checkpoint.get_training_algorithm_type()
+             << " with " << checkpoint.get_vector("parameters").size() << " parameters, "
+             << "but the training uses " << write_training_algorithm_type() << " with " << parameters_number << " parameters.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   return(true);
+}
+
+
 // void set_default() method 
 
 /// Sets the members of the training algorithm object to their default values.
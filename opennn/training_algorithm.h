@@ -22,10 +22,13 @@
 #include <limits>
 #include <cmath>
 #include <ctime>
+#include <future>
 
 // OpenNN includes
 
 #include "loss_index.h"
+#include "history_sink.h"
+#include "training_checkpoint.h"
 
 // TinyXml includes
 
@@ -135,6 +138,21 @@ public:
 
    const string& get_neural_network_file_name() const;
 
+   const size_t& get_training_batch_size() const;
+
+   // History sinks
+
+   HistorySink* get_parameters_history_sink() const;
+   HistorySink* get_gradient_history_sink() const;
+   HistorySink* get_training_direction_history_sink() const;
+   HistorySink* get_Hessian_approximation_history_sink() const;
+
+   // Checkpoints
+
+   const string& get_checkpoint_file_name() const;
+   const size_t& get_checkpoint_period() const;
+   const bool& get_resume_from_checkpoint() const;
+
    // Set methods
 
    void set();
@@ -156,6 +174,19 @@ public:
    void set_save_period(const size_t&);
    void set_neural_network_file_name(const string&);
 
+   // History sinks
+
+   void set_parameters_history_sink(HistorySink*);
+   void set_gradient_history_sink(HistorySink*);
+   void set_training_direction_history_sink(HistorySink*);
+   void set_Hessian_approximation_history_sink(HistorySink*);
+
+   // Checkpoints
+
+   void set_checkpoint_file_name(const string&);
+   void set_checkpoint_period(const size_t&);
+   void set_resume_from_checkpoint(const bool&);
+
    // Training methods
 
    virtual void check() const;
@@ -186,6 +217,15 @@ public:
 
 protected:
 
+   // Checkpoint methods
+
+   bool is_checkpoint_epoch(const size_t&) const;
+
+   void save_checkpoint(const TrainingCheckpoint&);
+   void wait_checkpoint();
+
+   bool load_checkpoint(TrainingCheckpoint&) const;
+
    // FIELDS
 
    /// Pointer to a loss index for a multilayer perceptron object.
@@ -215,6 +255,44 @@ protected:
 
    bool display;
 
+   // HISTORY SINKS
+
+   /// Sink which receives the parameters at each epoch, or nullptr. It is not owned by the training algorithm.
+
+   HistorySink* parameters_history_sink = nullptr;
+
+   /// Sink which receives the gradient at each epoch, or nullptr. It is not owned by the training algorithm.
+
+   HistorySink* gradient_history_sink = nullptr;
+
+   /// Sink which receives the training direction at each epoch, or nullptr. It is not owned by the training algorithm.
+
+   HistorySink* training_direction_history_sink = nullptr;
+
+   /// Sink which receives the Hessian approximation, or the inverse Hessian approximation, at each epoch, or nullptr.
+   /// It is not owned by the training algorithm.
+
+   HistorySink* Hessian_approximation_history_sink = nullptr;
+
+   // CHECKPOINTS
+
+   /// Name of the file where the training algorithms which support it save their checkpoints.
+   /// No checkpoint is saved if it is empty.
+
+   string checkpoint_file_name;
+
+   /// Number of epochs between two checkpoints.
+
+   size_t checkpoint_period = 10;
+
+   /// True if the training continues from the checkpoint file when it exists, and false if it always starts from the first epoch.
+
+   bool resume_from_checkpoint = false;
+
+   /// Checkpoint being saved in the background, if any.
+
+   shared_future<void> checkpoint_saving;
+
 };
 
 }
@@ -0,0 +1,687 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   T R A I N I N G   C H E C K P O I N T   C L A S S                                                          */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// OpenNN includes
+
+#include "training_checkpoint.h"
+
+// System includes
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <io.h>
+#include <fcntl.h>
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace OpenNN
+{
+
+/// Identifier at the beginning of every checkpoint file.
+
+static const char checkpoint_magic[8] = {'O', 'N', 'N', 'C', 'K', 'P', 'T', '\0'};
+
+/// Version of the checkpoint file format.
+
+static const uint64_t checkpoint_version = 1;
+
+
+/// Writes an unsigned integer as 64 bits.
+
+static void write_size(ofstream& file, const size_t& value)
+{
+    const uint64_t value_64 = static_cast<uint64_t>(value);
+
+    file.write(reinterpret_cast<const char*>(&value_64), sizeof(value_64));
+}
+
+
+/// Writes a string as its length followed by its characters.
+
+static void write_string(ofstream& file, const string& text)
+{
+    write_size(file, text.size());
+
+    file.write(text.data(), static_cast<streamsize>(text.size()));
+}
+
+
+/// Writes a block of doubles as its size followed by the values.
+
+static void write_doubles(ofstream& file, const double* values, const size_t& values_number)
+{
+    write_size(file, values_number);
+
+    file.write(reinterpret_cast<const char*>(values), static_cast<streamsize>(values_number*sizeof(double)));
+}
+
+
+/// Reads an unsigned integer written as 64 bits.
+
+static size_t read_size(ifstream& file)
+{
+    uint64_t value_64 = 0;
+
+    file.read(reinterpret_cast<char*>(&value_64), sizeof(value_64));
+
+    return(static_cast<size_t>(value_64));
+}
+
+
+/// Reads a string written as its length followed by its characters.
+
+static string read_string(ifstream& file)
+{
+    string text(read_size(file), '\0');
+
+    file.read(&text[0], static_cast<streamsize>(text.size()));
+
+    return(text);
+}
+
+
+/// Reads a block of doubles written as its size followed by the values.
+
+static Vector<double> read_doubles(ifstream& file)
+{
+    Vector<double> values(read_size(file));
+
+    file.read(reinterpret_cast<char*>(values.data()), static_cast<streamsize>(values.size()*sizeof(double)));
+
+    return(values);
+}
+
+
+/// Renames a file, replacing the destination file if it exists, in a single step of the file system.
+/// The destination is never removed before the renamed file takes its place.
+/// Returns false if the file cannot be renamed.
+
+static bool replace_file(const string& source_file_name, const string& destination_file_name)
+{
+#if defined(_WIN32)
+
+    return(MoveFileExA(source_file_name.c_str(), destination_file_name.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0);
+
+#else
+
+    return(rename(source_file_name.c_str(), destination_file_name.c_str()) == 0);
+
+#endif
+}
+
+
+/// Forces the contents of a file or directory, which may still be in the system buffers, to be written to the disk.
+/// Returns false if it cannot be done. Where the system provides no way of doing it, it returns true.
+
+static bool synchronize_file(const string& file_name)
+{
+#if defined(__unix__) || defined(__APPLE__)
+
+    const int descriptor = open(file_name.c_str(), O_RDONLY);
+
+    if(descriptor < 0)
+    {
+        return(false);
+    }
+
+    const bool synchronized = fsync(descriptor) == 0;
+
+    close(descriptor);
+
+    return(synchronized);
+
+#elif defined(_WIN32)
+
+    const int descriptor = _open(file_name.c_str(), _O_RDWR | _O_BINARY);
+
+    if(descriptor < 0)
+    {
+        return(false);
+    }
+
+    const bool synchronized = _commit(descriptor) == 0;
+
+    _close(descriptor);
+
+    return(synchronized);
+
+#else
+
+    return(true);
+
+#endif
+}
+
+
+// DEFAULT CONSTRUCTOR
+
+/// Default constructor.
+/// It creates an empty checkpoint.
+
+TrainingCheckpoint::TrainingCheckpoint()
+{
+}
+
+
+// FILE CONSTRUCTOR
+
+/// File constructor.
+/// It loads a checkpoint from a file.
+/// @param file_name Name of the checkpoint file.
+
+TrainingCheckpoint::TrainingCheckpoint(const string& file_name)
+{
+    load(file_name);
+}
+
+
+// DESTRUCTOR
+
+/// Destructor.
+
+TrainingCheckpoint::~TrainingCheckpoint()
+{
+}
+
+
+// METHODS
+
+/// Returns the type of the training algorithm which wrote the checkpoint.
+
+const string& TrainingCheckpoint::get_training_algorithm_type() const
+{
+    return(training_algorithm_type);
+}
+
+
+/// Returns the epoch from which the training continues.
+
+const size_t& TrainingCheckpoint::get_epoch() const
+{
+    return(epoch);
+}
+
+
+/// Returns true if the checkpoint contains a vector with the given name, and false otherwise.
+/// @param name Name of the vector.
+
+bool TrainingCheckpoint::has_vector(const string& name) const
+{
+    return(vectors.count(name) != 0);
+}
+
+
+/// Returns true if the checkpoint contains a matrix with the given name, and false otherwise.
+/// @param name Name of the matrix.
+
+bool TrainingCheckpoint::has_matrix(const string& name) const
+{
+    return(matrices.count(name) != 0);
+}
+
+
+/// Returns true if the checkpoint contains a real value with the given name, and false otherwise.
+/// @param name Name of the value.
+
+bool TrainingCheckpoint::has_scalar(const string& name) const
+{
+    return(scalars.count(name) != 0);
+}
+
+
+/// Returns true if the checkpoint contains an integer value with the given name, and false otherwise.
+/// @param name Name of the value.
+
+bool TrainingCheckpoint::has_integer(const string& name) const
+{
+    return(integers.count(name) != 0);
+}
+
+
+/// Returns true if the checkpoint contains a text with the given name, and false otherwise.
+/// @param name Name of the text.
+
+bool TrainingCheckpoint::has_text(const string& name) const
+{
+    return(texts.count(name) != 0);
+}
+
+
+/// Returns the vector stored with the given name.
+/// It throws an exception if there is no such vector.
+/// @param name Name of the vector.
+
+const Vector<double>& TrainingCheckpoint::get_vector(const string& name) const
+{
+    const map< string, Vector<double> >::const_iterator iterator = vectors.find(name);
+
+    if(iterator == vectors.end())
+    {
+        throw_missing_entry("const Vector<double>& get_vector(const string&) const", name);
+    }
+
+    return(iterator->second);
+}
+
+
+/// Returns the matrix stored with the given name.
+/// It throws an exception if there is no such matrix.
+/// @param name Name of the matrix.
+
+const Matrix<double>& TrainingCheckpoint::get_matrix(const string& name) const
+{
+    const map< string, Matrix<double> >::const_iterator iterator = matrices.find(name);
+
+    if(iterator == matrices.end())
+    {
+        throw_missing_entry("const Matrix<double>& get_matrix(const string&) const", name);
+    }
+
+    return(iterator->second);
+}
+
+
+/// Returns the real value stored with the given name.
+/// It throws an exception if there is no such value.
+/// @param name Name of the value.
+
+double TrainingCheckpoint::get_scalar(const string& name) const
+{
+    const map<string, double>::const_iterator iterator = scalars.find(name);
+
+    if(iterator == scalars.end())
+    {
+        throw_missing_entry("double get_scalar(const string&) const", name);
+    }
+
+    return(iterator->second);
+}
+
+
+/// Returns the integer value stored with the given name.
+/// It throws an exception if there is no such value.
+/// @param name Name of the value.
+
+size_t TrainingCheckpoint::get_integer(const string& name) const
+{
+    const map<string, size_t>::const_iterator iterator = integers.find(name);
+
+    if(iterator == integers.end())
+    {
+        throw_missing_entry("size_t get_integer(const string&) const", name);
+    }
+
+    return(iterator->second);
+}
+
+
+/// Returns the text stored with the given name.
+/// It throws an exception if there is no such text.
+/// @param name Name of the text.
+
+const string& TrainingCheckpoint::get_text(const string& name) const
+{
+    const map<string, string>::const_iterator iterator = texts.find(name);
+
+    if(iterator == texts.end())
+    {
+        throw_missing_entry("const string& get_text(const string&) const", name);
+    }
+
+    return(iterator->second);
+}
+
+
+/// Removes all the values of the checkpoint.
+
+void TrainingCheckpoint::set()
+{
+    training_algorithm_type.clear();
+
+    epoch = 0;
+
+    vectors.clear();
+    matrices.clear();
+    scalars.clear();
+    integers.clear();
+    texts.clear();
+}
+
+
+/// Sets the type of the training algorithm which writes the checkpoint.
+/// @param new_training_algorithm_type Type of the training algorithm, as written by write_training_algorithm_type().
+
+void TrainingCheckpoint::set_training_algorithm_type(const string& new_training_algorithm_type)
+{
+    training_algorithm_type = new_training_algorithm_type;
+}
+
+
+/// Sets the epoch from which the training continues.
+/// @param new_epoch First epoch to be performed when the training is resumed.
+
+void TrainingCheckpoint::set_epoch(const size_t& new_epoch)
+{
+    epoch = new_epoch;
+}
+
+
+/// Stores a vector with a given name, replacing any vector with the same name.
+/// @param name Name of the vector.
+/// @param new_vector Vector to be stored.
+
+void TrainingCheckpoint::set_vector(const string& name, const Vector<double>& new_vector)
+{
+    vectors[name] = new_vector;
+}
+
+
+/// Stores a matrix with a given name, replacing any matrix with the same name.
+/// @param name Name of the matrix.
+/// @param new_matrix Matrix to be stored.
+
+void TrainingCheckpoint::set_matrix(const string& name, const Matrix<double>& new_matrix)
+{
+    matrices[name] = new_matrix;
+}
+
+
+/// Stores a real value with a given name, replacing any value with the same name.
+/// @param name Name of the value.
+/// @param new_scalar Value to be stored.
+
+void TrainingCheckpoint::set_scalar(const string& name, const double& new_scalar)
+{
+    scalars[name] = new_scalar;
+}
+
+
+/// Stores an integer value with a given name, replacing any value with the same name.
+/// @param name Name of the value.
+/// @param new_integer Value to be stored.
+
+void TrainingCheckpoint::set_integer(const string& name, const size_t& new_integer)
+{
+    integers[name] = new_integer;
+}
+
+
+/// Stores a text with a given name, replacing any text with the same name.
+/// @param name Name of the text.
+/// @param new_text Text to be stored.
+
+void TrainingCheckpoint::set_text(const string& name, const string& new_text)
+{
+    texts[name] = new_text;
+}
+
+
+/// Saves the checkpoint to a binary file.
+/// The checkpoint is written to a temporary file, which is forced to the disk and then replaces the given file,
+/// so that the file holds either the previous or the new checkpoint, but never a partial one, even after a system failure.
+/// @param file_name Name of the checkpoint file.
+
+void TrainingCheckpoint::save(const string& file_name) const
+{
+    const string temporary_file_name = file_name + ".tmp";
+
+    ofstream file(temporary_file_name.c_str(), ios::binary | ios::trunc);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: TrainingCheckpoint class.\n"
+               << "void save(const string&) const method.\n"
+               << "Cannot open checkpoint file: " << temporary_file_name << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    file.write(checkpoint_magic, sizeof(checkpoint_magic));
+    file.write(reinterpret_cast<const char*>(&checkpoint_version), sizeof(checkpoint_version));
+
+    write_string(file, training_algorithm_type);
+    write_size(file, epoch);
+
+    write_size(file, vectors.size());
+
+    for(map< string, Vector<double> >::const_iterator iterator = vectors.begin(); iterator != vectors.end(); ++iterator)
+    {
+        write_string(file, iterator->first);
+        write_doubles(file, iterator->second.data(), iterator->second.size());
+    }
+
+    write_size(file, matrices.size());
+
+    for(map< string, Matrix<double> >::const_iterator iterator = matrices.begin(); iterator != matrices.end(); ++iterator)
+    {
+        write_string(file, iterator->first);
+        write_size(file, iterator->second.get_rows_number());
+        write_size(file, iterator->second.get_columns_number());
+        write_doubles(file, iterator->second.data(), iterator->second.size());
+    }
+
+    write_size(file, scalars.size());
+
+    for(map<string, double>::const_iterator iterator = scalars.begin(); iterator != scalars.end(); ++iterator)
+    {
+        write_string(file, iterator->first);
+        file.write(reinterpret_cast<const char*>(&iterator->second), sizeof(double));
+    }
+
+    write_size(file, integers.size());
+
+    for(map<string, size_t>::const_iterator iterator = integers.begin(); iterator != integers.end(); ++iterator)
+    {
+        write_string(file, iterator->first);
+        write_size(file, iterator->second);
+    }
+
+    write_size(file, texts.size());
+
+    for(map<string, string>::const_iterator iterator = texts.begin(); iterator != texts.end(); ++iterator)
+    {
+        write_string(file, iterator->first);
+        write_string(file, iterator->second);
+    }
+
+    file.close();
+
+    if(file.fail() || !synchronize_file(temporary_file_name))
+    {
+        remove(temporary_file_name.c_str());
+
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: TrainingCheckpoint class.\n"
+               << "void save(const string&) const method.\n"
+               << "Cannot write checkpoint file: " << temporary_file_name << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    if(!replace_file(temporary_file_name, file_name))
+    {
+        remove(temporary_file_name.c_str());
+
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: TrainingCheckpoint class.\n"
+               << "void save(const string&) const method.\n"
+               << "Cannot rename " << temporary_file_name << " to " << file_name << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    // The directory is also written to the disk, so that the renaming is not lost either
+
+    const size_t separator_position = file_name.find_last_of("/\\");
+
+    synchronize_file(separator_position == string::npos ? string(".") : file_name.substr(0, separator_position + 1));
+}
+
+
+/// Loads a checkpoint from a binary file written by the save method.
+/// The values previously held by the checkpoint are removed.
+/// @param file_name Name of the checkpoint file.
+
+void TrainingCheckpoint::load(const string& file_name)
+{
+    ifstream file(file_name.c_str(), ios::binary);
+
+    if(!file.is_open())
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: TrainingCheckpoint class.\n"
+               << "void load(const string&) method.\n"
+               << "Cannot open checkpoint file: " << file_name << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    char magic[sizeof(checkpoint_magic)];
+    uint64_t version = 0;
+
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+
+    if(!file || !equal(magic, magic + sizeof(magic), checkpoint_magic) || version != checkpoint_version)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: TrainingCheckpoint class.\n"
+               << "void load(const string&) method.\n"
+               << file_name << " is not a checkpoint file of version " << checkpoint_version << ".\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    set();
+
+    training_algorithm_type = read_string(file);
+    epoch = read_size(file);
+
+    const size_t vectors_number = read_size(file);
+
+    for(size_t i = 0; i < vectors_number && file; i++)
+    {
+        const string name = read_string(file);
+
+        vectors[name] = read_doubles(file);
+    }
+
+    const size_t matrices_number = read_size(file);
+
+    for(size_t i = 0; i < matrices_number && file; i++)
+    {
+        const string name = read_string(file);
+
+        const size_t rows_number = read_size(file);
+        const size_t columns_number = read_size(file);
+
+        const Vector<double> values = read_doubles(file);
+
+        Matrix<double>& matrix = matrices[name];
+
+        matrix.set(rows_number, columns_number);
+
+        if(values.size() == matrix.size())
+        {
+            copy(values.begin(), values.end(), matrix.begin());
+        }
+        else
+        {
+            file.setstate(ios::failbit);
+        }
+    }
+
+    const size_t scalars_number = read_size(file);
+
+    for(size_t i = 0; i < scalars_number && file; i++)
+    {
+        const string name = read_string(file);
+
+        file.read(reinterpret_cast<char*>(&scalars[name]), sizeof(double));
+    }
+
+    const size_t integers_number = read_size(file);
+
+    for(size_t i = 0; i < integers_number && file; i++)
+    {
+        const string name = read_string(file);
+
+        integers[name] = read_size(file);
+    }
+
+    const size_t texts_number = read_size(file);
+
+    for(size_t i = 0; i < texts_number && file; i++)
+    {
+        const string name = read_string(file);
+
+        texts[name] = read_string(file);
+    }
+
+    if(!file)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: TrainingCheckpoint class.\n"
+               << "void load(const string&) method.\n"
+               << "Checkpoint file " << file_name << " is truncated or corrupted.\n";
+
+        throw logic_error(buffer.str());
+    }
+}
+
+
+/// Throws the exception for a value which is not in the checkpoint.
+/// @param method Signature of the method which looked for the value.
+/// @param name Name of the value.
+
+void TrainingCheckpoint::throw_missing_entry(const string& method, const string& name) const
+{
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingCheckpoint class.\n"
+           << method << " method.\n"
+           << "Checkpoint of " << training_algorithm_type << " has no value named " << name << ".\n";
+
+    throw logic_error(buffer.str());
+}
+
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
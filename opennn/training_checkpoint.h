@@ -0,0 +1,154 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   T R A I N I N G   C H E C K P O I N T   C L A S S   H E A D E R                                            */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __TRAININGCHECKPOINT_H__
+#define __TRAININGCHECKPOINT_H__
+
+// System includes
+
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+
+// OpenNN includes
+
+#include "vector.h"
+#include "matrix.h"
+
+namespace OpenNN
+{
+
+///
+/// This class holds a snapshot of a training process: the epoch from which it continues,
+/// the parameters of the neural network and the state of the training algorithm, such as momentum terms,
+/// inverse Hessian approximations, counters or the state of random number generators.
+/// Each value is stored under a name chosen by the training algorithm which writes it.
+///
+/// Checkpoints are saved in a compact binary format, in the byte order of the machine, so that doubles are restored bit by bit.
+/// The file is first written with a temporary name and then renamed, so that an interrupted save never destroys the previous checkpoint.
+///
+
+class TrainingCheckpoint
+{
+
+public:
+
+    // DEFAULT CONSTRUCTOR
+
+    explicit TrainingCheckpoint();
+
+    // FILE CONSTRUCTOR
+
+    explicit TrainingCheckpoint(const string&);
+
+    // DESTRUCTOR
+
+    virtual ~TrainingCheckpoint();
+
+    // Get methods
+
+    const string& get_training_algorithm_type() const;
+
+    const size_t& get_epoch() const;
+
+    bool has_vector(const string&) const;
+    bool has_matrix(const string&) const;
+    bool has_scalar(const string&) const;
+    bool has_integer(const string&) const;
+    bool has_text(const string&) const;
+
+    const Vector<double>& get_vector(const string&) const;
+    const Matrix<double>& get_matrix(const string&) const;
+    double get_scalar(const string&) const;
+    size_t get_integer(const string&) const;
+    const string& get_text(const string&) const;
+
+    // Set methods
+
+    void set();
+
+    void set_training_algorithm_type(const string&);
+
+    void set_epoch(const size_t&);
+
+    void set_vector(const string&, const Vector<double>&);
+    void set_matrix(const string&, const Matrix<double>&);
+    void set_scalar(const string&, const double&);
+    void set_integer(const string&, const size_t&);
+    void set_text(const string&, const string&);
+
+    // Serialization methods
+
+    void save(const string&) const;
+    void load(const string&);
+
+private:
+
+    void throw_missing_entry(const string&, const string&) const;
+
+    // MEMBERS
+
+    /// Type of the training algorithm which wrote the checkpoint.
+
+    string training_algorithm_type;
+
+    /// Epoch from which the training continues.
+
+    size_t epoch = 0;
+
+    /// Named vectors, such as the parameters or the last increment.
+
+    map< string, Vector<double> > vectors;
+
+    /// Named matrices, such as the inverse Hessian approximation.
+
+    map< string, Matrix<double> > matrices;
+
+    /// Named real values, such as the last losses.
+
+    map<string, double> scalars;
+
+    /// Named integer values, such as counters.
+
+    map<string, size_t> integers;
+
+    /// Named texts, such as the state of a random number generator.
+
+    map<string, string> texts;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -185,6 +185,14 @@ const double& TrainingRateAlgorithm::get_error_training_rate() const
 }
 
 
+/// Returns the number of training rates which are evaluated together while bracketing the minimum.
+
+const size_t& TrainingRateAlgorithm::get_bracketing_evaluations_number() const
+{
+   return(bracketing_evaluations_number);
+}
+
+
 /// Returns true if messages from this class can be displayed on the screen, or false if messages from
 /// this class can't be displayed on the screen.
 
@@ -236,6 +244,8 @@ void TrainingRateAlgorithm::set_default()
 
    error_training_rate = 1.0e9;
 
+   bracketing_evaluations_number = 1;
+
    // UTILITIES
 
    display = true;
@@ -376,6 +386,32 @@ void TrainingRateAlgorithm::set_error_training_rate(const double& new_error_trai
 }
 
 
+/// Sets the number of training rates of the bracketing sequence which are evaluated in the same pass over the training instances.
+/// @param new_bracketing_evaluations_number Number of training rates. It must be greater than zero.
+
+void TrainingRateAlgorithm::set_bracketing_evaluations_number(const size_t& new_bracketing_evaluations_number)
+{
+   // Control sentence(if debug)
+
+   #ifdef __OPENNN_DEBUG__ 
+
+   if(new_bracketing_evaluations_number == 0)
+   {
+      ostringstream buffer;
+
+      buffer << "OpenNN Exception: TrainingRateAlgorithm class.\n"
+             << "void set_bracketing_evaluations_number(const size_t&) method.\n"
+             << "Bracketing evaluations number must be greater than 0.\n";
+
+      throw logic_error(buffer.str());
+   }
+
+   #endif
+
+   bracketing_evaluations_number = new_bracketing_evaluations_number;
+}
+
+
 // void set_display(const bool&) method
 
 /// Sets a new display value.
@@ -450,6 +486,96 @@ Vector<double> TrainingRateAlgorithm::calculate_directional_point(const double&
 }
 
 
+/// Returns the loss for a training rate along a training direction.
+/// Losses already calculated during the current line search are not calculated again.
+/// @param training_direction Training direction.
+/// @param training_rate Training rate.
+
+double TrainingRateAlgorithm::calculate_loss(const Vector<double>& training_direction, const double& training_rate) const
+{
+   const map<double, double>::const_iterator it = losses_cache.find(training_rate);
+
+   if(it != losses_cache.end())
+   {
+      return(it->second);
+   }
+
+   const double loss = loss_index_pointer->calculate_training_loss(training_direction, training_rate);
+
+   losses_cache[training_rate] = loss;
+
+   return(loss);
+}
+
+
+/// Returns the losses for several training rates along a training direction.
+/// The rates which have not been calculated during the current line search are evaluated in a single call to the loss index.
+/// @param training_direction Training direction.
+/// @param training_rates Training rates.
+
+Vector<double> TrainingRateAlgorithm::calculate_losses(const Vector<double>& training_direction, const Vector<double>& training_rates) const
+{
+   const size_t training_rates_number = training_rates.size();
+
+   Vector<double> new_training_rates;
+
+   for(size_t i = 0; i < training_rates_number; i++)
+   {
+      if(losses_cache.find(training_rates[i]) == losses_cache.end()
+      && !new_training_rates.contains(training_rates[i]))
+      {
+         new_training_rates.push_back(training_rates[i]);
+      }
+   }
+
+   if(!new_training_rates.empty())
+   {
+      const Vector<double> new_losses = loss_index_pointer->calculate_training_losses(training_direction, new_training_rates);
+
+      for(size_t i = 0; i < new_training_rates.size(); i++)
+      {
+         losses_cache[new_training_rates[i]] = new_losses[i];
+      }
+   }
+
+   Vector<double> losses(training_rates_number);
+
+   for(size_t i = 0; i < training_rates_number; i++)
+   {
+      losses[i] = losses_cache[training_rates[i]];
+   }
+
+   return(losses);
+}
+
+
+/// Returns the loss for a training rate of a bracketing sequence, in which each rate is the previous one times a factor.
+/// If that loss has not been calculated yet, it is calculated together with the losses of the following rates of the sequence,
+/// up to the bracketing evaluations number.
+/// @param training_direction Training direction.
+/// @param training_rate Training rate.
+/// @param factor Ratio between consecutive training rates of the sequence.
+
+double TrainingRateAlgorithm::calculate_bracketing_loss(const Vector<double>& training_direction, const double& training_rate, const double& factor) const
+{
+   if(bracketing_evaluations_number > 1 && losses_cache.find(training_rate) == losses_cache.end())
+   {
+      Vector<double> training_rates(bracketing_evaluations_number);
+
+      training_rates[0] = training_rate;
+
+      for(size_t i = 1; i < bracketing_evaluations_number; i++)
+      {
+         training_rates[i] = training_rates[i-1]*factor;
+      }
+
+      calculate_losses(training_direction, training_rates);
+   }
+
+   return(calculate_loss(training_direction, training_rate));
+}
+
+
 /// Returns bracketing triplet.
 /// This algorithm is used by line minimization algorithms. 
 /// @param loss Initial Performance value.
@@ -463,11 +589,15 @@ TrainingRateAlgorithm::Triplet TrainingRateAlgorithm::calculate_bracketing_tripl
 {    
     Triplet triplet;
 
+    losses_cache.clear();
+
     // Left point
 
     triplet.A[0] = 0.0;
     triplet.A[1] = loss;
 
+    losses_cache[triplet.A[0]] = triplet.A[1];
+
    if(training_direction == 0.0 || initial_training_rate == 0.0)
    {
        triplet.U = triplet.A;
@@ -481,7 +611,7 @@ TrainingRateAlgorithm::Triplet TrainingRateAlgorithm::calculate_bracketing_tripl
    // Right point
 
    triplet.B[0] = initial_training_rate;
-   triplet.B[1] = loss_index_pointer->calculate_training_loss(training_direction, triplet.B[0]);
+   triplet.B[1] = calculate_loss(training_direction, triplet.B[0]);
    count++;
 
    if(triplet.A[1] > triplet.B[1])
@@ -491,7 +621,7 @@ TrainingRateAlgorithm::Triplet TrainingRateAlgorithm::calculate_bracketing_tripl
        triplet.U = triplet.B;
 
        triplet.B[0] *= golden_ratio;
-       triplet.B[1] = loss_index_pointer->calculate_training_loss(training_direction, triplet.B[0]);
+       triplet.B[1] = calculate_bracketing_loss(training_direction, triplet.B[0], golden_ratio);
        count++;
 
        while(triplet.U[1] > triplet.B[1])
@@ -500,7 +630,7 @@ TrainingRateAlgorithm::Triplet TrainingRateAlgorithm::calculate_bracketing_tripl
            triplet.U = triplet.B;
 
            triplet.B[0] *= golden_ratio;
-           triplet.B[1] = loss_index_pointer->calculate_training_loss(training_direction, triplet.B[0]);
+           triplet.B[1] = calculate_bracketing_loss(training_direction, triplet.B[0], golden_ratio);
            count++;
        }
    }
@@ -509,7 +639,7 @@ TrainingRateAlgorithm::Triplet TrainingRateAlgorithm::calculate_bracketing_tripl
        //cout << "Case 2" << endl;
 
        triplet.U[0] = triplet.A[0] + (triplet.B[0] - triplet.A[0])*0.382;
-       triplet.U[1] = loss_index_pointer->calculate_training_loss(training_direction, triplet.U[0]);
+       triplet.U[1] = calculate_bracketing_loss(training_direction, triplet.U[0], 0.382);
        count++;
 
        while(triplet.A[1] < triplet.U[1])
@@ -517,7 +647,7 @@ TrainingRateAlgorithm::Triplet TrainingRateAlgorithm::calculate_bracketing_tripl
           triplet.B = triplet.U;
 
           triplet.U[0] = triplet.A[0] + (triplet.B[0]-triplet.A[0])*0.382;
-          triplet.U[1] = loss_index_pointer->calculate_training_loss(training_direction, triplet.U[0]);
+          triplet.U[1] = calculate_bracketing_loss(training_direction, triplet.U[0], 0.382);
           count++;
        }
    }
@@ -540,8 +670,10 @@ Vector<double> TrainingRateAlgorithm::calculate_fixed_directional_point(const do
 {
    Vector<double> directional_point(2);
 
+   losses_cache.clear();
+
    directional_point[0] = initial_training_rate;
-   directional_point[1] = loss_index_pointer->calculate_training_loss(training_direction, initial_training_rate);
+   directional_point[1] = calculate_loss(training_direction, initial_training_rate);
 
    return(directional_point);
 }
@@ -578,7 +710,7 @@ Vector<double> TrainingRateAlgorithm::calculate_golden_section_directional_point
       {
          V[0] = calculate_golden_section_training_rate(triplet);
 
-         V[1] = loss_index_pointer->calculate_training_loss(training_direction, V[0]);
+         V[1] = calculate_loss(training_direction, V[0]);
 
          // Update points
  
@@ -643,7 +775,7 @@ Vector<double> TrainingRateAlgorithm::calculate_golden_section_directional_point
 
 	  Vector<double> X(2);
       X[0] = initial_training_rate;
-      X[1] = loss_index_pointer->calculate_training_loss(training_direction, X[0]);
+      X[1] = calculate_loss(training_direction, X[0]);
 
 	   if(X[1] > loss)
 	   {
@@ -704,7 +836,7 @@ Vector<double> TrainingRateAlgorithm::calculate_Brent_method_directional_point(c
 
          // Calculate loss for V
 
-         V[1] = loss_index_pointer->calculate_training_loss(training_direction, V[0]);
+         V[1] = calculate_loss(training_direction, V[0]);
          count++;
 
          // Update points
@@ -808,7 +940,7 @@ Vector<double> TrainingRateAlgorithm::calculate_Brent_method_directional_point(c
 
 	  Vector<double> X(2);
       X[0] = initial_training_rate;
-      X[1] = loss_index_pointer->calculate_training_loss(training_direction, X[0]);
+      X[1] = calculate_loss(training_direction, X[0]);
 
       if(X[1] > loss)
 	  {
@@ -971,6 +1103,18 @@ tinyxml2::XMLDocument* TrainingRateAlgorithm::to_XML() const
    element->LinkEndChild(text);
    }
 
+   // Bracketing evaluations number
+   {
+   element = document->NewElement("BracketingEvaluationsNumber");
+   root_element->LinkEndChild(element);
+
+   buffer.str("");
+   buffer << bracketing_evaluations_number;
+
+   text = document->NewText(buffer.str().c_str());
+   element->LinkEndChild(text);
+   }
+
    // Warning training rate 
 //   {
 //   element = document->NewElement("WarningTrainingRate");
@@ -1041,6 +1185,16 @@ void TrainingRateAlgorithm::write_XML(tinyxml2::XMLPrinter& file_stream) const
 
     file_stream.CloseElement();
 
+    // Bracketing evaluations number
+
+    file_stream.OpenElement("BracketingEvaluationsNumber");
+
+    buffer.str("");
+    buffer << bracketing_evaluations_number;
+
+    file_stream.PushText(buffer.str().c_str());
+
+    file_stream.CloseElement();
 
     file_stream.CloseElement();
 }
@@ -1103,6 +1257,25 @@ void TrainingRateAlgorithm::from_XML(const tinyxml2::XMLDocument& document)
        }
    }
 
+   // Bracketing evaluations number
+   {
+       const tinyxml2::XMLElement* element = root_element->FirstChildElement("BracketingEvaluationsNumber");
+
+       if(element)
+       {
+          const size_t new_bracketing_evaluations_number = static_cast<size_t>(atoi(element->GetText()));
+
+          try
+          {
+             set_bracketing_evaluations_number(new_bracketing_evaluations_number);
+          }
+          catch(const logic_error& e)
+          {
+             cerr << e.what() << endl;
+          }
+       }
+   }
+
    // Warning training rate 
    {
        const tinyxml2::XMLElement* element = root_element->FirstChildElement("WarningTrainingRate");
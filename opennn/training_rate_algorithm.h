@@ -22,6 +22,7 @@
 #include <limits>
 #include <cmath>
 #include <ctime>
+#include <map>
 
 // OpenNN includes
 
@@ -235,6 +236,8 @@ public:
    const double& get_warning_training_rate() const;
 
    const double& get_error_training_rate() const;
+
+   const size_t& get_bracketing_evaluations_number() const;
   
    // Utilities
    
@@ -260,12 +263,21 @@ public:
 
    void set_error_training_rate(const double&);
 
+   void set_bracketing_evaluations_number(const size_t&);
+
    // Utilities
 
    void set_display(const bool&);
 
    void set_default();
 
+   // Loss evaluation methods
+
+   double calculate_loss(const Vector<double>&, const double&) const;
+   Vector<double> calculate_losses(const Vector<double>&, const Vector<double>&) const;
+
+   double calculate_bracketing_loss(const Vector<double>&, const double&, const double&) const;
+
    // Training rate method
 
    double calculate_golden_section_training_rate(const Triplet&) const;
@@ -312,6 +324,16 @@ protected:
 
    double error_training_rate;
 
+   /// Number of training rates of the bracketing sequence which are evaluated in the same pass over the training instances.
+   /// Values greater than one evaluate some rates which might not be needed, in exchange for fewer passes.
+
+   size_t bracketing_evaluations_number;
+
+   /// Losses already calculated along the current training direction, indexed by training rate.
+   /// It is cleared at the beginning of each line search.
+
+   mutable map<double, double> losses_cache;
+
    // UTILITIES
 
    /// Display messages to screen.
@@ -98,6 +98,7 @@ TrainingStrategy::~TrainingStrategy()
     delete quasi_Newton_method_pointer;
     delete Levenberg_Marquardt_algorithm_pointer;
     delete stochastic_gradient_descent_pointer;
+    delete adaptive_moment_estimation_pointer;
 }
 
 
@@ -303,6 +304,26 @@ StochasticGradientDescent* TrainingStrategy::get_stochastic_gradient_descent_poi
 }
 
 
+/// Returns a pointer to the adaptive moment estimation main algorithm.
+/// It also throws an exception if that pointer is nullptr.
+
+AdaptiveMomentEstimation* TrainingStrategy::get_adaptive_moment_estimation_pointer() const
+{
+    if(!adaptive_moment_estimation_pointer)
+    {
+        ostringstream buffer;
+
+        buffer << "OpenNN Exception: TrainingStrategy class.\n"
+               << "AdaptiveMomentEstimation* get_adaptive_moment_estimation_pointer() const method.\n"
+               << "adaptive moment estimation pointer is nullptr.\n";
+
+        throw logic_error(buffer.str());
+    }
+
+    return(adaptive_moment_estimation_pointer);
+}
+
+
 
 /// Returns a pointer to the sum squared error which is used as error.
 /// If that object does not exists, an exception is thrown.
@@ -580,6 +601,10 @@ string TrainingStrategy::write_training_method() const
    {
       return("STOCHASTIC_GRADIENT_DESCENT");
    }
+   else if(training_method == ADAPTIVE_MOMENT_ESTIMATION)
+   {
+      return("ADAPTIVE_MOMENT_ESTIMATION");
+   }
    else
    {
       ostringstream buffer;
@@ -621,6 +646,10 @@ string TrainingStrategy::write_training_method_text() const
    {
       return("Stochastic gradient descent");
    }
+   else if(training_method == ADAPTIVE_MOMENT_ESTIMATION)
+   {
+      return("adaptive moment estimation");
+   }
    else
    {
       ostringstream buffer;
@@ -798,6 +827,12 @@ void TrainingStrategy::set_training_method(const TrainingMethod& new_training_me
           stochastic_gradient_descent_pointer= new StochasticGradientDescent(loss_index_pointer);
       }
       break;
+
+      case ADAPTIVE_MOMENT_ESTIMATION:
+      {
+          adaptive_moment_estimation_pointer = new AdaptiveMomentEstimation(loss_index_pointer);
+      }
+      break;
    }
 }
 
@@ -827,6 +862,10 @@ void TrainingStrategy::set_training_method(const string& new_training_method)
    {
       set_training_method(STOCHASTIC_GRADIENT_DESCENT);
    }
+   else if(new_training_method == "ADAPTIVE_MOMENT_ESTIMATION")
+   {
+      set_training_method(ADAPTIVE_MOMENT_ESTIMATION);
+   }
    else
    {
       ostringstream buffer;
@@ -878,6 +917,12 @@ void TrainingStrategy::set_loss_index_pointer(LossIndex* new_loss_index_pointer)
          stochastic_gradient_descent_pointer->set_loss_index_pointer(new_loss_index_pointer);
       }
       break;
+
+      case ADAPTIVE_MOMENT_ESTIMATION:
+      {
+         adaptive_moment_estimation_pointer->set_loss_index_pointer(new_loss_index_pointer);
+      }
+      break;
    }
 
 }
@@ -925,6 +970,12 @@ void TrainingStrategy::set_display(const bool& new_display)
            stochastic_gradient_descent_pointer->set_display(display);
       }
       break;
+
+      case ADAPTIVE_MOMENT_ESTIMATION:
+      {
+           adaptive_moment_estimation_pointer->set_display(display);
+      }
+      break;
    }
 }
 
@@ -949,12 +1000,14 @@ void TrainingStrategy::destruct_training_algorithm()
     delete quasi_Newton_method_pointer;
     delete Levenberg_Marquardt_algorithm_pointer;
     delete stochastic_gradient_descent_pointer;
+    delete adaptive_moment_estimation_pointer;
 
     gradient_descent_pointer = nullptr;
     conjugate_gradient_pointer = nullptr;
     quasi_Newton_method_pointer = nullptr;
     Levenberg_Marquardt_algorithm_pointer = nullptr;
     stochastic_gradient_descent_pointer = nullptr;
+    adaptive_moment_estimation_pointer = nullptr;
 }
 
 
@@ -1109,6 +1162,15 @@ TrainingStrategy::Results TrainingStrategy::perform_training() const
            = stochastic_gradient_descent_pointer->perform_training();
       }
       break;
+
+      case ADAPTIVE_MOMENT_ESTIMATION:
+      {
+           adaptive_moment_estimation_pointer->set_display(display);
+
+           training_strategy_results.adaptive_moment_estimation_results_pointer
+           = adaptive_moment_estimation_pointer->perform_training();
+      }
+      break;
    }
 
    return training_strategy_results;
@@ -1179,10 +1241,295 @@ switch(training_method)
 //        = stochastic_gradient_descent_pointer->perform_training();
    }
    break;
+
+   case ADAPTIVE_MOMENT_ESTIMATION:
+   {
+        adaptive_moment_estimation_pointer->set_display(display);
+
+        adaptive_moment_estimation_pointer->perform_training_void();
+   }
+   break;
 }
 }
 
 
+/// Trains the neural network several times, from different initial parameters, and returns the results of each training.
+/// Up to threads_number trainings are performed at the same time, each one on copies of the neural network,
+/// the loss index and the training algorithm, and the threads which are left are shared out among the trainings
+/// to calculate the loss of each one in parallel.
+/// The results of each training only depend on its initial parameters, not on the order in which the trainings are performed.
+/// The data set is shared by all the trainings, and it must not be modified until they finish.
+/// The neural network of this training strategy is not modified.
+/// @param initial_parameters Initial parameters of each training.
+/// @param final_parameters Parameters of the neural network at the end of each training.
+/// @param threads_number Maximum number of threads used by all the trainings.
+/// @return Results of each training. They must be deleted by the caller.
+
+Vector<TrainingStrategy::Results*> TrainingStrategy::perform_training_trials(const Vector< Vector<double> >& initial_parameters,
+                                                                            Vector< Vector<double> >& final_parameters,
+                                                                            const size_t& threads_number) const
+{
+    const LossIndex* loss_index_pointer = get_loss_index_pointer();
+
+    const NeuralNetwork* trials_neural_network_pointer = loss_index_pointer->get_neural_network_pointer();
+    const DataSet* trials_data_set_pointer = loss_index_pointer->get_data_set_pointer();
+
+    const size_t trials_number = initial_parameters.size();
+
+#ifdef __OPENNN_MPI__
+
+    const size_t concurrent_trials_number = 1;
+
+#else
+
+    const size_t concurrent_trials_number = max(static_cast<size_t>(1), min(trials_number, threads_number));
+
+#endif
+
+#ifdef _OPENMP
+    const int trial_threads_number = static_cast<int>(max(static_cast<size_t>(1), threads_number/concurrent_trials_number));
+#endif
+
+    Vector<Results*> trials_results(trials_number, nullptr);
+
+    final_parameters.set(trials_number);
+
+    // The batches are gathered before the trainings share the data set, so that they only read them
+
+    trials_data_set_pointer->get_training_batches(loss_index_pointer->get_batch_size());
+    trials_data_set_pointer->get_selection_batches(loss_index_pointer->get_batch_size());
+
+    atomic<size_t> next_trial(0);
+
+    exception_ptr trials_exception;
+    mutex trials_exception_mutex;
+
+    const auto perform_trials = [&]()
+    {
+#ifdef _OPENMP
+        omp_set_num_threads(trial_threads_number);
+#endif
+
+        for(size_t trial = next_trial++; trial < trials_number; trial = next_trial++)
+        {
+            try
+            {
+                NeuralNetwork neural_network(*trials_neural_network_pointer);
+
+                neural_network.set_parameters(initial_parameters[trial]);
+
+#ifdef __OPENNN_MPI__
+
+                neural_network.set_MPI(&neural_network);
+
+#endif
+
+                trials_results[trial] = perform_trial_training(&neural_network);
+
+                final_parameters[trial] = neural_network.get_parameters();
+            }
+            catch(...)
+            {
+                lock_guard<mutex> lock(trials_exception_mutex);
+
+                if(!trials_exception) trials_exception = current_exception();
+            }
+        }
+    };
+
+#ifdef _OPENMP
+    const int threads_number_before = omp_get_max_threads();
+#endif
+
+    vector<thread> trials_threads;
+
+    for(size_t i = 1; i < concurrent_trials_number; i++)
+    {
+        trials_threads.push_back(thread(perform_trials));
+    }
+
+    perform_trials();
+
+    for(size_t i = 0; i < trials_threads.size(); i++)
+    {
+        trials_threads[i].join();
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(threads_number_before);
+#endif
+
+    if(trials_exception)
+    {
+        for(size_t i = 0; i < trials_number; i++)
+        {
+            delete trials_results[i];
+        }
+
+        rethrow_exception(trials_exception);
+    }
+
+    return(trials_results);
+}
+
+
+/// Returns a copy of a loss index, of the same class.
+/// The copy must be deleted by the caller.
+/// @param loss_index_pointer Pointer to the loss index to be copied.
+
+static LossIndex* copy_loss_index(const LossIndex* loss_index_pointer)
+{
+    if(const SumSquaredError* sum_squared_error_pointer = dynamic_cast<const SumSquaredError*>(loss_index_pointer))
+    {
+        return(new SumSquaredError(*sum_squared_error_pointer));
+    }
+    else if(const MeanSquaredError* mean_squared_error_pointer = dynamic_cast<const MeanSquaredError*>(loss_index_pointer))
+    {
+        return(new MeanSquaredError(*mean_squared_error_pointer));
+    }
+    else if(const RootMeanSquaredError* root_mean_squared_error_pointer = dynamic_cast<const RootMeanSquaredError*>(loss_index_pointer))
+    {
+        return(new RootMeanSquaredError(*root_mean_squared_error_pointer));
+    }
+    else if(const NormalizedSquaredError* normalized_squared_error_pointer = dynamic_cast<const NormalizedSquaredError*>(loss_index_pointer))
+    {
+        return(new NormalizedSquaredError(*normalized_squared_error_pointer));
+    }
+    else if(const MinkowskiError* Minkowski_error_pointer = dynamic_cast<const MinkowskiError*>(loss_index_pointer))
+    {
+        return(new MinkowskiError(*Minkowski_error_pointer));
+    }
+    else if(const WeightedSquaredError* weighted_squared_error_pointer = dynamic_cast<const WeightedSquaredError*>(loss_index_pointer))
+    {
+        return(new WeightedSquaredError(*weighted_squared_error_pointer));
+    }
+    else if(const CrossEntropyError* cross_entropy_error_pointer = dynamic_cast<const CrossEntropyError*>(loss_index_pointer))
+    {
+        return(new CrossEntropyError(*cross_entropy_error_pointer));
+    }
+
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: TrainingStrategy class.\n"
+           << "Results* perform_trial_training(NeuralNetwork*) const method.\n"
+           << "Unknown loss index.\n";
+
+    throw logic_error(buffer.str());
+}
+
+
+/// Prepares the copy of a training algorithm which trains a neural network in a trial.
+/// The copy trains with its own copy of the loss index, displays no messages, records no history sinks and saves no checkpoints,
+/// so that several trials can be performed at the same time.
+/// @param training_algorithm Copy of a training algorithm.
+/// @param loss_index Copy of the loss index of the training algorithm, which is set by this function.
+/// @param trial_neural_network_pointer Pointer to the neural network to be trained.
+
+static void prepare_trial_training_algorithm(TrainingAlgorithm& training_algorithm,
+                                             unique_ptr<LossIndex>& loss_index,
+                                             NeuralNetwork* trial_neural_network_pointer)
+{
+    loss_index.reset(copy_loss_index(training_algorithm.get_loss_index_pointer()));
+
+    loss_index->set_neural_network_pointer(trial_neural_network_pointer);
+
+    training_algorithm.set_loss_index_pointer(loss_index.get());
+
+    training_algorithm.set_display(false);
+
+    training_algorithm.set_parameters_history_sink(nullptr);
+    training_algorithm.set_gradient_history_sink(nullptr);
+    training_algorithm.set_training_direction_history_sink(nullptr);
+    training_algorithm.set_Hessian_approximation_history_sink(nullptr);
+
+    training_algorithm.set_checkpoint_file_name("");
+}
+
+
+/// Trains a neural network with copies of the training algorithm of this training strategy and of its loss index.
+/// The results point to the training algorithm of this training strategy.
+/// @param trial_neural_network_pointer Pointer to the neural network to be trained.
+/// @return Results of the training. They must be deleted by the caller.
+
+TrainingStrategy::Results* TrainingStrategy::perform_trial_training(NeuralNetwork* trial_neural_network_pointer) const
+{
+    unique_ptr<LossIndex> loss_index;
+
+    unique_ptr<Results> results(new Results());
+
+    switch(training_method)
+    {
+       case GRADIENT_DESCENT:
+       {
+          GradientDescent gradient_descent(*gradient_descent_pointer);
+
+          prepare_trial_training_algorithm(gradient_descent, loss_index, trial_neural_network_pointer);
+
+          results->gradient_descent_results_pointer = gradient_descent.perform_training();
+          results->gradient_descent_results_pointer->gradient_descent_pointer = gradient_descent_pointer;
+       }
+       break;
+
+       case CONJUGATE_GRADIENT:
+       {
+          ConjugateGradient conjugate_gradient(*conjugate_gradient_pointer);
+
+          prepare_trial_training_algorithm(conjugate_gradient, loss_index, trial_neural_network_pointer);
+
+          results->conjugate_gradient_results_pointer = conjugate_gradient.perform_training();
+          results->conjugate_gradient_results_pointer->conjugate_gradient_pointer = conjugate_gradient_pointer;
+       }
+       break;
+
+       case QUASI_NEWTON_METHOD:
+       {
+          QuasiNewtonMethod quasi_Newton_method(*quasi_Newton_method_pointer);
+
+          prepare_trial_training_algorithm(quasi_Newton_method, loss_index, trial_neural_network_pointer);
+
+          results->quasi_Newton_method_results_pointer = quasi_Newton_method.perform_training();
+          results->quasi_Newton_method_results_pointer->quasi_Newton_method_pointer = quasi_Newton_method_pointer;
+       }
+       break;
+
+       case LEVENBERG_MARQUARDT_ALGORITHM:
+       {
+          LevenbergMarquardtAlgorithm Levenberg_Marquardt_algorithm(*Levenberg_Marquardt_algorithm_pointer);
+
+          prepare_trial_training_algorithm(Levenberg_Marquardt_algorithm, loss_index, trial_neural_network_pointer);
+
+          results->Levenberg_Marquardt_algorithm_results_pointer = Levenberg_Marquardt_algorithm.perform_training();
+          results->Levenberg_Marquardt_algorithm_results_pointer->Levenberg_Marquardt_algorithm_pointer = Levenberg_Marquardt_algorithm_pointer;
+       }
+       break;
+
+       case STOCHASTIC_GRADIENT_DESCENT:
+       {
+          StochasticGradientDescent stochastic_gradient_descent(*stochastic_gradient_descent_pointer);
+
+          prepare_trial_training_algorithm(stochastic_gradient_descent, loss_index, trial_neural_network_pointer);
+
+          results->stochastic_gradient_descent_results_pointer = stochastic_gradient_descent.perform_training();
+          results->stochastic_gradient_descent_results_pointer->stochastic_gradient_descent_pointer = stochastic_gradient_descent_pointer;
+       }
+       break;
+
+       case ADAPTIVE_MOMENT_ESTIMATION:
+       {
+          AdaptiveMomentEstimation adaptive_moment_estimation(*adaptive_moment_estimation_pointer);
+
+          prepare_trial_training_algorithm(adaptive_moment_estimation, loss_index, trial_neural_network_pointer);
+
+          results->adaptive_moment_estimation_results_pointer = adaptive_moment_estimation.perform_training();
+          results->adaptive_moment_estimation_results_pointer->adaptive_moment_estimation_pointer = adaptive_moment_estimation_pointer;
+       }
+       break;
+    }
+
+    return(results.release());
+}
+
+
 /// Returns a string representation of the training strategy.
 
 string TrainingStrategy::object_to_string() const
@@ -1229,6 +1576,12 @@ string TrainingStrategy::object_to_string() const
 
       break;
 
+      case ADAPTIVE_MOMENT_ESTIMATION:
+
+           buffer << adaptive_moment_estimation_pointer->object_to_string();
+
+      break;
+
 
       default:
 
@@ -1376,6 +1729,26 @@ tinyxml2::XMLDocument* TrainingStrategy::to_XML() const
       }
       break;
 
+      case ADAPTIVE_MOMENT_ESTIMATION:
+      {
+           tinyxml2::XMLElement* main_element = document->NewElement("Main");
+           training_strategy_element->LinkEndChild(main_element);
+
+           main_element->SetAttribute("Type", "ADAPTIVE_MOMENT_ESTIMATION");
+
+           const tinyxml2::XMLDocument* adaptive_moment_estimation_document = adaptive_moment_estimation_pointer->to_XML();
+
+           const tinyxml2::XMLElement* adaptive_moment_estimation_element = adaptive_moment_estimation_document->FirstChildElement("AdaptiveMomentEstimation");
+
+           for( const tinyxml2::XMLNode* nodeFor = adaptive_moment_estimation_element->FirstChild(); nodeFor; nodeFor=nodeFor->NextSibling() ) {
+               tinyxml2::XMLNode* copy = nodeFor->DeepClone( document );
+               main_element->InsertEndChild( copy );
+           }
+
+           delete adaptive_moment_estimation_document;
+      }
+      break;
+
 
 
       default:
@@ -1477,6 +1850,18 @@ void TrainingStrategy::write_XML(tinyxml2::XMLPrinter& file_stream) const
        }
        break;
 
+       case ADAPTIVE_MOMENT_ESTIMATION:
+       {
+            file_stream.OpenElement("Main");
+
+            file_stream.PushAttribute("Type", "ADAPTIVE_MOMENT_ESTIMATION");
+
+            adaptive_moment_estimation_pointer->write_XML(file_stream);
+
+            file_stream.CloseElement();
+       }
+       break;
+
        default:
        {
           ostringstream buffer;
@@ -1610,6 +1995,23 @@ void TrainingStrategy::from_XML(const tinyxml2::XMLDocument& document)
              }
              break;
 
+             case ADAPTIVE_MOMENT_ESTIMATION:
+             {
+                  tinyxml2::XMLDocument new_document;
+
+                  tinyxml2::XMLElement* adaptive_moment_estimation_element = new_document.NewElement("AdaptiveMomentEstimation");
+
+                  for( const tinyxml2::XMLNode* nodeFor=element->FirstChild(); nodeFor; nodeFor=nodeFor->NextSibling() ) {
+                      tinyxml2::XMLNode* copy = nodeFor->DeepClone( &new_document );
+                      adaptive_moment_estimation_element->InsertEndChild( copy );
+                  }
+
+                  new_document.InsertEndChild(adaptive_moment_estimation_element);
+
+                  adaptive_moment_estimation_pointer->from_XML(new_document);
+             }
+             break;
+
              default:
              {
                 ostringstream buffer;
@@ -1705,6 +2107,8 @@ TrainingStrategy::Results::Results()
     Levenberg_Marquardt_algorithm_results_pointer = nullptr;
 
     stochastic_gradient_descent_results_pointer = nullptr;
+
+    adaptive_moment_estimation_results_pointer = nullptr;
 }
 
 
@@ -1726,6 +2130,8 @@ TrainingStrategy::Results::~Results()
 
     delete stochastic_gradient_descent_results_pointer;
 
+    delete adaptive_moment_estimation_results_pointer;
+
 
 }
 
@@ -1774,419 +2180,51 @@ void TrainingStrategy::Results::save(const string& file_name) const
       file << stochastic_gradient_descent_results_pointer->object_to_string();
    }
 
+   if(adaptive_moment_estimation_results_pointer)
+   {
+      file << adaptive_moment_estimation_results_pointer->object_to_string();
+   }
+
    file.close();
 }
 
 #ifdef __OPENNN_MPI__
 
-void TrainingStrategy::set_MPI(LossIndex* new_loss_index, const TrainingStrategy* training_strategy)
-{
-
-    set_loss_index_pointer(new_loss_index);
-
-    int size;
-    MPI_Comm_size(MPI_COMM_WORLD, &size);
+/// Sends the training strategy settings of the first MPI process to all the processes.
+/// The settings are broadcast as XML, and the neural network and data set of each process are kept.
+/// @param training_strategy Original training strategy, initialized by processor 0.
 
+void TrainingStrategy::set_MPI(const TrainingStrategy* training_strategy)
+{
     int rank;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-    int original_training_method;
-
-    int training_rate_method;
-    double loss_tolerance;
-
-    int training_direction_method;
-
-    int inverse_hessian_method;
-
-    double damping_parameter_factor;
-
-    int return_minimum_selection_error_model;
-    double minimum_parameters_increment_norm;
-    double minimum_loss_decrease;
-    double loss_goal;
-    double gradient_norm_goal;
-    int maximum_selection_error_increases;
-    int maximum_iterations_number;
-    int maximum_time;
-    int reserve_parameters_norm_history;
-    int reserve_training_loss_history;
-    int reserve_selection_error_history;
-    int reserve_gradient_norm_history;
+    Vector<char> training_strategy_XML;
 
     if(rank == 0)
     {
-        // Variables to send initialization
-
-        original_training_method = (int)training_strategy->get_training_method();
-
-        switch(original_training_method)
-        {
-            case(int)TrainingStrategy::GRADIENT_DESCENT:
-
-                training_rate_method = (int)training_strategy->get_gradient_descent_pointer()->get_training_rate_algorithm_pointer()->get_training_rate_method();
-                loss_tolerance = training_strategy->get_gradient_descent_pointer()->get_training_rate_algorithm_pointer()->get_loss_tolerance();
-
-                return_minimum_selection_error_model = training_strategy->get_gradient_descent_pointer()->get_return_minimum_selection_error_neural_network();
-                minimum_parameters_increment_norm = training_strategy->get_gradient_descent_pointer()->get_minimum_parameters_increment_norm();
-                minimum_loss_decrease = training_strategy->get_gradient_descent_pointer()->get_minimum_loss_increase();
-                loss_goal = training_strategy->get_gradient_descent_pointer()->get_loss_goal();
-                gradient_norm_goal = training_strategy->get_gradient_descent_pointer()->get_gradient_norm_goal();
-                maximum_selection_error_increases = (int)training_strategy->get_gradient_descent_pointer()->get_maximum_selection_error_decreases();
-                maximum_iterations_number = (int)training_strategy->get_gradient_descent_pointer()->get_maximum_iterations_number();
-                maximum_time = (int)training_strategy->get_gradient_descent_pointer()->get_maximum_time();
-                reserve_parameters_norm_history = training_strategy->get_gradient_descent_pointer()->get_reserve_parameters_norm_history();
-                reserve_training_loss_history = training_strategy->get_gradient_descent_pointer()->get_reserve_loss_history();
-                reserve_selection_error_history = training_strategy->get_gradient_descent_pointer()->get_reserve_selection_error_history();
-                reserve_gradient_norm_history = training_strategy->get_gradient_descent_pointer()->get_reserve_gradient_norm_history();
-
-                break;
-
-            case(int)TrainingStrategy::CONJUGATE_GRADIENT:
-
-                training_direction_method = (int)training_strategy->get_conjugate_gradient_pointer()->get_training_direction_method();
-
-                training_rate_method = (int)training_strategy->get_conjugate_gradient_pointer()->get_training_rate_algorithm_pointer()->get_training_rate_method();
-                loss_tolerance = training_strategy->get_conjugate_gradient_pointer()->get_training_rate_algorithm_pointer()->get_loss_tolerance();
-
-                return_minimum_selection_error_model = training_strategy->get_conjugate_gradient_pointer()->get_return_minimum_selection_error_neural_network();
-                minimum_parameters_increment_norm = training_strategy->get_conjugate_gradient_pointer()->get_minimum_parameters_increment_norm();
-                minimum_loss_decrease = training_strategy->get_conjugate_gradient_pointer()->get_minimum_loss_increase();
-                loss_goal = training_strategy->get_conjugate_gradient_pointer()->get_loss_goal();
-                gradient_norm_goal = training_strategy->get_conjugate_gradient_pointer()->get_gradient_norm_goal();
-                maximum_selection_error_increases = (int)training_strategy->get_conjugate_gradient_pointer()->get_maximum_selection_error_decreases();
-                maximum_iterations_number = (int)training_strategy->get_conjugate_gradient_pointer()->get_maximum_iterations_number();
-                maximum_time = (int)training_strategy->get_conjugate_gradient_pointer()->get_maximum_time();
-                reserve_parameters_norm_history = training_strategy->get_conjugate_gradient_pointer()->get_reserve_parameters_norm_history();
-                reserve_training_loss_history = training_strategy->get_conjugate_gradient_pointer()->get_reserve_loss_history();
-                reserve_selection_error_history = training_strategy->get_conjugate_gradient_pointer()->get_reserve_selection_error_history();
-                reserve_gradient_norm_history = training_strategy->get_conjugate_gradient_pointer()->get_reserve_gradient_norm_history();
-
-                break;
-
-            case(int)TrainingStrategy::QUASI_NEWTON_METHOD:
-
-                inverse_hessian_method = (int)training_strategy->get_quasi_Newton_method_pointer()->get_inverse_Hessian_approximation_method();
-
-                training_rate_method = (int)training_strategy->get_quasi_Newton_method_pointer()->get_training_rate_algorithm_pointer()->get_training_rate_method();
-                loss_tolerance = training_strategy->get_quasi_Newton_method_pointer()->get_training_rate_algorithm_pointer()->get_loss_tolerance();
-
-                return_minimum_selection_error_model = training_strategy->get_quasi_Newton_method_pointer()->get_return_minimum_selection_error_neural_network();
-                minimum_parameters_increment_norm = training_strategy->get_quasi_Newton_method_pointer()->get_minimum_parameters_increment_norm();
-                minimum_loss_decrease = training_strategy->get_quasi_Newton_method_pointer()->get_minimum_loss_increase();
-                loss_goal = training_strategy->get_quasi_Newton_method_pointer()->get_loss_goal();
-                gradient_norm_goal = training_strategy->get_quasi_Newton_method_pointer()->get_gradient_norm_goal();
-                maximum_selection_error_increases = (int)training_strategy->get_quasi_Newton_method_pointer()->get_maximum_selection_error_decreases();
-                maximum_iterations_number = (int)training_strategy->get_quasi_Newton_method_pointer()->get_maximum_iterations_number();
-                maximum_time = (int)training_strategy->get_quasi_Newton_method_pointer()->get_maximum_time();
-                reserve_parameters_norm_history = training_strategy->get_quasi_Newton_method_pointer()->get_reserve_parameters_norm_history();
-                reserve_training_loss_history = training_strategy->get_quasi_Newton_method_pointer()->get_reserve_loss_history();
-                reserve_selection_error_history = training_strategy->get_quasi_Newton_method_pointer()->get_reserve_selection_error_history();
-                reserve_gradient_norm_history = training_strategy->get_quasi_Newton_method_pointer()->get_reserve_gradient_norm_history();
-
-                break;
-
-            case(int)TrainingStrategy::LEVENBERG_MARQUARDT_ALGORITHM:
-
-                damping_parameter_factor = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_damping_parameter_factor();
-
-                return_minimum_selection_error_model = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_return_minimum_selection_error_neural_network();
-                minimum_parameters_increment_norm = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_minimum_parameters_increment_norm();
-                minimum_loss_decrease = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_minimum_loss_increase();
-                loss_goal = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_loss_goal();
-                gradient_norm_goal = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_gradient_norm_goal();
-                maximum_selection_error_increases = (int)training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_maximum_selection_error_decreases();
-                maximum_iterations_number = (int)training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_maximum_iterations_number();
-                maximum_time = (int)training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_maximum_time();
-                reserve_parameters_norm_history = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_reserve_parameters_norm_history();
-                reserve_training_loss_history = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_reserve_loss_history();
-                reserve_selection_error_history = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_reserve_selection_error_history();
-                reserve_gradient_norm_history = training_strategy->get_Levenberg_Marquardt_algorithm_pointer()->get_reserve_gradient_norm_history();
-
-                break;
-
-           case(int)TrainingStrategy::STOCHASTIC_GRADIENT_DESCENT:
-
-                damping_parameter_factor = training_strategy->get_stochastic_gradient_descent_pointer()->get_damping_parameter_factor();
-
-               return_minimum_selection_loss_model = training_strategy->get_stochastic_gradient_descent_pointer()->get_return_minimum_selection_error_neural_network();
-               minimum_parameters_increment_norm = training_strategy->get_stochastic_gradient_descent_pointer()->get_minimum_parameters_increment_norm();
-               minimum_loss_decrease = training_strategy->get_stochastic_gradient_descent_pointer()->get_minimum_loss_increase();
-               loss_goal = training_strategy->get_stochastic_gradient_descent_pointer()->get_loss_goal();
-               gradient_norm_goal = training_strategy->get_stochastic_gradient_descent_pointer()->get_gradient_norm_goal();
-               maximum_selection_loss_increases = (int)training_strategy->get_stochastic_gradient_descent_pointer()->get_maximum_selection_failures();
-               maximum_iterations_number = (int)training_strategy->get_stochastic_gradient_descent_pointer()->get_maximum_iterations_number();
-               maximum_time = (int)training_strategy->get_stochastic_gradient_descent_pointer()->get_maximum_time();
-               reserve_parameters_norm_history = training_strategy->get_stochastic_gradient_descent_pointer()->get_reserve_parameters_norm_history();
-               reserve_training_loss_history = training_strategy->get_stochastic_gradient_descent_pointer()->get_reserve_loss_history();
-               reserve_selection_error_history = training_strategy->get_stochastic_gradient_descent_pointer()->get_reserve_selection_error_history();
-               reserve_gradient_norm_history = training_strategy->get_stochastic_gradient_descent_pointer()->get_reserve_gradient_norm_history();
-
-               break;
-
-
-            default:
-                break;
-        }
-    }
-
-    // Send variables
-
-    MPI_Barrier(MPI_COMM_WORLD);
-
-    if(rank > 0)
-    {
-        MPI_Recv(&original_training_method, 1, MPI_INT, rank-1, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        MPI_Request req[12];
-
-        switch(original_training_method)
-        {
-            case(int)TrainingStrategy::GRADIENT_DESCENT:
-
-                MPI_Irecv(&training_rate_method, 1, MPI_INT, rank-1, 1, MPI_COMM_WORLD, &req[0]);
-                MPI_Irecv(&loss_tolerance, 1, MPI_DOUBLE, rank-1, 2, MPI_COMM_WORLD, &req[1]);
-
-                MPI_Waitall(2, req, MPI_STATUS_IGNORE);
-
-                break;
-
-            case(int)TrainingStrategy::CONJUGATE_GRADIENT:
-
-                MPI_Irecv(&training_rate_method, 1, MPI_INT, rank-1, 1, MPI_COMM_WORLD, &req[0]);
-                MPI_Irecv(&loss_tolerance, 1, MPI_DOUBLE, rank-1, 2, MPI_COMM_WORLD, &req[1]);
-
-                MPI_Irecv(&training_direction_method, 1, MPI_INT, rank-1, 3, MPI_COMM_WORLD, &req[2]);
-
-                MPI_Waitall(3, req, MPI_STATUS_IGNORE);
-
-                break;
-
-            case(int)TrainingStrategy::QUASI_NEWTON_METHOD:
-
-                MPI_Irecv(&training_rate_method, 1, MPI_INT, rank-1, 1, MPI_COMM_WORLD, &req[0]);
-                MPI_Irecv(&loss_tolerance, 1, MPI_DOUBLE, rank-1, 2, MPI_COMM_WORLD, &req[1]);
-
-                MPI_Irecv(&inverse_hessian_method, 1, MPI_INT, rank-1, 3, MPI_COMM_WORLD, &req[2]);
-
-                MPI_Waitall(3, req, MPI_STATUS_IGNORE);
-
-                break;
-
-            case(int)TrainingStrategy::LEVENBERG_MARQUARDT_ALGORITHM:
-
-                MPI_Irecv(&damping_parameter_factor, 1, MPI_DOUBLE, rank-1, 1, MPI_COMM_WORLD, &req[0]);
-
-                MPI_Waitall(1, req, MPI_STATUS_IGNORE);
-
-                break;
-
-            default:
-                break;
-        }
-
-        MPI_Irecv(&return_minimum_selection_error_model, 1, MPI_INT, rank-1, 4, MPI_COMM_WORLD, &req[0]);
-        MPI_Irecv(&minimum_parameters_increment_norm, 1, MPI_DOUBLE, rank-1, 5, MPI_COMM_WORLD, &req[1]);
-        MPI_Irecv(&minimum_loss_decrease, 1, MPI_DOUBLE, rank-1, 6, MPI_COMM_WORLD, &req[2]);
-        MPI_Irecv(&loss_goal, 1, MPI_DOUBLE, rank-1, 7, MPI_COMM_WORLD, &req[3]);
-        MPI_Irecv(&gradient_norm_goal, 1, MPI_DOUBLE, rank-1, 8, MPI_COMM_WORLD, &req[4]);
-        MPI_Irecv(&maximum_selection_error_increases, 1, MPI_INT, rank-1, 9, MPI_COMM_WORLD, &req[5]);
-        MPI_Irecv(&maximum_iterations_number, 1, MPI_INT, rank-1, 10, MPI_COMM_WORLD, &req[6]);
-        MPI_Irecv(&maximum_time, 1, MPI_INT, rank-1, 11, MPI_COMM_WORLD, &req[7]);
-        MPI_Irecv(&reserve_parameters_norm_history, 1, MPI_INT, rank-1, 12, MPI_COMM_WORLD, &req[8]);
-        MPI_Irecv(&reserve_training_loss_history, 1, MPI_INT, rank-1, 13, MPI_COMM_WORLD, &req[9]);
-        MPI_Irecv(&reserve_selection_error_history, 1, MPI_INT, rank-1, 14, MPI_COMM_WORLD, &req[10]);
-        MPI_Irecv(&reserve_gradient_norm_history, 1, MPI_INT, rank-1, 15, MPI_COMM_WORLD, &req[11]);
-
-        MPI_Waitall(12, req, MPI_STATUS_IGNORE);
-    }
-
-    if(rank < size-1)
-    {
-        MPI_Send(&original_training_method, 1, MPI_INT, rank+1, 1, MPI_COMM_WORLD);
-
-        MPI_Request req[12];
-
-        switch(original_training_method)
-        {
-            case(int)TrainingStrategy::GRADIENT_DESCENT:
-
-                MPI_Isend(&training_rate_method, 1, MPI_INT, rank+1, 1, MPI_COMM_WORLD, &req[0]);
-                MPI_Isend(&loss_tolerance, 1, MPI_DOUBLE, rank+1, 2, MPI_COMM_WORLD, &req[1]);
+        const tinyxml2::XMLDocument* document = training_strategy->to_XML();
 
-                MPI_Waitall(2, req, MPI_STATUS_IGNORE);
+        tinyxml2::XMLPrinter printer;
 
-                break;
+        document->Print(&printer);
 
-            case(int)TrainingStrategy::CONJUGATE_GRADIENT:
+        delete document;
 
-                MPI_Isend(&training_rate_method, 1, MPI_INT, rank+1, 1, MPI_COMM_WORLD, &req[0]);
-                MPI_Isend(&loss_tolerance, 1, MPI_DOUBLE, rank+1, 2, MPI_COMM_WORLD, &req[1]);
+        const string buffer(printer.CStr());
 
-                MPI_Isend(&training_direction_method, 1, MPI_INT, rank+1, 3, MPI_COMM_WORLD, &req[2]);
-
-                MPI_Waitall(3, req, MPI_STATUS_IGNORE);
-
-                break;
-
-            case(int)TrainingStrategy::QUASI_NEWTON_METHOD:
-
-                MPI_Isend(&training_rate_method, 1, MPI_INT, rank+1, 1, MPI_COMM_WORLD, &req[0]);
-                MPI_Isend(&loss_tolerance, 1, MPI_DOUBLE, rank+1, 2, MPI_COMM_WORLD, &req[1]);
-
-                MPI_Isend(&inverse_hessian_method, 1, MPI_INT, rank+1, 3, MPI_COMM_WORLD, &req[2]);
-
-                MPI_Waitall(3, req, MPI_STATUS_IGNORE);
-
-                break;
-
-            case(int)TrainingStrategy::LEVENBERG_MARQUARDT_ALGORITHM:
-
-                MPI_Isend(&damping_parameter_factor, 1, MPI_DOUBLE, rank+1, 1, MPI_COMM_WORLD, &req[0]);
-
-                MPI_Waitall(1, req, MPI_STATUS_IGNORE);
-
-                break;
-
-            default:
-                break;
-        }
-
-        MPI_Isend(&return_minimum_selection_error_model, 1, MPI_INT, rank+1, 4, MPI_COMM_WORLD, &req[0]);
-        MPI_Isend(&minimum_parameters_increment_norm, 1, MPI_DOUBLE, rank+1, 5, MPI_COMM_WORLD, &req[1]);
-        MPI_Isend(&minimum_loss_decrease, 1, MPI_DOUBLE, rank+1, 6, MPI_COMM_WORLD, &req[2]);
-        MPI_Isend(&loss_goal, 1, MPI_DOUBLE, rank+1, 7, MPI_COMM_WORLD, &req[3]);
-        MPI_Isend(&gradient_norm_goal, 1, MPI_DOUBLE, rank+1, 8, MPI_COMM_WORLD, &req[4]);
-        MPI_Isend(&maximum_selection_error_increases, 1, MPI_INT, rank+1, 9, MPI_COMM_WORLD, &req[5]);
-        MPI_Isend(&maximum_iterations_number, 1, MPI_INT, rank+1, 10, MPI_COMM_WORLD, &req[6]);
-        MPI_Isend(&maximum_time, 1, MPI_INT, rank+1, 11, MPI_COMM_WORLD, &req[7]);
-        MPI_Isend(&reserve_parameters_norm_history, 1, MPI_INT, rank+1, 12, MPI_COMM_WORLD, &req[8]);
-        MPI_Isend(&reserve_training_loss_history, 1, MPI_INT, rank+1, 13, MPI_COMM_WORLD, &req[9]);
-        MPI_Isend(&reserve_selection_error_history, 1, MPI_INT, rank+1, 14, MPI_COMM_WORLD, &req[10]);
-        MPI_Isend(&reserve_gradient_norm_history, 1, MPI_INT, rank+1, 15, MPI_COMM_WORLD, &req[11]);
-
-        MPI_Waitall(12, req, MPI_STATUS_IGNORE);
+        training_strategy_XML = Vector<char>(buffer.begin(), buffer.end());
     }
 
-    MPI_Barrier(MPI_COMM_WORLD);
+    training_strategy_XML.set_MPI(MPI_CHAR);
 
-    // Set variables
+    const string buffer(training_strategy_XML.begin(), training_strategy_XML.end());
 
-    set_training_method((TrainingStrategy::TrainingMethod)original_training_method);
+    tinyxml2::XMLDocument document;
 
-    switch(original_training_method)
-    {
-        case(int)TrainingStrategy::GRADIENT_DESCENT:
-
-            gradient_descent_pointer->get_training_rate_algorithm_pointer()->set_training_rate_method((TrainingRateAlgorithm::TrainingRateMethod)training_rate_method);
-            gradient_descent_pointer->get_training_rate_algorithm_pointer()->set_loss_tolerance(loss_tolerance);
-
-            gradient_descent_pointer->set_return_minimum_selection_error_neural_network(return_minimum_selection_error_model == 1);
-            gradient_descent_pointer->set_minimum_parameters_increment_norm(minimum_parameters_increment_norm);
-            gradient_descent_pointer->set_minimum_loss_decrease(minimum_loss_decrease);
-            gradient_descent_pointer->set_loss_goal(loss_goal);
-            gradient_descent_pointer->set_gradient_norm_goal(gradient_norm_goal);
-            gradient_descent_pointer->set_maximum_selection_error_increases(maximum_selection_error_increases);
-            gradient_descent_pointer->set_maximum_iterations_number(maximum_iterations_number);
-            gradient_descent_pointer->set_maximum_time(maximum_time);
-            gradient_descent_pointer->set_reserve_parameters_norm_history(reserve_parameters_norm_history == 1);
-            gradient_descent_pointer->set_reserve_loss_history(reserve_training_loss_history == 1);
-            gradient_descent_pointer->set_reserve_selection_error_history(reserve_selection_error_history == 1);
-            gradient_descent_pointer->set_reserve_gradient_norm_history(reserve_gradient_norm_history == 1);
-
-            break;
-
-        case(int)TrainingStrategy::CONJUGATE_GRADIENT:
-
-            conjugate_gradient_pointer->set_training_direction_method((ConjugateGradient::TrainingDirectionMethod)training_direction_method);
-
-            conjugate_gradient_pointer->get_training_rate_algorithm_pointer()->set_training_rate_method((TrainingRateAlgorithm::TrainingRateMethod)training_rate_method);
-            conjugate_gradient_pointer->get_training_rate_algorithm_pointer()->set_loss_tolerance(loss_tolerance);
-
-            conjugate_gradient_pointer->set_return_minimum_selection_error_neural_network(return_minimum_selection_error_model == 1);
-            conjugate_gradient_pointer->set_minimum_parameters_increment_norm(minimum_parameters_increment_norm);
-            conjugate_gradient_pointer->set_minimum_loss_decrease(minimum_loss_decrease);
-            conjugate_gradient_pointer->set_loss_goal(loss_goal);
-            conjugate_gradient_pointer->set_gradient_norm_goal(gradient_norm_goal);
-            conjugate_gradient_pointer->set_maximum_selection_error_increases(maximum_selection_error_increases);
-            conjugate_gradient_pointer->set_maximum_iterations_number(maximum_iterations_number);
-            conjugate_gradient_pointer->set_maximum_time(maximum_time);
-            conjugate_gradient_pointer->set_reserve_parameters_norm_history(reserve_parameters_norm_history == 1);
-            conjugate_gradient_pointer->set_reserve_loss_history(reserve_training_loss_history == 1);
-            conjugate_gradient_pointer->set_reserve_selection_error_history(reserve_selection_error_history == 1);
-            conjugate_gradient_pointer->set_reserve_gradient_norm_history(reserve_gradient_norm_history == 1);
-
-            break;
-
-        case(int)TrainingStrategy::QUASI_NEWTON_METHOD:
-
-            quasi_Newton_method_pointer->set_inverse_Hessian_approximation_method((QuasiNewtonMethod::InverseHessianApproximationMethod)inverse_hessian_method);
-
-            quasi_Newton_method_pointer->get_training_rate_algorithm_pointer()->set_training_rate_method((TrainingRateAlgorithm::TrainingRateMethod)training_rate_method);
-            quasi_Newton_method_pointer->get_training_rate_algorithm_pointer()->set_loss_tolerance(loss_tolerance);
-
-            quasi_Newton_method_pointer->set_return_minimum_selection_error_neural_network(return_minimum_selection_error_model == 1);
-            quasi_Newton_method_pointer->set_minimum_parameters_increment_norm(minimum_parameters_increment_norm);
-            quasi_Newton_method_pointer->set_minimum_loss_decrease(minimum_loss_decrease);
-            quasi_Newton_method_pointer->set_loss_goal(loss_goal);
-            quasi_Newton_method_pointer->set_gradient_norm_goal(gradient_norm_goal);
-            quasi_Newton_method_pointer->set_maximum_selection_error_increases(maximum_selection_error_increases);
-            quasi_Newton_method_pointer->set_maximum_iterations_number(maximum_iterations_number);
-            quasi_Newton_method_pointer->set_maximum_time(maximum_time);
-            quasi_Newton_method_pointer->set_reserve_parameters_norm_history(reserve_parameters_norm_history == 1);
-            quasi_Newton_method_pointer->set_reserve_loss_history(reserve_training_loss_history == 1);
-            quasi_Newton_method_pointer->set_reserve_selection_error_history(reserve_selection_error_history == 1);
-            quasi_Newton_method_pointer->set_reserve_gradient_norm_history(reserve_gradient_norm_history == 1);
-
-            break;
-
-        case(int)TrainingStrategy::LEVENBERG_MARQUARDT_ALGORITHM:
-
-            Levenberg_Marquardt_algorithm_pointer->set_damping_parameter_factor(damping_parameter_factor);
-
-            Levenberg_Marquardt_algorithm_pointer->set_return_minimum_selection_error_neural_network(return_minimum_selection_error_model == 1);
-            Levenberg_Marquardt_algorithm_pointer->set_minimum_parameters_increment_norm(minimum_parameters_increment_norm);
-            Levenberg_Marquardt_algorithm_pointer->set_minimum_loss_decrease(minimum_loss_decrease);
-            Levenberg_Marquardt_algorithm_pointer->set_loss_goal(loss_goal);
-            Levenberg_Marquardt_algorithm_pointer->set_gradient_norm_goal(gradient_norm_goal);
-            Levenberg_Marquardt_algorithm_pointer->set_maximum_selection_error_increases(maximum_selection_error_increases);
-            Levenberg_Marquardt_algorithm_pointer->set_maximum_iterations_number(maximum_iterations_number);
-            Levenberg_Marquardt_algorithm_pointer->set_maximum_time(maximum_time);
-            Levenberg_Marquardt_algorithm_pointer->set_reserve_parameters_norm_history(reserve_parameters_norm_history == 1);
-            Levenberg_Marquardt_algorithm_pointer->set_reserve_loss_history(reserve_training_loss_history == 1);
-            Levenberg_Marquardt_algorithm_pointer->set_reserve_selection_error_history(reserve_selection_error_history == 1);
-            Levenberg_Marquardt_algorithm_pointer->set_reserve_gradient_norm_history(reserve_gradient_norm_history == 1);
-
-            break;
-
-       case(int)TrainingStrategy::STOCHASTIC_GRADIENT_DESCENT:
-
-           stochastic_gradient_descent_pointer->set_damping_parameter_factor(damping_parameter_factor);
-
-           stochastic_gradient_descent_pointer->set_return_minimum_selection_error_neural_network(return_minimum_selection_loss_model == 1);
-           stochastic_gradient_descent_pointer->set_minimum_parameters_increment_norm(minimum_parameters_increment_norm);
-           stochastic_gradient_descent_pointer->set_minimum_loss_increase(minimum_loss_decrease);
-           stochastic_gradient_descent_pointer->set_loss_goal(loss_goal);
-           stochastic_gradient_descent_pointer->set_gradient_norm_goal(gradient_norm_goal);
-           stochastic_gradient_descent_pointer->set_maximum_selection_error_increases(maximum_selection_loss_increases);
-           stochastic_gradient_descent_pointer->set_maximum_iterations_number(maximum_iterations_number);
-           stochastic_gradient_descent_pointer->set_maximum_time(maximum_time);
-           stochastic_gradient_descent_pointer->set_reserve_parameters_norm_history(reserve_parameters_norm_history == 1);
-           stochastic_gradient_descent_pointer->set_reserve_loss_history(reserve_training_loss_history == 1);
-           stochastic_gradient_descent_pointer->set_reserve_selection_error_history(reserve_selection_error_history == 1);
-           stochastic_gradient_descent_pointer->set_reserve_gradient_norm_history(reserve_gradient_norm_history == 1);
-
-           break;
-
-
-        default:
-            break;
-    }
+    document.Parse(buffer.c_str());
 
-    if(rank != 0)
-    {
-        set_display(false);
-    }
+    from_XML(document);
 }
 #endif
 
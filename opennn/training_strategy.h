@@ -22,6 +22,11 @@
 #include <limits>
 #include <cmath>
 #include <ctime>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <memory>
 
 #ifdef __OPENNN_MPI__
 #include <mpi.h>
@@ -48,6 +53,7 @@
 #include "quasi_newton_method.h"
 #include "levenberg_marquardt_algorithm.h"
 #include "stochastic_gradient_descent.h"
+#include "adaptive_moment_estimation.h"
 
 // TinyXml includes
 
@@ -110,7 +116,8 @@ public:
        CONJUGATE_GRADIENT,
        QUASI_NEWTON_METHOD,
        LEVENBERG_MARQUARDT_ALGORITHM,
-       STOCHASTIC_GRADIENT_DESCENT
+       STOCHASTIC_GRADIENT_DESCENT,
+       ADAPTIVE_MOMENT_ESTIMATION
     };
 
    // STRUCTURES 
@@ -158,6 +165,10 @@ public:
 
         StochasticGradientDescent::StochasticGradientDescentResults* stochastic_gradient_descent_results_pointer;
 
+        /// Pointer to a structure with the results from the adaptive moment estimation training algorithm.
+
+        AdaptiveMomentEstimation::AdaptiveMomentEstimationResults* adaptive_moment_estimation_results_pointer;
+
   };
 
    // METHODS
@@ -181,6 +192,7 @@ public:
    QuasiNewtonMethod* get_quasi_Newton_method_pointer() const;
    LevenbergMarquardtAlgorithm* get_Levenberg_Marquardt_algorithm_pointer() const;
    StochasticGradientDescent* get_stochastic_gradient_descent_pointer() const;
+   AdaptiveMomentEstimation* get_adaptive_moment_estimation_pointer() const;
 
 
    SumSquaredError* get_sum_squared_error_pointer() const;
@@ -207,7 +219,7 @@ public:
    void set_default();
 
 #ifdef __OPENNN_MPI__
-   void set_MPI(LossIndex*, const TrainingStrategy*);
+   void set_MPI(const TrainingStrategy*);
 #endif
 
    void set_loss_index_pointer(LossIndex*);
@@ -233,6 +245,8 @@ public:
    Results perform_training() const;
    void perform_training_void() const;
 
+   Vector<Results*> perform_training_trials(const Vector< Vector<double> >&, Vector< Vector<double> >&, const size_t&) const;
+
    // Serialization methods
 
    string object_to_string() const;
@@ -250,6 +264,8 @@ public:
 
 private:
 
+   Results* perform_trial_training(NeuralNetwork*) const;
+
    DataSet* data_set_pointer = nullptr;
 
    NeuralNetwork* neural_network_pointer = nullptr;
@@ -318,6 +334,10 @@ private:
 
     StochasticGradientDescent* stochastic_gradient_descent_pointer = nullptr;
 
+    /// Pointer to an adaptive moment estimation algorithm object to be used as a main training algorithm.
+
+    AdaptiveMomentEstimation* adaptive_moment_estimation_pointer = nullptr;
+
     /// Type of main training algorithm.
 
     TrainingMethod training_method;
@@ -16,6 +16,7 @@
 // System includes
 
 #include <algorithm>
+#include <bitset>
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
@@ -348,6 +349,8 @@ public:
   Vector<T>
   calculate_minimum_maximum_missing_values(const Vector<size_t> &) const;
 
+  Vector<T> calculate_minimum_maximum_missing_mask(const Vector<unsigned long long> &) const;
+
   Vector<T> calculate_explained_variance() const;
 
   // Histogram methods
@@ -360,6 +363,9 @@ public:
   Histogram<T> calculate_histogram_missing_values(const Vector<size_t> &,
                                                   const size_t & = 10) const;
 
+  Histogram<T> calculate_histogram_missing_mask(const Vector<unsigned long long> &,
+                                                const size_t & = 10) const;
+
   Histogram<T> calculate_histogram_binary_missing_values(const Vector<size_t> &) const;
 
   Histogram<T> calculate_histogram_integers_missing_values(const Vector<size_t> &,
@@ -472,10 +478,16 @@ public:
 
   double calculate_kurtosis_missing_values(const Vector<size_t> &) const;
 
+  double calculate_mean_missing_mask(const Vector<unsigned long long> &) const;
+
+  double calculate_standard_deviation_missing_mask(const Vector<unsigned long long> &) const;
+
   Statistics<T> calculate_statistics() const;
 
   Statistics<T> calculate_statistics_missing_values(const Vector<size_t> &) const;
 
+  Statistics<T> calculate_statistics_missing_mask(const Vector<unsigned long long> &) const;
+
   Vector<double> calculate_shape_parameters() const;
 
   Vector<double> calculate_shape_parameters_missing_values(const Vector<size_t> &) const;
@@ -1093,41 +1105,31 @@ template <class T> void Vector<T>::set(const Vector &other_vector) {
 #ifdef __OPENNN_MPI__
 // void set_MPI(const MPI_Datatype) method
 
-/// Send the vector to the other MPI processors.
+/// Broadcasts the vector of the first MPI process to all the other processes.
 /// @param mpi_datatype MPI type of this vector.
 
 template <class T> void Vector<T>::set_MPI(const MPI_Datatype mpi_datatype) {
-    int size;
-    MPI_Comm_size(MPI_COMM_WORLD, &size);
-
     int rank;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-    int vector_size;
+    int vector_size = 0;
 
     if(rank == 0)
     {
-        vector_size = static_cast<int>(this)->size();
+        vector_size = static_cast<int>(this->size());
     }
 
+    MPI_Bcast(&vector_size, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
     if(rank > 0)
     {
-        MPI_Recv(&vector_size, 1, MPI_INT, rank - 1, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
-        set(vector_size);
-
-        MPI_Recv(data(), vector_size, mpi_datatype, rank - 1, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        set(static_cast<size_t>(vector_size));
     }
 
-    if(rank < size - 1)
+    if(vector_size > 0)
     {
-        MPI_Send(&vector_size, 1, MPI_INT, rank + 1, 1, MPI_COMM_WORLD);
-
-        MPI_Send(data(), vector_size, mpi_datatype, rank + 1, 2, MPI_COMM_WORLD);
+        MPI_Bcast(this->data(), vector_size, mpi_datatype, 0, MPI_COMM_WORLD);
     }
-
-    MPI_Barrier(MPI_COMM_WORLD);
-
 }
 #endif
 
@@ -4030,6 +4032,69 @@ Vector<T> Vector<T>::calculate_minimum_maximum_missing_values(
 }
 
 
+/// Returns a vector containing the smallest and the largest elements in the
+/// vector, skipping the missing values.
+/// @param missing_mask Bitmask of the missing values. Bit i%64 of word i/64
+/// is set when element i is missing.
+
+template <class T>
+Vector<T> Vector<T>::calculate_minimum_maximum_missing_mask(
+    const Vector<unsigned long long> &missing_mask) const {
+  const size_t this_size = this->size();
+
+// Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+  if(missing_mask.size() != (this_size + 63)/64) {
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: Vector Template.\n"
+           << "Vector<T> calculate_minimum_maximum_missing_mask(const "
+              "Vector<unsigned long long>&) const method.\n"
+           << "Size of missing mask(" << missing_mask.size()
+           << ") must be equal to number of words(" << (this_size + 63)/64 << ").\n";
+
+    throw logic_error(buffer.str());
+  }
+
+#endif
+
+  T minimum = numeric_limits<T>::max();
+
+  T maximum;
+
+  if(numeric_limits<T>::is_signed) {
+    maximum = -numeric_limits<T>::max();
+  } else {
+    maximum = 0;
+  }
+
+  const size_t words_number = missing_mask.size();
+
+  for(size_t k = 0; k < words_number; k++) {
+    const unsigned long long word = missing_mask[k];
+
+    const size_t begin = k*64;
+    const size_t end = min(begin + 64, this_size);
+
+    for(size_t i = begin; i < end; i++) {
+      if(word == 0 || ((word >> (i - begin)) & 1ULL) == 0) {
+        if((*this)[i] < minimum) {
+          minimum = (*this)[i];
+        }
+
+        if((*this)[i] > maximum) {
+          maximum = (*this)[i];
+        }
+      }
+    }
+  }
+
+  return {minimum, maximum};
+}
+
+
 /// Calculates the explained variance for a given vector(principal components analysis).
 /// This method returns a vector whose size is the same as the size of the given vector.
 
@@ -4371,6 +4436,99 @@ Histogram<T> Vector<T>::calculate_histogram_missing_values(
 }
 
 
+/// This method bins the elements of the vector into a given number of equally
+/// spaced containers, skipping the missing values.
+/// The bins are the same as those of calculate_histogram_missing_values.
+/// @param missing_mask Bitmask of the missing values. Bit i%64 of word i/64
+/// is set when element i is missing.
+/// @param bins_number Number of bins.
+
+template <class T>
+Histogram<T> Vector<T>::calculate_histogram_missing_mask(
+    const Vector<unsigned long long> &missing_mask, const size_t &bins_number) const {
+// Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+  if(bins_number < 1) {
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: Vector Template.\n"
+           << "Histogram<T> calculate_histogram_missing_mask(const "
+              "Vector<unsigned long long>&, const size_t&) const method.\n"
+           << "Number of bins is less than one.\n";
+
+    throw logic_error(buffer.str());
+  }
+
+#endif
+
+  Vector<T> minimums(bins_number);
+  Vector<T> maximums(bins_number);
+
+  Vector<T> centers(bins_number);
+  Vector<size_t> frequencies(bins_number, 0);
+
+  const Vector<T> minimum_maximum =
+      calculate_minimum_maximum_missing_mask(missing_mask);
+
+  const T minimum = minimum_maximum[0];
+  const T maximum = minimum_maximum[1];
+
+  const double length = (maximum - minimum) /static_cast<double>(bins_number);
+
+  minimums[0] = minimum;
+  maximums[0] = minimum + length;
+  centers[0] = (maximums[0] + minimums[0]) / 2.0;
+
+  // Calculate bins center
+
+  for(size_t i = 1; i < bins_number; i++) {
+    minimums[i] = minimums[i - 1] + length;
+    maximums[i] = maximums[i - 1] + length;
+
+    centers[i] = (maximums[i] + minimums[i]) / 2.0;
+  }
+
+  // Calculate bins frequency
+
+  const size_t this_size = this->size();
+
+  const size_t words_number = missing_mask.size();
+
+  for(size_t k = 0; k < words_number; k++) {
+    const unsigned long long word = missing_mask[k];
+
+    const size_t begin = k*64;
+    const size_t end = min(begin + 64, this_size);
+
+    for(size_t i = begin; i < end; i++) {
+      if(word != 0 && ((word >> (i - begin)) & 1ULL) != 0) {
+        continue;
+      }
+
+      for(size_t j = 0; j + 1 < bins_number; j++) {
+        if((*this)[i] >= minimums[j] &&(*this)[i] < maximums[j]) {
+          frequencies[j]++;
+        }
+      }
+
+      if((*this)[i] >= minimums[bins_number - 1]) {
+        frequencies[bins_number - 1]++;
+      }
+    }
+  }
+
+  Histogram<T> histogram(bins_number);
+  histogram.centers = centers;
+  histogram.minimums = minimums;
+  histogram.maximums = maximums;
+  histogram.frequencies = frequencies;
+
+  return(histogram);
+}
+
+
 /// This method bins the elements of the vector into a given number of equally
 /// spaced containers.
 /// It returns a vector of two vectors.
@@ -6160,6 +6318,166 @@ Statistics<T> Vector<T>::calculate_statistics_missing_values(
 }
 
 
+/// Returns the mean of the elements in the vector, skipping the missing values.
+/// @param missing_mask Bitmask of the missing values. Bit i%64 of word i/64
+/// is set when element i is missing.
+
+template <class T>
+double Vector<T>::calculate_mean_missing_mask(
+    const Vector<unsigned long long> &missing_mask) const
+{
+  const size_t this_size = this->size();
+
+  const size_t words_number = missing_mask.size();
+
+  double sum = 0.0;
+  size_t missing_number = 0;
+
+  for(size_t k = 0; k < words_number; k++) {
+    const unsigned long long word = missing_mask[k];
+
+    const size_t begin = k*64;
+    const size_t end = min(begin + 64, this_size);
+
+    if(word == 0) {
+      for(size_t i = begin; i < end; i++) {
+        sum += (*this)[i];
+      }
+    } else {
+      missing_number += bitset<64>(word).count();
+
+      for(size_t i = begin; i < end; i++) {
+        if(((word >> (i - begin)) & 1ULL) == 0) {
+          sum += (*this)[i];
+        }
+      }
+    }
+  }
+
+  return(sum/static_cast<double>(this_size - missing_number));
+}
+
+
+/// Returns the standard deviation of the elements in the vector, skipping the missing values.
+/// @param missing_mask Bitmask of the missing values. Bit i%64 of word i/64
+/// is set when element i is missing.
+
+template <class T>
+double Vector<T>::calculate_standard_deviation_missing_mask(
+    const Vector<unsigned long long> &missing_mask) const
+{
+  return(calculate_statistics_missing_mask(missing_mask).standard_deviation);
+}
+
+
+/// Returns the minimum, maximum, mean and standard deviation of the elements in the vector,
+/// skipping the missing values, in a single pass.
+/// The number of present elements is obtained by counting the bits of the mask.
+/// @param missing_mask Bitmask of the missing values. Bit i%64 of word i/64
+/// is set when element i is missing.
+
+template <class T>
+Statistics<T> Vector<T>::calculate_statistics_missing_mask(
+    const Vector<unsigned long long> &missing_mask) const
+{
+  const size_t this_size = this->size();
+
+// Control sentence(if debug)
+
+#ifdef __OPENNN_DEBUG__
+
+  if(this_size == 0) {
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: Vector Template.\n"
+           << "Statistics<T> calculate_statistics_missing_mask(const "
+              "Vector<unsigned long long>&) const method.\n"
+           << "Size must be greater than zero.\n";
+
+    throw logic_error(buffer.str());
+  }
+
+  if(missing_mask.size() != (this_size + 63)/64) {
+    ostringstream buffer;
+
+    buffer << "OpenNN Exception: Vector Template.\n"
+           << "Statistics<T> calculate_statistics_missing_mask(const "
+              "Vector<unsigned long long>&) const method.\n"
+           << "Size of missing mask(" << missing_mask.size()
+           << ") must be equal to number of words(" << (this_size + 63)/64 << ").\n";
+
+    throw logic_error(buffer.str());
+  }
+
+#endif
+
+  Statistics<T> statistics;
+
+  T minimum = numeric_limits<T>::max();
+  T maximum;
+
+  if(numeric_limits<T>::is_signed) {
+    maximum = -numeric_limits<T>::max();
+  } else {
+    maximum = 0;
+  }
+
+  double sum = 0.0;
+  double squared_sum = 0.0;
+  size_t missing_number = 0;
+
+  const size_t words_number = missing_mask.size();
+
+  for(size_t k = 0; k < words_number; k++) {
+    const unsigned long long word = missing_mask[k];
+
+    const size_t begin = k*64;
+    const size_t end = min(begin + 64, this_size);
+
+    if(word != 0) {
+      missing_number += bitset<64>(word).count();
+    }
+
+    for(size_t i = begin; i < end; i++) {
+      if(word != 0 && ((word >> (i - begin)) & 1ULL) != 0) {
+        continue;
+      }
+
+      const T value = (*this)[i];
+
+      if(value < minimum) {
+        minimum = value;
+      }
+
+      if(value > maximum) {
+        maximum = value;
+      }
+
+      sum += value;
+      squared_sum += value*value;
+    }
+  }
+
+  const size_t count = this_size - missing_number;
+
+  double standard_deviation = 0.0;
+
+  if(count > 1) {
+    const double numerator = squared_sum - (sum*sum)/static_cast<double>(count);
+    const double denominator = static_cast<double>(count) - 1.0;
+
+    standard_deviation = sqrt(max(numerator/denominator, 0.0));
+  }
+
+  statistics.minimum = minimum;
+  statistics.maximum = maximum;
+  statistics.mean = sum/static_cast<double>(count);
+  statistics.standard_deviation = standard_deviation;
+
+  return(statistics);
+}
+
+
 /// Returns a vector with the asymmetry and the kurtosis values of the elements
 /// in the vector.
 
@@ -10840,6 +11158,11 @@ Vector<struct tm> Vector<T>::time_stamp_to_time_structure() const
 template <class T>
 Vector< Vector<T> > Vector<T>::split(const size_t& n) const
 {
+    if(this->empty())
+    {
+        return Vector< Vector<T> >();
+    }
+
     // determine number of sub-vectors of size n
 
     const size_t batches_number = (this->size() - 1) / n + 1;
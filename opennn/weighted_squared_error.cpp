@@ -226,8 +226,8 @@ void WeightedSquaredError::set_weights()
 
     const Vector<size_t> target_distribution = data_set_pointer->calculate_target_distribution();
 
-    const size_t negatives = target_distribution[0];
-    const size_t positives = target_distribution[1];
+    const size_t negatives = sum_MPI(target_distribution[0]);
+    const size_t positives = sum_MPI(target_distribution[1]);
 
     if(positives == 0 || negatives == 0)
     {
@@ -258,7 +258,7 @@ void WeightedSquaredError::set_normalization_coefficient()
 
     const Vector<size_t> targets_indices = variables.get_targets_indices();
 
-    const size_t negatives = data_set_pointer->calculate_training_negatives(targets_indices[0]);
+    const size_t negatives = sum_MPI(data_set_pointer->calculate_training_negatives(targets_indices[0]));
 
     normalization_coefficient = negatives*negatives_weight*0.5;
 }
@@ -278,7 +278,7 @@ void WeightedSquaredError::set_selection_normalization_coefficient()
 
     const Vector<size_t> targets_indices = data_set_pointer->get_variables_pointer()->get_targets_indices();
 
-    const size_t negatives = data_set_pointer->calculate_selection_negatives(targets_indices[0]);
+    const size_t negatives = sum_MPI(data_set_pointer->calculate_selection_negatives(targets_indices[0]));
 
     selection_normalization_coefficient = negatives*negatives_weight*0.5;
 }
@@ -433,23 +433,26 @@ double WeightedSquaredError::calculate_training_error() const
 
     // Data set
 
-    const Vector< Vector<size_t> > batch_indices = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = batch_indices.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     double training_error = 0.0;
 
+    Matrix<double> inputs_buffer;
+    Matrix<double> targets_buffer;
+
     for(size_t i = 0; i < batches_number; i++)
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(batch_indices[static_cast<unsigned>(i)]);
+        const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+        const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
         const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
         training_error += outputs.calculate_weighted_sum_squared_error(targets, positives_weight, negatives_weight);
     }
 
-    return training_error / normalization_coefficient;
+    return sum_MPI(training_error) / normalization_coefficient;
 }
 
 
@@ -469,28 +472,34 @@ double WeightedSquaredError::calculate_selection_error() const
 
     // Data set
 
-    const Vector< Vector<size_t> > batch_indices = data_set_pointer->get_instances_pointer()->get_selection_batches(batch_size);
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
 
-    const size_t batches_number = batch_indices.size();
+    const size_t batches_number = selection_batches.get_batches_number();
 
     double selection_error = 0.0;
 
+    Matrix<double> inputs_buffer;
+    Matrix<double> targets_buffer;
+
     for(size_t i = 0; i < batches_number; i++)
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(batch_indices[static_cast<unsigned>(i)]);
+        const Matrix<double>& inputs = selection_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+        const Matrix<double>& targets = selection_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
         const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
 
         selection_error += outputs.calculate_weighted_sum_squared_error(targets, positives_weight, negatives_weight);
     }
 
-    return selection_error / normalization_coefficient;
+    return sum_MPI(selection_error) / normalization_coefficient;
 }
 
 
+/// Returns the weighted squared error on the selection instances for a given parameters vector.
+/// The neural network is not modified, so this can be evaluated while the neural network is being trained.
+/// @param parameters Parameters vector of the neural network.
 
-double WeightedSquaredError::calculate_training_error(const Vector<double>& parameters) const
+double WeightedSquaredError::calculate_selection_error(const Vector<double>& parameters) const
 {
     // Control sentence
 
@@ -506,27 +515,31 @@ double WeightedSquaredError::calculate_training_error(const Vector<double>& para
 
     // Data set
 
-    const Vector< Vector<size_t> > batch_indices = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& selection_batches = data_set_pointer->get_selection_batches(batch_size);
 
-    const size_t batches_number = batch_indices.size();
+    const size_t batches_number = selection_batches.get_batches_number();
 
-    double training_error = 0.0;
+    double selection_error = 0.0;
+
+    Matrix<double> inputs_buffer;
+    Matrix<double> targets_buffer;
 
     for(size_t i = 0; i < batches_number; i++)
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(batch_indices[static_cast<unsigned>(i)]);
+        const Matrix<double>& inputs = selection_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+        const Matrix<double>& targets = selection_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
         const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
 
-        training_error += outputs.calculate_weighted_sum_squared_error(targets, positives_weight, negatives_weight);
+        selection_error += outputs.calculate_weighted_sum_squared_error(targets, positives_weight, negatives_weight);
     }
 
-    return training_error / normalization_coefficient;
+    return sum_MPI(selection_error) / normalization_coefficient;
 }
 
 
-double WeightedSquaredError::calculate_batch_error(const Vector<size_t>& batch_indices) const
+
+double WeightedSquaredError::calculate_training_error(const Vector<double>& parameters) const
 {
     // Control sentence
 
@@ -542,14 +555,77 @@ double WeightedSquaredError::calculate_batch_error(const Vector<size_t>& batch_i
 
     // Data set
 
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    double training_error = 0.0;
+
+    Matrix<double> inputs_buffer;
+    Matrix<double> targets_buffer;
+
+    for(size_t i = 0; i < batches_number; i++)
+    {
+        const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+        const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs, parameters);
+
+        training_error += outputs.calculate_weighted_sum_squared_error(targets, positives_weight, negatives_weight);
+    }
+
+    return sum_MPI(training_error) / normalization_coefficient;
+}
+
+
+double WeightedSquaredError::calculate_batch_error(const Vector<size_t>& batch_indices) const
+{
+    // Control sentence
+
+    #ifdef __OPENNN_DEBUG__
+
+        check();
+
+    #endif
+
+    // Data set
+
     const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
     const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
 
-    const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+    return calculate_batch_error(inputs, targets);
+}
+
 
-    const double batch_error = outputs.calculate_weighted_sum_squared_error(targets, positives_weight, negatives_weight);
+/// Returns the weighted squared error of the multilayer perceptron on a batch which has already been gathered.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+double WeightedSquaredError::calculate_batch_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+    // Control sentence
+
+    #ifdef __OPENNN_DEBUG__
 
-    return batch_error / normalization_coefficient;
+        check();
+
+    #endif
+
+    // Multilayer perceptron
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    double batch_error = 0.0;
+
+    if(inputs.get_rows_number() > 0)
+    {
+        const Matrix<double> outputs = multilayer_perceptron_pointer->calculate_outputs(inputs);
+
+        batch_error = outputs.calculate_weighted_sum_squared_error(targets, positives_weight, negatives_weight);
+    }
+
+    return sum_MPI(batch_error) / normalization_coefficient;
 }
 
 
@@ -565,46 +641,46 @@ check();
 
     const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
 
-    const size_t layers_number = multilayer_perceptron_pointer->get_layers_number();
-
     const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
 
     // Data set
 
 //    const size_t training_instances_number = data_set_pointer->get_instances().get_training_instances_number();
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
     // Loss index
 
-    Vector<double> training_error_gradient(parameters_number, 0.0);
+    Vector<double> training_error_gradient;
 
-    #pragma omp parallel for
+    set_back_propagations(batch_size);
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
-    {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+    set_gradient_accumulators(parameters_number);
 
-        const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-                = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const Matrix<double> output_gradient
-                = calculate_output_gradient(first_order_forward_propagation.layers_activations[layers_number-1], targets);
+        #pragma omp for schedule(static)
 
-        const Vector< Matrix<double> > layers_delta
-                = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const Vector<double> batch_gradient
-                = calculate_error_gradient(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+            BackPropagation& back_propagation = get_back_propagation();
 
-        #pragma omp critical
+            calculate_back_propagation(inputs, targets, back_propagation);
 
-        training_error_gradient += batch_gradient;
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
     }
 
+    reduce_gradient_accumulators(training_error_gradient);
+
     return training_error_gradient / normalization_coefficient;
 }
 
@@ -1025,6 +1101,33 @@ check();
 }
 
 
+/// Calculates the output gradient of a batch and writes it into a given matrix, which is resized only if its dimensions change.
+/// @param outputs Matrix of outputs of the neural network.
+/// @param targets Matrix of targets of the data set.
+/// @param output_gradient Matrix where the output gradient is written.
+
+void WeightedSquaredError::calculate_output_gradient(const Matrix<double>& outputs, const Matrix<double>& targets, Matrix<double>& output_gradient) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    if(output_gradient.get_rows_number() != outputs.get_rows_number() || output_gradient.get_columns_number() != outputs.get_columns_number())
+    {
+        output_gradient.set(outputs.get_rows_number(), outputs.get_columns_number());
+    }
+
+    const size_t size = outputs.size();
+
+    for(size_t i = 0; i < size; i++)
+    {
+        output_gradient[i] = (outputs[i]-targets[i])*(targets[i]*(negatives_weight/positives_weight-negatives_weight) + negatives_weight)*2.0/normalization_coefficient;
+    }
+}
+
+
 /*
 Vector<double> WeightedSquaredError::calculate_error_terms() const
 {
@@ -1271,50 +1374,44 @@ check();
 
     // Data set
 
-    const Vector< Vector<size_t> > training_batches = data_set_pointer->get_instances_pointer()->get_training_batches(batch_size);
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
 
-    const size_t batches_number = training_batches.size();
+    const size_t batches_number = training_batches.get_batches_number();
 
-    SecondOrderErrorTerms terms_second_order_loss(parameters_number);
+    SecondOrderErrorTerms terms_second_order_loss;
 
-    #pragma omp parallel for
+    set_second_order_accumulators(parameters_number);
 
-    for(int i = 0; i < static_cast<int>(batches_number); i++)
+    #pragma omp parallel
     {
-        const Matrix<double> inputs = data_set_pointer->get_inputs(training_batches[static_cast<unsigned>(i)]);
-        const Matrix<double> targets = data_set_pointer->get_targets(training_batches[static_cast<unsigned>(i)]);
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
 
-        const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
-                = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+        #pragma omp for schedule(static)
 
-        const Vector<double> error_terms
-                = calculate_error_terms(first_order_forward_propagation.layers_activations[layers_number-1], targets);
-
-        const Matrix<double> output_gradient = (first_order_forward_propagation.layers_activations[layers_number-1] - targets)/error_terms;
-
-        const Vector< Matrix<double> > layers_delta
-                = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
-
-        const Matrix<double> error_terms_Jacobian
-                = calculate_error_terms_Jacobian(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
 
-        const Matrix<double> error_terms_Jacobian_transpose = error_terms_Jacobian.calculate_transpose();
+            const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
+                    = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
 
-        const double loss = error_terms.dot(error_terms);
+            const Vector<double> error_terms
+                    = calculate_error_terms(first_order_forward_propagation.layers_activations[layers_number-1], targets);
 
-        const Vector<double> gradient = error_terms_Jacobian_transpose.dot(error_terms);
+            const Matrix<double> output_gradient = (first_order_forward_propagation.layers_activations[layers_number-1] - targets)/error_terms;
 
-        Matrix<double> Hessian_approximation;
-        Hessian_approximation.dot(error_terms_Jacobian_transpose, error_terms_Jacobian);
+            const Vector< Matrix<double> > layers_delta
+                    = calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
 
-        #pragma omp critical
-        {
-            terms_second_order_loss.loss += loss;
-            terms_second_order_loss.gradient += gradient;
-            terms_second_order_loss.Hessian_approximation += Hessian_approximation;
-         }
+            accumulate_second_order_terms(inputs, first_order_forward_propagation.layers_activations, layers_delta,
+                                          error_terms, get_second_order_accumulator());
+        }
     }
 
+    reduce_second_order_accumulators(terms_second_order_loss);
+
 //    const Matrix<double> regularization_Hessian = loss_index_pointer->calculate_regularization_Hessian();
 
     terms_second_order_loss.loss /= normalization_coefficient;
@@ -1326,6 +1423,142 @@ check();
 
 
 
+/// Returns the weighted squared error and its gradient on the training instances.
+/// Both are computed in a single forward and backward propagation of each batch.
+
+LossIndex::FirstOrderError WeightedSquaredError::calculate_training_first_order_error() const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const MultilayerPerceptron* multilayer_perceptron_pointer = neural_network_pointer->get_multilayer_perceptron_pointer();
+
+    const size_t parameters_number = multilayer_perceptron_pointer->get_parameters_number();
+
+    // Data set
+
+    const DataSet::Batches& training_batches = data_set_pointer->get_training_batches(batch_size);
+
+    const size_t batches_number = training_batches.get_batches_number();
+
+    // Loss index
+
+    FirstOrderError first_order_error(0);
+
+    double training_error = 0.0;
+
+    set_back_propagations(batch_size);
+
+    set_gradient_accumulators(parameters_number);
+
+    #pragma omp parallel
+    {
+        Matrix<double> inputs_buffer;
+        Matrix<double> targets_buffer;
+
+        #pragma omp for schedule(static) reduction(+ : training_error)
+
+        for(int i = 0; i < static_cast<int>(batches_number); i++)
+        {
+            const Matrix<double>& inputs = training_batches.get_inputs(static_cast<size_t>(i), inputs_buffer);
+            const Matrix<double>& targets = training_batches.get_targets(static_cast<size_t>(i), targets_buffer);
+
+            BackPropagation& back_propagation = get_back_propagation();
+
+            calculate_back_propagation(inputs, targets, back_propagation);
+
+            training_error += back_propagation.get_outputs().calculate_weighted_sum_squared_error(targets, positives_weight, negatives_weight);
+
+            get_gradient_accumulator() += back_propagation.gradient;
+        }
+    }
+
+    first_order_error.error = sum_MPI(training_error)/normalization_coefficient;
+
+    reduce_gradient_accumulators(first_order_error.gradient);
+
+    first_order_error.gradient /= normalization_coefficient;
+
+    return first_order_error;
+}
+
+
+/// Returns the weighted squared error and its gradient on a batch of instances.
+/// @param batch_indices Indices of the instances in the batch.
+
+LossIndex::FirstOrderError WeightedSquaredError::calculate_batch_first_order_error(const Vector<size_t>& batch_indices) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Data set
+
+    const Matrix<double> inputs = data_set_pointer->get_inputs(batch_indices);
+    const Matrix<double> targets = data_set_pointer->get_targets(batch_indices);
+
+    return calculate_batch_first_order_error(inputs, targets);
+}
+
+
+/// Returns the weighted squared error and its gradient on a batch which has already been gathered.
+/// Both are computed in a single forward and backward propagation.
+/// With MPI, the batches of all the processes are taken together, and a batch can be empty.
+/// @param inputs Inputs of the instances in the batch.
+/// @param targets Targets of the instances in the batch.
+
+LossIndex::FirstOrderError WeightedSquaredError::calculate_batch_first_order_error(const Matrix<double>& inputs, const Matrix<double>& targets) const
+{
+#ifdef __OPENNN_DEBUG__
+
+check();
+
+#endif
+
+    // Neural network
+
+    const size_t parameters_number = neural_network_pointer->get_multilayer_perceptron_pointer()->get_parameters_number();
+
+    // Data set
+
+    const size_t instances_number = inputs.get_rows_number();
+
+    // Loss index
+
+    FirstOrderError first_order_error(parameters_number);
+
+    double batch_error = 0.0;
+
+    if(instances_number > 0)
+    {
+        set_back_propagations(instances_number);
+
+        BackPropagation& back_propagation = get_back_propagation();
+
+        calculate_back_propagation(inputs, targets, back_propagation);
+
+        batch_error = back_propagation.get_outputs().calculate_weighted_sum_squared_error(targets, positives_weight, negatives_weight);
+
+        first_order_error.gradient = back_propagation.gradient;
+    }
+
+    first_order_error.error = sum_MPI(batch_error)/normalization_coefficient;
+
+    sum_MPI(first_order_error.gradient);
+
+    first_order_error.gradient /= normalization_coefficient;
+
+    return first_order_error;
+}
+
+
 /// Returns a string with the name of the weighted squared error loss type, "WEIGHTED_SQUARED_ERROR".
 
 string WeightedSquaredError::write_error_term_type() const
@@ -0,0 +1,420 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   A D A P T I V E   M O M E N T   E S T I M A T I O N   T E S T   C L A S S                                  */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "adaptive_moment_estimation_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+AdaptiveMomentEstimationTest::AdaptiveMomentEstimationTest() : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+AdaptiveMomentEstimationTest::~AdaptiveMomentEstimationTest()
+{
+}
+
+
+// METHODS
+
+void AdaptiveMomentEstimationTest::test_constructor()
+{
+   message += "test_constructor\n";
+
+   SumSquaredError sse;
+
+   // Default constructor
+
+   AdaptiveMomentEstimation ame1;
+   assert_true(ame1.has_loss_index() == false, LOG);
+   assert_true(ame1.get_adaptive_method() == AdaptiveMomentEstimation::ADAM, LOG);
+
+   // Loss index constructor
+
+   AdaptiveMomentEstimation ame2(&sse);
+   assert_true(ame2.has_loss_index() == true, LOG);
+}
+
+
+void AdaptiveMomentEstimationTest::test_destructor()
+{
+   message += "test_destructor\n";
+}
+
+
+void AdaptiveMomentEstimationTest::test_set_adaptive_method()
+{
+   message += "test_set_adaptive_method\n";
+
+   AdaptiveMomentEstimation ame;
+
+   ame.set_adaptive_method("ADAMW");
+   assert_true(ame.get_adaptive_method() == AdaptiveMomentEstimation::ADAMW, LOG);
+   assert_true(ame.write_adaptive_method() == "ADAMW", LOG);
+
+   ame.set_adaptive_method("RMSPROP");
+   assert_true(ame.get_adaptive_method() == AdaptiveMomentEstimation::RMSPROP, LOG);
+
+   ame.set_adaptive_method("ADAGRAD");
+   assert_true(ame.get_adaptive_method() == AdaptiveMomentEstimation::ADAGRAD, LOG);
+
+   // Test
+
+   try
+   {
+      ame.set_adaptive_method("NESTEROV");
+
+      assert_true(false, LOG);
+   }
+   catch(const logic_error&)
+   {
+      assert_true(ame.get_adaptive_method() == AdaptiveMomentEstimation::ADAGRAD, LOG);
+   }
+}
+
+
+void AdaptiveMomentEstimationTest::test_update_parameters()
+{
+   message += "test_update_parameters\n";
+
+   AdaptiveMomentEstimation ame;
+
+   AdaptiveMomentEstimation::MomentEstimates moment_estimates;
+
+   const Vector<double> gradient({0.5, -2.0});
+
+   Vector<double> parameters;
+
+   ame.set_learning_rate(0.1);
+
+   // Adam, whose first step has the size of the learning rate
+
+   ame.set_adaptive_method(AdaptiveMomentEstimation::ADAM);
+
+   parameters = Vector<double>({1.0, 1.0});
+   moment_estimates.set(2);
+
+   ame.update_parameters(gradient, moment_estimates, parameters);
+
+   assert_true(moment_estimates.iteration == 1, LOG);
+   assert_true(fabs(parameters[0] - 0.9) < 1.0e-6, LOG);
+   assert_true(fabs(parameters[1] - 1.1) < 1.0e-6, LOG);
+
+   assert_true(fabs(moment_estimates.first_moment[0] - 0.05) < 1.0e-12, LOG);
+   assert_true(fabs(moment_estimates.second_moment[1] - 0.004) < 1.0e-12, LOG);
+
+   // Adam, second step with the same gradient
+
+   ame.update_parameters(gradient, moment_estimates, parameters);
+
+   assert_true(moment_estimates.iteration == 2, LOG);
+   assert_true(fabs(parameters[0] - 0.8) < 1.0e-6, LOG);
+   assert_true(fabs(parameters[1] - 1.2) < 1.0e-6, LOG);
+
+   // AdamW, which also shrinks the parameters
+
+   ame.set_adaptive_method(AdaptiveMomentEstimation::ADAMW);
+   ame.set_weight_decay(0.5);
+
+   parameters = Vector<double>({1.0, 1.0});
+   moment_estimates.set(2);
+
+   ame.update_parameters(gradient, moment_estimates, parameters);
+
+   assert_true(fabs(parameters[0] - 0.85) < 1.0e-6, LOG);
+   assert_true(fabs(parameters[1] - 1.05) < 1.0e-6, LOG);
+
+   // RMSProp
+
+   ame.set_adaptive_method(AdaptiveMomentEstimation::RMSPROP);
+   ame.set_decay_rate(0.9);
+
+   parameters = Vector<double>({1.0, 1.0});
+   moment_estimates.set(2);
+
+   ame.update_parameters(gradient, moment_estimates, parameters);
+
+   assert_true(fabs(moment_estimates.second_moment[0] - 0.025) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[0] - (1.0 - 0.1*0.5/sqrt(0.025))) < 1.0e-6, LOG);
+   assert_true(fabs(parameters[1] - (1.0 + 0.1*2.0/sqrt(0.4))) < 1.0e-6, LOG);
+
+   // AdaGrad, whose steps shrink as the squared gradients accumulate
+
+   ame.set_adaptive_method(AdaptiveMomentEstimation::ADAGRAD);
+
+   parameters = Vector<double>({1.0, 1.0});
+   moment_estimates.set(2);
+
+   ame.update_parameters(gradient, moment_estimates, parameters);
+
+   assert_true(fabs(parameters[0] - 0.9) < 1.0e-6, LOG);
+   assert_true(fabs(parameters[1] - 1.1) < 1.0e-6, LOG);
+
+   ame.update_parameters(gradient, moment_estimates, parameters);
+
+   assert_true(fabs(moment_estimates.second_moment[1] - 8.0) < 1.0e-12, LOG);
+   assert_true(fabs(parameters[0] - (0.9 - 0.1/sqrt(2.0))) < 1.0e-6, LOG);
+}
+
+
+void AdaptiveMomentEstimationTest::test_perform_training()
+{
+   message += "test_perform_training\n";
+
+   DataSet ds(50, 1, 2);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   NeuralNetwork nn(1, 2);
+
+   SumSquaredError sse(&nn, &ds);
+
+   AdaptiveMomentEstimation ame(&sse);
+
+   ame.set_display(false);
+   ame.set_learning_rate(0.01);
+   ame.set_training_batch_size(10);
+   ame.set_maximum_epochs_number(50);
+
+   double old_training_error;
+
+   // Test
+
+   const AdaptiveMomentEstimation::AdaptiveMethod adaptive_methods[] = {AdaptiveMomentEstimation::ADAM,
+                                                                        AdaptiveMomentEstimation::ADAMW,
+                                                                        AdaptiveMomentEstimation::RMSPROP,
+                                                                        AdaptiveMomentEstimation::ADAGRAD};
+
+   for(size_t i = 0; i < 4; i++)
+   {
+      nn.randomize_parameters_normal();
+
+      old_training_error = sse.calculate_training_error();
+
+      ame.set_adaptive_method(adaptive_methods[i]);
+
+      AdaptiveMomentEstimation::AdaptiveMomentEstimationResults* results = ame.perform_training();
+
+      assert_true(sse.calculate_training_error() < old_training_error, LOG);
+      assert_true(results->stopping_condition == TrainingAlgorithm::MaximumIterationsNumber, LOG);
+      assert_true(results->loss_history.size() == 51, LOG);
+
+      delete results;
+   }
+
+   // Selection error calculated in the background, which gives the same selection errors one epoch later
+
+   ds.get_instances_pointer()->split_random_indices(0.8, 0.2, 0.0);
+
+   nn.randomize_parameters_normal();
+
+   const Vector<double> initial_parameters = nn.get_parameters();
+
+   ame.set_adaptive_method(AdaptiveMomentEstimation::ADAM);
+   ame.set_reserve_selection_error_history(true);
+   ame.set_maximum_epochs_number(10);
+
+   AdaptiveMomentEstimation::AdaptiveMomentEstimationResults* synchronous_results = ame.perform_training();
+
+   nn.set_parameters(initial_parameters);
+
+   ame.set_asynchronous_selection_error(true);
+
+   AdaptiveMomentEstimation::AdaptiveMomentEstimationResults* asynchronous_results = ame.perform_training();
+
+   assert_true(asynchronous_results->selection_error_history.size() == synchronous_results->selection_error_history.size(), LOG);
+   assert_true((asynchronous_results->selection_error_history - synchronous_results->selection_error_history).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+   assert_true(fabs(asynchronous_results->final_selection_error - synchronous_results->final_selection_error) < 1.0e-9, LOG);
+
+   delete synchronous_results;
+   delete asynchronous_results;
+
+   ame.set_asynchronous_selection_error(false);
+
+   // Loss goal
+
+   nn.randomize_parameters_normal();
+
+   ame.set_adaptive_method(AdaptiveMomentEstimation::ADAM);
+   ame.set_loss_goal(numeric_limits<double>::max());
+
+   AdaptiveMomentEstimation::AdaptiveMomentEstimationResults* results = ame.perform_training();
+
+   assert_true(results->stopping_condition == TrainingAlgorithm::LossGoal, LOG);
+   assert_true(results->epochs_number == 0, LOG);
+
+   delete results;
+}
+
+
+void AdaptiveMomentEstimationTest::test_resize_training_history()
+{
+   message += "test_resize_training_history\n";
+
+   AdaptiveMomentEstimation ame;
+
+   ame.set_reserve_all_training_history(true);
+
+   AdaptiveMomentEstimation::AdaptiveMomentEstimationResults ametr(&ame);
+
+   ametr.resize_training_history(1);
+
+   assert_true(ametr.parameters_norm_history.size() == 1, LOG);
+   assert_true(ametr.loss_history.size() == 1, LOG);
+   assert_true(ametr.selection_error_history.size() == 1, LOG);
+   assert_true(ametr.gradient_norm_history.size() == 1, LOG);
+   assert_true(ametr.elapsed_time_history.size() == 1, LOG);
+}
+
+
+void AdaptiveMomentEstimationTest::test_to_XML()
+{
+   message += "test_to_XML\n";
+
+   AdaptiveMomentEstimation ame;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   document = ame.to_XML();
+   assert_true(document != nullptr, LOG);
+   assert_true(document->FirstChildElement("AdaptiveMomentEstimation")->FirstChildElement("Beta2") != nullptr, LOG);
+
+   delete document;
+}
+
+
+void AdaptiveMomentEstimationTest::test_from_XML()
+{
+   message += "test_from_XML\n";
+
+   AdaptiveMomentEstimation ame1;
+   AdaptiveMomentEstimation ame2;
+
+   tinyxml2::XMLDocument* document;
+
+   // Test
+
+   ame1.set_adaptive_method(AdaptiveMomentEstimation::ADAMW);
+   ame1.set_learning_rate(0.05);
+   ame1.set_beta_1(0.8);
+   ame1.set_beta_2(0.99);
+   ame1.set_decay_rate(0.95);
+   ame1.set_epsilon(1.0e-6);
+   ame1.set_weight_decay(0.1);
+   ame1.set_training_batch_size(32);
+   ame1.set_shuffle(true);
+   ame1.set_shuffle_seed(7);
+   ame1.set_asynchronous_selection_error(true);
+   ame1.set_reuse_batch_errors(true);
+   ame1.set_maximum_epochs_number(20);
+   ame1.set_display(false);
+
+   document = ame1.to_XML();
+
+   ame2.from_XML(*document);
+
+   delete document;
+
+   assert_true(ame2.get_adaptive_method() == AdaptiveMomentEstimation::ADAMW, LOG);
+   assert_true(fabs(ame2.get_learning_rate() - 0.05) < 1.0e-12, LOG);
+   assert_true(fabs(ame2.get_beta_1() - 0.8) < 1.0e-12, LOG);
+   assert_true(fabs(ame2.get_beta_2() - 0.99) < 1.0e-12, LOG);
+   assert_true(fabs(ame2.get_decay_rate() - 0.95) < 1.0e-12, LOG);
+   assert_true(fabs(ame2.get_epsilon() - 1.0e-6) < 1.0e-12, LOG);
+   assert_true(fabs(ame2.get_weight_decay() - 0.1) < 1.0e-12, LOG);
+   assert_true(ame2.get_training_batch_size() == 32, LOG);
+   assert_true(ame2.get_shuffle(), LOG);
+   assert_true(ame2.get_shuffle_seed() == 7, LOG);
+   assert_true(ame2.get_asynchronous_selection_error(), LOG);
+   assert_true(ame2.get_reuse_batch_errors(), LOG);
+   assert_true(ame2.get_maximum_epochs_number() == 20, LOG);
+   assert_true(!ame2.get_display(), LOG);
+
+   // Test
+
+   TrainingStrategy ts1;
+
+   ts1.set_loss_method(TrainingStrategy::SUM_SQUARED_ERROR);
+   ts1.set_training_method(TrainingStrategy::ADAPTIVE_MOMENT_ESTIMATION);
+
+   ts1.get_adaptive_moment_estimation_pointer()->set_adaptive_method(AdaptiveMomentEstimation::RMSPROP);
+
+   document = ts1.to_XML();
+
+   TrainingStrategy ts2;
+
+   ts2.set_loss_method(TrainingStrategy::SUM_SQUARED_ERROR);
+   ts2.from_XML(*document);
+
+   delete document;
+
+   assert_true(ts2.get_training_method() == TrainingStrategy::ADAPTIVE_MOMENT_ESTIMATION, LOG);
+   assert_true(ts2.get_adaptive_moment_estimation_pointer()->get_adaptive_method() == AdaptiveMomentEstimation::RMSPROP, LOG);
+}
+
+
+void AdaptiveMomentEstimationTest::run_test_case()
+{
+   message += "Running adaptive moment estimation test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+   test_destructor();
+
+   // Set methods
+
+   test_set_adaptive_method();
+
+   // Training methods
+
+   test_update_parameters();
+   test_perform_training();
+
+   // Training history methods
+
+   test_resize_training_history();
+
+   // Serialization methods
+
+   test_to_XML();
+   test_from_XML();
+
+   message += "End of adaptive moment estimation test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
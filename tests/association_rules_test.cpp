@@ -0,0 +1,328 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   A S S O C I A T I O N   R U L E S   T E S T   C L A S S                                                    */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "association_rules_test.h"
+
+using namespace OpenNN;
+
+
+/// Returns a sparse matrix of orders, where each item is in an order with a given probability.
+
+static SparseMatrix<int> generate_orders(const size_t& orders_number, const size_t& items_number, const double& probability)
+{
+   SparseMatrix<int> orders(orders_number, items_number);
+
+   for(size_t i = 0; i < orders_number; i++)
+   {
+      for(size_t j = 0; j < items_number; j++)
+      {
+         if(static_cast<double>(rand())/static_cast<double>(RAND_MAX) < probability)
+         {
+            orders.set_element(i, j, 1);
+         }
+      }
+   }
+
+   return(orders);
+}
+
+
+/// Returns the number of orders which contain all the items of an itemset, counted exhaustively.
+
+static size_t count_orders(const SparseMatrix<int>& orders, const Vector<size_t>& itemset)
+{
+   size_t frequency = 0;
+
+   for(size_t i = 0; i < orders.get_rows_number(); i++)
+   {
+      bool contains = true;
+
+      for(size_t j = 0; j < itemset.size(); j++)
+      {
+         if(orders(i, itemset[j]) != 1)
+         {
+            contains = false;
+         }
+      }
+
+      if(contains)
+      {
+         frequency++;
+      }
+   }
+
+   return(frequency);
+}
+
+
+// GENERAL CONSTRUCTOR
+
+AssociationRulesTest::AssociationRulesTest() : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+AssociationRulesTest::~AssociationRulesTest()
+{
+}
+
+
+// METHODS
+
+void AssociationRulesTest::test_calculate_support()
+{
+   message += "test_calculate_support\n";
+
+   AssociationRules association_rules;
+
+   const SparseMatrix<int> orders = generate_orders(50, 7, 0.4);
+
+   association_rules.set_sparse_matrix(orders);
+
+   Matrix<double> support;
+
+   // Test
+
+   support = association_rules.calculate_support(2);
+
+   assert_true(support.get_rows_number() == 21, LOG);
+   assert_true(support.get_columns_number() == 4, LOG);
+
+   for(size_t i = 0; i < support.get_rows_number(); i++)
+   {
+      const Vector<size_t> itemset = support.get_row(i).get_first(2).to_size_t_vector();
+
+      assert_true(support(i, 2) == static_cast<double>(count_orders(orders, itemset)), LOG);
+      assert_true(fabs(support(i, 3) - support(i, 2)*2.0) < 1.0e-12, LOG);
+   }
+
+   assert_true(support.get_column(2) == support.get_column(2).sort_descending_values(), LOG);
+
+   // Test
+
+   support = association_rules.calculate_support(3, Vector<size_t>({6, 1, 4, 2}));
+
+   assert_true(support.get_rows_number() == 4, LOG);
+
+   for(size_t i = 0; i < support.get_rows_number(); i++)
+   {
+      const Vector<size_t> itemset = support.get_row(i).get_first(3).to_size_t_vector();
+
+      assert_true(!itemset.contains(0) && !itemset.contains(3) && !itemset.contains(5), LOG);
+      assert_true(support(i, 3) == static_cast<double>(count_orders(orders, itemset)), LOG);
+   }
+}
+
+
+void AssociationRulesTest::test_calculate_confidence()
+{
+   message += "test_calculate_confidence\n";
+
+   AssociationRules association_rules;
+
+   SparseMatrix<int> orders(4, 3);
+
+   orders.set_element(0, 0, 1);
+   orders.set_element(0, 1, 1);
+   orders.set_element(1, 0, 1);
+   orders.set_element(1, 1, 1);
+   orders.set_element(2, 0, 1);
+   orders.set_element(3, 2, 1);
+
+   association_rules.set_sparse_matrix(orders);
+
+   // Test
+
+   const Matrix<double> confidence = association_rules.calculate_confidence(1, 1);
+
+   assert_true(confidence.get_rows_number() == 6, LOG);
+   assert_true(confidence.get_columns_number() == 3, LOG);
+
+   assert_true(confidence(0, 0) == 1.0 && confidence(0, 1) == 0.0, LOG);
+   assert_true(confidence(0, 2) == 1.0, LOG);
+
+   for(size_t i = 0; i < confidence.get_rows_number(); i++)
+   {
+      if(confidence(i, 0) == 0.0 && confidence(i, 1) == 1.0)
+      {
+         assert_true(fabs(confidence(i, 2) - 2.0/3.0) < 1.0e-12, LOG);
+      }
+      else if(confidence(i, 0) == 2.0 || confidence(i, 1) == 2.0)
+      {
+         assert_true(confidence(i, 2) == 0.0, LOG);
+      }
+   }
+}
+
+
+void AssociationRulesTest::test_calculate_lift()
+{
+   message += "test_calculate_lift\n";
+
+   AssociationRules association_rules;
+
+   SparseMatrix<int> orders(4, 3);
+
+   orders.set_element(0, 0, 1);
+   orders.set_element(0, 1, 1);
+   orders.set_element(1, 0, 1);
+   orders.set_element(1, 1, 1);
+   orders.set_element(2, 0, 1);
+   orders.set_element(3, 2, 1);
+
+   association_rules.set_sparse_matrix(orders);
+
+   // Test
+
+   const Matrix<double> lift = association_rules.calculate_lift(1, 1);
+
+   assert_true(lift.get_rows_number() == 6, LOG);
+
+   for(size_t i = 0; i < lift.get_rows_number(); i++)
+   {
+      if(lift(i, 0) + lift(i, 1) == 1.0)
+      {
+         assert_true(fabs(lift(i, 2) - 50.0/(75.0*50.0)) < 1.0e-12, LOG);
+      }
+      else
+      {
+         assert_true(lift(i, 2) == 0.0, LOG);
+      }
+   }
+}
+
+
+void AssociationRulesTest::test_calculate_frequent_itemsets()
+{
+   message += "test_calculate_frequent_itemsets\n";
+
+   AssociationRules association_rules;
+
+   association_rules.set_sparse_matrix(generate_orders(200, 9, 0.35));
+   association_rules.set_minimum_support(4.0);
+
+   Vector< Matrix<double> > frequent_itemsets;
+
+   // Test
+
+   frequent_itemsets = association_rules.calculate_frequent_itemsets();
+
+   assert_true(frequent_itemsets.size() >= 3, LOG);
+
+   for(size_t order = 1; order <= frequent_itemsets.size(); order++)
+   {
+      const Matrix<double>& itemsets = frequent_itemsets[order-1];
+
+      const Matrix<double> support = association_rules.calculate_support(order).filter_column_greater_than(order+1, 4.0);
+
+      assert_true(itemsets.get_rows_number() == support.get_rows_number(), LOG);
+      assert_true(itemsets.get_columns_number() == order+2, LOG);
+      assert_true(itemsets.get_column(order) == itemsets.get_column(order).sort_descending_values(), LOG);
+
+      for(size_t i = 0; i < support.get_rows_number(); i++)
+      {
+         const Vector<double> row = support.get_row(i);
+
+         bool found = false;
+
+         for(size_t j = 0; j < itemsets.get_rows_number(); j++)
+         {
+            if(itemsets.get_row(j).get_first(order).has_same_elements(row.get_first(order)))
+            {
+               found = itemsets(j, order) == row[order] && fabs(itemsets(j, order+1) - row[order+1]) < 1.0e-12;
+            }
+         }
+
+         assert_true(found, LOG);
+      }
+   }
+
+   assert_true(association_rules.calculate_support(frequent_itemsets.size()+1).filter_column_greater_than(frequent_itemsets.size()+2, 4.0).empty(), LOG);
+
+   // Test
+
+   frequent_itemsets = association_rules.calculate_frequent_itemsets(2);
+
+   assert_true(frequent_itemsets.size() == 2, LOG);
+
+   // Test
+
+   association_rules.set_minimum_support(100.0);
+
+   frequent_itemsets = association_rules.calculate_frequent_itemsets();
+
+   assert_true(frequent_itemsets.size() == 1, LOG);
+   assert_true(frequent_itemsets[0].get_rows_number() == 0, LOG);
+}
+
+
+void AssociationRulesTest::test_perform_a_priori_algorithm()
+{
+   message += "test_perform_a_priori_algorithm\n";
+
+   AssociationRules association_rules;
+
+   association_rules.set_display(false);
+   association_rules.set_sparse_matrix(generate_orders(100, 6, 0.5));
+   association_rules.set_minimum_support(10.0);
+
+   // Test
+
+   const Vector< Matrix<double> > most_frequent = association_rules.perform_a_priori_algorithm();
+
+   assert_true(most_frequent.size() > 1, LOG);
+   assert_true(most_frequent[0] == association_rules.calculate_frequent_itemsets()[0], LOG);
+   assert_true(association_rules.get_sparse_matrix().get_rows_number() == 100, LOG);
+}
+
+
+void AssociationRulesTest::run_test_case()
+{
+   message += "Running association rules test case...\n";
+
+   // Association rules methods
+
+   test_calculate_support();
+   test_calculate_confidence();
+   test_calculate_lift();
+
+   test_calculate_frequent_itemsets();
+
+   // Algorithm methods
+
+   test_perform_a_priori_algorithm();
+
+   message += "End of association rules test case.\n";
+}
+
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -0,0 +1,80 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   A S S O C I A T I O N   R U L E S   T E S T   C L A S S   H E A D E R                                      */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __ASSOCIATIONRULESTEST_H__
+#define __ASSOCIATIONRULESTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+namespace OpenNN
+{
+
+class AssociationRulesTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit AssociationRulesTest();
+
+   // DESTRUCTOR
+
+   virtual ~AssociationRulesTest();
+
+   // METHODS
+
+   // Association rules methods
+
+   void test_calculate_support();
+   void test_calculate_confidence();
+   void test_calculate_lift();
+
+   void test_calculate_frequent_itemsets();
+
+   // Algorithm methods
+
+   void test_perform_a_priori_algorithm();
+
+   // Unit testing methods
+
+   void run_test_case();
+};
+
+}
+
+#endif
+
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
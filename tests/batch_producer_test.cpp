@@ -0,0 +1,228 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   B A T C H   P R O D U C E R   T E S T   C L A S S                                                          */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "batch_producer_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+BatchProducerTest::BatchProducerTest() : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+BatchProducerTest::~BatchProducerTest()
+{
+}
+
+
+// METHODS
+
+void BatchProducerTest::test_constructor()
+{
+   message += "test_constructor\n";
+
+   DataSet ds(5, 2, 1);
+
+   // Test
+
+   BatchProducer bp1;
+
+   assert_true(bp1.get_data_set_pointer() == nullptr, LOG);
+   assert_true(bp1.get_batches_number() == 0, LOG);
+
+   // Test
+
+   BatchProducer bp2(&ds);
+
+   assert_true(bp2.get_data_set_pointer() == &ds, LOG);
+   assert_true(bp2.get_shuffle(), LOG);
+}
+
+
+void BatchProducerTest::test_start_epoch()
+{
+   message += "test_start_epoch\n";
+
+   DataSet ds(10, 2, 1);
+
+   ds.get_instances_pointer()->set_training();
+
+   BatchProducer bp(&ds);
+
+   Vector<size_t> indices;
+
+   // Test
+
+   bp.set_batch_size(4);
+   bp.set_shuffle(false);
+
+   bp.start_epoch();
+
+   assert_true(bp.get_batches_number() == 3, LOG);
+   assert_true(bp.get_batches_indices() == ds.get_instances().get_training_batches(4), LOG);
+
+   // Test
+
+   bp.set_shuffle(true);
+   bp.set_seed(1);
+
+   bp.start_epoch();
+
+   const Vector< Vector<size_t> > batches_indices = bp.get_batches_indices();
+
+   assert_true(bp.get_batches_number() == 3, LOG);
+
+   for(size_t i = 0; i < batches_indices.size(); i++)
+   {
+       indices.insert(indices.end(), batches_indices[i].begin(), batches_indices[i].end());
+   }
+
+   sort(indices.begin(), indices.end());
+
+   assert_true(indices == ds.get_instances().get_training_indices(), LOG);
+
+   // Test
+
+   bp.set_seed(1);
+
+   bp.start_epoch();
+
+   assert_true(bp.get_batches_indices() == batches_indices, LOG);
+}
+
+
+void BatchProducerTest::test_get_next_batch()
+{
+   message += "test_get_next_batch\n";
+
+   DataSet ds(23, 3, 2);
+
+   ds.randomize_data_normal();
+
+   ds.get_instances_pointer()->set_training();
+   ds.get_instances_pointer()->set_use(5, Instances::Selection);
+
+   BatchProducer bp(&ds);
+
+   BatchProducer::Batch batch;
+
+   size_t batches_count;
+   size_t instances_count;
+
+   bp.set_batch_size(5);
+   bp.set_shuffle(true);
+
+   for(size_t prefetched_batches_number = 0; prefetched_batches_number < 4; prefetched_batches_number++)
+   {
+       bp.set_prefetched_batches_number(prefetched_batches_number);
+
+       for(size_t epoch = 0; epoch < 2; epoch++)
+       {
+           bp.start_epoch();
+
+           batches_count = 0;
+           instances_count = 0;
+
+           while(bp.get_next_batch(batch))
+           {
+               assert_true(batch.indices == bp.get_batches_indices()[batches_count], LOG);
+               assert_true(batch.inputs == ds.get_inputs(batch.indices), LOG);
+               assert_true(batch.targets == ds.get_targets(batch.indices), LOG);
+
+               batches_count++;
+               instances_count += batch.indices.size();
+           }
+
+           assert_true(batches_count == 5, LOG);
+           assert_true(instances_count == 22, LOG);
+       }
+   }
+}
+
+
+void BatchProducerTest::test_stop()
+{
+   message += "test_stop\n";
+
+   DataSet ds(100, 2, 1);
+
+   ds.get_instances_pointer()->set_training();
+
+   BatchProducer bp(&ds);
+
+   BatchProducer::Batch batch;
+
+   bp.set_batch_size(1);
+   bp.set_prefetched_batches_number(2);
+
+   // Epoch abandoned before the producer finishes
+
+   bp.start_epoch();
+
+   assert_true(bp.get_next_batch(batch), LOG);
+
+   bp.stop();
+
+   // New epoch after stopping
+
+   bp.start_epoch();
+
+   size_t batches_count = 0;
+
+   while(bp.get_next_batch(batch)) batches_count++;
+
+   assert_true(batches_count == 100, LOG);
+}
+
+
+void BatchProducerTest::run_test_case()
+{
+   message += "Running batch producer test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+
+   // Epoch methods
+
+   test_start_epoch();
+
+   test_get_next_batch();
+
+   test_stop();
+
+   message += "End of batch producer test case.\n";
+}
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -133,6 +133,90 @@ void CorrelationAnalysisTest::test_calculate_linear_correlation_missing_values()
 }
 
 
+void CorrelationAnalysisTest::test_calculate_linear_correlations_missing_values()
+{
+    message += "test_calculate_linear_correlations_missing_values\n";
+
+    const size_t instances_number = 2500;
+    const size_t variables_number = 5;
+
+    Matrix<double> data(instances_number, variables_number);
+    data.randomize_normal();
+
+    data.set_column(2, data.get_column(0)*2.0 + data.get_column(1));
+    data.set_column(4, Vector<double>(instances_number, 3.0));
+
+    Vector<size_t> instances_indices(instances_number);
+    instances_indices.initialize_sequential();
+
+    Vector<size_t> variables_indices(variables_number);
+    variables_indices.initialize_sequential();
+
+    Vector< Vector<size_t> > missing_indices(variables_number);
+
+    Matrix<double> correlations;
+
+    // Test
+
+    correlations = CorrelationAnalysis::calculate_linear_correlations_missing_values(data, instances_indices, variables_indices, variables_indices, missing_indices);
+
+    assert_true(correlations.get_rows_number() == variables_number, LOG);
+    assert_true(correlations.get_columns_number() == variables_number, LOG);
+
+    for(size_t i = 0; i < variables_number; i++)
+    {
+        for(size_t j = 0; j < variables_number; j++)
+        {
+            const double correlation = CorrelationAnalysis::calculate_linear_correlation(data.get_column(i), data.get_column(j));
+
+            assert_true(abs(correlations(i,j) - correlation) < 1.0e-9, LOG);
+        }
+    }
+
+    // Test
+
+    for(size_t i = 0; i < instances_number; i += 7) missing_indices[0].push_back(i);
+    for(size_t i = 3; i < instances_number; i += 11) missing_indices[1].push_back(i);
+    for(size_t i = 1000; i < 1100; i++) missing_indices[3].push_back(i);
+
+    const Vector<size_t> rows_variables_indices({0, 1, 4});
+    const Vector<size_t> columns_variables_indices({2, 3});
+
+    correlations = CorrelationAnalysis::calculate_linear_correlations_missing_values(data, instances_indices, rows_variables_indices, columns_variables_indices, missing_indices);
+
+    for(size_t i = 0; i < rows_variables_indices.size(); i++)
+    {
+        for(size_t j = 0; j < columns_variables_indices.size(); j++)
+        {
+            const size_t row_variable = rows_variables_indices[i];
+            const size_t column_variable = columns_variables_indices[j];
+
+            const double correlation = CorrelationAnalysis::calculate_linear_correlation_missing_values(data.get_column(row_variable),
+                                                                                                       data.get_column(column_variable),
+                                                                                                       missing_indices[row_variable].get_union(missing_indices[column_variable]));
+
+            assert_true(abs(correlations(i,j) - correlation) < 1.0e-9, LOG);
+        }
+    }
+
+    // Test
+
+    correlations = CorrelationAnalysis::calculate_linear_correlations_missing_values(data, instances_indices, variables_indices, variables_indices, missing_indices);
+
+    for(size_t i = 0; i < variables_number; i++)
+    {
+        for(size_t j = 0; j < variables_number; j++)
+        {
+            const double correlation = CorrelationAnalysis::calculate_linear_correlation_missing_values(data.get_column(i),
+                                                                                                       data.get_column(j),
+                                                                                                       missing_indices[i].get_union(missing_indices[j]));
+
+            assert_true(abs(correlations(i,j) - correlation) < 1.0e-9, LOG);
+        }
+    }
+}
+
+
 void CorrelationAnalysisTest::test_calculate_multivariate_correlation()
 {
     message += "test_calculate_multivariate_correlation\n";
@@ -412,6 +496,8 @@ void CorrelationAnalysisTest::run_test_case()
 
    test_calculate_linear_correlation_missing_values();
 
+   test_calculate_linear_correlations_missing_values();
+
    // Multivariate correlation method
 
    test_calculate_multivariate_correlation();
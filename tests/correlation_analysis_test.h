@@ -51,6 +51,8 @@ public:
 
     void test_calculate_linear_correlation_missing_values();
 
+    void test_calculate_linear_correlations_missing_values();
+
     // Multivariate Correlation Methods
 
     void test_calculate_multivariate_correlation();
@@ -0,0 +1,359 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   D A T A   P A R A L L E L   T E S T   C L A S S                                                            */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "data_parallel_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+DataParallelTest::DataParallelTest() : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+DataParallelTest::~DataParallelTest()
+{
+}
+
+
+// METHODS
+
+void DataParallelTest::test_set_MPI()
+{
+   message += "test_set_MPI\n";
+
+   DataSet ds;
+
+   set_data_set(ds);
+
+   SumSquaredError sse;
+
+   // Test
+
+   DataSet shard;
+
+   shard.set_MPI(&ds);
+
+   assert_true(sse.sum_MPI(shard.get_instances().get_training_instances_number()) == ds.get_instances().get_training_instances_number(), LOG);
+   assert_true(sse.sum_MPI(shard.get_instances().get_selection_instances_number()) == ds.get_instances().get_selection_instances_number(), LOG);
+   assert_true(shard.get_instances().get_testing_instances_number() == 0, LOG);
+
+   assert_true(shard.get_variables().get_inputs_number() == 2, LOG);
+   assert_true(shard.get_variables().get_targets_number() == 1, LOG);
+
+   const Vector<size_t> used_indices = ds.get_instances().get_used_indices();
+
+   const double data_sum = ds.get_data().get_submatrix_rows(used_indices).calculate_sum();
+
+   assert_true(fabs(sse.sum_MPI(shard.get_data().calculate_sum()) - data_sum) < 1.0e-9, LOG);
+}
+
+
+void DataParallelTest::test_set_MPI_shard()
+{
+   message += "test_set_MPI_shard\n";
+
+   DataSet ds;
+
+   set_data_set(ds);
+
+   NeuralNetwork nn;
+
+   set_neural_network(nn);
+
+   // Test
+
+   DataSet shard(ds);
+
+   shard.set_MPI_shard();
+
+   MeanSquaredError mse(&nn, &shard);
+
+   assert_true(mse.sum_MPI(shard.get_instances().get_training_instances_number()) == ds.get_instances().get_training_instances_number(), LOG);
+   assert_true(mse.sum_MPI(shard.get_instances().get_selection_instances_number()) == ds.get_instances().get_selection_instances_number(), LOG);
+
+   const Vector<size_t> training_indices = ds.get_instances().get_training_indices();
+
+   const Matrix<double> outputs = nn.get_multilayer_perceptron_pointer()->calculate_outputs(ds.get_inputs(training_indices));
+
+   const double training_error = outputs.calculate_sum_squared_error(ds.get_targets(training_indices))/static_cast<double>(training_indices.size());
+
+   assert_true(fabs(mse.calculate_training_error() - training_error) < 1.0e-12, LOG);
+}
+
+
+void DataParallelTest::test_calculate_training_error()
+{
+   message += "test_calculate_training_error\n";
+
+   DataSet ds;
+
+   set_data_set(ds);
+
+   NeuralNetwork nn;
+
+   set_neural_network(nn);
+
+   DataSet shard;
+
+   shard.set_MPI(&ds);
+
+   NeuralNetwork shard_nn;
+
+   shard_nn.set_MPI(&nn);
+
+   const Vector<size_t> training_indices = ds.get_instances().get_training_indices();
+
+   const Matrix<double> outputs = nn.get_multilayer_perceptron_pointer()->calculate_outputs(ds.get_inputs(training_indices));
+
+   const double training_error = outputs.calculate_sum_squared_error(ds.get_targets(training_indices));
+
+   // Sum squared error
+
+   SumSquaredError sse(&shard_nn, &shard);
+
+   assert_true(fabs(sse.calculate_training_error() - training_error) < 1.0e-12, LOG);
+
+   // Mean squared error
+
+   MeanSquaredError mse(&shard_nn, &shard);
+
+   assert_true(fabs(mse.calculate_training_error() - training_error/static_cast<double>(training_indices.size())) < 1.0e-12, LOG);
+
+   // Normalized squared error
+
+   NormalizedSquaredError nse(&shard_nn, &shard);
+
+   NormalizedSquaredError full_nse(&nn, &ds);
+
+   assert_true(fabs(nse.get_normalization_coefficient() - full_nse.get_normalization_coefficient()/static_cast<double>(sse.sum_MPI(static_cast<size_t>(1)))) < 1.0e-12, LOG);
+   assert_true(fabs(nse.calculate_training_error() - full_nse.calculate_training_error()) < 1.0e-12, LOG);
+}
+
+
+void DataParallelTest::test_calculate_training_error_gradient()
+{
+   message += "test_calculate_training_error_gradient\n";
+
+   DataSet ds;
+
+   set_data_set(ds);
+
+   NeuralNetwork nn;
+
+   set_neural_network(nn);
+
+   DataSet shard;
+
+   shard.set_MPI(&ds);
+
+   NeuralNetwork shard_nn;
+
+   shard_nn.set_MPI(&nn);
+
+   // Each process computes the gradient of the whole data set, so that the sum counts it once for each process
+
+   SumSquaredError sse(&shard_nn, &shard);
+   SumSquaredError full_sse(&nn, &ds);
+
+   const double processes_number = static_cast<double>(sse.sum_MPI(static_cast<size_t>(1)));
+
+   const Vector<double> full_gradient = full_sse.calculate_training_error_gradient()/processes_number;
+
+   // Test
+
+   assert_true((sse.calculate_training_error_gradient() - full_gradient).calculate_L2_norm() < 1.0e-9, LOG);
+
+   // Test
+
+   const Vector<size_t> training_indices = shard.get_instances().get_training_indices();
+
+   const Vector<double> batch_gradient = sse.calculate_batch_error_gradient(shard.get_inputs(training_indices), shard.get_targets(training_indices));
+
+   assert_true((batch_gradient - full_gradient).calculate_L2_norm() < 1.0e-9, LOG);
+
+   // Test
+
+   MeanSquaredError mse(&shard_nn, &shard);
+   MeanSquaredError full_mse(&nn, &ds);
+
+   assert_true((mse.calculate_training_error_gradient() - full_mse.calculate_training_error_gradient()).calculate_L2_norm() < 1.0e-9, LOG);
+}
+
+
+void DataParallelTest::test_perform_training()
+{
+   message += "test_perform_training\n";
+
+   DataSet ds;
+
+   set_data_set(ds);
+
+   NeuralNetwork nn;
+
+   set_neural_network(nn);
+
+   DataSet shard;
+
+   shard.set_MPI(&ds);
+
+   NeuralNetwork shard_nn;
+
+   shard_nn.set_MPI(&nn);
+
+   SumSquaredError sse(&shard_nn, &shard);
+
+   double old_training_error;
+
+   // Quasi-Newton method
+
+   old_training_error = sse.calculate_training_error();
+
+   QuasiNewtonMethod qnm(&sse);
+
+   qnm.set_display(false);
+   qnm.set_maximum_epochs_number(5);
+
+   delete qnm.perform_training();
+
+   assert_true(sse.calculate_training_error() < old_training_error, LOG);
+   assert_true(is_equal_in_all_processes(sse, shard_nn.get_parameters()), LOG);
+
+   // Conjugate gradient
+
+   old_training_error = sse.calculate_training_error();
+
+   ConjugateGradient cg(&sse);
+
+   cg.set_display(false);
+   cg.set_maximum_epochs_number(5);
+
+   delete cg.perform_training();
+
+   assert_true(sse.calculate_training_error() <= old_training_error, LOG);
+   assert_true(is_equal_in_all_processes(sse, shard_nn.get_parameters()), LOG);
+
+   // Stochastic gradient descent, in which the shards have different numbers of batches
+
+   StochasticGradientDescent sgd(&sse);
+
+   sgd.set_display(false);
+   sgd.set_training_batch_size(2);
+   sgd.set_learning_rate(0.001);
+   sgd.set_maximum_epochs_number(3);
+
+   delete sgd.perform_training();
+
+   assert_true(is_equal_in_all_processes(sse, shard_nn.get_parameters()), LOG);
+}
+
+
+void DataParallelTest::run_test_case()
+{
+   message += "Running data parallel test case...\n";
+
+   // Data set methods
+
+   test_set_MPI();
+   test_set_MPI_shard();
+
+   // Loss index methods
+
+   test_calculate_training_error();
+   test_calculate_training_error_gradient();
+
+   // Training methods
+
+   test_perform_training();
+
+   message += "End of data parallel test case.\n";
+}
+
+
+/// Sets a data set with two inputs and one target, whose values are the same in all the processes.
+/// The first instances are used for training and the last ones for selection.
+
+void DataParallelTest::set_data_set(DataSet& ds) const
+{
+   const size_t instances_number = 23;
+
+   Matrix<double> data(instances_number, 3);
+
+   for(size_t i = 0; i < instances_number; i++)
+   {
+      data(i,0) = sin(0.5*static_cast<double>(i));
+      data(i,1) = cos(0.3*static_cast<double>(i));
+      data(i,2) = data(i,0)*data(i,1) + 0.1*static_cast<double>(i%3);
+   }
+
+   ds.set_data(data);
+
+   ds.get_instances_pointer()->split_sequential_indices(0.75, 0.25, 0.0);
+}
+
+
+/// Sets a neural network with two inputs, three hidden perceptrons and one output,
+/// whose parameters are the same in all the processes.
+
+void DataParallelTest::set_neural_network(NeuralNetwork& nn) const
+{
+   nn.set(2, 3, 1);
+
+   const size_t parameters_number = nn.get_parameters_number();
+
+   Vector<double> parameters(parameters_number);
+
+   for(size_t i = 0; i < parameters_number; i++)
+   {
+      parameters[i] = 0.5*sin(static_cast<double>(i+1));
+   }
+
+   nn.set_parameters(parameters);
+}
+
+
+/// Returns true if a vector has the same values in all the processes.
+
+bool DataParallelTest::is_equal_in_all_processes(const LossIndex& loss_index, const Vector<double>& vector) const
+{
+   const double processes_number = static_cast<double>(loss_index.sum_MPI(static_cast<size_t>(1)));
+
+   Vector<double> sum(vector);
+
+   loss_index.sum_MPI(sum);
+
+   return (sum - vector*processes_number).calculate_L2_norm() < 1.0e-9;
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
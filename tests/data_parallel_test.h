@@ -0,0 +1,91 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   D A T A   P A R A L L E L   T E S T   C L A S S   H E A D E R                                              */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __DATAPARALLELTEST_H__
+#define __DATAPARALLELTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+namespace OpenNN
+{
+
+/// This class tests data parallel training, in which each MPI process holds a shard of the instances.
+/// All the processes must run these tests. Without MPI, there is a single shard.
+
+class DataParallelTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit DataParallelTest();
+
+   // DESTRUCTOR
+
+   virtual ~DataParallelTest();
+
+   // METHODS
+
+   // Data set methods
+
+   void test_set_MPI();
+   void test_set_MPI_shard();
+
+   // Loss index methods
+
+   void test_calculate_training_error();
+   void test_calculate_training_error_gradient();
+
+   // Training methods
+
+   void test_perform_training();
+
+   // Unit testing methods
+
+   void run_test_case();
+
+private:
+
+   void set_data_set(DataSet&) const;
+   void set_neural_network(NeuralNetwork&) const;
+
+   bool is_equal_in_all_processes(const LossIndex&, const Vector<double>&) const;
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -232,6 +232,199 @@ void DataSetTest::test_get_targets()
 }
 
 
+void DataSetTest::test_get_training_batches()
+{
+   message += "test_get_training_batches\n";
+
+   DataSet ds;
+
+   // Test
+
+   ds.set(5, 2, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   const DataSet::Batches& batches = ds.get_training_batches(2);
+
+   assert_true(batches.get_batches_number() == 3, LOG);
+   assert_true(batches.inputs[0] == ds.get_inputs(batches.indices[0]), LOG);
+   assert_true(batches.targets[2] == ds.get_targets(batches.indices[2]), LOG);
+   assert_true(batches.inputs[2].get_rows_number() == 1, LOG);
+
+   // Test
+
+   ds.initialize_data(1.0);
+
+   assert_true(ds.get_training_batches(2).inputs[1] == 1.0, LOG);
+
+   // Test
+
+   ds.get_instances_pointer()->set_selection(0, 1);
+
+   assert_true(ds.get_training_batches(2).get_batches_number() == 2, LOG);
+   assert_true(ds.get_selection_batches(2).get_batches_number() == 1, LOG);
+}
+
+
+void DataSetTest::test_save_data_column_store()
+{
+   message += "test_save_data_column_store\n";
+
+   const string column_store_file_name = "../data/data_column_store.bin";
+
+   DataSet ds;
+   DataSet column_store_ds;
+
+   // Test
+
+   ds.set(7, 2, 1);
+   ds.randomize_data_normal();
+   ds.get_variables_pointer()->set_name(0, "x0");
+   ds.get_variables_pointer()->set_use(1, Variables::Unused);
+   ds.get_instances_pointer()->set_training();
+   ds.get_instances_pointer()->set_selection(5, 2);
+
+   ds.save_data_column_store(column_store_file_name);
+
+   column_store_ds.set_data_file_name(column_store_file_name);
+   column_store_ds.load_data_column_store();
+   column_store_ds.get_instances_pointer()->set_training();
+   column_store_ds.get_instances_pointer()->set_selection(5, 2);
+
+   assert_true(column_store_ds.has_column_store(), LOG);
+   assert_true(column_store_ds.get_data().empty(), LOG);
+   assert_true(column_store_ds.get_instances().get_instances_number() == 7, LOG);
+   assert_true(column_store_ds.get_variables().get_names()[0] == "x0", LOG);
+   assert_true(column_store_ds.get_variables().get_inputs_number() == 1, LOG);
+   assert_true(column_store_ds.get_column_store().get_matrix() == ds.get_data(), LOG);
+
+   assert_true(column_store_ds.get_training_inputs() == ds.get_training_inputs(), LOG);
+   assert_true(column_store_ds.get_selection_targets() == ds.get_selection_targets(), LOG);
+   const DataSet::Batches& column_store_batches = column_store_ds.get_training_batches(2);
+
+   Matrix<double> inputs_buffer;
+
+   assert_true(column_store_batches.inputs.empty(), LOG);
+   assert_true(column_store_batches.get_inputs(1, inputs_buffer) == ds.get_training_batches(2).inputs[1], LOG);
+
+   assert_true(column_store_ds.calculate_inputs_statistics()[0].mean == ds.calculate_inputs_statistics()[0].mean, LOG);
+   assert_true(column_store_ds.calculate_training_instances_statistics()[2].maximum == ds.calculate_training_instances_statistics()[2].maximum, LOG);
+   assert_true(column_store_ds.calculate_data_statistics()[1].standard_deviation == ds.calculate_data_statistics()[1].standard_deviation, LOG);
+
+   // Test
+
+   bool thrown = false;
+
+   try
+   {
+      column_store_ds.scale_inputs_minimum_maximum(ds.calculate_inputs_statistics());
+   }
+   catch(const logic_error&)
+   {
+      thrown = true;
+   }
+
+   assert_true(thrown, LOG);
+
+   thrown = false;
+
+   try
+   {
+      column_store_ds.impute_missing_values_mean();
+   }
+   catch(const logic_error&)
+   {
+      thrown = true;
+   }
+
+   assert_true(thrown, LOG);
+   assert_true(column_store_ds.get_column_store().get_matrix() == ds.get_data(), LOG);
+
+   // Test
+
+   column_store_ds.set(2, 2);
+
+   assert_true(!column_store_ds.has_column_store(), LOG);
+
+   // Test
+
+   {
+      fstream file(column_store_file_name.c_str(), ios::binary | ios::in | ios::out);
+
+      const uint64_t name_size = static_cast<uint64_t>(1) << 40;
+
+      file.seekp(56);
+      file.write(reinterpret_cast<const char*>(&name_size), sizeof(name_size));
+   }
+
+   thrown = false;
+
+   column_store_ds.set_data_file_name(column_store_file_name);
+
+   try
+   {
+      column_store_ds.load_data_column_store();
+   }
+   catch(const logic_error&)
+   {
+      thrown = true;
+   }
+
+   assert_true(thrown, LOG);
+}
+
+
+void DataSetTest::test_convert_data_file_to_column_store()
+{
+   message += "test_convert_data_file_to_column_store\n";
+
+   const string data_file_name = "../data/data.dat";
+   const string column_store_file_name = "../data/data_column_store.bin";
+
+   DataSet ds;
+
+   ofstream file;
+
+   const Matrix<double>* data_pointer;
+
+   // Test
+
+   ds.set_data_file_name(data_file_name);
+   ds.set_header_line(true);
+   ds.set_separator("Comma");
+   ds.set_missing_values_label("?");
+   ds.set_display(false);
+
+   file.open(data_file_name.c_str());
+   file << "a,b,c\n"
+        << "1,2,3\n"
+        << "\n"
+        << "4,?,6\n"
+        << "7,8,9\n";
+   file.close();
+
+   ds.convert_data_file_to_column_store(column_store_file_name);
+
+   ds.load_data();
+
+   data_pointer = &ds.get_data();
+
+   const Matrix<double> data = *data_pointer;
+
+   ds.set_data_file_name(column_store_file_name);
+   ds.load_data_column_store();
+
+   assert_true(ds.has_column_store(), LOG);
+   assert_true(ds.get_column_store().get_matrix() == data, LOG);
+   assert_true(ds.get_column_store().get_missing_values_numbers()[1] == 1, LOG);
+   assert_true(ds.get_variables().get_names()[2] == "c", LOG);
+   assert_true(ds.get_variables().get_targets_number() == 1, LOG);
+   assert_true(ds.get_missing_values().get_missing_values_number() == 1, LOG);
+   assert_true(ds.get_missing_values().is_missing_value(1, 1), LOG);
+   assert_true(ds.get_targets() == data.get_submatrix(Vector<size_t>(0, 1, 2), Vector<size_t>(1, 2)), LOG);
+}
+
+
 void DataSetTest::test_get_instance()
 {
    message += "test_get_instance\n";
@@ -546,6 +739,60 @@ void DataSetTest::test_calculate_targets_statistics()
 void DataSetTest::test_calculate_linear_correlations()
 {
    message += "test_calculate_linear_correlations\n";
+
+   DataSet ds(200, 4, 1);
+
+   ds.randomize_data_normal();
+
+   Matrix<double> data = ds.get_data();
+
+   for(size_t i = 0; i < 200; i++)
+   {
+       for(size_t k = 0; k < 3; k++)
+       {
+           data(i,1+k) = (i%3 == k) ? 1.0 : 0.0;
+       }
+
+       data(i,4) = data(i,0) + 2.0*data(i,2) - data(i,3) + 0.5*data(i,4);
+   }
+
+   ds.set_data(data);
+
+   Matrix<double> correlations;
+
+   // Test
+
+   correlations = ds.calculate_input_target_correlations();
+
+   assert_true(correlations.get_rows_number() == 4, LOG);
+   assert_true(correlations.get_columns_number() == 1, LOG);
+   assert_true(abs(correlations(0,0) - CorrelationAnalysis::calculate_linear_correlation(data.get_column(0), data.get_column(4))) < 1.0e-9, LOG);
+
+   // Test
+
+   correlations = ds.calculate_variables_correlations();
+
+   assert_true(correlations.get_rows_number() == 5, LOG);
+   assert_true(correlations.get_columns_number() == 5, LOG);
+
+   for(size_t i = 0; i < 5; i++)
+   {
+       for(size_t j = 0; j < 5; j++)
+       {
+           assert_true(abs(correlations(i,j) - CorrelationAnalysis::calculate_linear_correlation(data.get_column(i), data.get_column(j))) < 1.0e-9, LOG);
+       }
+   }
+
+   // Test
+
+   const Vector<size_t> nominal_variables({1, 3, 1});
+
+   correlations = ds.calculate_multiple_linear_correlations(nominal_variables);
+
+   assert_true(correlations.get_rows_number() == 2, LOG);
+   assert_true(correlations.get_columns_number() == 1, LOG);
+   assert_true(abs(correlations(0,0) - CorrelationAnalysis::calculate_linear_correlation(data.get_column(0), data.get_column(4))) < 1.0e-9, LOG);
+   assert_true(abs(correlations(1,0) - CorrelationAnalysis::calculate_multiple_linear_correlation(data.get_submatrix_columns(Vector<size_t>({1, 2, 3})), data.get_column(4))) < 1.0e-9, LOG);
 }
 
 void DataSetTest::test_calculate_autocorrelations()
@@ -1471,122 +1718,81 @@ void DataSetTest::test_balance_function_regression_targets_distribution()
     assert_true(unused_instances.size() == 1000, LOG);
 }
 
-/*
-void DataSetTest::test_calculate_instances_distances()
+void DataSetTest::test_calculate_instances_nearest_neighbors()
 {
-    message += "test_calculate_instances_distances\n";
+    message += "test_calculate_instances_nearest_neighbors\n";
 
-    DataSet ds(5, 5, 2);
+    DataSet ds(50, 2, 1);
     ds.randomize_data_normal();
 
-    Matrix<double> distances;
+    SpatialIndex::Neighbors nearest_neighbors;
 
-    //distances = ds.calculate_instances_distances();
-
-    assert_true(distances(0, 0) == 0, LOG);
-    assert_true(distances(1, 1) == 0, LOG);
-    assert_true(distances(0, 1) == distances(1, 0), LOG);
-}
-
-
-void DataSetTest::test_calculate_k_distances()
-{
-    message += "test_calculate_k_distances\n";
+    // Test
 
-    DataSet ds(5, 5, 10);
-    ds.randomize_data_normal();
+    nearest_neighbors = ds.calculate_instances_nearest_neighbors(3);
 
-    size_t nearest_neighbors_number = 2;
+    assert_true(nearest_neighbors.indices.get_rows_number() == 50, LOG);
+    assert_true(nearest_neighbors.indices.get_columns_number() == 3, LOG);
+    assert_true(!nearest_neighbors.indices.get_row(7).contains(7), LOG);
+    assert_true(nearest_neighbors.distances(7, 0) <= nearest_neighbors.distances(7, 2), LOG);
 
-    Vector<double> k_distances;
+    const Matrix<double> data = ds.get_data();
 
-    Matrix<double> distances(10, 10);
-    distances.randomize_uniform(0, 100);
+    Vector<double> distances(50);
 
-    for(size_t i = 0; i < 10; i++)
+    for(size_t i = 0; i < 50; i++)
     {
-        distances(i, i) = 0;
+        distances[i] = (data.get_row(i) - data.get_row(7)).calculate_L2_norm();
     }
 
-    k_distances = ds.calculate_k_distances(distances, nearest_neighbors_number);
+    distances[7] = numeric_limits<double>::max();
 
-    assert_true(k_distances.size() == 10, LOG);
-    assert_true(k_distances[0] == distances(0, distances.get_row(0).calculate_minimal_indices(nearest_neighbors_number + 1)[nearest_neighbors_number]), LOG);
-    assert_true(k_distances[9] == distances(9, distances.get_row(9).calculate_minimal_indices(nearest_neighbors_number + 1)[nearest_neighbors_number]), LOG);
-}
+    assert_true(nearest_neighbors.indices(7, 0) == distances.calculate_minimal_index(), LOG);
+    assert_true(fabs(nearest_neighbors.distances(7, 0) - distances.calculate_minimum()) < 1.0e-12, LOG);
 
+    // Test
 
-void DataSetTest::test_calculate_reachability_distances()
-{
-    message += "test_calculate_reachability_distances\n";
+    ds.get_instances_pointer()->set_unused(Vector<size_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
 
-    DataSet ds(5, 5, 10);
-    ds.randomize_data_normal();
+    nearest_neighbors = ds.calculate_instances_nearest_neighbors(3);
 
-    Matrix<double> distances(10, 10);
-    Vector<double> k_distances(10);
+    assert_true(nearest_neighbors.indices.get_rows_number() == 40, LOG);
+    assert_true(nearest_neighbors.indices.calculate_maximum() < 40, LOG);
+}
 
-    Matrix<double> reachability_distances;
 
-    // Test
+void DataSetTest::test_calculate_reachability_density()
+{
+    message += "test_calculate_reachability_density\n";
 
-    distances.initialize(1.0);
-    k_distances.initialize(3.0);
+    DataSet ds;
 
-    reachability_distances = ds.calculate_reachability_distances(distances, k_distances);
+    SpatialIndex::Neighbors nearest_neighbors;
 
-    assert_true(reachability_distances.get_columns_number() == 10, LOG);
-    assert_true(reachability_distances.get_rows_number() == 10, LOG);
-    assert_true(reachability_distances.get_row(0).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(1).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(2).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(3).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(4).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(5).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(6).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(7).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(8).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(9).is_in(3.0, 3.0), LOG);
+    Vector<double> reachability_density;
 
     // Test
 
-    distances.initialize(3.0);
-    k_distances.initialize(1.0);
+    nearest_neighbors.distances.set(3, 2, 1.0);
+    nearest_neighbors.indices.set(3, 2);
 
-    reachability_distances = ds.calculate_reachability_distances(distances, k_distances);
+    nearest_neighbors.indices.set_row(0, Vector<size_t>({1, 2}));
+    nearest_neighbors.indices.set_row(1, Vector<size_t>({0, 2}));
+    nearest_neighbors.indices.set_row(2, Vector<size_t>({0, 1}));
 
-    assert_true(reachability_distances.get_columns_number() == 10, LOG);
-    assert_true(reachability_distances.get_rows_number() == 10, LOG);
-    assert_true(reachability_distances.get_row(0).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(1).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(2).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(3).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(4).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(5).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(6).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(7).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(8).is_in(3.0, 3.0), LOG);
-    assert_true(reachability_distances.get_row(9).is_in(3.0, 3.0), LOG);
-}
+    reachability_density = ds.calculate_reachability_density(nearest_neighbors);
 
+    assert_true(reachability_density.size() == 3, LOG);
+    assert_true((reachability_density - 1.0).calculate_absolute_value() < 1.0e-9, LOG);
 
-void DataSetTest::test_calculate_reachability_density()
-{
-    message += "test_calculate_reachability_density\n";
-
-    DataSet ds(5, 5, 10);
-    ds.randomize_data_normal();
-
-    size_t nearest_neighbors_number = 2;
-
-    Matrix<double> distances(10, 10, 1.0);
+    // Test
 
-    Vector<double> reachability_density;
+    nearest_neighbors.distances.set_row(2, Vector<double>({3.0, 4.0}));
 
-    reachability_density = ds.calculate_reachability_density(distances, nearest_neighbors_number);
+    reachability_density = ds.calculate_reachability_density(nearest_neighbors);
 
-    assert_true(reachability_density.size() == 10, LOG);
-    assert_true(reachability_density.is_in(1.0, 1.0), LOG);
+    assert_true(fabs(reachability_density[0] - 2.0/5.0) < 1.0e-9, LOG);
+    assert_true(fabs(reachability_density[2] - 2.0/7.0) < 1.0e-9, LOG);
 }
 
 
@@ -1594,34 +1800,42 @@ void DataSetTest::test_calculate_local_outlier_factor()
 {
     message += "test_calculate_local_outlier_factor\n";
 
-    DataSet ds(2, 1, 100);
-    ds.generate_artificial_data(100, 3);
+    DataSet ds(101, 1, 1);
 
-    Vector<double> instance1(3, 1.0);
-    instance1[2] = 50.0;
+    Matrix<double> data(101, 2);
 
-    Vector<double> instance2(3, 1.0);
-    instance2[2] = 5.0;
+    for(size_t i = 0; i < 100; i++)
+    {
+        data(i, 0) = static_cast<double>(i/10);
+        data(i, 1) = static_cast<double>(i%10);
+    }
 
-    Vector<double> instance3(3);
+    data(100, 0) = 30.0;
+    data(100, 1) = 30.0;
 
-    instance3[0] = 1.0;
-    instance3[1] = 1.0;
-    instance3[2] = 0.0;
+    ds.set_data(data);
+
+    Vector<double> local_outlier_factor = ds.calculate_local_outlier_factor(5);
+
+    assert_true(local_outlier_factor.size() == 101, LOG);
+    assert_true(local_outlier_factor.calculate_maximal_index() == 100, LOG);
+    assert_true(local_outlier_factor[100] > 10.0, LOG);
+    assert_true(fabs(local_outlier_factor[55] - 1.0) < 1.0e-12, LOG);
 
-    Vector<double> instance4(3, 1.0);
-    instance4[2] = -10.0;
+    // Test
+
+    data.set(10, 2, 1.0);
 
-    ds.set_instance(96, instance1);
-    ds.set_instance(97, instance2);
-    ds.set_instance(98, instance3);
-    ds.set_instance(99, instance4);
+    data(9, 0) = 5.0;
 
-    ds.scale_data_minimum_maximum();
+    ds.set(10, 1, 1);
+    ds.set_data(data);
 
-    Vector<double> local_outlier_factor = ds.calculate_local_outlier_factor(8);
+    local_outlier_factor = ds.calculate_local_outlier_factor(3);
 
-    assert_true(local_outlier_factor.size() == 100, LOG);
+    assert_true(fabs(local_outlier_factor[0] - 1.0) < 1.0e-12, LOG);
+    assert_true(fabs(local_outlier_factor[8] - 1.0) < 1.0e-12, LOG);
+    assert_true(local_outlier_factor[9] > 1.6, LOG);
 }
 
 
@@ -1629,18 +1843,20 @@ void DataSetTest::test_clean_local_outlier_factor()
 {
     message += "test_clean_local_outlier_factor\n";
 
-    DataSet ds(5, 1, 100);
-    ds.randomize_data_uniform(1.0, 2.0);
+    DataSet ds(101, 1, 1);
 
-    Vector<double> instance(6);
+    Matrix<double> data(101, 2);
 
-    instance[0] = 1.0;
-    instance[1] = 1.9;
-    instance[2] = 2.5;
-    instance[3] = 1.1;
-    instance[4] = 1.8;
+    for(size_t i = 0; i < 100; i++)
+    {
+        data(i, 0) = static_cast<double>(i/10);
+        data(i, 1) = static_cast<double>(i%10);
+    }
 
-    ds.set_instance(9, instance);
+    data(100, 0) = 4.5;
+    data(100, 1) = 25.0;
+
+    ds.set_data(data);
 
     Vector<size_t> unused_instances;
 
@@ -1648,9 +1864,8 @@ void DataSetTest::test_clean_local_outlier_factor()
 
     assert_true(ds.get_instances().get_unused_instances_number() == 1, LOG);
     assert_true(unused_instances.size() == 1, LOG);
-    assert_true(unused_instances[0] == 9, LOG);
+    assert_true(unused_instances[0] == 100, LOG);
 }
-*/
 
 void DataSetTest::test_clean_Tukey_outliers()
 {
@@ -2288,6 +2503,121 @@ void DataSetTest::test_load_data()
 }
 
 
+void DataSetTest::test_load_data_sequential()
+{
+   message += "test_load_data_sequential\n";
+
+   const string data_file_name = "../data/data.dat";
+
+   DataSet ds;
+   DataSet sequential_ds;
+
+   ofstream file;
+
+   // Test
+
+   const Vector<string> example_file_names = {"../../examples/airfoil_self_noise/data/airfoil_self_noise.dat",
+                                              "../../examples/breast_cancer/data/breast_cancer.dat",
+                                              "../../examples/iris_plant/data/iris_plant.dat",
+                                              "../../examples/logical_operations/data/logical_operations.dat",
+                                              "../../examples/pima_indians_diabetes/data/pima_indians_diabetes.dat",
+                                              "../../examples/simple_function_regression/data/simplefunctionregression.dat",
+                                              "../../examples/simple_pattern_recognition/data/simple_pattern_recognition.dat",
+                                              "../../examples/urinary_inflammations_diagnosis/data/urinary_inflammations_diagnosis.dat",
+                                              "../../examples/yacht_hydrodynamics_design/data/yachtresistance.dat"};
+
+   for(size_t i = 0; i < example_file_names.size(); i++)
+   {
+       assert_true(ifstream(example_file_names[i].c_str()).is_open(), LOG);
+
+       ds.set();
+       ds.set_display(false);
+       ds.set_data_file_name(example_file_names[i]);
+       ds.set_separator(i == 0 ? "Tab" : "Space");
+       ds.load_data();
+
+       sequential_ds.set();
+       sequential_ds.set_display(false);
+       sequential_ds.set_data_file_name(example_file_names[i]);
+       sequential_ds.set_separator(i == 0 ? "Tab" : "Space");
+       sequential_ds.load_data_sequential();
+
+       assert_true(!ds.get_data().empty(), LOG);
+       assert_true(ds.get_data() == sequential_ds.get_data(), LOG);
+       assert_true(ds.get_variables().get_names() == sequential_ds.get_variables().get_names(), LOG);
+       assert_true(ds.get_variables().write_uses() == sequential_ds.get_variables().write_uses(), LOG);
+   }
+
+   // Test
+
+   file.open(data_file_name.c_str());
+   file << "\n"
+        << " x , y ,z\r\n"
+        << "  \t \n"
+        << "1.5,-2e3, 0.1\n"
+        << "\n"
+        << "?,123456789012345678901234,1e400\r\n"
+        << ".5,\t-0 ,0x10\n"
+        << "7,,8,9,\n"
+        << "3.14159265358979323846,1e-30,?";
+   file.close();
+
+   ds.set();
+   ds.set_display(false);
+   ds.set_data_file_name(data_file_name);
+   ds.set_separator("Comma");
+   ds.set_header_line(true);
+   ds.set_missing_values_label("?");
+   ds.load_data();
+
+   sequential_ds.set();
+   sequential_ds.set_display(false);
+   sequential_ds.set_data_file_name(data_file_name);
+   sequential_ds.set_separator("Comma");
+   sequential_ds.set_header_line(true);
+   sequential_ds.set_missing_values_label("?");
+   sequential_ds.load_data_sequential();
+
+   assert_true(ds.get_instances().get_instances_number() == 5, LOG);
+   assert_true(ds.get_data() == sequential_ds.get_data(), LOG);
+   assert_true(ds.get_variables().get_names() == sequential_ds.get_variables().get_names(), LOG);
+   assert_true(ds.get_missing_values().get_missing_indices() == sequential_ds.get_missing_values().get_missing_indices(), LOG);
+   assert_true(ds.get_missing_values().get_missing_values_number() == 2, LOG);
+
+   // Test
+
+   bool thrown;
+
+   const Vector<string> rows = {"1 2\n3\n", "1 2\n3 4 5\n"};
+
+   for(size_t i = 0; i < rows.size(); i++)
+   {
+       file.open(data_file_name.c_str());
+       file << rows[i];
+       file.close();
+
+       ds.set();
+       ds.set_display(false);
+       ds.set_data_file_name(data_file_name);
+       ds.set_separator("Space");
+       ds.set_header_line(false);
+
+       thrown = false;
+
+       try
+       {
+           ds.load_data();
+       }
+       catch(const logic_error&)
+       {
+           thrown = true;
+       }
+
+       assert_true(thrown, LOG);
+   }
+}
+
+
 void DataSetTest::test_get_data_statistics()
 {
    message += "test_get_data_statistics\n";
@@ -3196,6 +3526,15 @@ void DataSetTest::run_test_case()
    test_get_inputs();
    test_get_targets();
 
+   // Batch methods
+
+   test_get_training_batches();
+
+   // Column store methods
+
+   test_save_data_column_store();
+   test_convert_data_file_to_column_store();
+
    // Instance methods
 
    test_get_instance();
@@ -3301,13 +3640,11 @@ void DataSetTest::run_test_case()
 
    // Outlier detection
 
-   //test_calculate_instances_distances();
-   //test_calculate_k_distances();
-   //test_calculate_reachability_distances();
-   //test_calculate_reachability_density();
-   //test_calculate_local_outlier_factor();
+   test_calculate_instances_nearest_neighbors();
+   test_calculate_reachability_density();
+   test_calculate_local_outlier_factor();
 
-   //test_clean_local_outlier_factor();
+   test_clean_local_outlier_factor();
    test_clean_Tukey_outliers();
 
    // Data generation
@@ -3331,6 +3668,8 @@ void DataSetTest::run_test_case()
 
 //   test_load_data();
 
+   test_load_data_sequential();
+
 //   test_get_data_statistics();
 //   test_print_data_statistics();
 
@@ -68,6 +68,15 @@ public:
 
    void test_get_inputs();
    void test_get_targets();
+
+   // Batch methods
+
+   void test_get_training_batches();
+
+   // Column store methods
+
+   void test_save_data_column_store();
+   void test_convert_data_file_to_column_store();
   
    // Instance methods
 
@@ -201,13 +210,11 @@ public:
 
    // Outlier detection
 
-   //void test_calculate_instances_distances();
-   //void test_calculate_k_distances();
-   //void test_calculate_reachability_distances();
-   //void test_calculate_reachability_density();
-   //void test_calculate_local_outlier_factor();
+   void test_calculate_instances_nearest_neighbors();
+   void test_calculate_reachability_density();
+   void test_calculate_local_outlier_factor();
 
-   //void test_clean_local_outlier_factor();
+   void test_clean_local_outlier_factor();
    void test_clean_Tukey_outliers();
 
    // Data generation
@@ -230,6 +237,7 @@ public:
    void test_print_data();
    void test_save_data();
    void test_load_data();
+   void test_load_data_sequential();
 
    void test_get_data_statistics();
    void test_print_data_statistics();
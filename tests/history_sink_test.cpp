@@ -0,0 +1,335 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   H I S T O R Y   S I N K   T E S T   C L A S S                                                              */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "history_sink_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+HistorySinkTest::HistorySinkTest() : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+HistorySinkTest::~HistorySinkTest()
+{
+}
+
+
+// METHODS
+
+void HistorySinkTest::test_ring_buffer_history_sink()
+{
+   message += "test_ring_buffer_history_sink\n";
+
+   RingBufferHistorySink ring_buffer(3);
+
+   Vector<size_t> epochs;
+   Vector< Vector<double> > records;
+
+   // Test
+
+   ring_buffer.record(0, Vector<double>(2, 0.0));
+   ring_buffer.record(1, Vector<double>(2, 1.0));
+
+   epochs = ring_buffer.get_epochs();
+   records = ring_buffer.get_records();
+
+   assert_true(epochs == Vector<size_t>({0, 1}), LOG);
+   assert_true(records.size() == 2, LOG);
+   assert_true(records[1] == Vector<double>(2, 1.0), LOG);
+
+   // Test
+
+   for(size_t epoch = 2; epoch < 10; epoch++)
+   {
+      ring_buffer.record(epoch, Vector<double>(2, static_cast<double>(epoch)));
+   }
+
+   epochs = ring_buffer.get_epochs();
+   records = ring_buffer.get_records();
+
+   assert_true(ring_buffer.get_records_number() == 10, LOG);
+   assert_true(epochs == Vector<size_t>({7, 8, 9}), LOG);
+   assert_true(records[0] == Vector<double>(2, 7.0), LOG);
+   assert_true(records[2] == Vector<double>(2, 9.0), LOG);
+
+   // Test
+
+   ring_buffer.set_sampling_period(2);
+   ring_buffer.clear();
+
+   for(size_t epoch = 0; epoch < 10; epoch++)
+   {
+      ring_buffer.record(epoch, Matrix<double>(2, 2, static_cast<double>(epoch)));
+   }
+
+   epochs = ring_buffer.get_epochs();
+   records = ring_buffer.get_records();
+
+   assert_true(epochs == Vector<size_t>({4, 6, 8}), LOG);
+   assert_true(records[2] == Vector<double>(4, 8.0), LOG);
+}
+
+
+void HistorySinkTest::test_sampled_history_sink()
+{
+   message += "test_sampled_history_sink\n";
+
+   SampledHistorySink sampled(3);
+
+   // Test
+
+   for(size_t epoch = 0; epoch < 10; epoch++)
+   {
+      sampled.record(epoch, Vector<double>(1, static_cast<double>(epoch)));
+   }
+
+   assert_true(sampled.get_records_number() == 4, LOG);
+   assert_true(sampled.get_epochs() == Vector<size_t>({0, 3, 6, 9}), LOG);
+   assert_true(sampled.get_records()[3] == Vector<double>(1, 9.0), LOG);
+
+   // Test
+
+   sampled.clear();
+
+   assert_true(sampled.get_records_number() == 0, LOG);
+   assert_true(sampled.get_records().empty(), LOG);
+}
+
+
+void HistorySinkTest::test_binary_file_history_sink()
+{
+   message += "test_binary_file_history_sink\n";
+
+   const string file_name = "../data/history_sink.bin";
+
+   Vector<size_t> epochs;
+   Vector< Vector<double> > records;
+
+   // Test
+
+   {
+      BinaryFileHistorySink binary_file(file_name);
+
+      binary_file.clear();
+
+      binary_file.record(0, Vector<double>({1.0, 2.0, 3.0}));
+      binary_file.record(1, Vector<double>());
+      binary_file.record(2, Matrix<double>(2, 2, -1.5));
+
+      assert_true(binary_file.get_records_number() == 3, LOG);
+   }
+
+   BinaryFileHistorySink::load(file_name, epochs, records);
+
+   assert_true(epochs == Vector<size_t>({0, 1, 2}), LOG);
+   assert_true(records[0] == Vector<double>({1.0, 2.0, 3.0}), LOG);
+   assert_true(records[1].empty(), LOG);
+   assert_true(records[2] == Vector<double>(4, -1.5), LOG);
+
+   // Test
+
+   {
+      BinaryFileHistorySink binary_file(file_name);
+
+      binary_file.record(3, Vector<double>(1, 4.0));
+   }
+
+   BinaryFileHistorySink::load(file_name, epochs, records);
+
+   assert_true(epochs == Vector<size_t>({0, 1, 2, 3}), LOG);
+   assert_true(records[3] == Vector<double>(1, 4.0), LOG);
+
+   // Test
+
+   if(ofstream("/dev/full").is_open())
+   {
+      BinaryFileHistorySink full_binary_file("/dev/full");
+
+      bool thrown = false;
+
+      try
+      {
+         full_binary_file.record(0, Vector<double>(1, 1.0));
+      }
+      catch(const logic_error&)
+      {
+         thrown = true;
+      }
+
+      assert_true(thrown, LOG);
+   }
+}
+
+
+void HistorySinkTest::test_perform_training()
+{
+   message += "test_perform_training\n";
+
+   DataSet ds(20, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   NeuralNetwork nn(1, 2, 1);
+   nn.randomize_parameters_normal();
+
+   SumSquaredError sse(&nn, &ds);
+
+   QuasiNewtonMethod qnm(&sse);
+
+   RingBufferHistorySink parameters_history(5);
+   SampledHistorySink gradient_history(2);
+   SampledHistorySink inverse_Hessian_history(4);
+
+   // Test
+
+   qnm.set_display(false);
+   qnm.set_maximum_epochs_number(10);
+   qnm.set_loss_goal(0.0);
+   qnm.set_minimum_loss_decrease(0.0);
+   qnm.set_gradient_norm_goal(0.0);
+   qnm.set_minimum_parameters_increment_norm(0.0);
+
+   qnm.set_parameters_history_sink(&parameters_history);
+   qnm.set_gradient_history_sink(&gradient_history);
+   qnm.set_Hessian_approximation_history_sink(&inverse_Hessian_history);
+
+   QuasiNewtonMethod::QuasiNewtonMethodResults* results = qnm.perform_training();
+
+   const size_t parameters_number = nn.get_parameters_number();
+
+   assert_true(parameters_history.get_epochs() == Vector<size_t>({5, 6, 7, 8, 9}), LOG);
+   assert_true(parameters_history.get_records()[4].size() == parameters_number, LOG);
+   assert_true(gradient_history.get_epochs() == Vector<size_t>({0, 2, 4, 6, 8}), LOG);
+   assert_true(gradient_history.get_records()[0].size() == parameters_number, LOG);
+   assert_true(inverse_Hessian_history.get_records_number() == 3, LOG);
+   assert_true(inverse_Hessian_history.get_records()[0].size() == parameters_number*parameters_number, LOG);
+
+   delete results;
+}
+
+
+void HistorySinkTest::test_perform_training_stochastic_gradient_descent()
+{
+   message += "test_perform_training_stochastic_gradient_descent\n";
+
+   DataSet ds(20, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   NeuralNetwork nn(1, 2, 1);
+   nn.randomize_parameters_normal();
+
+   MeanSquaredError mse(&nn, &ds);
+
+   StochasticGradientDescent sgd(&mse);
+
+   RingBufferHistorySink gradient_history(3);
+
+   // Test
+
+   sgd.set_display(false);
+   sgd.set_training_batch_size(5);
+   sgd.set_maximum_epochs_number(9);
+   sgd.set_loss_goal(0.0);
+   sgd.set_apply_early_stopping(false);
+
+   sgd.set_gradient_history_sink(&gradient_history);
+
+   StochasticGradientDescent::StochasticGradientDescentResults* results = sgd.perform_training();
+
+   assert_true(gradient_history.get_epochs() == Vector<size_t>({7, 8, 9}), LOG);
+   assert_true(gradient_history.get_records()[2].size() == nn.get_parameters_number(), LOG);
+
+   delete results;
+}
+
+
+void HistorySinkTest::test_perform_training_adaptive_moment_estimation()
+{
+   message += "test_perform_training_adaptive_moment_estimation\n";
+
+   DataSet ds(20, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   NeuralNetwork nn(1, 2, 1);
+   nn.randomize_parameters_normal();
+
+   MeanSquaredError mse(&nn, &ds);
+
+   AdaptiveMomentEstimation ame(&mse);
+
+   SampledHistorySink gradient_history(2);
+
+   // Test
+
+   ame.set_display(false);
+   ame.set_training_batch_size(5);
+   ame.set_maximum_epochs_number(9);
+   ame.set_loss_goal(0.0);
+   ame.set_apply_early_stopping(false);
+
+   ame.set_gradient_history_sink(&gradient_history);
+
+   AdaptiveMomentEstimation::AdaptiveMomentEstimationResults* results = ame.perform_training();
+
+   assert_true(gradient_history.get_epochs() == Vector<size_t>({0, 2, 4, 6, 8}), LOG);
+   assert_true(gradient_history.get_records()[0].size() == nn.get_parameters_number(), LOG);
+
+   delete results;
+}
+
+
+void HistorySinkTest::run_test_case()
+{
+   message += "Running history sink test case...\n";
+
+   // Record methods
+
+   test_ring_buffer_history_sink();
+   test_sampled_history_sink();
+   test_binary_file_history_sink();
+
+   // Training methods
+
+   test_perform_training();
+   test_perform_training_stochastic_gradient_descent();
+   test_perform_training_adaptive_moment_estimation();
+
+   message += "End of history sink test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
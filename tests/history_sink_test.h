@@ -0,0 +1,79 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   H I S T O R Y   S I N K   T E S T   C L A S S   H E A D E R                                                */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __HISTORYSINKTEST_H__
+#define __HISTORYSINKTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+namespace OpenNN
+{
+
+class HistorySinkTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit HistorySinkTest();
+
+   // DESTRUCTOR
+
+   virtual ~HistorySinkTest();
+
+   // METHODS
+
+   // Record methods
+
+   void test_ring_buffer_history_sink();
+   void test_sampled_history_sink();
+   void test_binary_file_history_sink();
+
+   // Training methods
+
+   void test_perform_training();
+   void test_perform_training_stochastic_gradient_descent();
+   void test_perform_training_adaptive_moment_estimation();
+
+   // Unit testing methods
+
+   void run_test_case();
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
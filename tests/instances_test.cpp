@@ -585,6 +585,83 @@ void InstancesTest::test_from_XML()
 }
 
 
+void InstancesTest::test_get_shuffled_training_batches()
+{
+   message += "test_get_shuffled_training_batches\n";
+
+   Instances i(10);
+
+   i.set_training();
+   i.set_use(9, Instances::Unused);
+
+   Vector< Vector<size_t> > batches;
+
+   Vector<size_t> indices;
+
+   mt19937 generator;
+
+   // Instances shuffled one by one
+
+   batches = i.get_shuffled_training_batches(3, 1, generator);
+
+   assert_true(batches.size() == 3, LOG);
+   assert_true(batches[0].size() == 3, LOG);
+   assert_true(batches[2].size() == 3, LOG);
+
+   indices.clear();
+
+   for(size_t j = 0; j < batches.size(); j++)
+   {
+       indices.insert(indices.end(), batches[j].begin(), batches[j].end());
+   }
+
+   sort(indices.begin(), indices.end());
+
+   assert_true(indices == i.get_training_indices(), LOG);
+
+   // Same seed
+
+   mt19937 generator_1(1);
+   mt19937 generator_2(1);
+
+   assert_true(i.get_shuffled_training_batches(2, 1, generator_1) == i.get_shuffled_training_batches(2, 1, generator_2), LOG);
+
+   // Instances shuffled in blocks of consecutive instances
+
+   batches = i.get_shuffled_training_batches(4, 4, generator);
+
+   assert_true(batches.size() == 3, LOG);
+
+   indices.clear();
+
+   for(size_t j = 0; j < batches.size(); j++)
+   {
+       indices.insert(indices.end(), batches[j].begin(), batches[j].end());
+   }
+
+   size_t blocks_changes = 0;
+
+   for(size_t j = 1; j < indices.size(); j++)
+   {
+       if(indices[j]/4 != indices[j-1]/4) blocks_changes++;
+   }
+
+   assert_true(blocks_changes == 2, LOG);
+
+   sort(indices.begin(), indices.end());
+
+   assert_true(indices == i.get_training_indices(), LOG);
+
+   // No training instances
+
+   i.set_testing();
+
+   batches = i.get_shuffled_training_batches(4, 4, generator);
+
+   assert_true(batches.empty(), LOG);
+}
+
+
 void InstancesTest::run_test_case()
 {
    message += "Running instances test case...\n";
@@ -640,6 +717,10 @@ void InstancesTest::run_test_case()
    test_split_random_indices();
    test_split_sequential_indices();
 
+   // Batches methods
+
+   test_get_shuffled_training_batches();
+
    // Serialization methods
 
    test_to_XML();
@@ -87,6 +87,10 @@ public:
    void test_split_random_indices();
    void test_split_sequential_indices();
 
+   // Batches methods
+
+   void test_get_shuffled_training_batches();
+
    // Serialization methods
 
    void test_to_XML();
@@ -0,0 +1,229 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   K   N E A R E S T   N E I G H B O R S   T E S T   C L A S S                                                */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "k_nearest_neighbors_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+KNearestNeighborsTest::KNearestNeighborsTest() : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+KNearestNeighborsTest::~KNearestNeighborsTest()
+{
+}
+
+
+// METHODS
+
+void KNearestNeighborsTest::test_set_distance_method()
+{
+   message += "test_set_distance_method\n";
+
+   DataSet ds(20, 2, 1);
+   ds.randomize_data_uniform();
+   ds.get_instances_pointer()->set_training();
+
+   KNearestNeighbors knn(&ds);
+
+   const Vector<double> inputs({0.1, 0.2});
+
+   KNearestNeighbors::Neighbors neighbors;
+
+   // Test
+
+   knn.set_distance_method("Manhattan");
+
+   neighbors = knn.calculate_k_nearest_neighbors_unsupervised(inputs);
+
+   const Matrix<double> training_inputs = ds.get_training_inputs();
+
+   const size_t nearest_index = neighbors.indices(0, 0);
+
+   assert_true(fabs(neighbors.distances(0, 0) - (training_inputs.get_row(nearest_index) - inputs).calculate_absolute_value().calculate_sum()) < 1.0e-12, LOG);
+
+   // Test
+
+   knn.set_distance_method("Euclidean");
+
+   neighbors = knn.calculate_k_nearest_neighbors_unsupervised(inputs);
+
+   assert_true(fabs(neighbors.distances(0, 0) - (training_inputs.get_row(neighbors.indices(0, 0)) - inputs).calculate_L2_norm()) < 1.0e-12, LOG);
+}
+
+
+void KNearestNeighborsTest::test_calculate_k_nearest_neighbors_supervised()
+{
+   message += "test_calculate_k_nearest_neighbors_supervised\n";
+
+   DataSet ds(100, 3, 2);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   Matrix<double> weights(5, 2, 1.0);
+   weights(0, 1) = 0.0;
+
+   KNearestNeighbors knn(&ds);
+   knn.set_weights(weights);
+   knn.set_k(4);
+
+   const Matrix<double> training_inputs = ds.get_training_inputs();
+
+   const Vector<double> inputs({0.5, -0.5, 0.0});
+
+   // Test
+
+   const KNearestNeighbors::Neighbors neighbors = knn.calculate_k_nearest_neighbors_supervised(inputs);
+
+   assert_true(neighbors.indices.get_rows_number() == 4, LOG);
+   assert_true(neighbors.indices.get_columns_number() == 2, LOG);
+
+   for(size_t i = 0; i < 2; i++)
+   {
+      const Vector<double> distances = training_inputs.calculate_euclidean_weighted_distance(inputs, weights.get_column(i).get_first(3));
+
+      assert_true(neighbors.indices.get_column(i) == distances.calculate_lower_indices(4), LOG);
+      assert_true((neighbors.distances.get_column(i) - distances.calculate_lower_values(4)).calculate_absolute_value() < 1.0e-12, LOG);
+   }
+}
+
+
+void KNearestNeighborsTest::test_calculate_k_nearest_neighbors_unsupervised()
+{
+   message += "test_calculate_k_nearest_neighbors_unsupervised\n";
+
+   DataSet ds(50, 2, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   KNearestNeighbors knn(&ds);
+
+   KNearestNeighbors::Neighbors neighbors;
+
+   // Test
+
+   neighbors = knn.calculate_k_nearest_neighbors_unsupervised(ds.get_training_inputs().get_row(7));
+
+   assert_true(neighbors.indices.get_rows_number() == 3, LOG);
+   assert_true(neighbors.indices.get_columns_number() == 1, LOG);
+   assert_true(neighbors.indices(0, 0) == 7, LOG);
+   assert_true(neighbors.distances(0, 0) == 0.0, LOG);
+
+   // Test
+
+   knn.set_k(100);
+
+   neighbors = knn.calculate_k_nearest_neighbors_unsupervised(Vector<double>(2, 0.0));
+
+   assert_true(neighbors.indices.get_rows_number() == 50, LOG);
+}
+
+
+void KNearestNeighborsTest::test_calculate_outputs()
+{
+   message += "test_calculate_outputs\n";
+
+   DataSet ds(300, 20, 2);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->split_random_indices(0.75, 0.25, 0.0);
+
+   Matrix<double> weights(22, 2, 1.0);
+   weights(3, 1) = 2.0;
+
+   KNearestNeighbors knn(&ds);
+   knn.set_weights(weights);
+   knn.set_k(5);
+
+   const Matrix<double> selection_inputs = ds.get_selection_inputs();
+   const size_t selection_instances_number = selection_inputs.get_rows_number();
+
+   Matrix<double> outputs;
+
+   // Test
+
+   knn.set_search_method(SpatialIndex::Tree);
+
+   outputs = knn.calculate_outputs(selection_inputs);
+
+   assert_true(outputs.get_rows_number() == selection_instances_number, LOG);
+   assert_true(outputs.get_columns_number() == 2, LOG);
+
+   for(size_t i = 0; i < selection_instances_number; i++)
+   {
+      const Vector<double> instance_outputs = knn.calculate_outputs(selection_inputs.get_row(i));
+
+      assert_true((outputs.get_row(i) - instance_outputs).calculate_absolute_value() < 1.0e-12, LOG);
+   }
+
+   // Test
+
+   knn.set_search_method(SpatialIndex::BruteForce);
+
+   assert_true((knn.calculate_outputs(selection_inputs) - outputs).calculate_absolute_value() < 1.0e-9, LOG);
+
+   // Test
+
+   knn.set_search_method(SpatialIndex::Automatic);
+   knn.set_distance_method(KNearestNeighbors::Manhattan);
+
+   outputs = knn.calculate_selection_outputs();
+
+   assert_true(fabs(outputs(0, 1) - knn.calculate_outputs(selection_inputs.get_row(0))[1]) < 1.0e-12, LOG);
+}
+
+
+void KNearestNeighborsTest::run_test_case()
+{
+   message += "Running k-nearest neighbors test case...\n";
+
+   // Set methods
+
+   test_set_distance_method();
+
+   // Algorithm methods
+
+   test_calculate_k_nearest_neighbors_supervised();
+   test_calculate_k_nearest_neighbors_unsupervised();
+
+   // Output methods
+
+   test_calculate_outputs();
+
+   message += "End of k-nearest neighbors test case.\n";
+}
+
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -567,6 +567,66 @@ void LevenbergMarquardtAlgorithmTest::test_perform_Householder_QR_decomposition(
 }
 
 
+void LevenbergMarquardtAlgorithmTest::test_perform_Cholesky_decomposition()
+{
+   message += "test_perform_Cholesky_decomposition\n";
+
+   LevenbergMarquardtAlgorithm lma;
+
+   Eigen::LLT<Eigen::MatrixXd> Cholesky_decomposition;
+
+   Matrix<double> a;
+   Matrix<double> damped_a;
+   Vector<double> b;
+   Vector<double> x;
+
+   // Test
+
+   a.set(2, 2);
+   a.initialize_identity();
+
+   b.set(2, 3.0);
+
+   x = lma.perform_Cholesky_decomposition(a, 2.0, b, Cholesky_decomposition);
+
+   assert_true((x - 1.0).calculate_L2_norm() < 1.0e-12, LOG);
+   assert_true(a(0,0) == 1.0, LOG);
+
+   // Test
+
+   a.set(50, 30);
+   a.randomize_normal();
+   a = a.calculate_transpose().dot(a);
+
+   b.set(30);
+   b.randomize_normal();
+
+   damped_a = a;
+   damped_a.sum_diagonal(1.0e-3);
+
+   x = lma.perform_Cholesky_decomposition(a, 1.0e-3, b, Cholesky_decomposition);
+
+   assert_true((x - lma.perform_Householder_QR_decomposition(damped_a, b)).calculate_L2_norm() < 1.0e-6*(1.0 + x.calculate_L2_norm()), LOG);
+
+   x = lma.perform_Cholesky_decomposition(a, 1.0e2, b, Cholesky_decomposition);
+
+   assert_true((damped_a.dot(x) + x*(1.0e2 - 1.0e-3) - b).calculate_L2_norm() < 1.0e-9*(1.0 + b.calculate_L2_norm()), LOG);
+
+   // Test
+
+   a.set(2, 2, 0.0);
+   a(0,0) = 1.0;
+   a(1,1) = -4.0;
+
+   b.set(2, 2.0);
+
+   x = lma.perform_Cholesky_decomposition(a, 1.0, b, Cholesky_decomposition);
+
+   assert_true(fabs(x[0] - 1.0) < 1.0e-12, LOG);
+   assert_true(fabs(x[1] + 2.0/3.0) < 1.0e-12, LOG);
+}
+
+
 void LevenbergMarquardtAlgorithmTest::run_test_case()
 {
    message += "Running Levenberg-Marquardt algorithm test case...\n";
@@ -616,6 +676,8 @@ void LevenbergMarquardtAlgorithmTest::run_test_case()
 
    test_perform_Householder_QR_decomposition();
 */
+   test_perform_Cholesky_decomposition();
+
    message += "End of Levenberg-Marquardt algorithm test case.\n";
 }
 
@@ -88,6 +88,7 @@ public:
    // Linear algebraic equations methods
 
    void test_perform_Householder_QR_decomposition();
+   void test_perform_Cholesky_decomposition();
 
 
    // Unit testing methods
@@ -32,20 +32,42 @@ int main()
 
     MPI_Init(NULL, NULL);
 
-    int size;
-    MPI_Comm_size(MPI_COMM_WORLD, &size);
-
     int rank;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
 
-    if(rank == 0)
+    // With MPI, only the data parallel tests are run, by all the processes
+
+    int mpi_tests_failed_count = 0;
+
+    try
+    {
+       DataParallelTest data_parallel_test;
+       data_parallel_test.run_test_case();
+
+       const int tests_failed_count = static_cast<int>(data_parallel_test.get_tests_failed_count());
+
+       MPI_Allreduce(&tests_failed_count, &mpi_tests_failed_count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+
+       if(rank == 0)
+       {
+          cout << data_parallel_test.get_message() << "\n"
+               << "OpenNN test suite results:\n"
+               << "Tests run: " << data_parallel_test.get_tests_count() << "\n"
+               << "Tests failed in all the processes: " << mpi_tests_failed_count << "\n";
+
+          cout << (mpi_tests_failed_count == 0 ? "Test OK" : "Test NOT OK") << endl;
+       }
+    }
+    catch(exception& e)
     {
-        cout << "Tests do not work with MPI\n";
+       cerr << e.what() << endl;
+
+       MPI_Abort(MPI_COMM_WORLD, 1);
     }
 
     MPI_Finalize();
 
-    return(1);
+    return(mpi_tests_failed_count == 0 ? 0 : 1);
 
 #endif
 
@@ -60,6 +82,10 @@ int main()
    "missing_values\n"
    "correlation_analysis\n"
    "data_set\n"
+   "spatial_index\n"
+   "k_nearest_neighbors\n"
+   "association_rules\n"
+   "batch_producer\n"
    "unscaling_layer\n"
    "scaling_layer\n"
    "inputs_trending_layer\n"
@@ -79,9 +105,12 @@ int main()
    "minkowski_error\n"
    "mean_squared_error\n"
    "cross_entropy_error\n"
+   "single_precision_engine\n"
    "training_strategy\n"
    "training_rate_algorithm\n"
    "training_algorithm\n"
+   "history_sink\n"
+   "training_checkpoint\n"
    "random_search\n"
    "quasi_newton_method\n"
    "newton_method\n"
@@ -89,6 +118,9 @@ int main()
    "gradient_descent\n"
    "evolutionary_algorithm\n"
    "conjugate_gradient\n"
+   "stochastic_gradient_descent\n"
+   "adaptive_moment_estimation\n"
+   "data_parallel\n"
    "testing_analysis\n"
    "model_selection\n"
    "order_selection_algorithm\n"
@@ -216,6 +248,42 @@ int main()
          tests_passed_count += data_set_test.get_tests_passed_count();
          tests_failed_count += data_set_test.get_tests_failed_count();
       }
+      else if(test == "spatial_index")
+      {
+         SpatialIndexTest spatial_index_test;
+         spatial_index_test.run_test_case();
+         message += spatial_index_test.get_message();
+         tests_count += spatial_index_test.get_tests_count();
+         tests_passed_count += spatial_index_test.get_tests_passed_count();
+         tests_failed_count += spatial_index_test.get_tests_failed_count();
+      }
+      else if(test == "k_nearest_neighbors")
+      {
+         KNearestNeighborsTest k_nearest_neighbors_test;
+         k_nearest_neighbors_test.run_test_case();
+         message += k_nearest_neighbors_test.get_message();
+         tests_count += k_nearest_neighbors_test.get_tests_count();
+         tests_passed_count += k_nearest_neighbors_test.get_tests_passed_count();
+         tests_failed_count += k_nearest_neighbors_test.get_tests_failed_count();
+      }
+      else if(test == "association_rules")
+      {
+         AssociationRulesTest association_rules_test;
+         association_rules_test.run_test_case();
+         message += association_rules_test.get_message();
+         tests_count += association_rules_test.get_tests_count();
+         tests_passed_count += association_rules_test.get_tests_passed_count();
+         tests_failed_count += association_rules_test.get_tests_failed_count();
+      }
+      else if(test == "batch_producer")
+      {
+         BatchProducerTest batch_producer_test;
+         batch_producer_test.run_test_case();
+         message += batch_producer_test.get_message();
+         tests_count += batch_producer_test.get_tests_count();
+         tests_passed_count += batch_producer_test.get_tests_passed_count();
+         tests_failed_count += batch_producer_test.get_tests_failed_count();
+      }
 
       //
       // N E U R A L   N E T W O R K   T E S T S
@@ -420,6 +488,24 @@ int main()
         tests_passed_count += training_algorithm_test.get_tests_passed_count();
         tests_failed_count += training_algorithm_test.get_tests_failed_count();
       }
+      else if(test == "history_sink")
+      {
+        HistorySinkTest history_sink_test;
+        history_sink_test.run_test_case();
+        message += history_sink_test.get_message();
+        tests_count += history_sink_test.get_tests_count();
+        tests_passed_count += history_sink_test.get_tests_passed_count();
+        tests_failed_count += history_sink_test.get_tests_failed_count();
+      }
+      else if(test == "training_checkpoint")
+      {
+        TrainingCheckpointTest training_checkpoint_test;
+        training_checkpoint_test.run_test_case();
+        message += training_checkpoint_test.get_message();
+        tests_count += training_checkpoint_test.get_tests_count();
+        tests_passed_count += training_checkpoint_test.get_tests_passed_count();
+        tests_failed_count += training_checkpoint_test.get_tests_failed_count();
+      }
       else if(test == "random_search")
       {
         RandomSearchTest random_search_test;
@@ -483,6 +569,33 @@ int main()
         tests_passed_count += stochastic_gradient_descent_test.get_tests_passed_count();
         tests_failed_count += stochastic_gradient_descent_test.get_tests_failed_count();
       }
+      else if(test == "adaptive_moment_estimation")
+      {
+        AdaptiveMomentEstimationTest adaptive_moment_estimation_test;
+        adaptive_moment_estimation_test.run_test_case();
+        message += adaptive_moment_estimation_test.get_message();
+        tests_count += adaptive_moment_estimation_test.get_tests_count();
+        tests_passed_count += adaptive_moment_estimation_test.get_tests_passed_count();
+        tests_failed_count += adaptive_moment_estimation_test.get_tests_failed_count();
+      }
+      else if(test == "data_parallel")
+      {
+        DataParallelTest data_parallel_test;
+        data_parallel_test.run_test_case();
+        message += data_parallel_test.get_message();
+        tests_count += data_parallel_test.get_tests_count();
+        tests_passed_count += data_parallel_test.get_tests_passed_count();
+        tests_failed_count += data_parallel_test.get_tests_failed_count();
+      }
+      else if(test == "single_precision_engine")
+      {
+        SinglePrecisionEngineTest single_precision_engine_test;
+        single_precision_engine_test.run_test_case();
+        message += single_precision_engine_test.get_message();
+        tests_count += single_precision_engine_test.get_tests_count();
+        tests_passed_count += single_precision_engine_test.get_tests_passed_count();
+        tests_failed_count += single_precision_engine_test.get_tests_failed_count();
+      }
       else if(test == "training_strategy")
       {
         TrainingStrategyTest training_strategy_test;
@@ -677,6 +790,42 @@ int main()
           tests_passed_count += data_set_test.get_tests_passed_count();
           tests_failed_count += data_set_test.get_tests_failed_count();
 
+          // spatial index
+
+          SpatialIndexTest spatial_index_test;
+          spatial_index_test.run_test_case();
+          message += spatial_index_test.get_message();
+          tests_count += spatial_index_test.get_tests_count();
+          tests_passed_count += spatial_index_test.get_tests_passed_count();
+          tests_failed_count += spatial_index_test.get_tests_failed_count();
+
+          // k-nearest neighbors
+
+          KNearestNeighborsTest k_nearest_neighbors_test;
+          k_nearest_neighbors_test.run_test_case();
+          message += k_nearest_neighbors_test.get_message();
+          tests_count += k_nearest_neighbors_test.get_tests_count();
+          tests_passed_count += k_nearest_neighbors_test.get_tests_passed_count();
+          tests_failed_count += k_nearest_neighbors_test.get_tests_failed_count();
+
+          // association rules
+
+          AssociationRulesTest association_rules_test;
+          association_rules_test.run_test_case();
+          message += association_rules_test.get_message();
+          tests_count += association_rules_test.get_tests_count();
+          tests_passed_count += association_rules_test.get_tests_passed_count();
+          tests_failed_count += association_rules_test.get_tests_failed_count();
+
+          // batch producer
+
+          BatchProducerTest batch_producer_test;
+          batch_producer_test.run_test_case();
+          message += batch_producer_test.get_message();
+          tests_count += batch_producer_test.get_tests_count();
+          tests_passed_count += batch_producer_test.get_tests_passed_count();
+          tests_failed_count += batch_producer_test.get_tests_failed_count();
+
           // N E U R A L   N E T W O R K   T E S T S
 
           // perceptron layer
@@ -845,6 +994,24 @@ int main()
           tests_passed_count += training_algorithm_test.get_tests_passed_count();
           tests_failed_count += training_algorithm_test.get_tests_failed_count();
 
+          // history sink
+
+          HistorySinkTest history_sink_test;
+          history_sink_test.run_test_case();
+          message += history_sink_test.get_message();
+          tests_count += history_sink_test.get_tests_count();
+          tests_passed_count += history_sink_test.get_tests_passed_count();
+          tests_failed_count += history_sink_test.get_tests_failed_count();
+
+          // training checkpoint
+
+          TrainingCheckpointTest training_checkpoint_test;
+          training_checkpoint_test.run_test_case();
+          message += training_checkpoint_test.get_message();
+          tests_count += training_checkpoint_test.get_tests_count();
+          tests_passed_count += training_checkpoint_test.get_tests_passed_count();
+          tests_failed_count += training_checkpoint_test.get_tests_failed_count();
+
           // random search
 
           RandomSearchTest random_search_test;
@@ -907,6 +1074,33 @@ int main()
           tests_passed_count += stochastic_gradient_descent_test.get_tests_passed_count();
           tests_failed_count += stochastic_gradient_descent_test.get_tests_failed_count();
 
+          // adaptive_moment_estimation
+
+          AdaptiveMomentEstimationTest adaptive_moment_estimation_test;
+          adaptive_moment_estimation_test.run_test_case();
+          message += adaptive_moment_estimation_test.get_message();
+          tests_count += adaptive_moment_estimation_test.get_tests_count();
+          tests_passed_count += adaptive_moment_estimation_test.get_tests_passed_count();
+          tests_failed_count += adaptive_moment_estimation_test.get_tests_failed_count();
+
+          // data_parallel
+
+          DataParallelTest data_parallel_test;
+          data_parallel_test.run_test_case();
+          message += data_parallel_test.get_message();
+          tests_count += data_parallel_test.get_tests_count();
+          tests_passed_count += data_parallel_test.get_tests_passed_count();
+          tests_failed_count += data_parallel_test.get_tests_failed_count();
+
+          // single_precision_engine
+
+          SinglePrecisionEngineTest single_precision_engine_test;
+          single_precision_engine_test.run_test_case();
+          message += single_precision_engine_test.get_message();
+          tests_count += single_precision_engine_test.get_tests_count();
+          tests_passed_count += single_precision_engine_test.get_tests_passed_count();
+          tests_failed_count += single_precision_engine_test.get_tests_failed_count();
+
           // training_strategy
 
           TrainingStrategyTest training_strategy_test;
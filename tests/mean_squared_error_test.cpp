@@ -463,6 +463,41 @@ void MeanSquaredErrorTest::test_calculate_error_terms_Jacobian()
 }
 
 
+void MeanSquaredErrorTest::test_calculate_first_order_error()
+{
+   message += "test_calculate_first_order_error\n";
+
+   DataSet ds;
+   NeuralNetwork nn;
+   MeanSquaredError mse(&nn, &ds);
+
+   LossIndex::FirstOrderError first_order_error(0);
+
+   // Test
+
+   nn.set(2, 3, 2);
+   nn.randomize_parameters_normal();
+
+   ds.set(30, 2, 2);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   first_order_error = mse.calculate_training_first_order_error();
+
+   assert_true(fabs(first_order_error.error - mse.calculate_training_error()) < 1.0e-12, LOG);
+   assert_true((first_order_error.gradient - mse.calculate_training_error_gradient()).calculate_absolute_value() < 1.0e-12, LOG);
+
+   // Test
+
+   const Vector<size_t> batch_indices({0, 3, 7, 11, 29});
+
+   first_order_error = mse.calculate_batch_first_order_error(batch_indices);
+
+   assert_true(fabs(first_order_error.error - mse.calculate_batch_error(batch_indices)) < 1.0e-12, LOG);
+   assert_true((first_order_error.gradient - mse.calculate_batch_error_gradient(batch_indices)).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
 void MeanSquaredErrorTest::test_calculate_Hessian()
 {
     message += "test_calculate_Hessian\n";
@@ -810,6 +845,8 @@ void MeanSquaredErrorTest::run_test_case()
 
 //   test_calculate_error_gradient();
 
+   test_calculate_first_order_error();
+
    // Error terms methods
 
 //   test_calculate_error_terms();
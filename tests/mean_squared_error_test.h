@@ -58,6 +58,8 @@ public:
 
    void test_calculate_error_gradient();
 
+   void test_calculate_first_order_error();
+
    void test_calculate_Hessian();
 
    // Error terms methods 
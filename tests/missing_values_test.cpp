@@ -130,6 +130,26 @@ void MissingValuesTest::test_set_missing_values_number()
    mv.set_missing_values_number(2);
 
    assert_true(mv.get_missing_values_number() == 2, LOG);
+   assert_true(!mv.is_missing_value(0, 0), LOG);
+
+   // Test
+
+   mv.set(3, 2);
+
+   mv.set_missing_values_number(2);
+
+   mv.set_item(0, 1, 1);
+   mv.set_item(1, 2, 0);
+
+   assert_true(mv.is_missing_value(1, 1), LOG);
+   assert_true(mv.is_missing_value(2, 0), LOG);
+   assert_true(!mv.is_missing_value(0, 0), LOG);
+
+   mv.set_item(0, 0, 1);
+
+   assert_true(!mv.is_missing_value(1, 1), LOG);
+   assert_true(mv.is_missing_value(0, 1), LOG);
+   assert_true(mv.is_missing_value(2, 0), LOG);
 }
 
 
@@ -176,6 +196,120 @@ void MissingValuesTest::test_convert_time_series()
 }
 
 
+void MissingValuesTest::test_append()
+{
+   message += "test_append\n";
+
+   MissingValues mv(70, 2);
+
+   // Test
+
+   mv.append(3, 1);
+   mv.append(65, 1);
+   mv.append(3, 1);
+
+   assert_true(mv.get_missing_values_number() == 2, LOG);
+   assert_true(mv.is_missing_value(3, 1), LOG);
+   assert_true(mv.is_missing_value(65, 1), LOG);
+   assert_true(!mv.is_missing_value(3, 0), LOG);
+   assert_true(!mv.is_missing_value(64, 1), LOG);
+}
+
+
+void MissingValuesTest::test_get_missing_indices()
+{
+   message += "test_get_missing_indices\n";
+
+   MissingValues mv(130, 3);
+
+   Vector<size_t> missing_indices;
+
+   // Test
+
+   mv.append(129, 0);
+   mv.append(2, 0);
+   mv.append(64, 2);
+   mv.append(2, 2);
+
+   missing_indices = mv.get_missing_indices(0);
+
+   assert_true(missing_indices.size() == 2, LOG);
+   assert_true(missing_indices[0] == 2, LOG);
+   assert_true(missing_indices[1] == 129, LOG);
+
+   assert_true(mv.get_missing_indices(1).empty(), LOG);
+
+   assert_true(mv.get_missing_instances() == Vector<size_t>({2, 64, 129}), LOG);
+
+   assert_true(mv.count_variables_missing_indices() == Vector<size_t>({2, 0, 2}), LOG);
+   assert_true(mv.count_missing_instances() == 3, LOG);
+   assert_true(mv.count_missing_instances(2) == 2, LOG);
+
+   assert_true(mv.get_missing_variables() == Vector<size_t>({0, 2}), LOG);
+
+   assert_true(mv.has_missing_values(64), LOG);
+   assert_true(!mv.has_missing_values(65), LOG);
+   assert_true(!mv.has_missing_values(64, Vector<size_t>({0, 1})), LOG);
+}
+
+
+void MissingValuesTest::test_get_missing_mask()
+{
+   message += "test_get_missing_mask\n";
+
+   MissingValues mv(100, 2);
+
+   Vector<unsigned long long> missing_mask;
+
+   // Test
+
+   mv.append(1, 0);
+   mv.append(70, 0);
+
+   assert_true(mv.get_mask_words_number() == 2, LOG);
+
+   missing_mask = mv.get_missing_mask(0);
+
+   assert_true(missing_mask.size() == 2, LOG);
+   assert_true(missing_mask[0] == 2, LOG);
+   assert_true(missing_mask[1] == 64, LOG);
+
+   assert_true(mv.get_missing_mask(1) == Vector<unsigned long long>({0, 0}), LOG);
+
+   // Test
+
+   missing_mask = mv.get_missing_mask(0, Vector<size_t>({70, 0, 1}));
+
+   assert_true(missing_mask.size() == 1, LOG);
+   assert_true(missing_mask[0] == 5, LOG);
+
+   // Test
+
+   Vector<double> column(100);
+   column.initialize_sequential();
+
+   column[1] = -99.9;
+   column[70] = -99.9;
+
+   Vector<size_t> missing_indices(2);
+   missing_indices[0] = 1;
+   missing_indices[1] = 70;
+
+   const Statistics<double> statistics = column.calculate_statistics_missing_mask(mv.get_missing_mask(0));
+
+   assert_true(statistics.minimum == 0.0, LOG);
+   assert_true(statistics.maximum == 99.0, LOG);
+   assert_true(fabs(statistics.mean - column.calculate_mean_missing_values(missing_indices)) < 1.0e-12, LOG);
+   assert_true(fabs(column.calculate_mean_missing_mask(mv.get_missing_mask(0)) - statistics.mean) < 1.0e-12, LOG);
+   assert_true(fabs(column.calculate_standard_deviation_missing_mask(mv.get_missing_mask(0)) - statistics.standard_deviation) < 1.0e-12, LOG);
+
+   const Histogram<double> histogram = column.calculate_histogram_missing_mask(mv.get_missing_mask(0), 10);
+
+   assert_true(histogram.frequencies == column.calculate_histogram_missing_values(missing_indices, 10).frequencies, LOG);
+   assert_true(histogram.frequencies.calculate_sum() == 98, LOG);
+}
+
+
 // @todo Complete method and tests.
 
 void MissingValuesTest::test_to_XML()
@@ -203,6 +337,24 @@ void MissingValuesTest::test_to_XML()
    assert_true(mv.get_instances_number() == 2, LOG);
    assert_true(mv.get_variables_number() == 2, LOG);
    assert_true(mv.get_scrubbing_method() == MissingValues::Mean, LOG);
+
+   // Test
+
+   mv.set(3, 2);
+
+   mv.append(2, 1);
+   mv.append(0, 0);
+
+   document = mv.to_XML();
+
+   mv.set();
+
+   mv.from_XML(*document);
+
+   assert_true(mv.get_missing_values_number() == 2, LOG);
+   assert_true(mv.is_missing_value(2, 1), LOG);
+   assert_true(mv.is_missing_value(0, 0), LOG);
+   assert_true(mv.count_variables_missing_indices() == Vector<size_t>({1, 1}), LOG);
 }
 
 
@@ -250,6 +402,14 @@ void MissingValuesTest::run_test_case()
 
    test_convert_time_series();
 
+   // Missing values methods
+
+   test_append();
+
+   test_get_missing_indices();
+
+   test_get_missing_mask();
+
    // Serialization methods
 
    test_to_XML();
@@ -66,6 +66,14 @@ public:
 
    void test_convert_time_series();
 
+   // Missing values methods
+
+   void test_append();
+
+   void test_get_missing_indices();
+
+   void test_get_missing_mask();
+
    // Serialization methods
 
    void test_to_XML();
@@ -228,6 +228,43 @@ system("pause");
 }
 
 
+void NormalizedSquaredErrorTest::test_calculate_first_order_error()
+{
+   message += "test_calculate_first_order_error\n";
+
+   DataSet ds;
+   NeuralNetwork nn;
+   NormalizedSquaredError nse(&nn, &ds);
+
+   LossIndex::FirstOrderError first_order_error(0);
+
+   // Test
+
+   nn.set(2, 3, 2);
+   nn.randomize_parameters_normal();
+
+   ds.set(30, 2, 2);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   nse.set_normalization_coefficient();
+
+   first_order_error = nse.calculate_training_first_order_error();
+
+   assert_true(fabs(first_order_error.error - nse.calculate_training_error()) < 1.0e-12, LOG);
+   assert_true((first_order_error.gradient - nse.calculate_training_error_gradient()).calculate_absolute_value() < 1.0e-12, LOG);
+
+   // Test
+
+   const Vector<size_t> training_indices = ds.get_instances().get_training_indices();
+
+   first_order_error = nse.calculate_batch_first_order_error(training_indices);
+
+   assert_true(fabs(first_order_error.error - nse.calculate_batch_error(training_indices)) < 1.0e-12, LOG);
+   assert_true((first_order_error.gradient - nse.calculate_training_error_gradient()).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
 void NormalizedSquaredErrorTest::test_calculate_Hessian(void)
 {
    message += "test_calculate_Hessian\n";
@@ -429,6 +466,8 @@ void NormalizedSquaredErrorTest::run_test_case(void)
    test_calculate_error();
 */
    test_calculate_error_gradient();
+
+   test_calculate_first_order_error();
 /*
    test_calculate_Hessian();
 
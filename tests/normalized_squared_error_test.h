@@ -59,6 +59,8 @@ public:
    void test_calculate_error(void);
 
    void test_calculate_error_gradient(void);
+
+   void test_calculate_first_order_error();
    void test_calculate_Hessian(void);
 
    // Error terms methods
@@ -27,6 +27,10 @@
 #include "variables_test.h"
 #include "missing_values_test.h"
 #include "data_set_test.h"
+#include "spatial_index_test.h"
+#include "k_nearest_neighbors_test.h"
+#include "association_rules_test.h"
+#include "batch_producer_test.h"
 
 #include "perceptron_layer_test.h"
 #include "multilayer_perceptron_test.h"
@@ -51,6 +55,8 @@
 
 #include "training_rate_algorithm_test.h"
 #include "training_algorithm_test.h"
+#include "history_sink_test.h"
+#include "training_checkpoint_test.h"
 #include "random_search_test.h"
 #include "evolutionary_algorithm_test.h"
 #include "gradient_descent_test.h"
@@ -59,6 +65,9 @@
 #include "quasi_newton_method_test.h"
 #include "levenberg_marquardt_algorithm_test.h"
 #include "stochastic_gradient_descent_test.h"
+#include "single_precision_engine_test.h"
+#include "adaptive_moment_estimation_test.h"
+#include "data_parallel_test.h"
 #include "training_strategy_test.h"
 
 #include "model_selection_test.h"
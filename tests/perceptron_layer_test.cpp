@@ -1568,6 +1568,42 @@ void PerceptronLayerTest::test_calculate_activations_second_derivatives()
 }
 
 
+void PerceptronLayerTest::test_calculate_first_order_outputs()
+{
+   message += "test_calculate_first_order_outputs\n";
+
+   PerceptronLayer pl(4, 3);
+
+   Matrix<double> inputs(7, 4);
+
+   Matrix<double> combinations;
+   Matrix<double> activations;
+   Matrix<double> activations_derivatives;
+   Matrix<double> outputs;
+
+   // Test
+
+   for(int i = PerceptronLayer::Threshold; i <= PerceptronLayer::HardSigmoid; i++)
+   {
+       pl.set_activation_function(static_cast<PerceptronLayer::ActivationFunction>(i));
+       pl.randomize_parameters_normal();
+
+       inputs.randomize_normal(0.0, 3.0);
+
+       const Matrix<double> reference_combinations = pl.calculate_combinations(inputs);
+
+       pl.calculate_first_order_outputs(inputs, combinations, activations, activations_derivatives);
+
+       pl.calculate_outputs(inputs, outputs);
+
+       assert_true((combinations - reference_combinations).calculate_absolute_value() < 1.0e-12, LOG);
+       assert_true((activations - pl.calculate_activations(reference_combinations)).calculate_absolute_value() < 1.0e-12, LOG);
+       assert_true((activations_derivatives - pl.calculate_activations_derivatives(reference_combinations)).calculate_absolute_value() < 1.0e-12, LOG);
+       assert_true((outputs - activations).calculate_absolute_value() < 1.0e-12, LOG);
+   }
+}
+
+
 void PerceptronLayerTest::test_calculate_outputs()
 {
 /*
@@ -2056,6 +2092,9 @@ void PerceptronLayerTest::run_test_case()
    // Activation
 
    test_calculate_activations();
+
+   test_calculate_first_order_outputs();
+
  /*  test_calculate_activations_derivatives();
    test_calculate_activations_second_derivatives();
 
@@ -152,6 +152,8 @@ public:
 
    void test_calculate_outputs();
 
+   void test_calculate_first_order_outputs();
+
    void test_calculate_Jacobian();   
    void test_calculate_Hessian();
 
@@ -90,6 +90,10 @@ void QuasiNewtonMethodTest::test_set_inverse_Hessian_approximation_method()
 
    qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::BFGS);
    assert_true(qnm.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::BFGS, LOG);
+
+   qnm.set_inverse_Hessian_approximation_method("LBFGS");
+   assert_true(qnm.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::LBFGS, LOG);
+   assert_true(qnm.write_inverse_Hessian_approximation_method() == "LBFGS", LOG);
 }
 
 
@@ -281,9 +285,105 @@ void QuasiNewtonMethodTest::test_calculate_inverse_Hessian_approximation()
 }
 
 
+void QuasiNewtonMethodTest::test_calculate_limited_memory_inverse_Hessian()
+{
+   message += "test_calculate_limited_memory_inverse_Hessian\n";
+
+   QuasiNewtonMethod::LimitedMemoryInverseHessian limited_memory_inverse_Hessian;
+
+   Vector<double> old_parameters(3);
+   Vector<double> parameters(3);
+   Vector<double> old_gradient(3);
+   Vector<double> gradient(3);
+
+   Vector<double> vector(3);
+   Vector<double> product;
+
+   // Test
+
+   limited_memory_inverse_Hessian.set(3, 2);
+
+   vector = Vector<double>({1.0, -2.0, 3.0});
+
+   product = limited_memory_inverse_Hessian.dot(vector);
+
+   assert_true(product == vector, LOG);
+
+   // Test
+
+   limited_memory_inverse_Hessian.set(3, 2);
+
+   old_parameters = Vector<double>({0.0, 0.0, 0.0});
+   parameters = Vector<double>({1.0, 0.5, -0.5});
+   old_gradient = Vector<double>({1.0, 1.0, 1.0});
+   gradient = Vector<double>({3.0, 2.0, 0.0});
+
+   limited_memory_inverse_Hessian.update(old_parameters, parameters, old_gradient, gradient);
+
+   assert_true(limited_memory_inverse_Hessian.pairs_number == 1, LOG);
+
+   product = limited_memory_inverse_Hessian.dot(gradient - old_gradient);
+
+   assert_true((product - (parameters - old_parameters)).calculate_L2_norm() < 1.0e-12, LOG);
+
+   // Test
+
+   old_parameters = parameters;
+   parameters = Vector<double>({1.5, 0.0, -0.25});
+   old_gradient = gradient;
+   gradient = Vector<double>({4.0, 1.0, 1.0});
+
+   limited_memory_inverse_Hessian.update(old_parameters, parameters, old_gradient, gradient);
+
+   old_parameters = parameters;
+   parameters = Vector<double>({1.0, 0.0, 0.0});
+   old_gradient = gradient;
+   gradient = Vector<double>({3.0, 1.0, 2.0});
+
+   limited_memory_inverse_Hessian.update(old_parameters, parameters, old_gradient, gradient);
+
+   assert_true(limited_memory_inverse_Hessian.pairs_number == 2, LOG);
+
+   product = limited_memory_inverse_Hessian.dot(gradient - old_gradient);
+
+   assert_true((product - (parameters - old_parameters)).calculate_L2_norm() < 1.0e-12, LOG);
+
+   // Test
+
+   limited_memory_inverse_Hessian.set(3, 2);
+
+   old_parameters = Vector<double>({0.0, 0.0, 0.0});
+   parameters = Vector<double>({1.0, 0.0, 0.0});
+   old_gradient = Vector<double>({1.0, 0.0, 0.0});
+   gradient = Vector<double>({0.0, 0.0, 0.0});
+
+   limited_memory_inverse_Hessian.update(old_parameters, parameters, old_gradient, gradient);
+
+   assert_true(limited_memory_inverse_Hessian.pairs_number == 0, LOG);
+}
+
+
 void QuasiNewtonMethodTest::test_calculate_training_direction()
 {
    message += "test_calculate_training_direction\n";
+
+   QuasiNewtonMethod qnm;
+
+   QuasiNewtonMethod::LimitedMemoryInverseHessian limited_memory_inverse_Hessian;
+
+   Vector<double> gradient(2);
+   Vector<double> training_direction;
+
+   // Test
+
+   limited_memory_inverse_Hessian.set(2, 5);
+
+   gradient = Vector<double>({3.0, -4.0});
+
+   training_direction = qnm.calculate_training_direction(gradient, limited_memory_inverse_Hessian);
+
+   assert_true(fabs(training_direction[0] + 0.6) < 1.0e-12, LOG);
+   assert_true(fabs(training_direction[1] - 0.8) < 1.0e-12, LOG);
 }
 
 
@@ -382,6 +482,35 @@ void QuasiNewtonMethodTest::test_perform_training()
    double gradient_norm = sse.calculate_gradient().calculate_norm();
    assert_true(gradient_norm < gradient_norm_goal, LOG);
 */
+
+   // Limited-memory BFGS
+
+   DataSet limited_memory_ds(50, 1, 2);
+   limited_memory_ds.randomize_data_normal();
+   limited_memory_ds.get_instances_pointer()->set_training();
+
+   NeuralNetwork limited_memory_nn(1, 2);
+
+   SumSquaredError limited_memory_sse(&limited_memory_nn, &limited_memory_ds);
+
+   QuasiNewtonMethod limited_memory_qnm(&limited_memory_sse);
+
+   limited_memory_qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::LBFGS);
+   limited_memory_qnm.set_limited_memory_size(3);
+   limited_memory_qnm.set_reserve_inverse_Hessian_history(true);
+   limited_memory_qnm.set_maximum_epochs_number(20);
+   limited_memory_qnm.set_display(false);
+
+   limited_memory_nn.randomize_parameters_normal();
+
+   const double old_training_error = limited_memory_sse.calculate_training_error();
+
+   QuasiNewtonMethod::QuasiNewtonMethodResults* results = limited_memory_qnm.perform_training();
+
+   assert_true(limited_memory_sse.calculate_training_error() < old_training_error, LOG);
+   assert_true(results->inverse_Hessian_history[0].empty(), LOG);
+
+   delete results;
 }
 
 
@@ -395,6 +524,22 @@ void QuasiNewtonMethodTest::test_to_XML()
    assert_true(document != nullptr, LOG);
 
    delete document;
+
+   // Test
+
+   qnm.set_inverse_Hessian_approximation_method(QuasiNewtonMethod::LBFGS);
+   qnm.set_limited_memory_size(7);
+
+   document = qnm.to_XML();
+
+   QuasiNewtonMethod qnm_copy;
+
+   qnm_copy.from_XML(*document);
+
+   assert_true(qnm_copy.get_inverse_Hessian_approximation_method() == QuasiNewtonMethod::LBFGS, LOG);
+   assert_true(qnm_copy.get_limited_memory_size() == 7, LOG);
+
+   delete document;
 }
 
 
@@ -469,6 +614,7 @@ void QuasiNewtonMethodTest::run_test_case()
    test_calculate_BFGS_inverse_Hessian_approximation();
 
    test_calculate_inverse_Hessian_approximation();
+   test_calculate_limited_memory_inverse_Hessian();
    test_calculate_training_direction();
 
    test_perform_training();
@@ -62,6 +62,7 @@ public:
    void test_calculate_BFGS_inverse_Hessian_approximation();
 
    void test_calculate_inverse_Hessian_approximation();
+   void test_calculate_limited_memory_inverse_Hessian();
    void test_calculate_training_direction();
 
    void test_perform_training();
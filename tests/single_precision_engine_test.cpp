@@ -0,0 +1,284 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   S I N G L E   P R E C I S I O N   E N G I N E   T E S T   C L A S S                                        */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "single_precision_engine_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+SinglePrecisionEngineTest::SinglePrecisionEngineTest() : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+SinglePrecisionEngineTest::~SinglePrecisionEngineTest()
+{
+}
+
+
+// METHODS
+
+void SinglePrecisionEngineTest::test_constructor()
+{
+   message += "test_constructor\n";
+
+   NeuralNetwork nn(2, 3, 1);
+   DataSet ds(5, 2, 1);
+
+   // Test
+
+   SinglePrecisionEngine spe1;
+
+   assert_true(spe1.get_neural_network_pointer() == nullptr, LOG);
+   assert_true(spe1.get_data_set_pointer() == nullptr, LOG);
+
+   // Test
+
+   SinglePrecisionEngine spe2(&nn, &ds);
+
+   assert_true(spe2.get_neural_network_pointer() == &nn, LOG);
+   assert_true(spe2.get_data_set_pointer() == &ds, LOG);
+   assert_true(spe2.get_parameters().size() == nn.get_parameters_number(), LOG);
+}
+
+
+void SinglePrecisionEngineTest::test_calculate_outputs()
+{
+   message += "test_calculate_outputs\n";
+
+   NeuralNetwork nn;
+
+   Vector<size_t> architecture;
+
+   Matrix<double> inputs;
+   Matrix<float> inputs_float;
+
+   Statistics<double> statistics;
+
+   statistics.minimum = -2.0;
+   statistics.maximum = 3.0;
+   statistics.mean = 0.5;
+   statistics.standard_deviation = 1.5;
+
+   // Test
+
+   for(int i = PerceptronLayer::Logistic; i <= PerceptronLayer::HardSigmoid; i++)
+   {
+       architecture.set(3);
+       architecture[0] = 3;
+       architecture[1] = 4;
+       architecture[2] = 2;
+
+       nn.set(architecture);
+       nn.randomize_parameters_normal();
+       nn.get_multilayer_perceptron_pointer()->set_layers_activation_function(Vector<PerceptronLayer::ActivationFunction>(2, static_cast<PerceptronLayer::ActivationFunction>(i)));
+
+       nn.construct_scaling_layer();
+       nn.get_scaling_layer_pointer()->set_statistics(Vector< Statistics<double> >(3, statistics));
+       nn.get_scaling_layer_pointer()->set_scaling_methods(ScalingLayer::MinimumMaximum);
+
+       nn.construct_unscaling_layer();
+       nn.get_unscaling_layer_pointer()->set_statistics(Vector< Statistics<double> >(2, statistics));
+       nn.get_unscaling_layer_pointer()->set_unscaling_method(UnscalingLayer::MinimumMaximum);
+
+       inputs.set(6, 3);
+       inputs.randomize_normal();
+
+       inputs_float.set(6, 3);
+       transform(inputs.begin(), inputs.end(), inputs_float.begin(), [](const double& value){return static_cast<float>(value);});
+
+       SinglePrecisionEngine spe(&nn, nullptr);
+
+       const Matrix<double> outputs = nn.calculate_outputs(inputs);
+       const Matrix<float> outputs_float = spe.calculate_outputs(inputs_float);
+
+       assert_true(outputs_float.get_rows_number() == 6, LOG);
+       assert_true(outputs_float.get_columns_number() == 2, LOG);
+
+       for(size_t j = 0; j < outputs.size(); j++)
+       {
+           assert_true(fabs(outputs[j] - static_cast<double>(outputs_float[j])) < 1.0e-4*(1.0 + fabs(outputs[j])), LOG);
+       }
+   }
+}
+
+
+void SinglePrecisionEngineTest::test_calculate_batch_error_gradient()
+{
+   message += "test_calculate_batch_error_gradient\n";
+
+   NeuralNetwork nn;
+   DataSet ds;
+   SumSquaredError sse(&nn, &ds);
+
+   Vector<size_t> architecture;
+
+   Vector<float> gradient;
+
+   // Test
+
+   architecture.set(4);
+   architecture[0] = 2;
+   architecture[1] = 5;
+   architecture[2] = 3;
+   architecture[3] = 1;
+
+   nn.set(architecture);
+   nn.randomize_parameters_normal();
+
+   ds.set(20, 2, 1);
+   ds.randomize_data_normal();
+
+   const Matrix<double> inputs = ds.get_inputs();
+   const Matrix<double> targets = ds.get_targets();
+
+   Matrix<float> inputs_float(20, 2);
+   Matrix<float> targets_float(20, 1);
+
+   transform(inputs.begin(), inputs.end(), inputs_float.begin(), [](const double& value){return static_cast<float>(value);});
+   transform(targets.begin(), targets.end(), targets_float.begin(), [](const double& value){return static_cast<float>(value);});
+
+   SinglePrecisionEngine spe(&nn, &ds);
+
+   const float error = spe.calculate_batch_error_gradient(inputs_float, targets_float, gradient);
+
+   sse.set_back_propagations(20);
+
+   sse.calculate_back_propagation(inputs, targets, sse.get_back_propagation());
+
+   const Vector<double> mean_squared_error_gradient = sse.get_back_propagation().gradient/20.0;
+
+   const double mean_squared_error = sse.calculate_error(nn.get_multilayer_perceptron_pointer()->calculate_outputs(inputs), targets)/20.0;
+
+   assert_true(gradient.size() == nn.get_parameters_number(), LOG);
+   assert_true(fabs(static_cast<double>(error) - mean_squared_error) < 1.0e-4*(1.0 + mean_squared_error), LOG);
+
+   for(size_t i = 0; i < gradient.size(); i++)
+   {
+       assert_true(fabs(static_cast<double>(gradient[i]) - mean_squared_error_gradient[i]) < 1.0e-4*(1.0 + fabs(mean_squared_error_gradient[i])), LOG);
+   }
+}
+
+
+void SinglePrecisionEngineTest::test_perform_training()
+{
+   message += "test_perform_training\n";
+
+   NeuralNetwork nn;
+   DataSet ds;
+
+   Matrix<double> data(100, 2);
+
+   // Test
+
+   for(size_t i = 0; i < 100; i++)
+   {
+       data(i,0) = -1.0 + 2.0*static_cast<double>(i)/99.0;
+       data(i,1) = 0.5*data(i,0) - 0.25;
+   }
+
+   ds.set(data);
+   ds.get_instances_pointer()->set_training();
+
+   for(size_t i = 0; i < 4; i++)
+   {
+       nn.set(1, 3, 1);
+       nn.randomize_parameters_normal(0.0, 0.1);
+
+       SinglePrecisionEngine spe(&nn, &ds);
+
+       spe.set_optimization_method(i < 2 ? SinglePrecisionEngine::StochasticGradientDescent : SinglePrecisionEngine::Adam);
+       spe.set_double_master_parameters(i%2 == 0);
+       spe.set_batch_size(10);
+       spe.set_epochs_number(200);
+
+       const double initial_error = static_cast<double>(spe.calculate_training_error());
+
+       const double final_error = spe.perform_training();
+
+       assert_true(final_error < initial_error, LOG);
+       assert_true(final_error < 1.0e-2, LOG);
+       assert_true(fabs(static_cast<double>(spe.get_parameters()[0]) - nn.get_parameters()[0]) < 1.0e-12, LOG);
+   }
+
+   // Test
+
+   nn.set(1, 3, 1);
+   nn.randomize_parameters_normal(0.0, 0.1);
+
+   const Vector<double> initial_parameters = nn.get_parameters();
+
+   SinglePrecisionEngine spe(&nn, &ds);
+
+   spe.set_batch_size(30);
+   spe.set_epochs_number(50);
+   spe.set_seed(1);
+
+   const double initial_error = static_cast<double>(spe.calculate_training_error());
+
+   assert_true(spe.perform_training() < initial_error, LOG);
+
+   const Vector<double> parameters = nn.get_parameters();
+
+   nn.set_parameters(initial_parameters);
+
+   spe.set_seed(1);
+   spe.perform_training();
+
+   assert_true(nn.get_parameters() == parameters, LOG);
+}
+
+
+void SinglePrecisionEngineTest::run_test_case()
+{
+   message += "Running single precision engine test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+
+   // Operation methods
+
+   test_calculate_outputs();
+
+   test_calculate_batch_error_gradient();
+
+   // Training methods
+
+   test_perform_training();
+
+   message += "End of single precision engine test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright (C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
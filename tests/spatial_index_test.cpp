@@ -0,0 +1,498 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   S P A T I A L   I N D E X   T E S T   C L A S S                                                            */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "spatial_index_test.h"
+
+using namespace OpenNN;
+
+
+/// Returns the sorted distances from a query point to all the rows of a matrix, computed exhaustively.
+
+static Vector<double> calculate_sorted_distances(const Matrix<double>& points, const Vector<double>& weights,
+                                                 const SpatialIndex::DistanceMethod& distance_method, const Vector<double>& query)
+{
+   const size_t points_number = points.get_rows_number();
+   const size_t dimensions_number = points.get_columns_number();
+
+   Vector<double> distances(points_number, 0.0);
+
+   for(size_t i = 0; i < points_number; i++)
+   {
+      for(size_t j = 0; j < dimensions_number; j++)
+      {
+         const double difference = points(i,j) - query[j];
+
+         if(distance_method == SpatialIndex::Euclidean)
+         {
+            distances[i] += weights[j]*difference*difference;
+         }
+         else
+         {
+            distances[i] += weights[j]*fabs(difference);
+         }
+      }
+
+      if(distance_method == SpatialIndex::Euclidean)
+      {
+         distances[i] = sqrt(distances[i]);
+      }
+   }
+
+   sort(distances.begin(), distances.end());
+
+   return(distances);
+}
+
+
+// GENERAL CONSTRUCTOR
+
+SpatialIndexTest::SpatialIndexTest() : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+SpatialIndexTest::~SpatialIndexTest()
+{
+}
+
+
+// METHODS
+
+void SpatialIndexTest::test_constructor()
+{
+   message += "test_constructor\n";
+
+   // Default constructor
+
+   SpatialIndex si1;
+
+   assert_true(si1.get_points_number() == 0, LOG);
+   assert_true(si1.get_dimensions_number() == 0, LOG);
+
+   // Points constructor
+
+   Matrix<double> points(10, 3);
+   points.randomize_uniform();
+
+   SpatialIndex si2(points, SpatialIndex::Manhattan);
+
+   assert_true(si2.get_points_number() == 10, LOG);
+   assert_true(si2.get_dimensions_number() == 3, LOG);
+   assert_true(si2.get_weights() == Vector<double>(3, 1.0), LOG);
+   assert_true(si2.get_distance_method() == SpatialIndex::Manhattan, LOG);
+   assert_true(!si2.is_exhaustive(), LOG);
+
+   // Weighted points constructor
+
+   SpatialIndex si3(points, Vector<double>({1.0, -1.0, 2.0}));
+
+   assert_true(si3.get_distance_method() == SpatialIndex::Euclidean, LOG);
+   assert_true(si3.is_exhaustive(), LOG);
+}
+
+
+void SpatialIndexTest::test_set_leaf_size()
+{
+   message += "test_set_leaf_size\n";
+
+   Matrix<double> points(200, 2);
+   points.randomize_uniform();
+
+   SpatialIndex spatial_index(points);
+
+   const Vector<double> query({0.1, -0.2});
+
+   const SpatialIndex::Neighbors neighbors = spatial_index.calculate_k_nearest_neighbors(query, 7);
+
+   // Test
+
+   spatial_index.set_leaf_size(1);
+
+   assert_true(spatial_index.get_leaf_size() == 1, LOG);
+
+   const SpatialIndex::Neighbors neighbors_1 = spatial_index.calculate_k_nearest_neighbors(query, 7);
+
+   assert_true(neighbors_1.indices == neighbors.indices, LOG);
+   assert_true((neighbors_1.distances - neighbors.distances).calculate_absolute_value() < 1.0e-12, LOG);
+
+   // Test
+
+   spatial_index.set_leaf_size(1000);
+
+   const SpatialIndex::Neighbors neighbors_1000 = spatial_index.calculate_k_nearest_neighbors(query, 7);
+
+   assert_true(neighbors_1000.indices == neighbors.indices, LOG);
+}
+
+
+void SpatialIndexTest::test_set_search_method()
+{
+   message += "test_set_search_method\n";
+
+   Matrix<double> points(100, 20);
+   points.randomize_uniform();
+
+   SpatialIndex spatial_index(points);
+
+   // Test
+
+   assert_true(spatial_index.get_search_method() == SpatialIndex::Automatic, LOG);
+   assert_true(spatial_index.is_brute_force(10), LOG);
+   assert_true(!spatial_index.is_brute_force(1), LOG);
+
+   // Test
+
+   spatial_index.set(points.get_submatrix_columns(Vector<size_t>(0, 1, 4)));
+
+   assert_true(!spatial_index.is_brute_force(10), LOG);
+
+   spatial_index.set_search_method(SpatialIndex::BruteForce);
+
+   assert_true(spatial_index.is_brute_force(1), LOG);
+
+   // Test
+
+   spatial_index.set(points);
+   spatial_index.set_search_method(SpatialIndex::Tree);
+
+   assert_true(!spatial_index.is_brute_force(10), LOG);
+}
+
+
+void SpatialIndexTest::test_calculate_k_nearest_neighbors()
+{
+   message += "test_calculate_k_nearest_neighbors\n";
+
+   const size_t points_number = 500;
+   const size_t dimensions_number = 4;
+
+   Matrix<double> points(points_number, dimensions_number);
+   points.randomize_normal();
+
+   const Vector<double> weights(dimensions_number, 1.0);
+
+   Vector<double> query(dimensions_number);
+
+   SpatialIndex::Neighbors neighbors;
+
+   Vector<double> distances;
+
+   // Test
+
+   SpatialIndex euclidean(points);
+
+   for(size_t t = 0; t < 10; t++)
+   {
+      query.randomize_normal();
+
+      neighbors = euclidean.calculate_k_nearest_neighbors(query, 10);
+
+      distances = calculate_sorted_distances(points, weights, SpatialIndex::Euclidean, query);
+
+      assert_true(neighbors.distances.get_rows_number() == 1, LOG);
+      assert_true(neighbors.distances.get_columns_number() == 10, LOG);
+
+      for(size_t j = 0; j < 10; j++)
+      {
+         const size_t index = neighbors.indices(0,j);
+
+         assert_true(fabs(neighbors.distances(0,j) - distances[j]) < 1.0e-12, LOG);
+         assert_true(fabs((points.get_row(index) - query).calculate_L2_norm() - distances[j]) < 1.0e-12, LOG);
+      }
+   }
+
+   // Test
+
+   SpatialIndex manhattan(points, SpatialIndex::Manhattan);
+
+   for(size_t t = 0; t < 10; t++)
+   {
+      query.randomize_normal();
+
+      neighbors = manhattan.calculate_k_nearest_neighbors(query, 10);
+
+      distances = calculate_sorted_distances(points, weights, SpatialIndex::Manhattan, query);
+
+      for(size_t j = 0; j < 10; j++)
+      {
+         assert_true(fabs(neighbors.distances(0,j) - distances[j]) < 1.0e-12, LOG);
+      }
+   }
+
+   // Test
+
+   neighbors = euclidean.calculate_k_nearest_neighbors(query, 2*points_number);
+
+   assert_true(neighbors.indices.get_columns_number() == points_number, LOG);
+   assert_true(neighbors.indices.get_row(0).sort_ascending_values() == Vector<size_t>(0, 1, points_number-1), LOG);
+
+   // Test
+
+   Matrix<double> grid(9, 2);
+
+   for(size_t i = 0; i < 9; i++)
+   {
+      grid(i,0) = static_cast<double>(i/3);
+      grid(i,1) = static_cast<double>(i%3);
+   }
+
+   SpatialIndex grid_index(grid);
+   grid_index.set_leaf_size(1);
+
+   neighbors = grid_index.calculate_k_nearest_neighbors(Vector<double>({1.0, 1.0}), 5);
+
+   assert_true(neighbors.indices(0,0) == 4, LOG);
+   assert_true(neighbors.indices.get_row(0) == Vector<size_t>({4, 1, 3, 5, 7}), LOG);
+}
+
+
+void SpatialIndexTest::test_calculate_k_nearest_neighbors_weights()
+{
+   message += "test_calculate_k_nearest_neighbors_weights\n";
+
+   const size_t points_number = 300;
+   const size_t dimensions_number = 3;
+
+   Matrix<double> points(points_number, dimensions_number);
+   points.randomize_uniform();
+
+   Vector<double> query(dimensions_number);
+
+   SpatialIndex::Neighbors neighbors;
+
+   Vector<double> distances;
+
+   // Test
+
+   const Vector<double> weights({0.5, 3.0, 0.0});
+
+   SpatialIndex spatial_index(points, weights, SpatialIndex::Manhattan);
+
+   for(size_t t = 0; t < 10; t++)
+   {
+      query.randomize_uniform();
+
+      neighbors = spatial_index.calculate_k_nearest_neighbors(query, 5);
+
+      distances = calculate_sorted_distances(points, weights, SpatialIndex::Manhattan, query);
+
+      for(size_t j = 0; j < 5; j++)
+      {
+         assert_true(fabs(neighbors.distances(0,j) - distances[j]) < 1.0e-12, LOG);
+      }
+   }
+
+   // Test
+
+   const Vector<double> negative_weights({1.0, -0.5, 2.0});
+
+   spatial_index.set(points, negative_weights, SpatialIndex::Euclidean);
+
+   assert_true(spatial_index.is_exhaustive(), LOG);
+
+   query.randomize_uniform();
+
+   neighbors = spatial_index.calculate_k_nearest_neighbors(query, 5);
+
+   Vector<double> reduced_distances(points_number, 0.0);
+
+   for(size_t i = 0; i < points_number; i++)
+   {
+      for(size_t j = 0; j < dimensions_number; j++)
+      {
+         reduced_distances[i] += negative_weights[j]*(points(i,j) - query[j])*(points(i,j) - query[j]);
+      }
+   }
+
+   assert_true(neighbors.indices(0,0) == reduced_distances.calculate_minimal_index(), LOG);
+}
+
+
+void SpatialIndexTest::test_calculate_k_nearest_neighbors_batch()
+{
+   message += "test_calculate_k_nearest_neighbors_batch\n";
+
+   Matrix<double> points(400, 5);
+   points.randomize_normal();
+
+   Matrix<double> queries(50, 5);
+   queries.randomize_normal();
+
+   SpatialIndex spatial_index(points, Vector<double>({1.0, 2.0, 0.5, 1.0, 1.0}));
+
+   // Test
+
+   const SpatialIndex::Neighbors neighbors = spatial_index.calculate_k_nearest_neighbors(queries, 8);
+
+   assert_true(neighbors.indices.get_rows_number() == 50, LOG);
+   assert_true(neighbors.indices.get_columns_number() == 8, LOG);
+
+   for(size_t i = 0; i < 50; i++)
+   {
+      const SpatialIndex::Neighbors query_neighbors = spatial_index.calculate_k_nearest_neighbors(queries.get_row(i), 8);
+
+      assert_true(neighbors.indices.get_row(i) == query_neighbors.indices.get_row(0), LOG);
+      assert_true(neighbors.distances.get_row(i) == query_neighbors.distances.get_row(0), LOG);
+   }
+}
+
+
+void SpatialIndexTest::test_calculate_k_nearest_neighbors_points()
+{
+   message += "test_calculate_k_nearest_neighbors_points\n";
+
+   const size_t points_number = 300;
+
+   Matrix<double> points(points_number, 3);
+   points.randomize_uniform();
+
+   SpatialIndex spatial_index(points);
+
+   // Test
+
+   const SpatialIndex::Neighbors neighbors = spatial_index.calculate_k_nearest_neighbors(6);
+
+   assert_true(neighbors.indices.get_rows_number() == points_number, LOG);
+   assert_true(neighbors.indices.get_columns_number() == 6, LOG);
+
+   for(size_t i = 0; i < points_number; i++)
+   {
+      const SpatialIndex::Neighbors point_neighbors = spatial_index.calculate_k_nearest_neighbors(points.get_row(i), 7);
+
+      assert_true(point_neighbors.indices(0,0) == i, LOG);
+      assert_true(!neighbors.indices.get_row(i).contains(i), LOG);
+
+      for(size_t j = 0; j < 6; j++)
+      {
+         assert_true(neighbors.indices(i,j) == point_neighbors.indices(0,j+1), LOG);
+      }
+   }
+
+   // Test
+
+   assert_true(spatial_index.calculate_k_nearest_neighbors(points_number).indices.get_columns_number() == points_number-1, LOG);
+}
+
+
+void SpatialIndexTest::test_calculate_k_nearest_neighbors_brute_force()
+{
+   message += "test_calculate_k_nearest_neighbors_brute_force\n";
+
+   const size_t points_number = 1500;
+
+   Matrix<double> points(points_number, 6);
+   points.randomize_normal();
+
+   Matrix<double> queries(130, 6);
+   queries.randomize_normal();
+
+   const Vector<double> weights({1.0, 0.5, 2.0, 0.0, 1.0, 3.0});
+
+   SpatialIndex spatial_index;
+
+   SpatialIndex::Neighbors tree_neighbors;
+   SpatialIndex::Neighbors brute_force_neighbors;
+
+   // Test
+
+   spatial_index.set(points, weights);
+   spatial_index.set_search_method(SpatialIndex::Tree);
+
+   tree_neighbors = spatial_index.calculate_k_nearest_neighbors(queries, 7);
+   brute_force_neighbors = spatial_index.calculate_k_nearest_neighbors_brute_force(queries, 7);
+
+   assert_true(brute_force_neighbors.indices.get_rows_number() == 130, LOG);
+   assert_true(brute_force_neighbors.indices.get_columns_number() == 7, LOG);
+   assert_true(brute_force_neighbors.indices == tree_neighbors.indices, LOG);
+   assert_true((brute_force_neighbors.distances - tree_neighbors.distances).calculate_absolute_value() < 1.0e-9, LOG);
+
+   // Test
+
+   spatial_index.set(points, weights, SpatialIndex::Manhattan);
+   spatial_index.set_search_method(SpatialIndex::Tree);
+
+   tree_neighbors = spatial_index.calculate_k_nearest_neighbors(queries, 7);
+   brute_force_neighbors = spatial_index.calculate_k_nearest_neighbors_brute_force(queries, 7);
+
+   assert_true(brute_force_neighbors.indices == tree_neighbors.indices, LOG);
+   assert_true(brute_force_neighbors.distances == tree_neighbors.distances, LOG);
+
+   // Test
+
+   spatial_index.set(points, weights);
+   spatial_index.set_search_method(SpatialIndex::Tree);
+
+   tree_neighbors = spatial_index.calculate_k_nearest_neighbors(4);
+
+   spatial_index.set_search_method(SpatialIndex::BruteForce);
+
+   brute_force_neighbors = spatial_index.calculate_k_nearest_neighbors(4);
+
+   assert_true(brute_force_neighbors.indices.get_rows_number() == points_number, LOG);
+   assert_true(brute_force_neighbors.indices == tree_neighbors.indices, LOG);
+   assert_true((brute_force_neighbors.distances - tree_neighbors.distances).calculate_absolute_value() < 1.0e-9, LOG);
+
+   // Test
+
+   brute_force_neighbors = spatial_index.calculate_k_nearest_neighbors_brute_force(queries.get_submatrix_rows(Vector<size_t>(0, 1, 2)), 2*points_number);
+
+   assert_true(brute_force_neighbors.indices.get_columns_number() == points_number, LOG);
+   assert_true(brute_force_neighbors.indices.get_row(1).sort_ascending_values() == Vector<size_t>(0, 1, points_number-1), LOG);
+}
+
+
+void SpatialIndexTest::run_test_case()
+{
+   message += "Running spatial index test case...\n";
+
+   // Constructor and destructor methods
+
+   test_constructor();
+
+   // Set methods
+
+   test_set_leaf_size();
+   test_set_search_method();
+
+   // Query methods
+
+   test_calculate_k_nearest_neighbors();
+   test_calculate_k_nearest_neighbors_weights();
+   test_calculate_k_nearest_neighbors_batch();
+   test_calculate_k_nearest_neighbors_points();
+   test_calculate_k_nearest_neighbors_brute_force();
+
+   message += "End of spatial index test case.\n";
+}
+
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
@@ -121,6 +121,73 @@ void StochasticGradientDescentTest::test_perform_training()
 
    sgd.perform_training();
 
+   // Shuffled batches prefetched on a background thread
+
+   ds.set(50, 1, 2);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   nn.randomize_parameters_normal();
+
+   const double old_training_error = sse.calculate_training_error();
+
+   sgd.set_shuffle(true);
+   sgd.set_shuffle_block_size(4);
+   sgd.set_shuffle_seed(1);
+   sgd.set_prefetched_batches_number(2);
+
+   sgd.set_minimum_parameters_increment_norm(0.0);
+   sgd.set_training_batch_size(10);
+   sgd.set_maximum_epochs_number(100);
+
+   sgd.perform_training();
+
+   assert_true(sse.calculate_training_error() < old_training_error, LOG);
+
+   // Selection error calculated in the background
+
+   ds.get_instances_pointer()->split_random_indices(0.8, 0.2, 0.0);
+
+   nn.randomize_parameters_normal();
+
+   const Vector<double> initial_parameters = nn.get_parameters();
+
+   sgd.set_reserve_selection_error_history(true);
+   sgd.set_maximum_epochs_number(10);
+
+   StochasticGradientDescent::StochasticGradientDescentResults* results = sgd.perform_training();
+
+   const Vector<double> selection_error_history = results->selection_error_history;
+   const double final_selection_error = results->final_selection_error;
+
+   delete results;
+
+   nn.set_parameters(initial_parameters);
+
+   sgd.set_asynchronous_selection_error(true);
+
+   results = sgd.perform_training();
+
+   assert_true(results->selection_error_history.size() == selection_error_history.size(), LOG);
+   assert_true((results->selection_error_history - selection_error_history).calculate_absolute_value().calculate_maximum() < 1.0e-9, LOG);
+   assert_true(fabs(results->final_selection_error - final_selection_error) < 1.0e-9, LOG);
+   assert_true(fabs(results->final_selection_error - sse.calculate_selection_error()) < 1.0e-9, LOG);
+
+   delete results;
+
+   // Training error estimated from the batch errors
+
+   sgd.set_asynchronous_selection_error(false);
+   sgd.set_reuse_batch_errors(true);
+   sgd.set_learning_rate(0.0);
+   sgd.set_maximum_epochs_number(1);
+
+   results = sgd.perform_training();
+
+   assert_true(fabs(results->final_loss - sse.calculate_training_error()) < 1.0e-9, LOG);
+
+   delete results;
+
    // Performance goal
 /*
    nn.initialize_parameters(-1.0);
@@ -240,6 +307,28 @@ void StochasticGradientDescentTest::test_from_XML()
 
    assert_true(sgd2 == sgd1, LOG);
 
+   // Test
+
+   sgd1.set_shuffle(true);
+   sgd1.set_shuffle_block_size(8);
+   sgd1.set_prefetched_batches_number(3);
+   sgd1.set_shuffle_seed(5);
+   sgd1.set_asynchronous_selection_error(true);
+   sgd1.set_reuse_batch_errors(true);
+
+   document = sgd1.to_XML();
+
+   sgd2.from_XML(*document);
+
+   delete document;
+
+   assert_true(sgd2.get_shuffle(), LOG);
+   assert_true(sgd2.get_shuffle_block_size() == 8, LOG);
+   assert_true(sgd2.get_prefetched_batches_number() == 3, LOG);
+   assert_true(sgd2.get_shuffle_seed() == 5, LOG);
+   assert_true(sgd2.get_asynchronous_selection_error(), LOG);
+   assert_true(sgd2.get_reuse_batch_errors(), LOG);
+
 }
 
 
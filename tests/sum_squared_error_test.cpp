@@ -195,6 +195,161 @@ void SumSquaredErrorTest::test_calculate_layers_delta()
 }
 
 
+void SumSquaredErrorTest::test_calculate_back_propagation()
+{
+   message += "test_calculate_back_propagation\n";
+
+   DataSet ds;
+   NeuralNetwork nn;
+   SumSquaredError sse(&nn, &ds);
+
+   Vector<size_t> architecture;
+
+   // Test
+
+   architecture.set(4);
+   architecture[0] = 3;
+   architecture[1] = 5;
+   architecture[2] = 4;
+   architecture[3] = 2;
+
+   nn.set(architecture);
+   nn.randomize_parameters_normal();
+
+   ds.set(8, 3, 2);
+   ds.randomize_data_normal();
+
+   const Matrix<double> inputs = ds.get_inputs();
+   const Matrix<double> targets = ds.get_targets();
+
+   const MultilayerPerceptron* multilayer_perceptron_pointer = nn.get_multilayer_perceptron_pointer();
+
+   const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
+           = multilayer_perceptron_pointer->calculate_first_order_forward_propagation(inputs);
+
+   const Matrix<double> output_gradient = sse.calculate_output_gradient(first_order_forward_propagation.layers_activations[2], targets);
+
+   const Vector< Matrix<double> > layers_delta = sse.calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+
+   const Vector<double> gradient = sse.calculate_error_gradient(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+
+   sse.set_back_propagations(8);
+
+   LossIndex::BackPropagation& back_propagation = sse.get_back_propagation();
+
+   sse.calculate_back_propagation(inputs, targets, back_propagation);
+
+   assert_true(back_propagation.gradient.size() == nn.get_parameters_number(), LOG);
+   assert_true((back_propagation.gradient - gradient).calculate_absolute_value() < 1.0e-12, LOG);
+   assert_true((back_propagation.forward_propagation.layers_activations[2] - first_order_forward_propagation.layers_activations[2]).calculate_absolute_value() < 1.0e-12, LOG);
+
+   // Test
+
+   const double* gradient_data = back_propagation.gradient.data();
+
+   sse.set_back_propagations(8);
+
+   sse.calculate_back_propagation(inputs, targets, sse.get_back_propagation());
+
+   assert_true(sse.get_back_propagation().gradient.data() == gradient_data, LOG);
+   assert_true((sse.get_back_propagation().gradient - gradient).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
+void SumSquaredErrorTest::test_calculate_training_error_gradient_reproducibility()
+{
+   message += "test_calculate_training_error_gradient_reproducibility\n";
+
+   DataSet ds;
+   NeuralNetwork nn;
+   SumSquaredError sse(&nn, &ds);
+
+   // Test
+
+#ifdef _OPENMP
+   const int threads_number = omp_get_max_threads();
+
+   omp_set_num_threads(3);
+#endif
+
+   nn.set(2, 3, 1);
+   nn.randomize_parameters_normal();
+
+   ds.set(2500, 2, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   const Vector<double> gradient = sse.calculate_training_error_gradient();
+
+   const LossIndex::SecondOrderErrorTerms terms_second_order_loss = sse.calculate_terms_second_order_loss();
+
+   for(size_t i = 0; i < 3; i++)
+   {
+       assert_true(sse.calculate_training_error_gradient() == gradient, LOG);
+
+       const LossIndex::SecondOrderErrorTerms new_terms_second_order_loss = sse.calculate_terms_second_order_loss();
+
+       assert_true(new_terms_second_order_loss.loss == terms_second_order_loss.loss, LOG);
+       assert_true(new_terms_second_order_loss.gradient == terms_second_order_loss.gradient, LOG);
+       assert_true(new_terms_second_order_loss.Hessian_approximation == terms_second_order_loss.Hessian_approximation, LOG);
+   }
+
+   const Matrix<double> inputs = ds.get_inputs();
+   const Matrix<double> targets = ds.get_targets();
+
+   const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
+           = nn.get_multilayer_perceptron_pointer()->calculate_first_order_forward_propagation(inputs);
+
+   const Matrix<double> output_gradient = sse.calculate_output_gradient(first_order_forward_propagation.layers_activations[1], targets);
+
+   const Vector< Matrix<double> > layers_delta = sse.calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+
+   const Vector<double> serial_gradient = sse.calculate_error_gradient(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+
+   assert_true((gradient - serial_gradient).calculate_absolute_value() < 1.0e-6*(1.0 + serial_gradient.calculate_L2_norm()), LOG);
+   assert_true((terms_second_order_loss.gradient - gradient).calculate_absolute_value() < 1.0e-6*(1.0 + serial_gradient.calculate_L2_norm()), LOG);
+
+#ifdef _OPENMP
+   omp_set_num_threads(threads_number);
+#endif
+}
+
+
+void SumSquaredErrorTest::test_calculate_first_order_error()
+{
+   message += "test_calculate_first_order_error\n";
+
+   DataSet ds;
+   NeuralNetwork nn;
+   SumSquaredError sse(&nn, &ds);
+
+   LossIndex::FirstOrderError first_order_error(0);
+
+   // Test
+
+   nn.set(2, 3, 2);
+   nn.randomize_parameters_normal();
+
+   ds.set(30, 2, 2);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   first_order_error = sse.calculate_training_first_order_error();
+
+   assert_true(fabs(first_order_error.error - sse.calculate_training_error()) < 1.0e-12, LOG);
+   assert_true((first_order_error.gradient - sse.calculate_training_error_gradient()).calculate_absolute_value() < 1.0e-12, LOG);
+
+   // Test
+
+   const Vector<size_t> batch_indices({0, 3, 7, 11, 29});
+
+   first_order_error = sse.calculate_batch_first_order_error(batch_indices);
+
+   assert_true(fabs(first_order_error.error - sse.calculate_batch_error(batch_indices)) < 1.0e-12, LOG);
+   assert_true((first_order_error.gradient - sse.calculate_batch_error_gradient(batch_indices)).calculate_absolute_value() < 1.0e-12, LOG);
+}
+
+
 void SumSquaredErrorTest::test_calculate_error_gradient()
 {
    message += "test_calculate_gradient\n";
@@ -779,6 +934,55 @@ void SumSquaredErrorTest::test_calculate_error_terms()
 }
 
 
+void SumSquaredErrorTest::test_calculate_terms_second_order_loss()
+{
+   message += "test_calculate_terms_second_order_loss\n";
+
+   DataSet ds;
+   NeuralNetwork nn;
+   SumSquaredError sse(&nn, &ds);
+
+   // Test
+
+   nn.set(2, 3, 2);
+   nn.randomize_parameters_normal();
+
+   ds.set(150, 2, 2);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->set_training();
+
+   const LossIndex::SecondOrderErrorTerms terms_second_order_loss = sse.calculate_terms_second_order_loss();
+
+   const Matrix<double> inputs = ds.get_inputs();
+   const Matrix<double> targets = ds.get_targets();
+
+   const MultilayerPerceptron::FirstOrderForwardPropagation first_order_forward_propagation
+           = nn.get_multilayer_perceptron_pointer()->calculate_first_order_forward_propagation(inputs);
+
+   const Vector<double> error_terms = sse.calculate_error_terms(first_order_forward_propagation.layers_activations[1], targets);
+
+   const Matrix<double> output_gradient = (first_order_forward_propagation.layers_activations[1] - targets)/error_terms;
+
+   const Vector< Matrix<double> > layers_delta = sse.calculate_layers_delta(first_order_forward_propagation.layers_activation_derivatives, output_gradient);
+
+   const Matrix<double> error_terms_Jacobian = sse.calculate_error_terms_Jacobian(inputs, first_order_forward_propagation.layers_activations, layers_delta);
+
+   const Matrix<double> error_terms_Jacobian_transpose = error_terms_Jacobian.calculate_transpose();
+
+   const Vector<double> gradient = error_terms_Jacobian_transpose.dot(error_terms)*2.0;
+
+   Matrix<double> Hessian_approximation;
+   Hessian_approximation.dot(error_terms_Jacobian_transpose, error_terms_Jacobian);
+   Hessian_approximation *= 2.0;
+
+   assert_true(fabs(terms_second_order_loss.loss - error_terms.dot(error_terms)) < 1.0e-9*(1.0 + terms_second_order_loss.loss), LOG);
+   assert_true((terms_second_order_loss.gradient - gradient).calculate_L2_norm() < 1.0e-9*(1.0 + gradient.calculate_L2_norm()), LOG);
+   assert_true((terms_second_order_loss.Hessian_approximation - Hessian_approximation).to_vector().calculate_L2_norm()
+               < 1.0e-9*(1.0 + Hessian_approximation.to_vector().calculate_L2_norm()), LOG);
+   assert_true(terms_second_order_loss.Hessian_approximation.is_symmetric(), LOG);
+}
+
+
 void SumSquaredErrorTest::test_calculate_error_terms_Jacobian()
 {   
    message += "test_calculate_error_terms_Jacobian\n";
@@ -1031,6 +1235,12 @@ void SumSquaredErrorTest::run_test_case()
 
    test_calculate_error_gradient();
 
+   test_calculate_back_propagation();
+
+   test_calculate_training_error_gradient_reproducibility();
+
+   test_calculate_first_order_error();
+
 //   test_calculate_Hessian();
 
    // Error terms methods
@@ -1039,6 +1249,8 @@ void SumSquaredErrorTest::run_test_case()
 
 //   test_calculate_error_terms_Jacobian();
 
+   test_calculate_terms_second_order_loss();
+
    // Serialization methods
 
 //   test_to_XML();
@@ -61,6 +61,12 @@ public:
 
    void test_calculate_error_gradient();
 
+   void test_calculate_back_propagation();
+
+   void test_calculate_training_error_gradient_reproducibility();
+
+   void test_calculate_first_order_error();
+
    void test_calculate_error_Hessian();
 
    // Error terms methods
@@ -69,6 +75,8 @@ public:
 
    void test_calculate_error_terms_Jacobian();
 
+   void test_calculate_terms_second_order_loss();
+
    // Other methods
 
    void test_calculate_squared_errors();
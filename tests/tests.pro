@@ -31,6 +31,10 @@ SOURCES += \
     instances_test.cpp \
     missing_values_test.cpp \
     data_set_test.cpp \
+    spatial_index_test.cpp \
+    k_nearest_neighbors_test.cpp \
+    association_rules_test.cpp \
+    batch_producer_test.cpp \
     unscaling_layer_test.cpp \
     scaling_layer_test.cpp \
     probabilistic_layer_test.cpp \
@@ -48,10 +52,13 @@ SOURCES += \
     mean_squared_error_test.cpp \
     normalized_squared_error_test.cpp \
     cross_entropy_error_test.cpp \
+    single_precision_engine_test.cpp \
     training_strategy_test.cpp \
     training_rate_algorithm_test.cpp \
     mock_training_algorithm.cpp \
     training_algorithm_test.cpp \
+    history_sink_test.cpp \
+    training_checkpoint_test.cpp \
     random_search_test.cpp \
     quasi_newton_method_test.cpp \
     levenberg_marquardt_algorithm_test.cpp \
@@ -76,6 +83,8 @@ SOURCES += \
     outputs_trending_layer_test.cpp \
     correlation_analysis_test.cpp \
     stochastic_gradient_descent_test.cpp \
+    adaptive_moment_estimation_test.cpp \
+    data_parallel_test.cpp \
     main.cpp
 
 HEADERS += \
@@ -84,6 +93,10 @@ HEADERS += \
     instances_test.h \
     missing_values_test.h \
     data_set_test.h \
+    spatial_index_test.h \
+    k_nearest_neighbors_test.h \
+    association_rules_test.h \
+    batch_producer_test.h \
     unscaling_layer_test.h \
     scaling_layer_test.h \
     probabilistic_layer_test.h \
@@ -101,10 +114,13 @@ HEADERS += \
     mean_squared_error_test.h \
     normalized_squared_error_test.h \
     cross_entropy_error_test.h \
+    single_precision_engine_test.h \
     training_strategy_test.h \
     training_rate_algorithm_test.h \
     mock_training_algorithm.h \
     training_algorithm_test.h \
+    history_sink_test.h \
+    training_checkpoint_test.h \
     random_search_test.h \
     quasi_newton_method_test.h \
     levenberg_marquardt_algorithm_test.h \
@@ -129,6 +145,8 @@ HEADERS += \
     inputs_trending_layer_test.h \
     outputs_trending_layer_test.h \
     stochastic_gradient_descent_test.h \
+    adaptive_moment_estimation_test.h \
+    data_parallel_test.h \
     correlation_analysis_test.h
 
 win32-g++{
@@ -0,0 +1,589 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   T R A I N I N G   C H E C K P O I N T   T E S T   C L A S S                                                */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+// Unit testing includes
+
+#include "training_checkpoint_test.h"
+
+using namespace OpenNN;
+
+
+// GENERAL CONSTRUCTOR
+
+TrainingCheckpointTest::TrainingCheckpointTest() : UnitTesting()
+{
+}
+
+
+// DESTRUCTOR
+
+TrainingCheckpointTest::~TrainingCheckpointTest()
+{
+}
+
+
+// METHODS
+
+void TrainingCheckpointTest::test_save()
+{
+   message += "test_save\n";
+
+   const string file_name = "../data/training_checkpoint.bin";
+
+   TrainingCheckpoint checkpoint;
+
+   Matrix<double> matrix(2, 3);
+   matrix.randomize_normal();
+
+   // Test
+
+   checkpoint.set_training_algorithm_type("QUASI_NEWTON_METHOD");
+   checkpoint.set_epoch(7);
+
+   checkpoint.set_vector("parameters", Vector<double>({0.1, -0.0, 1.0e-300, numeric_limits<double>::max()}));
+   checkpoint.set_vector("empty", Vector<double>());
+   checkpoint.set_matrix("inverse_Hessian", matrix);
+   checkpoint.set_scalar("old_training_loss", 1.0/3.0);
+   checkpoint.set_integer("selection_failures", 4);
+   checkpoint.set_text("generator_state", "1 2 3");
+
+   checkpoint.save(file_name);
+
+   assert_true(!ifstream((file_name + ".tmp").c_str()).good(), LOG);
+
+   const TrainingCheckpoint loaded_checkpoint(file_name);
+
+   assert_true(loaded_checkpoint.get_training_algorithm_type() == "QUASI_NEWTON_METHOD", LOG);
+   assert_true(loaded_checkpoint.get_epoch() == 7, LOG);
+   assert_true(loaded_checkpoint.get_vector("parameters") == checkpoint.get_vector("parameters"), LOG);
+   assert_true(loaded_checkpoint.get_vector("empty").empty(), LOG);
+   assert_true(loaded_checkpoint.get_matrix("inverse_Hessian") == matrix, LOG);
+   assert_true(loaded_checkpoint.get_matrix("inverse_Hessian").get_columns_number() == 3, LOG);
+   assert_true(loaded_checkpoint.get_scalar("old_training_loss") == 1.0/3.0, LOG);
+   assert_true(loaded_checkpoint.get_integer("selection_failures") == 4, LOG);
+   assert_true(loaded_checkpoint.get_text("generator_state") == "1 2 3", LOG);
+   assert_true(!loaded_checkpoint.has_vector("old_gradient"), LOG);
+
+   // Test
+
+   checkpoint.set();
+   checkpoint.set_epoch(8);
+
+   checkpoint.save(file_name);
+
+   assert_true(TrainingCheckpoint(file_name).get_epoch() == 8, LOG);
+   assert_true(!TrainingCheckpoint(file_name).has_matrix("inverse_Hessian"), LOG);
+}
+
+
+void TrainingCheckpointTest::test_load()
+{
+   message += "test_load\n";
+
+   const string file_name = "../data/training_checkpoint.bin";
+
+   TrainingCheckpoint checkpoint;
+
+   bool thrown;
+
+   // Test
+
+   {
+      ofstream file(file_name.c_str(), ios::binary | ios::trunc);
+
+      file << "Not a checkpoint";
+   }
+
+   thrown = false;
+
+   try
+   {
+      checkpoint.load(file_name);
+   }
+   catch(const logic_error&)
+   {
+      thrown = true;
+   }
+
+   assert_true(thrown, LOG);
+
+   // Test
+
+   checkpoint.set_vector("parameters", Vector<double>(100, 1.0));
+
+   checkpoint.save(file_name);
+
+   {
+      ifstream file(file_name.c_str(), ios::binary);
+
+      const string contents((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+
+      ofstream truncated_file(file_name.c_str(), ios::binary | ios::trunc);
+
+      truncated_file.write(contents.data(), static_cast<streamsize>(contents.size()/2));
+   }
+
+   thrown = false;
+
+   try
+   {
+      checkpoint.load(file_name);
+   }
+   catch(const logic_error&)
+   {
+      thrown = true;
+   }
+
+   assert_true(thrown, LOG);
+}
+
+
+void TrainingCheckpointTest::test_perform_training_quasi_Newton_method()
+{
+   message += "test_perform_training_quasi_Newton_method\n";
+
+   const string file_name = "../data/training_checkpoint.bin";
+
+   DataSet ds(20, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->split_sequential_indices(0.75, 0.25, 0.0);
+
+   NeuralNetwork nn(1, 2, 1);
+   nn.randomize_parameters_normal();
+
+   const Vector<double> initial_parameters = nn.get_parameters();
+
+   SumSquaredError sse(&nn, &ds);
+
+   QuasiNewtonMethod qnm(&sse);
+
+   qnm.set_display(false);
+   qnm.set_loss_goal(0.0);
+   qnm.set_minimum_loss_decrease(0.0);
+   qnm.set_gradient_norm_goal(0.0);
+   qnm.set_minimum_parameters_increment_norm(0.0);
+
+   Vector<double> parameters;
+
+   // Test
+
+   for(size_t method = 0; method < 2; method++)
+   {
+      qnm.set_inverse_Hessian_approximation_method(method == 0 ? QuasiNewtonMethod::BFGS : QuasiNewtonMethod::LBFGS);
+
+      // Uninterrupted training
+
+      nn.set_parameters(initial_parameters);
+
+      qnm.set_checkpoint_file_name("");
+      qnm.set_resume_from_checkpoint(false);
+      qnm.set_maximum_epochs_number(6);
+
+      delete qnm.perform_training();
+
+      parameters = nn.get_parameters();
+
+      // Training interrupted after three epochs
+
+      nn.set_parameters(initial_parameters);
+
+      remove(file_name.c_str());
+
+      qnm.set_checkpoint_file_name(file_name);
+      qnm.set_checkpoint_period(1);
+      qnm.set_maximum_epochs_number(3);
+
+      delete qnm.perform_training();
+
+      assert_true(TrainingCheckpoint(file_name).get_epoch() == 3, LOG);
+
+      // Resumed training
+
+      nn.randomize_parameters_normal();
+
+      qnm.set_resume_from_checkpoint(true);
+      qnm.set_maximum_epochs_number(6);
+
+      delete qnm.perform_training();
+
+      assert_true(nn.get_parameters() == parameters, LOG);
+   }
+}
+
+
+void TrainingCheckpointTest::test_perform_training_stochastic_gradient_descent()
+{
+   message += "test_perform_training_stochastic_gradient_descent\n";
+
+   const string file_name = "../data/training_checkpoint.bin";
+
+   DataSet ds(40, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->split_sequential_indices(0.75, 0.25, 0.0);
+
+   NeuralNetwork nn(1, 2, 1);
+   nn.randomize_parameters_normal();
+
+   const Vector<double> initial_parameters = nn.get_parameters();
+
+   MeanSquaredError mse(&nn, &ds);
+
+   StochasticGradientDescent sgd(&mse);
+
+   sgd.set_display(false);
+   sgd.set_training_batch_size(5);
+   sgd.set_shuffle(true);
+   sgd.set_shuffle_seed(3);
+   sgd.set_apply_early_stopping(false);
+   sgd.set_asynchronous_selection_error(true);
+
+   Vector<double> parameters;
+
+   // Uninterrupted training
+
+   sgd.set_maximum_epochs_number(6);
+
+   delete sgd.perform_training();
+
+   parameters = nn.get_parameters();
+
+   // Training interrupted after four epochs
+
+   nn.set_parameters(initial_parameters);
+
+   remove(file_name.c_str());
+
+   sgd.set_checkpoint_file_name(file_name);
+   sgd.set_checkpoint_period(2);
+   sgd.set_maximum_epochs_number(4);
+
+   delete sgd.perform_training();
+
+   assert_true(TrainingCheckpoint(file_name).get_epoch() == 4, LOG);
+
+   // Test
+
+   nn.randomize_parameters_normal();
+
+   sgd.set_resume_from_checkpoint(true);
+   sgd.set_maximum_epochs_number(6);
+
+   StochasticGradientDescent::StochasticGradientDescentResults* results_pointer = sgd.perform_training();
+
+   assert_true(nn.get_parameters() == parameters, LOG);
+   assert_true(results_pointer->loss_history.size() == 3, LOG);
+
+   delete results_pointer;
+}
+
+
+void TrainingCheckpointTest::test_perform_training_gradient_descent()
+{
+   message += "test_perform_training_gradient_descent\n";
+
+   const string file_name = "../data/training_checkpoint.bin";
+
+   DataSet ds(20, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->split_sequential_indices(0.75, 0.25, 0.0);
+
+   NeuralNetwork nn(1, 2, 1);
+   nn.randomize_parameters_normal();
+
+   const Vector<double> initial_parameters = nn.get_parameters();
+
+   SumSquaredError sse(&nn, &ds);
+
+   GradientDescent gd(&sse);
+
+   gd.set_display(false);
+   gd.set_loss_goal(0.0);
+   gd.set_minimum_loss_decrease(-numeric_limits<double>::max());
+   gd.set_gradient_norm_goal(0.0);
+   gd.set_apply_early_stopping(false);
+
+   Vector<double> parameters;
+
+   // Uninterrupted training
+
+   gd.set_maximum_iterations_number(6);
+
+   delete gd.perform_training();
+
+   parameters = nn.get_parameters();
+
+   // Training interrupted after three epochs
+
+   nn.set_parameters(initial_parameters);
+
+   remove(file_name.c_str());
+
+   gd.set_checkpoint_file_name(file_name);
+   gd.set_checkpoint_period(1);
+   gd.set_maximum_iterations_number(3);
+
+   delete gd.perform_training();
+
+   assert_true(TrainingCheckpoint(file_name).get_epoch() == 3, LOG);
+
+   // Test
+
+   nn.randomize_parameters_normal();
+
+   gd.set_resume_from_checkpoint(true);
+   gd.set_maximum_iterations_number(6);
+
+   GradientDescent::GradientDescentResults* results_pointer = gd.perform_training();
+
+   assert_true(nn.get_parameters() == parameters, LOG);
+   assert_true(results_pointer->loss_history.size() == 4, LOG);
+
+   delete results_pointer;
+}
+
+
+void TrainingCheckpointTest::test_perform_training_conjugate_gradient()
+{
+   message += "test_perform_training_conjugate_gradient\n";
+
+   const string file_name = "../data/training_checkpoint.bin";
+
+   DataSet ds(20, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->split_sequential_indices(0.75, 0.25, 0.0);
+
+   NeuralNetwork nn(1, 2, 1);
+   nn.randomize_parameters_normal();
+
+   const Vector<double> initial_parameters = nn.get_parameters();
+
+   SumSquaredError sse(&nn, &ds);
+
+   ConjugateGradient cg(&sse);
+
+   cg.set_display(false);
+   cg.set_loss_goal(0.0);
+   cg.set_minimum_loss_decrease(numeric_limits<double>::max());
+   cg.set_gradient_norm_goal(0.0);
+   cg.set_minimum_parameters_increment_norm(0.0);
+   cg.set_apply_early_stopping(false);
+
+   Vector<double> parameters;
+
+   // Uninterrupted training
+
+   cg.set_maximum_epochs_number(6);
+
+   delete cg.perform_training();
+
+   parameters = nn.get_parameters();
+
+   // Training interrupted after three epochs
+
+   nn.set_parameters(initial_parameters);
+
+   remove(file_name.c_str());
+
+   cg.set_checkpoint_file_name(file_name);
+   cg.set_checkpoint_period(1);
+   cg.set_maximum_epochs_number(3);
+
+   delete cg.perform_training();
+
+   assert_true(TrainingCheckpoint(file_name).get_epoch() == 3, LOG);
+
+   // Test
+
+   nn.randomize_parameters_normal();
+
+   cg.set_resume_from_checkpoint(true);
+   cg.set_maximum_epochs_number(6);
+
+   delete cg.perform_training();
+
+   assert_true(nn.get_parameters() == parameters, LOG);
+}
+
+
+void TrainingCheckpointTest::test_perform_training_Levenberg_Marquardt_algorithm()
+{
+   message += "test_perform_training_Levenberg_Marquardt_algorithm\n";
+
+   const string file_name = "../data/training_checkpoint.bin";
+
+   DataSet ds(20, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->split_sequential_indices(0.75, 0.25, 0.0);
+
+   NeuralNetwork nn(1, 2, 1);
+   nn.randomize_parameters_normal();
+
+   const Vector<double> initial_parameters = nn.get_parameters();
+
+   SumSquaredError sse(&nn, &ds);
+
+   LevenbergMarquardtAlgorithm lma(&sse);
+
+   lma.set_display(false);
+   lma.set_loss_goal(0.0);
+   lma.set_minimum_loss_decrease(numeric_limits<double>::max());
+   lma.set_gradient_norm_goal(0.0);
+   lma.set_minimum_parameters_increment_norm(0.0);
+   lma.set_apply_early_stopping(false);
+
+   const double initial_damping_parameter = lma.get_damping_parameter();
+
+   Vector<double> parameters;
+
+   // Uninterrupted training
+
+   lma.set_maximum_epochs_number(6);
+
+   delete lma.perform_training();
+
+   parameters = nn.get_parameters();
+
+   // Training interrupted after three epochs
+
+   nn.set_parameters(initial_parameters);
+   lma.set_damping_parameter(initial_damping_parameter);
+
+   remove(file_name.c_str());
+
+   lma.set_checkpoint_file_name(file_name);
+   lma.set_checkpoint_period(1);
+   lma.set_maximum_epochs_number(3);
+
+   delete lma.perform_training();
+
+   assert_true(TrainingCheckpoint(file_name).get_epoch() == 3, LOG);
+
+   // Test
+
+   nn.randomize_parameters_normal();
+   lma.set_damping_parameter(initial_damping_parameter);
+
+   lma.set_resume_from_checkpoint(true);
+   lma.set_maximum_epochs_number(6);
+
+   delete lma.perform_training();
+
+   assert_true(nn.get_parameters() == parameters, LOG);
+}
+
+
+void TrainingCheckpointTest::test_perform_training_adaptive_moment_estimation()
+{
+   message += "test_perform_training_adaptive_moment_estimation\n";
+
+   const string file_name = "../data/training_checkpoint.bin";
+
+   DataSet ds(40, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->split_sequential_indices(0.75, 0.25, 0.0);
+
+   NeuralNetwork nn(1, 2, 1);
+   nn.randomize_parameters_normal();
+
+   const Vector<double> initial_parameters = nn.get_parameters();
+
+   MeanSquaredError mse(&nn, &ds);
+
+   AdaptiveMomentEstimation ame(&mse);
+
+   ame.set_display(false);
+   ame.set_training_batch_size(5);
+   ame.set_shuffle(true);
+   ame.set_shuffle_seed(3);
+   ame.set_loss_goal(0.0);
+   ame.set_apply_early_stopping(false);
+   ame.set_asynchronous_selection_error(true);
+   ame.set_reserve_selection_error_history(true);
+
+   Vector<double> parameters;
+
+   // Uninterrupted training
+
+   ame.set_maximum_epochs_number(6);
+
+   delete ame.perform_training();
+
+   parameters = nn.get_parameters();
+
+   // Training interrupted after four epochs
+
+   nn.set_parameters(initial_parameters);
+
+   remove(file_name.c_str());
+
+   ame.set_checkpoint_file_name(file_name);
+   ame.set_checkpoint_period(2);
+   ame.set_maximum_epochs_number(4);
+
+   delete ame.perform_training();
+
+   assert_true(TrainingCheckpoint(file_name).get_epoch() == 4, LOG);
+
+   // Test
+
+   nn.randomize_parameters_normal();
+
+   ame.set_resume_from_checkpoint(true);
+   ame.set_maximum_epochs_number(6);
+
+   AdaptiveMomentEstimation::AdaptiveMomentEstimationResults* results_pointer = ame.perform_training();
+
+   assert_true(nn.get_parameters() == parameters, LOG);
+   assert_true(results_pointer->selection_error_history.size() == 3, LOG);
+
+   delete results_pointer;
+}
+
+
+void TrainingCheckpointTest::run_test_case()
+{
+   message += "Running training checkpoint test case...\n";
+
+   // Serialization methods
+
+   test_save();
+   test_load();
+
+   // Training methods
+
+   test_perform_training_gradient_descent();
+   test_perform_training_conjugate_gradient();
+   test_perform_training_quasi_Newton_method();
+   test_perform_training_Levenberg_Marquardt_algorithm();
+   test_perform_training_stochastic_gradient_descent();
+   test_perform_training_adaptive_moment_estimation();
+
+   message += "End of training checkpoint test case.\n";
+}
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
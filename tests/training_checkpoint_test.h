@@ -0,0 +1,81 @@
+/****************************************************************************************************************/
+/*                                                                                                              */
+/*   OpenNN: Open Neural Networks Library                                                                       */
+/*   www.opennn.net                                                                                             */
+/*                                                                                                              */
+/*   T R A I N I N G   C H E C K P O I N T   T E S T   C L A S S   H E A D E R                                  */
+/*                                                                                                              */
+/*   Artificial Intelligence Techniques SL                                                                      */
+/*   artelnics@artelnics.com                                                                                    */
+/*                                                                                                              */
+/****************************************************************************************************************/
+
+#ifndef __TRAININGCHECKPOINTTEST_H__
+#define __TRAININGCHECKPOINTTEST_H__
+
+// Unit testing includes
+
+#include "unit_testing.h"
+
+namespace OpenNN
+{
+
+class TrainingCheckpointTest : public UnitTesting
+{
+
+#define	STRING(x) #x
+#define TOSTRING(x) STRING(x)
+#define LOG __FILE__ ":" TOSTRING(__LINE__)"\n"
+
+public:
+
+   // GENERAL CONSTRUCTOR
+
+   explicit TrainingCheckpointTest();
+
+   // DESTRUCTOR
+
+   virtual ~TrainingCheckpointTest();
+
+   // METHODS
+
+   // Serialization methods
+
+   void test_save();
+   void test_load();
+
+   // Training methods
+
+   void test_perform_training_gradient_descent();
+   void test_perform_training_conjugate_gradient();
+   void test_perform_training_quasi_Newton_method();
+   void test_perform_training_Levenberg_Marquardt_algorithm();
+   void test_perform_training_stochastic_gradient_descent();
+   void test_perform_training_adaptive_moment_estimation();
+
+   // Unit testing methods
+
+   void run_test_case();
+};
+
+}
+
+#endif
+
+
+// OpenNN: Open Neural Networks Library.
+// Copyright(C) 2005-2018 Artificial Intelligence Techniques, SL.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
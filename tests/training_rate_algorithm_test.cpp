@@ -362,6 +362,76 @@ void TrainingRateAlgorithmTest::test_calculate_bracketing_triplet()
 }
 
 
+void TrainingRateAlgorithmTest::test_calculate_losses()
+{
+    message += "test_calculate_losses\n";
+
+    DataSet ds(20, 1, 1);
+    ds.randomize_data_normal();
+    ds.get_instances_pointer()->set_training();
+
+    NeuralNetwork nn(1, 1);
+    nn.randomize_parameters_normal();
+
+    SumSquaredError sse(&nn, &ds);
+
+    TrainingRateAlgorithm tra(&sse);
+
+    double loss;
+    Vector<double> training_direction;
+
+    const Vector<double> training_rates({0.0, 0.001, 0.01, 0.1});
+    Vector<double> losses;
+
+    TrainingRateAlgorithm::Triplet triplet_1;
+    TrainingRateAlgorithm::Triplet triplet_2;
+
+    // Test
+
+    sse.set_regularization_method(LossIndex::L2);
+
+    training_direction = sse.calculate_training_loss_gradient()*(-1.0);
+
+    losses = sse.calculate_training_losses(training_direction, training_rates);
+
+    assert_true(losses.size() == 4, LOG);
+
+    for(size_t i = 0; i < 4; i++)
+    {
+        assert_true(fabs(losses[i] - sse.calculate_training_loss(training_direction, training_rates[i])) < 1.0e-9, LOG);
+    }
+
+    // Test
+
+    nn.randomize_parameters_normal();
+
+    loss = sse.calculate_training_loss();
+    training_direction = sse.calculate_training_loss_gradient()*(-1.0);
+
+    tra.set_bracketing_evaluations_number(1);
+
+    triplet_1 = tra.calculate_bracketing_triplet(loss, training_direction, 0.001);
+
+    tra.set_bracketing_evaluations_number(4);
+
+    triplet_2 = tra.calculate_bracketing_triplet(loss, training_direction, 0.001);
+
+    assert_true(fabs(triplet_1.A[0] - triplet_2.A[0]) < 1.0e-12, LOG);
+    assert_true(fabs(triplet_1.U[0] - triplet_2.U[0]) < 1.0e-12, LOG);
+    assert_true(fabs(triplet_1.B[0] - triplet_2.B[0]) < 1.0e-12, LOG);
+    assert_true(fabs(triplet_1.U[1] - triplet_2.U[1]) < 1.0e-9, LOG);
+
+    // Test
+
+    triplet_2 = tra.calculate_bracketing_triplet(loss, training_direction, 100.0);
+
+    assert_true(triplet_2.A[0] <= triplet_2.U[0], LOG);
+    assert_true(triplet_2.U[0] <= triplet_2.B[0], LOG);
+    assert_true(triplet_2.U[1] <= triplet_2.A[1], LOG);
+    assert_true(triplet_2.U[1] <= triplet_2.B[1], LOG);
+}
+
+
 void TrainingRateAlgorithmTest::test_calculate_golden_section_directional_point()
 {
    message += "test_calculate_golden_section_directional_point\n";
@@ -498,6 +568,7 @@ void TrainingRateAlgorithmTest::run_test_case()
    // Training methods
 
    test_calculate_bracketing_triplet();
+   test_calculate_losses();
 //   test_calculate_fixed_directional_point();
 //   test_calculate_golden_section_directional_point();
 //   test_calculate_Brent_method_directional_point();
@@ -102,6 +102,8 @@ public:
 
    void test_calculate_bracketing_triplet();
 
+   void test_calculate_losses();
+
    void test_calculate_fixed_directional_point();
    void test_calculate_golden_section_directional_point();
    void test_calculate_Brent_method_directional_point();
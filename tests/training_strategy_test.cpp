@@ -241,6 +241,88 @@ void TrainingStrategyTest::test_perform_training()
 }
 
 
+void TrainingStrategyTest::test_perform_training_trials()
+{
+   message += "test_perform_training_trials\n";
+
+   DataSet ds(20, 1, 1);
+   ds.randomize_data_normal();
+   ds.get_instances_pointer()->split_sequential_indices(0.75, 0.25, 0.0);
+
+   NeuralNetwork nn(1, 2, 1);
+
+   TrainingStrategy ts(&nn, &ds);
+
+   QuasiNewtonMethod* qnm = ts.get_quasi_Newton_method_pointer();
+
+   qnm->set_display(false);
+   qnm->set_loss_goal(0.0);
+   qnm->set_minimum_loss_decrease(0.0);
+   qnm->set_gradient_norm_goal(0.0);
+   qnm->set_minimum_parameters_increment_norm(0.0);
+   qnm->set_maximum_epochs_number(5);
+
+   const size_t trials_number = 4;
+
+   Vector< Vector<double> > initial_parameters(trials_number);
+
+   for(size_t i = 0; i < trials_number; i++)
+   {
+      nn.randomize_parameters_normal();
+
+      initial_parameters[i] = nn.get_parameters();
+   }
+
+   nn.randomize_parameters_normal();
+
+   const Vector<double> parameters = nn.get_parameters();
+
+   Vector< Vector<double> > sequential_parameters;
+   Vector< Vector<double> > parallel_parameters;
+
+   Vector<TrainingStrategy::Results*> results;
+
+   // Test
+
+   results = ts.perform_training_trials(initial_parameters, sequential_parameters, 1);
+
+   assert_true(results.size() == trials_number, LOG);
+   assert_true(sequential_parameters.size() == trials_number, LOG);
+   assert_true(results[0]->quasi_Newton_method_results_pointer != nullptr, LOG);
+   assert_true(results[0]->quasi_Newton_method_results_pointer->quasi_Newton_method_pointer == qnm, LOG);
+   assert_true(nn.get_parameters() == parameters, LOG);
+
+   for(size_t i = 0; i < results.size(); i++)
+   {
+      delete results[i];
+   }
+
+   // Test
+
+   results = ts.perform_training_trials(initial_parameters, parallel_parameters, trials_number);
+
+   assert_true(parallel_parameters.size() == trials_number, LOG);
+
+   for(size_t i = 0; i < trials_number; i++)
+   {
+      assert_true((parallel_parameters[i] - sequential_parameters[i]).calculate_L2_norm() < 1.0e-9, LOG);
+   }
+
+   for(size_t i = 0; i < results.size(); i++)
+   {
+      delete results[i];
+   }
+
+   // Test
+
+   nn.set_parameters(initial_parameters[1]);
+
+   delete qnm->perform_training();
+
+   assert_true((nn.get_parameters() - sequential_parameters[1]).calculate_L2_norm() < 1.0e-9, LOG);
+}
+
+
 void TrainingStrategyTest::test_to_XML()
 {
    message += "test_to_XML\n";
@@ -370,6 +452,8 @@ void TrainingStrategyTest::run_test_case()
    // Training methods
 */
    test_initialize_layers_autoencoding();
+
+   test_perform_training_trials();
 /*
    test_perform_training();
 
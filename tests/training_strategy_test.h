@@ -70,6 +70,7 @@ public:
 
    void test_initialize_layers_autoencoding();
    void test_perform_training();
+   void test_perform_training_trials();
 
    // Serialization methods
 